@@ -10,7 +10,8 @@ scintilla_dir = ../../scintilla
 INCDIR = \
 	-I"../../src" \
 	-I"../../src/EditLexers" \
-	-I"$(scintilla_dir)/include"
+	-I"$(scintilla_dir)/include" \
+	-I"$(scintilla_dir)/src"
 
 LDFLAGS += -L"$(BINFOLDER)/obj"
 
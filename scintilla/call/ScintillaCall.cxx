@@ -1202,6 +1202,22 @@ void ScintillaCall::AllocateLines(Line lines) {
 	Call(Message::AllocateLines, lines);
 }
 
+Position ScintillaCall::IndexLines(Position length) {
+	return Call(Message::IndexLines, length);
+}
+
+void ScintillaCall::IndexLinesTo(Line line) {
+	Call(Message::IndexLinesTo, line);
+}
+
+Line ScintillaCall::LineCountEstimate() {
+	return Call(Message::GetLineCountEstimate);
+}
+
+Position ScintillaCall::LineIndexEnd() {
+	return Call(Message::GetLineIndexEnd);
+}
+
 void ScintillaCall::SetMarginLeft(int pixelWidth) {
 	Call(Message::SetMarginLeft, 0, pixelWidth);
 }
@@ -1694,6 +1710,30 @@ LineCache ScintillaCall::LayoutCache() {
 	return static_cast<Scintilla::LineCache>(Call(Message::GetLayoutCache));
 }
 
+void ScintillaCall::SetLayoutCacheBudget(Position bytes) {
+	Call(Message::SetLayoutCacheBudget, bytes);
+}
+
+Position ScintillaCall::LayoutCacheBudget() {
+	return Call(Message::GetLayoutCacheBudget);
+}
+
+Position ScintillaCall::LayoutCacheStatistic(int statistic, bool reset) {
+	return Call(Message::GetLayoutCacheStatistic, statistic, reset);
+}
+
+void ScintillaCall::SetPreLayoutScreens(int screens) {
+	Call(Message::SetPreLayoutScreens, screens);
+}
+
+int ScintillaCall::PreLayoutScreens() {
+	return static_cast<int>(Call(Message::GetPreLayoutScreens));
+}
+
+Position ScintillaCall::PreLayoutStatistic(int statistic, bool reset) {
+	return Call(Message::GetPreLayoutStatistic, statistic, reset);
+}
+
 void ScintillaCall::SetScrollWidth(int pixelWidth) {
 	Call(Message::SetScrollWidth, pixelWidth);
 }
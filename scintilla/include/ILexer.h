@@ -50,6 +50,14 @@ enum {
 	lvRelease5 = 3,
 };
 
+// ILexer5::PrivateCall() operations understood by Scintilla.
+enum {
+	// pointer is int *, set to line state bits that mark line end can't be used as relex checkpoint.
+	// returns pointer when line state, style and fold level at other line ends fully describe lexer state,
+	// so relexing after a modification can stop once they matched previous lexing.
+	pcCheckpointMask = 0x4350,
+};
+
 class ILexer5 {
 public:
 	virtual int SCI_METHOD Version() const noexcept = 0;
@@ -504,6 +504,10 @@ typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wP
 #define SCI_GETLINE 2153
 #define SCI_GETLINECOUNT 2154
 #define SCI_ALLOCATELINES 2089
+#define SCI_INDEXLINES 2094
+#define SCI_INDEXLINESTO 2095
+#define SCI_GETLINECOUNTESTIMATE 2096
+#define SCI_GETLINEINDEXEND 2139
 #define SCI_SETMARGINLEFT 2155
 #define SCI_GETMARGINLEFT 2156
 #define SCI_SETMARGINRIGHT 2157
@@ -673,6 +677,12 @@ typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wP
 #define SC_CACHE_DOCUMENT 3
 #define SCI_SETLAYOUTCACHE 2272
 #define SCI_GETLAYOUTCACHE 2273
+#define SCI_SETLAYOUTCACHEBUDGET 2215
+#define SCI_GETLAYOUTCACHEBUDGET 2216
+#define SCI_GETLAYOUTCACHESTATISTIC 2217
+#define SCI_SETPRELAYOUTSCREENS 2298
+#define SCI_GETPRELAYOUTSCREENS 2299
+#define SCI_GETPRELAYOUTSTATISTIC 2258
 #define SCI_SETSCROLLWIDTH 2274
 #define SCI_GETSCROLLWIDTH 2275
 #define SCI_SETSCROLLWIDTHTRACKING 2516
@@ -813,6 +823,8 @@ typedef sptr_t (*SciFnDirectStatus)(sptr_t ptr, unsigned int iMessage, uptr_t wP
 #define SCI_GETZOOM 2374
 #define SC_DOCUMENTOPTION_DEFAULT 0
 #define SC_DOCUMENTOPTION_STYLES_NONE 0x1
+#define SC_DOCUMENTOPTION_STYLES_COMPRESSED 0x2
+#define SC_DOCUMENTOPTION_VIEW_ONLY 0x4
 #define SC_DOCUMENTOPTION_TEXT_LARGE 0x100
 #define SCI_CREATEDOCUMENT 2375
 #define SCI_ADDREFDOCUMENT 2376
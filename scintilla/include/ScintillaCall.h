@@ -347,6 +347,10 @@ public:
 	std::string GetLine(Line line);
 	Line LineCount();
 	void AllocateLines(Line lines);
+	Position IndexLines(Position length);
+	void IndexLinesTo(Line line);
+	Line LineCountEstimate();
+	Position LineIndexEnd();
 	void SetMarginLeft(int pixelWidth);
 	int MarginLeft();
 	void SetMarginRight(int pixelWidth);
@@ -470,6 +474,12 @@ public:
 	Scintilla::WrapIndentMode WrapIndentMode();
 	void SetLayoutCache(Scintilla::LineCache cacheMode);
 	Scintilla::LineCache LayoutCache();
+	void SetLayoutCacheBudget(Position bytes);
+	Position LayoutCacheBudget();
+	Position LayoutCacheStatistic(int statistic, bool reset);
+	void SetPreLayoutScreens(int screens);
+	int PreLayoutScreens();
+	Position PreLayoutStatistic(int statistic, bool reset);
 	void SetScrollWidth(int pixelWidth);
 	int ScrollWidth();
 	void SetScrollWidthTracking(bool tracking);
@@ -271,6 +271,10 @@ enum class Message {
 	GetLine = 2153,
 	GetLineCount = 2154,
 	AllocateLines = 2089,
+	IndexLines = 2094,
+	IndexLinesTo = 2095,
+	GetLineCountEstimate = 2096,
+	GetLineIndexEnd = 2139,
 	SetMarginLeft = 2155,
 	GetMarginLeft = 2156,
 	SetMarginRight = 2157,
@@ -390,6 +394,12 @@ enum class Message {
 	GetWrapIndentMode = 2473,
 	SetLayoutCache = 2272,
 	GetLayoutCache = 2273,
+	SetLayoutCacheBudget = 2215,
+	GetLayoutCacheBudget = 2216,
+	GetLayoutCacheStatistic = 2217,
+	SetPreLayoutScreens = 2298,
+	GetPreLayoutScreens = 2299,
+	GetPreLayoutStatistic = 2258,
 	SetScrollWidth = 2274,
 	GetScrollWidth = 2275,
 	SetScrollWidthTracking = 2516,
@@ -419,6 +419,8 @@ enum class PopUp {
 enum class DocumentOption {
 	Default = 0,
 	StylesNone = 0x1,
+	StylesCompressed = 0x2,
+	ViewOnly = 0x4,
 	TextLarge = 0x100,
 };
 
@@ -18,7 +18,12 @@
 // https://software.intel.com/sites/landingpage/IntrinsicsGuide/
 // https://gcc.gnu.org/onlinedocs/gcc/Other-Builtins.html
 // https://clang.llvm.org/docs/LanguageExtensions.html
+#if defined(_MSC_VER) || defined(_WIN32)
 #include <intrin.h>
+#elif defined(__i386__) || defined(__x86_64__)
+// GCC and Clang on Linux and macOS, MSVC specific bit functions are replaced below
+#include <x86intrin.h>
+#endif
 
 #if defined(__aarch64__) || defined(_ARM64_) || defined(_M_ARM64)
 	#define NP2_TARGET_ARM		1
@@ -85,7 +90,7 @@
 #endif
 
 // find index of the highest set bit
-#if NP2_TARGET_ARM
+#if NP2_TARGET_ARM || !defined(_WIN32)
 #if defined(__clang__) || defined(__GNUC__)
 	#define np2_bsr(x)		(__builtin_clz(x) ^ 31)
 	#define np2_bsr64(x)	(__builtin_clzll(x) ^ 63)
@@ -259,7 +264,7 @@ constexpr uint32_t bit_zero_high_u32(uint32_t x, uint32_t index) noexcept {
 }
 #endif
 
-#if NP2_TARGET_ARM
+#if NP2_TARGET_ARM || !defined(_WIN32)
 inline bool bittest(const uint32_t *addr, uint32_t index) noexcept {
 	return (*addr >> index) & true;
 }
@@ -0,0 +1,52 @@
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+// Byte classification kernels shared by Scintilla and Notepad4.
+// Each kernel has scalar, SSE2, AVX2 and AVX-512BW variants, the best variant
+// is resolved once at startup with cpuid, then called through vectorKernels.
+// Only depends on the C++ standard library and compiler intrinsics,
+// so it can be built and tested outside of Notepad4.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace np2 {
+
+enum class ISALevel {
+	Scalar,
+	SSE2,		// SSSE3 is used when available
+	AVX2,		// with BMI1, BMI2 and POPCNT
+	AVX512BW,	// x64 only
+};
+
+// values kept in same order as SC_EOL_CRLF, SC_EOL_CR, SC_EOL_LF
+struct LineEndingCount {
+	size_t CRLF;
+	size_t CR;
+	size_t LF;
+};
+
+struct VectorKernels {
+	ISALevel level;
+	// count CR+LF, CR and LF line endings in data.
+	void (*CountLineEndings)(const char *data, size_t length, LineEndingCount &count) noexcept;
+	// whether data is well-formed UTF-8.
+	bool (*IsValidUTF8)(const char *data, size_t length) noexcept;
+	// whether data is ASCII only.
+	bool (*AllASCII)(const char *data, size_t length) noexcept;
+	// whether data contains two adjacent or at least 8 C0 control characters (excluding whitespace).
+	bool (*MaybeBinary)(const char *data, size_t length) noexcept;
+	// find first occurrence of pattern (patternLength > 0) in data, returns nullptr when not found.
+	const char *(*FindSubstring)(const char *data, size_t length, const char *pattern, size_t patternLength) noexcept;
+};
+
+extern VectorKernels vectorKernels;
+
+// highest level supported by both CPU and operating system.
+ISALevel DetectISALevel() noexcept;
+const char *GetISALevelName(ISALevel level) noexcept;
+// resolve vectorKernels for level, which is lowered to detected level.
+// used by tests and benchmarks to force a variant, returns actual level.
+ISALevel SelectVectorKernels(ISALevel level) noexcept;
+
+}
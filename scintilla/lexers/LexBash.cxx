@@ -396,6 +396,17 @@ void ColouriseBashDoc(Sci_PositionU startPos, Sci_Position length, int initStyle
 			Delimiter[DelimiterLength++] = static_cast<char>(ch);
 			Delimiter[DelimiterLength] = '\0';
 		}
+		// state saved with delimiter for lines inside here doc text
+		int Pack(CmdState cmdState) const noexcept {
+			return 1 | (Quoted << 1) | (Escaped << 2) | (Indent << 3) | (static_cast<int>(cmdState) << 4);
+		}
+		CmdState Unpack(int state) noexcept {
+			State = 2;
+			Quoted = state & 2;
+			Escaped = state & 4;
+			Indent = state & 8;
+			return static_cast<CmdState>(state >> 4);
+		}
 	};
 	HereDocCls HereDoc;
 
@@ -406,20 +417,30 @@ void ColouriseBashDoc(Sci_PositionU startPos, Sci_Position length, int initStyle
 	CmdState cmdState = CmdState::Start;
 
 	QuoteStack.isCShell = styler.GetPropertyBool("lexer.lang");
-	// Always backtracks to the start of a line that is not a continuation
-	// of the previous line (i.e. start of a bash command segment)
 	Sci_Line ln = styler.GetLine(startPos);
+	int hereDocState = 0;
 	if (ln > 0 && startPos == static_cast<Sci_PositionU>(styler.LineStart(ln))) {
 		ln--;
+		if (initStyle == SCE_SH_HERE_Q) {
+			hereDocState = styler.GetLineDelimiter(ln, HereDoc.Delimiter, HereDoc.DelimiterLength);
+		}
 	}
-	for (;;) {
-		startPos = styler.LineStart(ln);
-		if (ln == 0 || styler.GetLineState(ln) == static_cast<int>(CmdState::Start)) {
-			break;
+	if (hereDocState != 0) {
+		// resume inside here doc text with delimiter saved for previous line
+		cmdState = HereDoc.Unpack(hereDocState);
+		QuoteStack.Start(-1, QuoteStyle::HereDoc, SCE_SH_DEFAULT, cmdState);
+	} else {
+		// Always backtracks to the start of a line that is not a continuation
+		// of the previous line (i.e. start of a bash command segment)
+		for (;;) {
+			startPos = styler.LineStart(ln);
+			if (ln == 0 || styler.GetLineState(ln) == static_cast<int>(CmdState::Start)) {
+				break;
+			}
+			ln--;
 		}
-		ln--;
+		initStyle = SCE_SH_DEFAULT;
 	}
-	initStyle = SCE_SH_DEFAULT;
 	StyleContext sc(startPos, endPos - startPos, initStyle, styler);
 
 	while (sc.More()) {
@@ -637,6 +658,7 @@ void ColouriseBashDoc(Sci_PositionU startPos, Sci_Position length, int initStyle
 					}
 					QuoteStack.Pop();
 					sc.SetState(SCE_SH_DEFAULT);
+					styler.SetLineDelimiter(sc.currentLine, 0);
 					break;
 				}
 			}
@@ -723,6 +745,11 @@ void ColouriseBashDoc(Sci_PositionU startPos, Sci_Position length, int initStyle
 				sc.SetState(SCE_SH_HERE_Q);
 				QuoteStack.Start(-1, QuoteStyle::HereDoc, SCE_SH_DEFAULT, cmdState);
 			}
+			if (sc.state == SCE_SH_HERE_Q) {
+				// nested here doc can't be resumed without outer quotes
+				const int state = (QuoteStack.Depth == 0) ? HereDoc.Pack(cmdState) : 0;
+				styler.SetLineDelimiter(sc.currentLine, state, HereDoc.Delimiter, HereDoc.DelimiterLength);
+			}
 		}
 
 		// update cmdState about the current command segment
@@ -34,6 +34,10 @@ namespace {
 enum script_type { eScriptNone = 0, eScriptJS, eScriptVBS, eScriptXML, eScriptSGML, eScriptSGMLblock, eScriptComment };
 enum script_mode { eHtml = 0, eNonHtmlScript, eNonHtmlPreProc, eNonHtmlScriptPreProc };
 
+// line ends inside a tag, lexing for next line restarts from the tag start,
+// so the line can't be used as relex checkpoint.
+constexpr int LineStateInTag = 1 << 21;
+
 // Put an upper limit to bound time taken for unexpected text.
 constexpr Sci_PositionU maxLengthCheck = 200;
 
@@ -392,7 +396,7 @@ void ColouriseHyperTextDoc(Sci_PositionU startPos, Sci_Position length, int init
 	script_mode inScriptType = static_cast<script_mode>((lineState >> 0) & 0x03); // 2 bits of scripting mode
 	bool tagOpened = (lineState >> 2) & 0x01; // 1 bit to know if we are in an opened tag
 	bool tagClosing = (lineState >> 3) & 0x01; // 1 bit to know if we are in a closing tag
-	bool tagDontFold = false; //some HTML tags should not be folded
+	bool tagDontFold = (lineState >> 22) & 1; //some HTML tags should not be folded
 	script_type aspScript = static_cast<script_type>((lineState >> 4) & 0x0F); // 4 bits of script name
 	script_type clientScript = static_cast<script_type>((lineState >> 8) & 0x0F); // 4 bits of script name
 	int beforePreProc = (lineState >> 12) & 0xFF; // 8 bits of state
@@ -432,18 +436,19 @@ void ColouriseHyperTextDoc(Sci_PositionU startPos, Sci_Position length, int init
 	int chPrev = ' ';
 	int ch = ' ';
 	int chPrevNonWhite = ' ';
-	// look back to set chPrevNonWhite properly for better regex colouring
+	// look back to set chPrevNonWhite properly for better regex colouring,
+	// same as lexing from earlier position: last non-white character outside of comment.
 	if (scriptLanguage == eScriptJS && startPos > 0) {
 		Sci_Position back = startPos;
-		int style = 0;
 		while (--back) {
-			style = styler.StyleIndexAt(back);
-			if (style < SCE_HJ_DEFAULT || style > SCE_HJ_COMMENTDOC)
-				// includes SCE_HJ_COMMENT & SCE_HJ_COMMENTLINE
-				break;
-		}
-		if (style == SCE_HJ_SYMBOLS) {
-			chPrevNonWhite = styler.SafeGetUCharAt(back);
+			const int chBack = styler.SafeGetUCharAt(back);
+			if (!IsASpace(chBack)) {
+				const int style = stateForPrintState(styler.StyleIndexAt(back));
+				if (style < SCE_HJ_COMMENT || style > SCE_HJ_COMMENTDOC) {
+					chPrevNonWhite = chBack;
+					break;
+				}
+			}
 		}
 	}
 
@@ -523,7 +528,9 @@ void ColouriseHyperTextDoc(Sci_PositionU startPos, Sci_Position length, int init
 			                    ((aspScript & 0x0F) << 4) |
 			                    ((clientScript & 0x0F) << 8) |
 			                    ((beforePreProc & 0xFF) << 12) |
-			                    ((isLanguageType ? 1 : 0) << 20));
+			                    ((isLanguageType ? 1 : 0) << 20) |
+			                    (InTagState(state) ? LineStateInTag : 0) |
+			                    ((tagDontFold ? 1 : 0) << 22));
 			lineCurrent++;
 		}
 
@@ -1210,13 +1217,15 @@ void ColouriseHyperTextDoc(Sci_PositionU startPos, Sci_Position length, int init
 			}
 			break;
 		case SCE_HJ_REGEX:
-			if (ch == '\r' || ch == '\n' || ch == '/') {
-				if (ch == '/') {
-					while (IsLowerCase(chNext)) {   // gobble regex flags
-						i++;
-						ch = chNext;
-						chNext = styler.SafeGetUCharAt(i + 1);
-					}
+			if (IsEOLChar(ch)) {
+				// unterminated regex, line ending is not styled as regex to not continue on next line
+				styler.ColorTo(i, StateToPrint);
+				state = SCE_HJ_DEFAULT;
+			} else if (ch == '/') {
+				while (IsLowerCase(chNext)) {   // gobble regex flags
+					i++;
+					ch = chNext;
+					chNext = styler.SafeGetUCharAt(i + 1);
 				}
 				styler.ColorTo(i + 1, StateToPrint);
 				state = SCE_HJ_DEFAULT;
@@ -1353,18 +1362,20 @@ void ColouriseHyperTextDoc(Sci_PositionU startPos, Sci_Position length, int init
 		}
 	}
 
-	switch (state) {
-	case SCE_HJ_WORD:
-		classifyWordHTJS(styler.GetStartSegment(), lengthDoc, keywordsJS, styler, inScriptType);
-		break;
-	case SCE_HB_WORD:
-		classifyWordHTVB(styler.GetStartSegment(), lengthDoc, keywordsVBS, styler, inScriptType);
-		break;
-	default:
-		StateToPrint = statePrintForState(state, inScriptType);
-		if (static_cast<Sci_Position>(styler.GetStartSegment()) < lengthDoc)
+	// last character may already be styled when lexing stopped after a multiple character token
+	if (static_cast<Sci_Position>(styler.GetStartSegment()) < lengthDoc) {
+		switch (state) {
+		case SCE_HJ_WORD:
+			classifyWordHTJS(styler.GetStartSegment(), lengthDoc, keywordsJS, styler, inScriptType);
+			break;
+		case SCE_HB_WORD:
+			classifyWordHTVB(styler.GetStartSegment(), lengthDoc, keywordsVBS, styler, inScriptType);
+			break;
+		default:
+			StateToPrint = statePrintForState(state, inScriptType);
 			styler.ColorTo(lengthDoc, StateToPrint);
-		break;
+			break;
+		}
 	}
 
 	// Fill in the real level of the next line, keeping the current flags as they will be filled in later
@@ -1386,5 +1397,5 @@ void ColouriseHTMLDoc(Sci_PositionU startPos, Sci_Position length, int initStyle
 
 }
 
-LexerModule lmHTML(SCLEX_HTML, ColouriseHTMLDoc, "hypertext");
-LexerModule lmXML(SCLEX_XML, ColouriseXMLDoc, "xml");
+LexerModule lmHTML(SCLEX_HTML, ColouriseHTMLDoc, "hypertext", nullptr, LineStateInTag);
+LexerModule lmXML(SCLEX_XML, ColouriseXMLDoc, "xml", nullptr, LineStateInTag);
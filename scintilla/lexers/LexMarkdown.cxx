@@ -135,6 +135,12 @@ constexpr int GetIndentChild(uint32_t lineState) noexcept {
 	return lineState >> 24;
 }
 
+// block context at line end that doesn't fit into line state, saved as line data.
+// relexing restores container indent from previous line instead of looking back.
+constexpr int PackBlockContext(int indentParent, int indentPrevious) noexcept {
+	return 1 | (indentParent << 8) | (sci::min(indentPrevious, 0x7fff) << 16);
+}
+
 constexpr bool IsMarkdownSpace(int ch) noexcept {
 	return IsSpaceOrTab(ch) || IsEOLChar(ch);
 }
@@ -1897,8 +1903,14 @@ void ColouriseMarkdownDoc(Sci_PositionU startPos, Sci_Position lengthDoc, int in
 		8: indentCurrent
 		8: indentChild
 		*/
-		indentPrevious = lexer.UpdateParentIndentCount(-1);
-		indentPrevious = sci::max(indentPrevious, 0);
+		const int blockContext = styler.GetLineData(sc.currentLine - 1);
+		if (blockContext != 0) {
+			lexer.indentParent = (blockContext >> 8) & 0xff;
+			indentPrevious = blockContext >> 16;
+		} else {
+			indentPrevious = lexer.UpdateParentIndentCount(-1);
+			indentPrevious = sci::max(indentPrevious, 0);
+		}
 	}
 	if (startPos == 0) {
 		switch (sc.ch) {
@@ -2452,6 +2464,7 @@ void ColouriseMarkdownDoc(Sci_PositionU startPos, Sci_Position lengthDoc, int in
 				lineState |= LineStateNestedStateLine;
 			}
 			styler.SetLineState(sc.currentLine, static_cast<int>(lineState));
+			styler.SetLineData(sc.currentLine, PackBlockContext(lexer.indentParent, indentPrevious));
 		}
 		sc.Forward();
 	}
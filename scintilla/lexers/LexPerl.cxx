@@ -582,13 +582,26 @@ void ColourisePerlDoc(Sci_PositionU startPos, Sci_Position length, int initStyle
 		|| initStyle == SCE_PL_HERE_QX
 		|| initStyle == SCE_PL_FORMAT
 		) {
-		// backtrack through multiple styles to reach the delimiter start
-		const int delim = (initStyle == SCE_PL_FORMAT) ? SCE_PL_FORMAT_IDENT : SCE_PL_HERE_DELIM;
-		while ((startPos > 1) && (styler.StyleAt(startPos) != delim)) {
-			startPos--;
+		int state = 0;
+		const Sci_Line ln = styler.GetLine(startPos);
+		if (ln > 0 && startPos == static_cast<Sci_PositionU>(styler.LineStart(ln))) {
+			state = styler.GetLineDelimiter(ln - 1, HereDoc.Delimiter, HereDoc.DelimiterLength);
+		}
+		if ((state & 0xff) == initStyle) {
+			// resume inside here doc text or format body with delimiter saved for previous line
+			if (initStyle != SCE_PL_FORMAT) {
+				HereDoc.State = 2;
+				HereDoc.StripIndent = state & 0x100;
+			}
+		} else {
+			// backtrack through multiple styles to reach the delimiter start
+			const int delim = (initStyle == SCE_PL_FORMAT) ? SCE_PL_FORMAT_IDENT : SCE_PL_HERE_DELIM;
+			while ((startPos > 1) && (styler.StyleAt(startPos) != delim)) {
+				startPos--;
+			}
+			startPos = styler.LineStart(styler.GetLine(startPos));
+			initStyle = styler.StyleAt(startPos - 1);
 		}
-		startPos = styler.LineStart(styler.GetLine(startPos));
-		initStyle = styler.StyleAt(startPos - 1);
 	}
 	if (initStyle == SCE_PL_STRING_DQ
 		|| initStyle == SCE_PL_STRING_QQ
@@ -877,6 +890,7 @@ void ColourisePerlDoc(Sci_PositionU startPos, Sci_Position length, int initStyle
 				if (c == '\r' || c == '\n') {	// peek first, do not consume match
 					sc.ForwardBytes(HereDoc.DelimiterLength);
 					sc.SetState(SCE_PL_DEFAULT);
+					styler.SetLineDelimiter(sc.currentLine, 0);
 					backFlag = BACK_NONE;
 					HereDoc.State = 0;
 					if (!sc.atLineEnd)
@@ -1122,8 +1136,10 @@ void ColourisePerlDoc(Sci_PositionU startPos, Sci_Position length, int initStyle
 			sc.Complete();
 			if (sc.ch == '.') {
 				sc.Forward();
-				if (sc.atLineEnd || ((sc.ch == '\r' && sc.chNext == '\n')))
+				if (sc.atLineEnd || ((sc.ch == '\r' && sc.chNext == '\n'))) {
 					sc.SetState(SCE_PL_DEFAULT);
+					styler.SetLineDelimiter(sc.currentLine, 0);
+				}
 			}
 			while (!sc.atLineEnd)
 				sc.Forward();
@@ -1195,11 +1211,13 @@ void ColourisePerlDoc(Sci_PositionU startPos, Sci_Position length, int initStyle
 					st_new = SCE_PL_HERE_Q;
 			}
 			sc.SetState(st_new);
+			styler.SetLineDelimiter(sc.currentLine, st_new | (HereDoc.StripIndent << 8), HereDoc.Delimiter, HereDoc.DelimiterLength);
 		}
 		if (HereDoc.State == 3 && sc.atLineEnd) {
 			// Start of format body.
 			HereDoc.State = 0;
 			sc.SetState(SCE_PL_FORMAT);
+			styler.SetLineDelimiter(sc.currentLine, SCE_PL_FORMAT);
 		}
 
 		// Determine if a new state should be entered.
@@ -116,6 +116,12 @@ bool keywordIsAmbiguous(const char *prevWord) noexcept;
 bool keywordDoStartsLoop(Sci_Position pos, LexAccessor &styler);
 bool keywordIsModifier(const char *word, Sci_Position pos, LexAccessor &styler);
 
+constexpr bool IsHereDocStyle(int style) noexcept {
+	return style == SCE_RB_HERE_Q
+		|| style == SCE_RB_HERE_QQ
+		|| style == SCE_RB_HERE_QX;
+}
+
 constexpr bool IsIdentifierStyle(int style) noexcept {
 	return style == SCE_RB_IDENTIFIER
 		|| style == SCE_RB_LIKE_MODULE
@@ -694,7 +700,20 @@ void ColouriseRbDoc(Sci_PositionU startPos, Sci_Position length, int initStyle,
 
 	QuoteCls Quote;
 
-	synchronizeDocStart(startPos, length, initStyle, styler, false);
+	int hereDocState = 0;
+	if (IsHereDocStyle(initStyle)) {
+		const Sci_Line ln = styler.GetLine(startPos);
+		if (ln > 0 && startPos == static_cast<Sci_PositionU>(styler.LineStart(ln))) {
+			hereDocState = styler.GetLineDelimiter(ln - 1, HereDoc.Delimiter, HereDoc.DelimiterLength);
+		}
+	}
+	if (hereDocState != 0 && (hereDocState & 0xff) == initStyle) {
+		// resume inside here doc text with delimiter saved for previous line
+		HereDoc.State = 2;
+		HereDoc.CanBeIndented = hereDocState & 0x100;
+	} else {
+		synchronizeDocStart(startPos, length, initStyle, styler, false);
+	}
 	const Sci_Position lengthDoc = startPos + length;
 
 	bool preferRE = true;
@@ -811,6 +830,9 @@ void ColouriseRbDoc(Sci_PositionU startPos, Sci_Position length, int initStyle,
 					state = SCE_RB_HERE_QX;
 				}
 			}
+			// here doc inside interpolation can't be resumed without outer string
+			const int hereState = innerExpr.canExit() ? 0 : (state | (HereDoc.CanBeIndented << 8));
+			styler.SetLineDelimiter(styler.GetLine(i), hereState, HereDoc.Delimiter, HereDoc.DelimiterLength);
 		}
 
 		// Regular transitions
@@ -1304,7 +1326,7 @@ void ColouriseRbDoc(Sci_PositionU startPos, Sci_Position length, int initStyle,
 					preferRE = false;
 				}
 			}
-		} else if (state == SCE_RB_HERE_Q || state == SCE_RB_HERE_QQ || state == SCE_RB_HERE_QX) {
+		} else if (IsHereDocStyle(state)) {
 			if (ch == '\\' && !IsEOLChar(chNext)) {
 				advance_char(i, ch, chNext, chNext2);
 			} else if (ch == '#' && state != SCE_RB_HERE_Q
@@ -1337,6 +1359,7 @@ void ColouriseRbDoc(Sci_PositionU startPos, Sci_Position length, int initStyle,
 					chNext = styler.SafeGetCharAt(i + 1);
 					if (IsEOLChar(chNext)) {
 						styler.ColorTo(i + 1, SCE_RB_HERE_DELIM);
+						styler.SetLineDelimiter(styler.GetLine(i), 0);
 						state = SCE_RB_DEFAULT;
 						HereDoc.State = 0;
 						preferRE = false;
@@ -1347,6 +1370,7 @@ void ColouriseRbDoc(Sci_PositionU startPos, Sci_Position length, int initStyle,
 				&& lookingAtHereDocDelim(styler, i + 1 - HereDoc.DelimiterLength, HereDoc.Delimiter)) {
 				styler.ColorTo(i + 1 - HereDoc.DelimiterLength, state);
 				styler.ColorTo(i + 1, SCE_RB_HERE_DELIM);
+				styler.SetLineDelimiter(styler.GetLine(i), 0);
 				state = SCE_RB_DEFAULT;
 				preferRE = false;
 				HereDoc.State = 0;
@@ -1738,7 +1762,10 @@ bool keywordDoStartsLoop(Sci_Position pos, LexAccessor &styler) {
 #define IsCommentLine(line)	IsLexCommentLine(styler, line, SCE_RB_COMMENTLINE)
 
 void FoldRbDoc(Sci_PositionU startPos, Sci_Position length, int initStyle, LexerWordList keywordLists, Accessor &styler) {
-	synchronizeDocStart(startPos, length, initStyle, styler, false);
+	// fold level inside here doc text only depends on previous line
+	if (startPos == 0 || !IsHereDocStyle(initStyle)) {
+		synchronizeDocStart(startPos, length, initStyle, styler, false);
+	}
 	const Sci_PositionU endPos = startPos + length;
 	Sci_Line lineCurrent = styler.GetLine(startPos);
 	int levelPrev = styler.LevelAt(lineCurrent) & SC_FOLDLEVELNUMBERMASK;
@@ -11,6 +11,7 @@
 #include <string>
 #include <string_view>
 #include <vector>
+#include <algorithm>
 //#include <map>
 
 #include "ILexer.h"
@@ -19,10 +20,12 @@
 #include "PropSetSimple.h"
 #include "LexAccessor.h"
 #include "Accessor.h"
+#include "SparseState.h"
 
 using namespace Lexilla;
 
-Accessor::Accessor(Scintilla::IDocument *pAccess_, const PropSetSimple &props_) noexcept : LexAccessor(pAccess_), props(props_) {
+Accessor::Accessor(Scintilla::IDocument *pAccess_, const PropSetSimple &props_, LexerLineData *lineData_) noexcept :
+	LexAccessor(pAccess_), props(props_), lineData(lineData_) {
 }
 
 const char *Accessor::GetProperty(const char *key, size_t keyLen) const {
@@ -33,6 +36,42 @@ int Accessor::GetPropertyInt(const char *key, size_t keyLen, int defaultValue) c
 	return props.GetInt(key, keyLen, defaultValue);
 }
 
+int Accessor::GetLineData(Sci_Line line) const {
+	return lineData ? lineData->ValueAt(line) : 0;
+}
+
+void Accessor::SetLineData(Sci_Line line, int value) {
+	if (lineData) {
+		lineData->Set(line, value);
+	}
+}
+
+void Accessor::SetLineDelimiter(Sci_Line line, int state, const char *delimiter, size_t length) {
+	if (lineData) {
+		int value = 0;
+		if (state != 0) {
+			const int index = lineData->Intern(std::string_view(delimiter, length));
+			value = (index << LexerLineData::StringIndexShift) | (state & LexerLineData::StateMask);
+		}
+		lineData->Set(line, value);
+	}
+}
+
+int Accessor::GetLineDelimiter(Sci_Line line, char *delimiter, size_t size, int &length) const {
+	const int value = GetLineData(line);
+	if (value == 0) {
+		return 0;
+	}
+	const std::string_view text = lineData->StringAt(value >> LexerLineData::StringIndexShift);
+	if (text.length() >= size) {
+		return 0;
+	}
+	memcpy(delimiter, text.data(), text.length());
+	delimiter[text.length()] = '\0';
+	length = static_cast<int>(text.length());
+	return value & LexerLineData::StateMask;
+}
+
 int Accessor::IndentAmount(Sci_Line line) noexcept {
 	const Sci_Position end = Length();
 	Sci_Position pos = LineStart(line);
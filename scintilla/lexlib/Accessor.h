@@ -14,13 +14,15 @@ enum {
 
 class Accessor;
 class PropSetSimple;
+class LexerLineData;
 
 typedef bool (*PFNIsCommentLeader)(Accessor &styler, Sci_Position pos, Sci_Position len);
 
 class Accessor final : public LexAccessor {
 	const PropSetSimple &props;
+	LexerLineData *lineData;
 public:
-	Accessor(Scintilla::IDocument *pAccess_, const PropSetSimple &props_) noexcept;
+	Accessor(Scintilla::IDocument *pAccess_, const PropSetSimple &props_, LexerLineData *lineData_ = nullptr) noexcept;
 	const char *GetProperty(const char *key, size_t keyLen) const;
 	int GetPropertyInt(const char *key, size_t keyLen, int defaultValue = 0) const;
 
@@ -39,6 +41,21 @@ public:
 		return GetPropertyInt(key, N - 1, defaultValue) & true;
 	}
 
+	// per line lexer state that doesn't fit into line state, kept by LexerBase between lexing.
+	// value continues to following lines until changed, returns 0 when not available.
+	int GetLineData(Sci_Line line) const;
+	void SetLineData(Sci_Line line, int value);
+
+	// delimiter of multiple line string (e.g. here document) that continues after the line,
+	// state is lexer defined nonzero value below 0x10000, zero when no string continues.
+	void SetLineDelimiter(Sci_Line line, int state, const char *delimiter = "", size_t length = 0);
+	// copy delimiter into buffer, returns state or 0 when not available.
+	int GetLineDelimiter(Sci_Line line, char *delimiter, size_t size, int &length) const;
+	template <size_t N>
+	int GetLineDelimiter(Sci_Line line, char (&delimiter)[N], int &length) const {
+		return GetLineDelimiter(line, delimiter, N, length);
+	}
+
 	int IndentAmount(Sci_Line line) noexcept;
 
 	[[deprecated]]
@@ -1,18 +1,18 @@
 // Scintilla source code edit control
 /** @file CharacterCategory.cxx
- ** Returns the Unicode general category of a character.
+ ** Returns the Unicode general category and identifier class of a character.
  ** Table automatically regenerated by scripts/GenerateCharacterCategory.py
  ** Should only be rarely regenerated for new versions of Unicode.
  **/
 // Copyright 2013 by Neil Hodgson <neilh@scintilla.org>
 // The License.txt file describes the conditions under which this software may be distributed.
 
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 
 #include <vector>
 #include <algorithm>
-#include <iterator>
 
 #include "CharacterCategory.h"
 
@@ -20,588 +20,921 @@ namespace Lexilla {
 
 namespace {
 
-#define CharacterCategoryUseRangeList 0
 //++Autogenerated -- start of section automatically generated
 // Created with Python 3.13.0a1, Unicode 15.1.0
-#if CharacterCategoryUseRangeList
-const int catRanges[] = {
-};
 
-#else
+const uint8_t CharacterPropertyLatin[0x800] = {
+0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+0x16, 0x11, 0x11, 0x11, 0x13, 0x11, 0x11, 0x11, 0x0D, 0x0E, 0x11, 0x12, 0x11, 0x0C, 0x11, 0x11,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x11, 0x11, 0x12, 0x12, 0x12, 0x11,
+0x11, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x0D, 0x11, 0x0E, 0x14, 0x2B,
+0x14, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0D, 0x12, 0x0E, 0x12, 0x19,
+0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+0x16, 0x11, 0x13, 0x13, 0x13, 0x13, 0x15, 0x11, 0x14, 0x15, 0x44, 0x0F, 0x12, 0x1A, 0x15, 0x14,
+0x15, 0x12, 0x0A, 0x0A, 0x14, 0x41, 0x11, 0x31, 0x14, 0x0A, 0x44, 0x10, 0x0A, 0x0A, 0x0A, 0x11,
+0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x12, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x12, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41,
+0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41,
+0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41,
+0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40,
+0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41,
+0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41,
+0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41,
+0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x41,
+0x41, 0x40, 0x40, 0x41, 0x40, 0x41, 0x40, 0x40, 0x41, 0x40, 0x40, 0x40, 0x41, 0x41, 0x40, 0x40,
+0x40, 0x40, 0x41, 0x40, 0x40, 0x41, 0x40, 0x40, 0x40, 0x41, 0x41, 0x41, 0x40, 0x40, 0x41, 0x40,
+0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x40, 0x41, 0x40, 0x41, 0x41, 0x40, 0x41, 0x40, 0x40,
+0x41, 0x40, 0x40, 0x40, 0x41, 0x40, 0x41, 0x40, 0x40, 0x41, 0x41, 0x44, 0x40, 0x41, 0x41, 0x41,
+0x44, 0x44, 0x44, 0x44, 0x40, 0x42, 0x41, 0x40, 0x42, 0x41, 0x40, 0x42, 0x41, 0x40, 0x41, 0x40,
+0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x41, 0x40, 0x41,
+0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41,
+0x41, 0x40, 0x42, 0x41, 0x40, 0x41, 0x40, 0x40, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41,
+0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41,
+0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41,
+0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41,
+0x40, 0x41, 0x40, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x40, 0x40, 0x41, 0x40, 0x40, 0x41,
+0x41, 0x40, 0x41, 0x40, 0x40, 0x40, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x44, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x14, 0x14, 0x14, 0x14, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+0x43, 0x43, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+0x43, 0x43, 0x43, 0x43, 0x43, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x43, 0x14, 0x43, 0x14,
+0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x40, 0x41, 0x40, 0x41, 0x43, 0x14, 0x40, 0x41, 0x1D, 0x1D, 0x83, 0x41, 0x41, 0x41, 0x11, 0x40,
+0x1D, 0x1D, 0x1D, 0x1D, 0x14, 0x14, 0x40, 0x31, 0x40, 0x40, 0x40, 0x1D, 0x40, 0x1D, 0x40, 0x40,
+0x41, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+0x40, 0x40, 0x1D, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x40,
+0x41, 0x41, 0x40, 0x40, 0x40, 0x41, 0x41, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41,
+0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x40, 0x41, 0x12, 0x40, 0x41, 0x40, 0x40, 0x41, 0x41, 0x40, 0x40, 0x40,
+0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41,
+0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41,
+0x40, 0x41, 0x15, 0x25, 0x25, 0x25, 0x25, 0x25, 0x07, 0x07, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41,
+0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41,
+0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41,
+0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41,
+0x40, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x41,
+0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41,
+0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41,
+0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41,
+0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41,
+0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41,
+0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41,
+0x1D, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x1D, 0x1D, 0x43, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x11, 0x0C, 0x1D, 0x1D, 0x15, 0x15, 0x13,
+0x1D, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x0C, 0x25,
+0x11, 0x25, 0x25, 0x11, 0x25, 0x25, 0x11, 0x25, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x1D, 0x1D, 0x1D, 0x1D, 0x44,
+0x44, 0x44, 0x44, 0x11, 0x11, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x12, 0x12, 0x12, 0x11, 0x11, 0x13, 0x11, 0x11, 0x15, 0x15,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x11, 0x1A, 0x11, 0x11, 0x11,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x11, 0x11, 0x11, 0x11, 0x44, 0x44,
+0x25, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x11, 0x44, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x1A, 0x15, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x43, 0x43, 0x25, 0x25, 0x15, 0x25, 0x25, 0x25, 0x25, 0x44, 0x44,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x44, 0x44, 0x44, 0x15, 0x15, 0x44,
+0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1D, 0x1A,
+0x44, 0x25, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x1D, 0x1D, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x44, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D,
+0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x25, 0x25, 0x25, 0x25, 0x25,
+0x25, 0x25, 0x25, 0x25, 0x43, 0x43, 0x15, 0x11, 0x11, 0x11, 0x43, 0x1D, 0x1D, 0x25, 0x13, 0x13,
+};
 
-const uint8_t catTable[] = {
-// catTable index 1
+const uint8_t CharacterPropertyTable[] = {
+// CharacterPropertyTable index 1
 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38,
-40, 42, 44, 46, 48, 50, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 54, 52,
-52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
-52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
-56, 52, 58, 60, 62, 64, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
-52, 52, 52, 52, 52, 52, 52, 66, 68, 68, 68, 68, 70, 70, 70, 70, 70, 70, 70, 70,
-70, 70, 70, 70, 72, 74, 76, 78, 80, 82, 84, 86, 88, 90, 92, 94, 96, 98, 100, 102,
-104, 106, 108, 110, 52, 112, 114, 116, 116, 116, 116, 118, 52, 52, 120, 116, 116, 116, 116, 116,
-116, 116, 52, 122, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-52, 124, 116, 126, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 128, 52, 52, 130, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 132, 134, 136, 116, 116,
-116, 116, 138, 116, 116, 116, 116, 116, 116, 116, 116, 140, 142, 144, 146, 148, 150, 152, 116, 154,
-156, 158, 160, 162, 164, 116, 166, 168, 170, 172, 150, 174, 176, 178, 116, 116, 52, 52, 52, 52,
-52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
-52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
-52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
-52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 180,
-52, 52, 52, 52, 52, 52, 52, 182, 184, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 186,
-52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 188, 52, 190, 116, 116, 116, 116,
-52, 192, 116, 116, 52, 52, 52, 52, 52, 52, 52, 52, 52, 194, 52, 52, 52, 52, 52, 52,
-52, 196, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 198, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
-70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-70, 70, 70, 70, 70, 70, 70, 200, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
-70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 200,
-// catTable index 3
-0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 2, 4, 5, 6, 2, 7, 7, 7, 7,
-7, 2, 8, 9, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 13, 14,
-15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 18, 19, 1, 20, 20, 21,
-22, 23, 24, 25, 26, 27, 15, 2, 28, 29, 27, 30, 11, 11, 11, 11, 11, 11, 11, 11,
-11, 11, 11, 31, 11, 11, 11, 32, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 33,
-16, 16, 16, 16, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 34, 34, 34, 34,
-34, 34, 34, 34, 16, 32, 32, 32, 32, 32, 32, 32, 11, 34, 34, 16, 34, 32, 32, 11,
-34, 11, 16, 11, 11, 34, 32, 11, 32, 16, 11, 34, 32, 32, 32, 11, 34, 16, 32, 11,
-34, 11, 34, 34, 32, 35, 32, 16, 36, 36, 37, 34, 38, 37, 34, 34, 34, 34, 34, 34,
-34, 34, 16, 32, 34, 38, 32, 11, 32, 32, 32, 32, 32, 32, 16, 16, 16, 11, 34, 32,
-34, 34, 11, 32, 32, 32, 32, 32, 16, 16, 39, 16, 16, 16, 16, 16, 40, 40, 40, 40,
-40, 40, 40, 40, 40, 41, 41, 40, 40, 40, 40, 40, 40, 41, 41, 41, 41, 41, 41, 41,
-40, 40, 42, 41, 41, 41, 42, 42, 41, 41, 41, 41, 41, 41, 41, 41, 43, 43, 43, 43,
-43, 43, 43, 43, 32, 32, 42, 32, 44, 45, 16, 10, 44, 44, 41, 46, 11, 47, 47, 11,
-34, 11, 11, 11, 11, 11, 11, 11, 11, 48, 11, 11, 11, 11, 16, 16, 16, 16, 16, 16,
-16, 16, 16, 34, 16, 11, 32, 16, 32, 32, 32, 32, 16, 16, 32, 49, 34, 32, 34, 11,
-32, 50, 43, 43, 51, 32, 32, 32, 11, 34, 34, 34, 34, 34, 34, 16, 48, 11, 11, 11,
-11, 11, 11, 11, 11, 11, 11, 47, 52, 2, 2, 2, 16, 16, 16, 16, 53, 54, 55, 56,
-57, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 58, 59, 60, 43, 59,
-44, 44, 44, 44, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 61, 44, 62,
-36, 63, 64, 44, 44, 44, 44, 44, 65, 65, 65, 8, 9, 66, 2, 67, 43, 43, 43, 43,
-43, 60, 68, 2, 69, 36, 36, 36, 36, 70, 43, 43, 7, 7, 7, 7, 7, 2, 2, 36,
-71, 36, 36, 36, 36, 36, 36, 36, 36, 36, 72, 43, 43, 43, 73, 50, 43, 43, 74, 75,
-76, 43, 43, 36, 7, 7, 7, 7, 7, 36, 77, 78, 2, 2, 2, 2, 2, 2, 2, 79,
-70, 36, 36, 36, 36, 36, 36, 36, 43, 43, 43, 43, 43, 80, 62, 36, 36, 36, 36, 43,
-43, 43, 43, 43, 71, 44, 44, 44, 44, 44, 44, 44, 7, 7, 7, 7, 7, 36, 36, 36,
-36, 36, 36, 36, 36, 70, 43, 43, 43, 43, 40, 21, 2, 81, 57, 20, 36, 36, 36, 43,
-43, 75, 43, 43, 43, 43, 75, 43, 75, 43, 43, 44, 2, 2, 2, 2, 2, 2, 2, 64,
-36, 36, 36, 36, 70, 43, 44, 64, 36, 36, 36, 36, 36, 61, 44, 44, 36, 36, 36, 36,
-82, 36, 36, 61, 65, 44, 44, 44, 43, 43, 43, 43, 36, 36, 36, 36, 83, 43, 43, 43,
-43, 84, 43, 43, 43, 43, 43, 43, 43, 85, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
-36, 85, 71, 86, 87, 43, 43, 43, 85, 86, 87, 86, 70, 43, 43, 43, 36, 36, 36, 36,
-36, 43, 2, 7, 7, 7, 7, 7, 88, 36, 36, 36, 36, 36, 36, 36, 70, 86, 62, 36,
-36, 36, 61, 62, 61, 62, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 61, 36, 36, 36,
-61, 61, 44, 36, 36, 44, 71, 86, 87, 43, 80, 89, 90, 89, 87, 61, 44, 44, 44, 89,
-44, 44, 36, 62, 36, 43, 44, 7, 7, 7, 7, 7, 36, 20, 27, 27, 27, 56, 63, 80,
-57, 85, 62, 36, 36, 61, 44, 62, 61, 36, 62, 61, 36, 44, 80, 86, 87, 80, 44, 57,
-80, 57, 43, 44, 57, 44, 44, 44, 62, 36, 61, 61, 44, 44, 44, 7, 7, 7, 7, 7,
-43, 36, 70, 64, 44, 44, 44, 44, 57, 85, 62, 36, 36, 36, 36, 62, 36, 62, 36, 36,
-36, 36, 36, 36, 61, 36, 62, 36, 36, 44, 71, 86, 87, 43, 43, 57, 85, 89, 87, 44,
-61, 44, 44, 44, 44, 44, 44, 44, 66, 44, 44, 44, 62, 43, 43, 43, 57, 86, 62, 36,
-36, 36, 61, 62, 61, 36, 62, 36, 36, 44, 71, 87, 87, 43, 80, 89, 90, 89, 87, 44,
-44, 44, 57, 85, 44, 44, 36, 62, 78, 27, 27, 27, 44, 44, 44, 44, 44, 71, 62, 36,
-36, 61, 44, 36, 61, 36, 36, 44, 62, 61, 61, 36, 44, 62, 61, 44, 36, 61, 44, 36,
-36, 36, 36, 36, 36, 44, 44, 86, 85, 90, 44, 86, 90, 86, 87, 44, 61, 44, 44, 89,
-44, 44, 44, 44, 27, 91, 67, 67, 56, 92, 44, 44, 85, 86, 71, 36, 36, 36, 61, 36,
-61, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 44, 71, 43, 85, 86, 90, 43,
-80, 43, 43, 44, 44, 44, 57, 80, 36, 61, 62, 44, 44, 44, 44, 93, 27, 27, 27, 91,
-70, 86, 72, 36, 36, 36, 61, 36, 36, 36, 62, 36, 36, 44, 71, 87, 86, 86, 90, 85,
-90, 86, 43, 44, 44, 44, 89, 90, 44, 44, 62, 61, 62, 94, 44, 44, 44, 44, 44, 44,
-43, 86, 36, 36, 36, 36, 61, 36, 36, 36, 36, 36, 36, 70, 71, 86, 87, 43, 80, 86,
-90, 86, 87, 77, 44, 44, 36, 94, 27, 27, 27, 95, 27, 27, 27, 27, 91, 36, 36, 36,
-57, 86, 62, 36, 36, 36, 36, 36, 36, 36, 36, 61, 44, 36, 36, 36, 36, 62, 36, 36,
-36, 36, 62, 44, 36, 36, 36, 61, 44, 80, 44, 89, 86, 43, 80, 80, 86, 86, 86, 86,
-44, 86, 64, 44, 44, 44, 44, 44, 62, 36, 36, 36, 36, 36, 36, 36, 70, 36, 43, 43,
-43, 80, 44, 96, 36, 36, 36, 75, 43, 43, 43, 60, 7, 7, 7, 7, 7, 2, 44, 44,
-44, 44, 44, 44, 44, 44, 44, 44, 62, 61, 61, 36, 36, 61, 36, 36, 36, 36, 62, 62,
-36, 36, 36, 36, 70, 36, 43, 43, 43, 43, 71, 44, 36, 36, 61, 81, 43, 43, 43, 80,
-7, 7, 7, 7, 7, 44, 36, 36, 77, 67, 2, 2, 2, 2, 2, 2, 2, 97, 97, 67,
-43, 67, 67, 67, 7, 7, 7, 7, 7, 27, 27, 27, 27, 27, 50, 50, 50, 4, 4, 86,
-36, 36, 36, 36, 62, 36, 36, 36, 36, 36, 36, 36, 36, 36, 61, 44, 57, 43, 43, 43,
-43, 43, 43, 85, 43, 43, 60, 43, 36, 36, 70, 43, 43, 43, 43, 43, 57, 43, 43, 43,
-43, 43, 43, 43, 43, 43, 80, 67, 67, 67, 67, 76, 67, 67, 92, 67, 2, 2, 97, 67,
-21, 64, 44, 44, 36, 36, 36, 36, 36, 94, 87, 43, 85, 43, 43, 43, 87, 85, 87, 71,
-7, 7, 7, 7, 7, 2, 2, 2, 36, 36, 36, 86, 43, 36, 36, 43, 71, 86, 98, 94,
-86, 86, 86, 36, 70, 43, 71, 36, 36, 36, 36, 36, 36, 85, 87, 85, 86, 86, 87, 94,
-7, 7, 7, 7, 7, 86, 87, 67, 11, 11, 11, 48, 44, 44, 48, 44, 16, 16, 16, 16,
-16, 53, 45, 16, 36, 36, 36, 36, 61, 36, 36, 44, 36, 36, 36, 61, 61, 36, 36, 44,
-61, 36, 36, 44, 36, 36, 36, 61, 61, 36, 36, 44, 36, 36, 36, 36, 36, 36, 36, 61,
-36, 36, 36, 36, 36, 36, 36, 36, 36, 61, 57, 43, 2, 2, 2, 2, 99, 27, 27, 27,
-27, 27, 27, 27, 27, 27, 100, 44, 67, 67, 67, 67, 67, 44, 44, 44, 11, 11, 11, 44,
-16, 16, 16, 44, 101, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 77, 72,
-102, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 103, 104, 44, 36, 36, 36, 36,
-36, 63, 2, 105, 106, 36, 36, 36, 61, 44, 44, 44, 36, 43, 85, 44, 44, 44, 44, 62,
-36, 43, 107, 64, 44, 44, 44, 44, 36, 43, 44, 44, 44, 44, 44, 44, 36, 36, 36, 36,
-36, 36, 61, 36, 61, 43, 44, 44, 44, 44, 44, 44, 36, 36, 43, 87, 43, 43, 43, 86,
-86, 86, 86, 85, 87, 43, 43, 43, 43, 43, 2, 88, 2, 66, 70, 44, 7, 7, 7, 7,
-7, 44, 44, 44, 27, 27, 27, 27, 27, 44, 44, 44, 2, 2, 2, 108, 2, 59, 43, 84,
-36, 83, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 61, 44, 44, 44, 36, 36, 70, 71,
-36, 36, 36, 36, 36, 36, 36, 36, 70, 61, 44, 44, 36, 36, 36, 44, 44, 44, 44, 44,
-36, 36, 36, 36, 36, 36, 36, 61, 43, 85, 86, 87, 85, 86, 44, 44, 86, 85, 86, 86,
-87, 43, 44, 44, 92, 44, 2, 7, 7, 7, 7, 7, 36, 36, 36, 36, 36, 36, 36, 44,
-36, 36, 61, 44, 44, 44, 44, 44, 36, 36, 36, 36, 36, 36, 44, 44, 36, 36, 36, 36,
-36, 44, 44, 44, 7, 7, 7, 7, 7, 100, 44, 67, 67, 67, 67, 67, 67, 67, 67, 67,
-36, 36, 36, 70, 85, 87, 44, 2, 36, 36, 94, 85, 43, 43, 43, 80, 85, 85, 87, 43,
-43, 43, 85, 86, 86, 87, 43, 43, 43, 43, 80, 57, 2, 2, 2, 88, 2, 2, 2, 44,
-43, 43, 43, 43, 43, 43, 43, 109, 43, 43, 43, 43, 43, 43, 43, 80, 43, 43, 98, 36,
-36, 36, 36, 36, 36, 36, 85, 43, 43, 85, 85, 86, 86, 85, 98, 36, 36, 36, 61, 44,
-97, 67, 67, 67, 67, 50, 43, 43, 43, 43, 67, 67, 67, 67, 21, 64, 43, 98, 36, 36,
-36, 36, 36, 36, 94, 43, 43, 86, 43, 87, 43, 36, 36, 36, 36, 85, 43, 86, 87, 87,
-43, 86, 44, 44, 44, 44, 2, 2, 36, 36, 86, 86, 86, 86, 43, 43, 43, 43, 86, 43,
-44, 93, 2, 2, 7, 7, 7, 7, 7, 44, 62, 36, 36, 36, 36, 36, 40, 40, 40, 2,
-16, 16, 16, 16, 110, 44, 44, 44, 11, 11, 11, 11, 11, 47, 48, 11, 2, 2, 2, 2,
-44, 44, 44, 44, 43, 60, 43, 43, 43, 43, 43, 43, 85, 43, 43, 43, 71, 36, 70, 36,
-36, 36, 71, 94, 43, 61, 44, 44, 16, 16, 16, 16, 16, 16, 40, 40, 40, 40, 40, 40,
-40, 45, 16, 16, 16, 16, 16, 16, 45, 16, 16, 16, 16, 16, 16, 16, 16, 111, 40, 40,
-32, 32, 32, 16, 16, 16, 16, 32, 16, 16, 16, 16, 11, 11, 11, 11, 16, 16, 16, 44,
-11, 11, 11, 44, 16, 16, 16, 16, 48, 48, 48, 48, 16, 16, 16, 16, 16, 16, 16, 44,
-16, 16, 16, 16, 112, 112, 112, 112, 16, 16, 110, 16, 11, 11, 113, 114, 41, 16, 110, 16,
-11, 11, 113, 41, 16, 16, 44, 16, 11, 11, 115, 41, 16, 16, 16, 16, 11, 11, 116, 41,
-44, 16, 110, 16, 11, 11, 113, 117, 118, 118, 118, 118, 118, 119, 65, 65, 120, 120, 120, 2,
-121, 122, 121, 122, 2, 2, 2, 2, 123, 65, 65, 124, 2, 2, 2, 2, 125, 126, 2, 127,
-128, 2, 129, 130, 2, 2, 2, 2, 2, 9, 128, 2, 2, 2, 2, 131, 65, 65, 132, 65,
-65, 65, 65, 65, 133, 44, 27, 27, 27, 8, 129, 134, 27, 27, 27, 27, 27, 8, 129, 104,
-40, 40, 40, 40, 40, 40, 81, 44, 20, 20, 20, 20, 20, 20, 20, 20, 135, 44, 44, 44,
-44, 44, 44, 44, 43, 43, 43, 43, 43, 43, 136, 51, 109, 51, 109, 43, 43, 43, 43, 43,
-80, 44, 44, 44, 44, 44, 44, 44, 67, 137, 67, 138, 67, 34, 11, 16, 11, 32, 138, 67,
-49, 11, 11, 67, 67, 67, 137, 137, 137, 11, 11, 139, 11, 11, 35, 36, 39, 67, 16, 11,
-8, 8, 49, 16, 16, 26, 67, 140, 27, 27, 27, 27, 27, 27, 27, 27, 105, 105, 105, 105,
-105, 105, 105, 105, 105, 141, 142, 105, 143, 67, 44, 44, 8, 8, 144, 67, 67, 8, 67, 67,
-144, 26, 67, 144, 67, 67, 67, 144, 67, 67, 67, 67, 67, 67, 67, 8, 67, 144, 144, 67,
-67, 67, 67, 67, 67, 67, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-67, 67, 67, 67, 4, 4, 67, 67, 8, 67, 67, 67, 145, 146, 67, 67, 67, 67, 67, 67,
-67, 67, 144, 67, 67, 67, 67, 67, 67, 26, 8, 8, 8, 8, 67, 67, 67, 67, 67, 67,
-67, 67, 67, 67, 67, 67, 8, 8, 8, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 92,
-44, 44, 44, 44, 67, 67, 67, 67, 67, 92, 44, 44, 27, 27, 27, 27, 27, 27, 67, 67,
-67, 67, 67, 67, 67, 27, 27, 27, 67, 67, 67, 26, 67, 67, 67, 67, 26, 67, 67, 67,
-67, 67, 67, 67, 67, 67, 67, 67, 8, 8, 8, 8, 67, 67, 67, 67, 67, 67, 67, 26,
-67, 67, 67, 67, 4, 4, 4, 4, 4, 4, 4, 27, 27, 27, 27, 27, 27, 27, 67, 67,
-67, 67, 67, 67, 8, 8, 129, 147, 8, 8, 8, 8, 8, 8, 8, 4, 4, 4, 4, 4,
-8, 129, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 147, 8, 8, 8, 8, 8, 8, 8,
-4, 4, 8, 8, 8, 8, 8, 8, 8, 8, 4, 8, 8, 8, 144, 26, 8, 8, 144, 67,
-67, 67, 44, 67, 67, 67, 67, 67, 67, 67, 67, 55, 67, 67, 67, 67, 32, 11, 32, 34,
-34, 34, 34, 11, 32, 32, 34, 16, 16, 16, 40, 11, 32, 32, 140, 67, 67, 138, 34, 149,
-43, 32, 44, 44, 93, 2, 99, 2, 16, 16, 16, 150, 44, 44, 150, 44, 36, 36, 36, 36,
-44, 44, 44, 52, 64, 44, 44, 44, 44, 44, 44, 57, 36, 36, 36, 61, 44, 44, 44, 44,
-36, 36, 36, 61, 36, 36, 36, 61, 2, 121, 121, 2, 125, 126, 121, 2, 2, 2, 2, 6,
-2, 108, 121, 2, 121, 4, 4, 4, 4, 2, 2, 88, 2, 2, 2, 2, 2, 120, 2, 2,
-108, 151, 2, 2, 2, 2, 2, 2, 67, 2, 152, 148, 148, 148, 153, 44, 67, 67, 67, 67,
-67, 55, 67, 67, 67, 67, 44, 44, 44, 44, 44, 44, 67, 67, 67, 44, 44, 44, 44, 44,
-1, 2, 154, 155, 4, 4, 4, 4, 4, 67, 4, 4, 4, 4, 156, 157, 158, 105, 105, 105,
-105, 43, 43, 86, 159, 40, 40, 67, 105, 160, 63, 67, 36, 36, 36, 61, 57, 161, 162, 69,
-36, 36, 36, 36, 36, 63, 40, 69, 44, 44, 62, 36, 36, 36, 36, 36, 67, 27, 27, 67,
-67, 67, 67, 67, 67, 67, 44, 44, 44, 44, 44, 55, 67, 67, 67, 67, 67, 67, 67, 92,
-27, 27, 27, 27, 27, 67, 67, 67, 67, 67, 67, 67, 27, 27, 27, 27, 163, 27, 27, 27,
-27, 27, 27, 27, 36, 36, 83, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 164, 2,
-7, 7, 7, 7, 7, 36, 44, 44, 32, 32, 32, 32, 32, 32, 32, 70, 51, 165, 43, 43,
-43, 43, 43, 88, 32, 32, 32, 32, 32, 32, 40, 43, 36, 36, 36, 105, 105, 105, 105, 105,
-43, 2, 2, 2, 44, 44, 44, 44, 41, 41, 41, 162, 40, 40, 40, 40, 41, 32, 32, 32,
-32, 32, 32, 32, 16, 32, 32, 32, 32, 32, 32, 32, 45, 16, 16, 16, 34, 34, 34, 32,
-32, 32, 32, 32, 42, 166, 34, 35, 32, 32, 16, 32, 32, 32, 32, 32, 32, 32, 32, 32,
-32, 11, 11, 32, 11, 11, 32, 32, 32, 32, 32, 32, 32, 32, 11, 11, 34, 110, 44, 44,
-32, 150, 150, 32, 32, 44, 44, 44, 44, 40, 167, 35, 40, 35, 36, 36, 36, 71, 36, 71,
-36, 70, 36, 36, 36, 94, 87, 85, 67, 67, 80, 44, 27, 27, 27, 67, 168, 44, 44, 44,
-36, 36, 2, 2, 44, 44, 44, 44, 86, 36, 36, 36, 36, 36, 36, 36, 36, 36, 86, 86,
-86, 86, 86, 86, 86, 86, 43, 44, 44, 44, 44, 2, 43, 36, 36, 36, 2, 72, 72, 70,
-36, 36, 36, 43, 43, 43, 43, 2, 36, 36, 36, 70, 43, 43, 43, 43, 43, 86, 44, 44,
-44, 44, 44, 93, 36, 70, 86, 43, 43, 86, 43, 86, 107, 2, 2, 2, 2, 2, 2, 52,
-7, 7, 7, 7, 7, 44, 44, 2, 36, 36, 70, 69, 36, 36, 36, 36, 7, 7, 7, 7,
-7, 36, 36, 61, 36, 36, 36, 36, 70, 43, 43, 85, 87, 85, 87, 80, 44, 44, 44, 44,
-36, 70, 36, 36, 36, 36, 85, 44, 7, 7, 7, 7, 7, 44, 2, 2, 69, 36, 36, 77,
-67, 94, 85, 36, 71, 43, 71, 70, 71, 36, 36, 43, 70, 61, 44, 44, 44, 44, 44, 44,
-44, 44, 44, 44, 44, 62, 83, 2, 36, 36, 36, 36, 36, 94, 43, 86, 2, 83, 169, 80,
-44, 44, 44, 44, 62, 36, 36, 61, 62, 36, 36, 61, 62, 36, 36, 61, 44, 44, 44, 44,
-16, 16, 16, 16, 16, 114, 40, 40, 16, 16, 16, 16, 111, 41, 44, 44, 36, 94, 87, 86,
-85, 107, 87, 44, 36, 36, 44, 44, 44, 44, 44, 44, 36, 36, 36, 61, 44, 62, 36, 36,
-170, 170, 170, 170, 170, 170, 170, 170, 171, 171, 171, 171, 171, 171, 171, 171, 16, 16, 16, 110,
-44, 44, 44, 44, 44, 150, 16, 16, 44, 44, 62, 71, 36, 36, 36, 36, 172, 36, 36, 36,
-36, 36, 36, 61, 36, 36, 61, 61, 36, 62, 61, 36, 36, 36, 36, 36, 36, 41, 41, 41,
-41, 41, 41, 41, 41, 117, 44, 44, 44, 44, 44, 44, 44, 62, 36, 36, 36, 36, 36, 36,
-36, 36, 36, 36, 36, 36, 36, 148, 44, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
-44, 44, 44, 55, 36, 36, 36, 36, 36, 36, 168, 67, 2, 2, 2, 152, 130, 44, 44, 44,
-6, 173, 174, 148, 148, 148, 148, 148, 148, 148, 130, 152, 130, 2, 127, 175, 2, 64, 2, 2,
-156, 148, 148, 130, 2, 176, 8, 177, 66, 2, 44, 44, 36, 36, 61, 36, 36, 36, 36, 36,
-36, 36, 36, 36, 36, 36, 61, 79, 93, 2, 3, 2, 4, 5, 6, 2, 16, 16, 16, 16,
-16, 17, 18, 129, 130, 4, 2, 36, 36, 36, 36, 36, 69, 36, 36, 36, 36, 36, 36, 36,
-36, 36, 36, 36, 36, 36, 36, 40, 44, 36, 36, 36, 44, 36, 36, 36, 44, 36, 36, 36,
-44, 36, 61, 44, 20, 178, 56, 135, 26, 8, 144, 92, 44, 44, 44, 44, 79, 65, 67, 44,
-36, 36, 36, 36, 36, 36, 62, 36, 36, 36, 36, 36, 36, 61, 36, 62, 2, 64, 44, 179,
-27, 27, 27, 27, 27, 27, 44, 55, 67, 67, 67, 67, 105, 105, 143, 27, 91, 67, 67, 67,
-67, 67, 67, 67, 67, 27, 67, 92, 67, 67, 67, 67, 67, 67, 92, 44, 92, 44, 44, 44,
-44, 44, 44, 44, 67, 67, 67, 67, 67, 67, 50, 44, 180, 27, 27, 27, 27, 27, 27, 27,
-27, 27, 27, 27, 27, 27, 44, 44, 27, 27, 44, 44, 44, 44, 62, 36, 155, 36, 36, 36,
-36, 181, 44, 44, 36, 36, 36, 43, 43, 80, 44, 44, 36, 36, 36, 36, 36, 36, 36, 93,
-36, 36, 44, 44, 36, 36, 36, 36, 182, 105, 105, 44, 44, 44, 44, 44, 11, 11, 11, 11,
-16, 16, 16, 16, 11, 11, 44, 44, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 44, 44,
-36, 36, 36, 36, 44, 44, 44, 44, 36, 36, 44, 44, 44, 44, 44, 93, 11, 11, 11, 11,
-11, 47, 11, 11, 11, 47, 11, 150, 16, 16, 16, 16, 16, 150, 16, 16, 16, 16, 16, 16,
-16, 150, 16, 16, 16, 150, 110, 44, 40, 40, 40, 52, 40, 40, 40, 40, 81, 40, 40, 40,
-40, 81, 44, 44, 36, 36, 36, 44, 61, 36, 36, 36, 36, 36, 36, 62, 61, 44, 61, 62,
-36, 36, 36, 93, 27, 27, 27, 27, 36, 36, 36, 77, 163, 27, 27, 27, 44, 44, 44, 179,
-27, 27, 27, 27, 36, 61, 36, 44, 44, 179, 27, 27, 36, 36, 36, 27, 27, 27, 44, 93,
-36, 36, 36, 36, 36, 44, 44, 93, 36, 36, 36, 36, 44, 44, 27, 36, 44, 27, 27, 27,
-27, 27, 27, 27, 70, 43, 57, 80, 44, 44, 43, 43, 36, 36, 62, 36, 62, 36, 36, 36,
-36, 36, 36, 44, 43, 80, 44, 57, 27, 27, 27, 27, 100, 44, 44, 44, 2, 2, 2, 2,
-64, 44, 44, 44, 36, 36, 36, 36, 36, 36, 183, 30, 36, 36, 36, 36, 36, 36, 183, 27,
-36, 36, 36, 36, 78, 36, 36, 36, 36, 36, 70, 80, 44, 179, 27, 27, 2, 2, 2, 64,
-44, 44, 44, 44, 36, 36, 36, 44, 93, 2, 2, 2, 36, 36, 36, 44, 27, 27, 27, 27,
-36, 61, 44, 44, 27, 27, 27, 27, 36, 44, 44, 44, 93, 2, 64, 44, 44, 44, 44, 44,
-179, 27, 27, 27, 11, 47, 44, 44, 44, 44, 44, 44, 16, 110, 44, 44, 44, 27, 27, 27,
-36, 36, 43, 43, 44, 44, 44, 44, 27, 27, 27, 27, 27, 27, 27, 100, 36, 36, 36, 36,
-36, 57, 184, 44, 36, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 57, 43,
-27, 27, 27, 95, 44, 44, 44, 44, 180, 27, 30, 2, 2, 44, 44, 44, 36, 43, 43, 2,
-2, 44, 44, 44, 36, 36, 183, 27, 27, 27, 44, 44, 87, 98, 36, 36, 36, 36, 36, 36,
-36, 36, 36, 36, 43, 43, 43, 43, 43, 43, 43, 60, 2, 2, 2, 44, 27, 27, 27, 7,
-7, 7, 7, 7, 71, 70, 71, 44, 44, 44, 44, 57, 86, 87, 43, 85, 87, 60, 185, 2,
-2, 80, 44, 44, 44, 44, 79, 44, 43, 71, 36, 36, 36, 36, 36, 36, 36, 36, 36, 70,
-43, 43, 87, 43, 43, 43, 80, 7, 7, 7, 7, 7, 2, 2, 94, 98, 44, 44, 44, 44,
-36, 70, 2, 61, 44, 44, 44, 44, 36, 94, 86, 43, 43, 43, 43, 85, 98, 36, 63, 2,
-59, 43, 60, 87, 7, 7, 7, 7, 7, 63, 63, 2, 179, 27, 27, 27, 27, 27, 27, 27,
-27, 27, 100, 44, 44, 44, 44, 44, 36, 36, 36, 36, 36, 36, 86, 87, 43, 86, 85, 43,
-2, 2, 2, 71, 70, 44, 44, 44, 44, 44, 44, 44, 36, 36, 36, 61, 61, 36, 36, 62,
-36, 36, 36, 36, 36, 36, 36, 62, 36, 36, 36, 36, 63, 44, 44, 44, 36, 36, 36, 36,
-36, 36, 36, 70, 86, 87, 43, 43, 43, 80, 44, 44, 43, 86, 62, 36, 36, 36, 61, 62,
-61, 36, 62, 36, 36, 57, 71, 86, 85, 86, 90, 89, 90, 89, 86, 44, 61, 44, 44, 89,
-44, 44, 62, 36, 36, 86, 44, 43, 43, 43, 80, 44, 43, 43, 80, 44, 44, 44, 44, 44,
-36, 36, 94, 86, 43, 43, 43, 43, 86, 43, 85, 71, 36, 63, 2, 2, 7, 7, 7, 7,
-7, 2, 93, 71, 86, 87, 43, 43, 85, 85, 86, 87, 85, 43, 36, 72, 44, 44, 44, 44,
-36, 36, 36, 36, 36, 36, 36, 94, 86, 43, 43, 44, 86, 86, 43, 87, 60, 2, 2, 2,
-2, 2, 2, 2, 2, 2, 2, 2, 36, 36, 43, 44, 86, 87, 43, 43, 43, 85, 87, 87,
-60, 2, 61, 44, 44, 44, 44, 44, 2, 2, 2, 2, 2, 2, 64, 44, 36, 36, 36, 36,
-36, 70, 87, 86, 43, 43, 43, 87, 63, 44, 44, 44, 86, 43, 43, 87, 43, 43, 44, 44,
-7, 7, 7, 7, 7, 27, 2, 97, 43, 43, 43, 43, 87, 60, 44, 44, 27, 100, 44, 44,
-44, 44, 44, 62, 36, 36, 36, 61, 62, 44, 36, 36, 36, 36, 62, 61, 36, 36, 36, 36,
-86, 86, 86, 89, 90, 57, 85, 71, 98, 87, 2, 64, 44, 44, 44, 44, 36, 36, 36, 36,
-44, 36, 36, 36, 94, 86, 43, 43, 44, 43, 86, 86, 71, 72, 90, 44, 44, 44, 44, 44,
-70, 43, 43, 43, 43, 71, 36, 36, 36, 70, 43, 43, 85, 70, 43, 60, 2, 2, 2, 59,
-44, 44, 44, 44, 70, 43, 43, 85, 87, 43, 36, 36, 36, 36, 36, 36, 36, 43, 43, 43,
-43, 43, 43, 85, 43, 2, 72, 2, 2, 64, 44, 44, 44, 44, 44, 44, 2, 2, 2, 2,
-2, 44, 44, 44, 43, 43, 43, 80, 43, 43, 43, 87, 63, 2, 2, 44, 44, 44, 44, 44,
-2, 36, 36, 36, 36, 36, 36, 36, 44, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
-89, 43, 43, 43, 85, 43, 87, 80, 44, 44, 44, 44, 36, 36, 36, 61, 36, 62, 36, 36,
-70, 43, 43, 80, 44, 80, 43, 57, 43, 43, 43, 70, 44, 44, 44, 44, 36, 36, 36, 62,
-61, 36, 36, 36, 36, 36, 36, 36, 36, 86, 86, 90, 43, 89, 87, 87, 61, 44, 44, 44,
-36, 70, 85, 107, 64, 44, 44, 44, 43, 94, 36, 36, 36, 36, 36, 36, 36, 36, 86, 43,
-43, 80, 44, 86, 85, 60, 2, 2, 2, 2, 2, 2, 27, 27, 91, 67, 67, 67, 56, 20,
-168, 67, 67, 67, 67, 67, 67, 67, 67, 44, 44, 44, 44, 44, 44, 93, 105, 105, 105, 105,
-105, 105, 105, 181, 2, 2, 64, 44, 44, 44, 44, 44, 63, 64, 44, 44, 44, 44, 44, 44,
-65, 65, 65, 65, 65, 65, 65, 65, 71, 36, 36, 70, 43, 43, 43, 43, 43, 43, 43, 44,
-44, 44, 44, 44, 43, 43, 60, 44, 44, 44, 44, 44, 43, 43, 43, 60, 2, 2, 67, 67,
-40, 40, 97, 44, 44, 44, 44, 44, 7, 7, 7, 7, 7, 179, 27, 27, 27, 62, 36, 36,
-36, 36, 36, 36, 36, 36, 36, 36, 44, 44, 62, 36, 27, 27, 27, 30, 2, 64, 44, 44,
-36, 36, 36, 36, 36, 61, 44, 57, 94, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
-86, 86, 86, 86, 86, 86, 86, 86, 44, 44, 44, 57, 43, 74, 40, 40, 40, 40, 40, 40,
-40, 88, 80, 44, 44, 44, 44, 44, 86, 44, 44, 44, 44, 44, 44, 44, 40, 40, 52, 40,
-40, 40, 52, 81, 36, 61, 44, 44, 44, 44, 44, 44, 44, 61, 44, 44, 44, 44, 44, 44,
-36, 61, 62, 44, 44, 44, 44, 44, 44, 44, 36, 36, 44, 44, 44, 44, 36, 36, 36, 36,
-36, 44, 50, 60, 65, 65, 44, 44, 44, 44, 44, 44, 43, 43, 43, 43, 43, 43, 43, 44,
-43, 43, 43, 80, 44, 44, 44, 44, 67, 67, 67, 92, 55, 67, 67, 67, 67, 67, 186, 87,
-43, 67, 186, 86, 86, 187, 65, 65, 65, 84, 43, 43, 43, 76, 50, 43, 43, 43, 67, 67,
-67, 67, 67, 67, 67, 43, 43, 67, 67, 43, 76, 44, 44, 44, 44, 44, 27, 27, 44, 44,
-44, 44, 44, 44, 11, 11, 11, 11, 11, 16, 16, 16, 16, 16, 11, 11, 11, 11, 11, 11,
-11, 11, 11, 11, 11, 11, 11, 16, 16, 16, 110, 16, 16, 16, 16, 16, 11, 16, 16, 16,
-16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 47, 11, 44, 47, 48, 47, 48, 11, 47, 11,
-11, 11, 11, 16, 16, 150, 150, 16, 16, 16, 150, 16, 16, 16, 16, 16, 16, 16, 11, 48,
-11, 47, 48, 11, 11, 11, 47, 11, 11, 11, 47, 16, 16, 16, 16, 16, 11, 48, 11, 47,
-11, 11, 47, 47, 44, 11, 11, 11, 47, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
-16, 16, 11, 11, 11, 11, 11, 16, 16, 16, 16, 16, 16, 16, 16, 44, 11, 11, 11, 11,
-31, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 33, 16, 16, 16, 11, 11, 11,
-11, 11, 11, 11, 11, 11, 11, 11, 11, 31, 16, 16, 16, 16, 33, 16, 16, 16, 11, 11,
-11, 11, 31, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 33, 16, 16, 16, 11,
-11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 31, 16, 16, 16, 16, 33, 16, 16, 16,
-11, 11, 11, 11, 31, 16, 16, 16, 16, 33, 16, 16, 16, 32, 44, 7, 7, 7, 7, 7,
-7, 7, 7, 7, 43, 43, 43, 76, 67, 50, 43, 43, 43, 43, 43, 43, 43, 43, 76, 67,
-67, 67, 50, 67, 67, 67, 67, 67, 67, 67, 76, 21, 2, 2, 44, 44, 44, 44, 44, 44,
-44, 57, 43, 43, 16, 16, 16, 16, 16, 39, 16, 16, 16, 16, 16, 16, 16, 16, 16, 110,
-44, 44, 150, 16, 16, 110, 44, 44, 43, 43, 43, 80, 43, 43, 43, 43, 43, 43, 43, 43,
-80, 57, 43, 43, 43, 57, 80, 43, 43, 80, 44, 44, 40, 40, 40, 40, 40, 40, 40, 44,
-44, 44, 44, 44, 44, 44, 44, 57, 43, 43, 43, 74, 40, 40, 40, 44, 7, 7, 7, 7,
-7, 44, 44, 77, 36, 36, 36, 36, 36, 36, 36, 80, 36, 36, 36, 36, 36, 36, 43, 43,
-7, 7, 7, 7, 7, 44, 44, 96, 36, 36, 36, 36, 36, 83, 43, 43, 36, 36, 36, 61,
-36, 36, 62, 61, 36, 36, 61, 179, 27, 27, 27, 27, 16, 16, 43, 43, 43, 74, 44, 44,
-27, 27, 27, 27, 27, 27, 163, 27, 188, 27, 100, 44, 44, 44, 44, 44, 27, 27, 27, 27,
-27, 27, 27, 163, 27, 27, 27, 27, 27, 27, 27, 44, 36, 36, 62, 36, 36, 36, 36, 36,
-62, 61, 61, 62, 62, 36, 36, 36, 36, 61, 36, 36, 62, 62, 44, 44, 44, 61, 44, 62,
-62, 62, 62, 36, 62, 61, 61, 62, 62, 62, 62, 62, 62, 61, 61, 62, 36, 61, 36, 36,
-36, 61, 36, 36, 62, 36, 61, 61, 36, 36, 36, 36, 36, 62, 36, 36, 62, 36, 62, 36,
-36, 62, 36, 36, 8, 44, 44, 44, 44, 44, 44, 44, 67, 67, 67, 67, 67, 67, 44, 44,
-55, 67, 67, 67, 67, 67, 67, 67, 27, 27, 27, 27, 27, 27, 91, 67, 67, 67, 67, 67,
-67, 67, 67, 44, 44, 44, 44, 67, 67, 67, 67, 67, 67, 92, 44, 44, 44, 44, 44, 44,
-67, 67, 67, 67, 92, 44, 44, 44, 67, 44, 44, 44, 44, 44, 44, 44, 67, 67, 67, 67,
-67, 25, 41, 41, 67, 67, 67, 67, 44, 44, 67, 67, 67, 67, 67, 92, 44, 55, 67, 67,
-67, 67, 67, 67, 44, 44, 44, 44, 67, 67, 67, 67, 67, 67, 67, 55, 67, 67, 67, 44,
-44, 44, 44, 67, 67, 92, 67, 67, 67, 67, 67, 67, 79, 44, 44, 44, 44, 44, 44, 44,
-171, 171, 171, 171, 171, 171, 171, 44,
-// catTable values
-25, 25, 22, 17, 17, 17, 19, 17, 13, 14, 17, 18, 17, 12, 8, 8, 18, 18, 18, 17,
-17, 0, 0, 0, 0, 13, 17, 14, 20, 11, 20, 1, 1, 1, 1, 13, 18, 14, 18, 25,
-19, 19, 21, 17, 20, 21, 4, 15, 18, 26, 21, 20, 21, 18, 10, 10, 20, 10, 4, 16,
-10, 17, 0, 18, 0, 1, 1, 18, 1, 0, 1, 4, 4, 4, 0, 2, 2, 1, 4, 1,
-3, 3, 20, 20, 3, 20, 5, 5, 29, 29, 3, 1, 0, 17, 0, 29, 29, 0, 18, 0,
-21, 5, 7, 7, 29, 3, 1, 17, 12, 29, 29, 21, 21, 19, 29, 5, 12, 5, 17, 5,
-5, 17, 4, 29, 29, 4, 4, 17, 17, 29, 26, 26, 17, 19, 21, 21, 26, 17, 3, 4,
-4, 5, 5, 4, 17, 4, 5, 26, 5, 3, 3, 5, 5, 21, 4, 21, 21, 4, 29, 26,
-5, 29, 3, 29, 20, 4, 4, 3, 26, 5, 5, 6, 6, 6, 6, 5, 17, 3, 29, 6,
-6, 29, 10, 21, 21, 29, 29, 17, 4, 6, 10, 4, 29, 19, 17, 21, 6, 4, 17, 10,
-10, 29, 12, 4, 22, 4, 4, 13, 14, 29, 9, 9, 9, 4, 6, 17, 12, 17, 7, 5,
-1, 29, 1, 3, 2, 2, 2, 20, 1, 20, 29, 20, 0, 20, 20, 29, 22, 22, 22, 26,
-12, 12, 15, 16, 13, 15, 23, 24, 26, 22, 17, 15, 16, 17, 17, 11, 11, 17, 18, 13,
-14, 17, 17, 22, 26, 29, 10, 3, 14, 3, 19, 29, 5, 7, 0, 21, 21, 0, 21, 1,
-1, 21, 9, 0, 1, 9, 9, 10, 18, 21, 21, 13, 14, 21, 14, 18, 14, 13, 1, 5,
-29, 1, 13, 17, 17, 13, 14, 12, 21, 3, 4, 9, 12, 13, 14, 14, 21, 9, 12, 3,
-9, 3, 5, 20, 20, 3, 21, 10, 3, 17, 7, 17, 20, 0, 3, 0, 19, 21, 3, 6,
-27, 27, 28, 28, 4, 18, 12, 11, 11, 13, 11, 11, 18, 12, 18, 29, 18, 20, 29, 10,
-5, 10, 9, 29, 17, 9, 4, 10, 5, 12, 17, 26, 21, 6, 6, 26, 19, 10,
+40, 42, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 46, 44, 44, 44, 44, 44,
+44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 48, 44, 50, 52,
+54, 56, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+44, 44, 44, 58, 60, 60, 60, 60, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 84, 86, 88, 90, 92, 94, 96, 98, 100, 102,
+44, 104, 106, 108, 108, 108, 108, 110, 44, 44, 112, 108, 108, 108, 108, 108, 108, 108, 44, 114,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 44, 116, 108, 118,
+44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 120, 44, 44, 122, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 124, 126, 128, 108, 108, 108, 108, 130, 108,
+108, 108, 108, 108, 108, 108, 108, 132, 134, 136, 138, 140, 142, 144, 108, 146, 148, 150, 152, 154,
+156, 108, 158, 160, 162, 164, 142, 166, 168, 170, 108, 108, 44, 44, 44, 44, 44, 44, 44, 44,
+44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 172, 44, 44, 44, 44,
+44, 44, 44, 174, 176, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 178, 44, 44, 44, 44,
+44, 44, 44, 44, 44, 44, 44, 44, 44, 180, 44, 182, 108, 108, 108, 108, 44, 184, 108, 108,
+44, 44, 44, 44, 44, 44, 44, 44, 44, 186, 44, 44, 44, 44, 44, 44, 44, 188, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 190, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 62, 62, 62, 62,
+62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+62, 62, 62, 192, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 192,
+// CharacterPropertyTable values
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 37, 37, 37, 37, 67, 37, 37, 37, 37, 37, 37, 37, 37, 37, 67, 37, 37, 37,
+67, 37, 37, 37, 37, 37, 29, 29, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+17, 17, 17, 29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 37, 37, 37, 29, 29, 17, 29,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 29, 29, 29, 29, 29, 68, 68, 68, 68,
+68, 68, 68, 68, 20, 68, 68, 68, 68, 68, 68, 29, 26, 26, 29, 29, 29, 29, 29, 29,
+37, 37, 37, 37, 37, 37, 37, 37, 68, 68, 68, 68, 68, 68, 68, 68, 68, 67, 37, 37,
+37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+37, 37, 26, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 38,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 37, 38, 37, 68, 38, 38, 38, 37, 37, 37, 37, 37, 37, 37, 37, 38, 38, 38,
+38, 37, 38, 38, 68, 37, 37, 37, 37, 37, 37, 37, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 37, 37, 17, 17, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 17, 67, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 37, 38, 38, 29, 68, 68, 68,
+68, 68, 68, 68, 68, 29, 29, 68, 68, 29, 29, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 29, 68, 68, 68, 68, 68, 68,
+68, 29, 68, 29, 29, 29, 68, 68, 68, 68, 29, 29, 37, 68, 38, 38, 38, 37, 37, 37,
+37, 29, 29, 38, 38, 29, 29, 38, 38, 37, 68, 29, 29, 29, 29, 29, 29, 29, 29, 38,
+29, 29, 29, 29, 68, 68, 29, 68, 68, 68, 37, 37, 29, 29, 40, 40, 40, 40, 40, 40,
+40, 40, 40, 40, 68, 68, 19, 19, 10, 10, 10, 10, 10, 10, 21, 19, 68, 17, 37, 29,
+29, 37, 37, 38, 29, 68, 68, 68, 68, 68, 68, 29, 29, 29, 29, 68, 68, 29, 68, 68,
+29, 68, 68, 29, 68, 68, 29, 29, 37, 29, 38, 38, 38, 37, 37, 29, 29, 29, 29, 37,
+37, 29, 29, 37, 37, 37, 29, 29, 29, 37, 29, 29, 29, 29, 29, 29, 29, 68, 68, 68,
+68, 29, 68, 29, 29, 29, 29, 29, 29, 29, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+37, 37, 68, 68, 68, 37, 17, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 37, 37, 38,
+29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 29, 68, 68, 68, 29, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 29, 68, 68, 29, 68, 68, 68, 68, 68, 29, 29,
+37, 68, 38, 38, 38, 37, 37, 37, 37, 37, 29, 37, 37, 38, 29, 38, 38, 37, 29, 29,
+68, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 17, 19, 29, 29,
+29, 29, 29, 29, 29, 68, 37, 37, 37, 37, 37, 37, 29, 37, 38, 38, 29, 68, 68, 68,
+68, 68, 68, 68, 68, 29, 29, 68, 68, 29, 68, 68, 29, 68, 68, 68, 68, 68, 29, 29,
+37, 68, 38, 37, 38, 37, 37, 37, 37, 29, 29, 38, 38, 29, 29, 38, 38, 37, 29, 29,
+29, 29, 29, 29, 29, 37, 37, 38, 29, 29, 29, 29, 68, 68, 29, 68, 21, 68, 10, 10,
+10, 10, 10, 10, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 37, 68, 29, 68, 68, 68,
+68, 68, 68, 29, 29, 29, 68, 68, 68, 29, 68, 68, 68, 68, 29, 29, 29, 68, 68, 29,
+68, 29, 68, 68, 29, 29, 29, 68, 68, 29, 29, 29, 68, 68, 68, 29, 29, 29, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 29, 29, 29, 29, 38, 38, 37, 38, 38, 29,
+29, 29, 38, 38, 38, 29, 38, 38, 38, 37, 29, 29, 68, 29, 29, 29, 29, 29, 29, 38,
+29, 29, 29, 29, 29, 29, 29, 29, 10, 10, 10, 21, 21, 21, 21, 21, 21, 19, 21, 29,
+29, 29, 29, 29, 37, 38, 38, 38, 37, 68, 68, 68, 68, 68, 68, 68, 68, 29, 68, 68,
+68, 29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 29, 29, 37, 68, 37, 37, 37, 38, 38, 38, 38, 29, 37, 37,
+37, 29, 37, 37, 37, 37, 29, 29, 29, 29, 29, 29, 29, 37, 37, 29, 68, 68, 68, 29,
+29, 68, 29, 29, 29, 29, 29, 29, 29, 29, 29, 17, 10, 10, 10, 10, 10, 10, 10, 21,
+68, 37, 38, 38, 17, 68, 68, 68, 68, 68, 68, 68, 68, 29, 68, 68, 68, 68, 68, 68,
+29, 68, 68, 68, 68, 68, 29, 29, 37, 68, 38, 37, 38, 38, 38, 38, 38, 29, 37, 38,
+38, 29, 38, 38, 37, 37, 29, 29, 29, 29, 29, 29, 29, 38, 38, 29, 29, 29, 29, 29,
+29, 68, 68, 29, 29, 68, 68, 38, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+37, 37, 38, 38, 68, 68, 68, 68, 68, 68, 68, 68, 68, 29, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 37, 37, 68, 38, 38, 38, 37, 37, 37, 37, 29, 38, 38,
+38, 29, 38, 38, 38, 37, 68, 21, 29, 29, 29, 29, 68, 68, 68, 38, 10, 10, 10, 10,
+10, 10, 10, 68, 10, 10, 10, 10, 10, 10, 10, 10, 10, 21, 68, 68, 68, 68, 68, 68,
+29, 37, 38, 38, 29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 29, 29, 29, 68, 68, 68, 68, 68, 68, 68, 68, 29, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 29, 68, 29, 29, 68, 68, 68, 68, 68, 68, 68, 29, 29, 29, 37, 29,
+29, 29, 29, 38, 38, 38, 37, 37, 37, 29, 37, 29, 38, 38, 38, 38, 38, 38, 38, 38,
+29, 29, 38, 38, 17, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 37, 68, 100, 37, 37, 37, 37,
+37, 37, 37, 29, 29, 29, 29, 19, 68, 68, 68, 68, 68, 68, 67, 37, 37, 37, 37, 37,
+37, 37, 37, 17, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 17, 17, 29, 29, 29, 29,
+29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 68, 68, 29,
+68, 29, 68, 68, 68, 68, 68, 29, 68, 68, 68, 68, 68, 68, 68, 68, 29, 68, 29, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 37, 68, 100, 37, 37, 37, 37, 37, 37, 37, 37,
+37, 68, 29, 29, 68, 68, 68, 68, 68, 29, 67, 29, 37, 37, 37, 37, 37, 37, 37, 29,
+40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 29, 29, 68, 68, 68, 68, 68, 21, 21, 21,
+17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 21, 17, 21, 21, 21,
+37, 37, 21, 21, 21, 21, 21, 21, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 10, 10,
+10, 10, 10, 10, 10, 10, 10, 10, 21, 37, 21, 37, 21, 37, 13, 14, 13, 14, 38, 38,
+68, 68, 68, 68, 68, 68, 68, 68, 29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 29, 29, 29, 29, 37, 37, 37, 37, 37, 37, 37,
+37, 37, 37, 37, 37, 37, 37, 38, 37, 37, 37, 37, 37, 17, 37, 37, 68, 68, 68, 68,
+68, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 29, 37, 37, 37, 37, 37, 37, 37,
+37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 29, 21, 21, 21, 21, 21, 21,
+21, 21, 37, 21, 21, 21, 21, 21, 21, 29, 21, 21, 17, 17, 17, 17, 17, 21, 21, 21,
+21, 17, 17, 29, 29, 29, 29, 29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 38,
+38, 37, 37, 37, 37, 38, 37, 37, 37, 37, 37, 37, 38, 37, 37, 38, 38, 37, 37, 68,
+40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 17, 17, 17, 17, 17, 17, 68, 68, 68, 68,
+68, 68, 38, 38, 37, 37, 68, 68, 68, 68, 37, 37, 37, 68, 38, 38, 38, 68, 68, 38,
+38, 38, 38, 38, 38, 38, 68, 68, 68, 37, 37, 37, 37, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 37, 38, 38, 37, 37, 38, 38, 38, 38, 38, 38, 37, 68, 38,
+40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 38, 38, 38, 37, 21, 21, 64, 64, 64, 64,
+64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 29, 64,
+29, 29, 29, 29, 29, 64, 29, 29, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 17, 67, 65, 65, 65,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 29, 68, 68, 68, 68, 29, 29, 68, 68, 68, 68,
+68, 68, 68, 29, 68, 29, 68, 68, 68, 68, 29, 29, 68, 29, 68, 68, 68, 68, 29, 29,
+68, 68, 68, 68, 68, 68, 68, 29, 68, 29, 68, 68, 68, 68, 29, 29, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 29, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 29, 29, 37, 37, 37, 17, 17, 17, 17,
+17, 17, 17, 17, 17, 42, 42, 42, 42, 42, 42, 42, 42, 42, 10, 10, 10, 10, 10, 10,
+10, 10, 10, 10, 10, 29, 29, 29, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 29, 29,
+29, 29, 29, 29, 64, 64, 64, 64, 64, 64, 29, 29, 65, 65, 65, 65, 65, 65, 29, 29,
+12, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 21, 17, 68, 22, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 13,
+14, 29, 29, 29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 17, 17, 17, 73, 73,
+73, 68, 68, 68, 68, 68, 68, 68, 68, 29, 29, 29, 29, 29, 29, 29, 68, 68, 37, 37,
+37, 38, 29, 29, 29, 29, 29, 29, 29, 29, 29, 68, 68, 68, 37, 37, 38, 17, 17, 29,
+29, 29, 29, 29, 29, 29, 29, 29, 68, 68, 37, 37, 29, 29, 29, 29, 29, 29, 29, 29,
+29, 29, 29, 29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 29, 68, 68,
+68, 29, 37, 37, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 68, 68, 68, 68,
+37, 37, 38, 37, 37, 37, 37, 37, 37, 37, 38, 38, 38, 38, 38, 38, 38, 38, 37, 38,
+38, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 17, 17, 17, 67, 17, 17, 17, 19,
+68, 37, 29, 29, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 29, 29, 29, 29, 29, 29,
+10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 29, 29, 29, 29, 29, 29, 17, 17, 17, 17,
+17, 17, 12, 17, 17, 17, 17, 37, 37, 37, 26, 37, 68, 68, 68, 67, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 29, 29, 29,
+29, 29, 29, 29, 68, 68, 68, 68, 68, 69, 69, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 37, 68, 29, 29, 29, 29, 29, 68, 68, 68, 68,
+68, 68, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 29, 37, 37, 37, 38, 38, 38, 38, 37, 37, 38, 38, 38,
+29, 29, 29, 29, 38, 38, 37, 38, 38, 38, 38, 38, 38, 37, 37, 37, 29, 29, 29, 29,
+21, 29, 29, 29, 17, 17, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 29, 29, 68, 68, 68, 68, 68, 29, 29, 29,
+29, 29, 29, 29, 29, 29, 29, 29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+29, 29, 29, 29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 29, 29, 29, 29, 29, 29,
+40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 42, 29, 29, 29, 21, 21, 21, 21, 21, 21,
+21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 68, 68, 68, 68, 68, 68, 68, 37,
+37, 38, 38, 37, 29, 29, 17, 17, 68, 68, 68, 68, 68, 38, 37, 38, 37, 37, 37, 37,
+37, 37, 37, 29, 37, 38, 37, 38, 38, 37, 37, 37, 37, 37, 37, 37, 37, 38, 38, 38,
+38, 38, 38, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 29, 29, 37, 17, 17, 17, 17,
+17, 17, 17, 67, 17, 17, 17, 17, 17, 17, 29, 29, 37, 37, 37, 37, 37, 37, 37, 37,
+37, 37, 37, 37, 37, 37, 7, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+37, 37, 37, 29, 37, 37, 37, 37, 38, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 37, 38, 37, 37, 37, 37, 37, 38, 37, 38, 38, 38, 38, 38, 37, 38,
+38, 68, 68, 68, 68, 68, 68, 68, 68, 29, 29, 29, 17, 21, 21, 21, 21, 21, 21, 21,
+21, 21, 21, 37, 37, 37, 37, 37, 37, 37, 37, 37, 21, 21, 21, 21, 21, 21, 21, 21,
+21, 17, 17, 29, 37, 37, 38, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 38, 37, 37, 37, 37, 38, 38, 37, 37, 38, 37, 37, 37, 68, 68, 40, 40, 40, 40,
+40, 40, 40, 40, 40, 40, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 37, 38,
+37, 37, 38, 38, 38, 37, 38, 37, 37, 37, 38, 38, 29, 29, 29, 29, 29, 29, 29, 29,
+17, 17, 17, 17, 68, 68, 68, 68, 38, 38, 38, 38, 38, 38, 38, 38, 37, 37, 37, 37,
+37, 37, 37, 37, 38, 38, 37, 37, 29, 29, 29, 17, 17, 17, 17, 17, 40, 40, 40, 40,
+40, 40, 40, 40, 40, 40, 29, 29, 29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+67, 67, 67, 67, 67, 67, 17, 17, 65, 65, 65, 65, 65, 65, 65, 65, 65, 29, 29, 29,
+29, 29, 29, 29, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 29, 29, 64, 64, 64,
+17, 17, 17, 17, 17, 17, 17, 17, 29, 29, 29, 29, 29, 29, 29, 29, 37, 37, 37, 17,
+37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 38, 37, 37, 37, 37, 37, 37,
+37, 68, 68, 68, 68, 37, 68, 68, 68, 68, 68, 68, 37, 68, 68, 38, 37, 37, 68, 29,
+29, 29, 29, 29, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 67, 67, 67, 67,
+67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+67, 67, 67, 67, 67, 67, 67, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+67, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 67,
+67, 67, 67, 67, 64, 65, 64, 65, 64, 65, 64, 65, 64, 65, 64, 65, 64, 65, 64, 65,
+64, 65, 64, 65, 64, 65, 65, 65, 65, 65, 65, 65, 65, 65, 64, 65, 65, 65, 65, 65,
+65, 65, 65, 65, 64, 64, 64, 64, 64, 64, 64, 64, 65, 65, 65, 65, 65, 65, 29, 29,
+64, 64, 64, 64, 64, 64, 29, 29, 65, 65, 65, 65, 65, 65, 65, 65, 29, 64, 29, 64,
+29, 64, 29, 64, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 29, 29,
+65, 65, 65, 65, 65, 65, 65, 65, 66, 66, 66, 66, 66, 66, 66, 66, 65, 65, 65, 65,
+65, 29, 65, 65, 64, 64, 64, 64, 66, 20, 65, 20, 20, 20, 65, 65, 65, 29, 65, 65,
+64, 64, 64, 64, 66, 20, 20, 20, 65, 65, 65, 65, 29, 29, 65, 65, 64, 64, 64, 64,
+29, 20, 20, 20, 65, 65, 65, 65, 65, 65, 65, 65, 64, 64, 64, 64, 64, 20, 20, 20,
+29, 29, 65, 65, 65, 29, 65, 65, 64, 64, 64, 64, 66, 20, 20, 29, 22, 22, 22, 22,
+22, 22, 22, 22, 22, 22, 22, 26, 26, 26, 26, 26, 12, 12, 12, 12, 12, 12, 17, 17,
+15, 16, 13, 15, 15, 16, 13, 15, 17, 17, 17, 17, 17, 17, 17, 17, 23, 24, 26, 26,
+26, 26, 26, 22, 17, 17, 17, 17, 17, 17, 17, 17, 17, 15, 16, 17, 17, 17, 17, 43,
+43, 17, 17, 17, 18, 13, 14, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 18, 17,
+43, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 22, 26, 26, 26, 26, 26, 29, 26, 26,
+26, 26, 26, 26, 26, 26, 26, 26, 10, 67, 29, 29, 10, 10, 10, 10, 10, 10, 18, 18,
+18, 13, 14, 67, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 18, 18, 18, 13, 14, 29,
+67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 29, 29, 29, 19, 19, 19, 19,
+19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 29, 29, 29, 29, 29, 29, 29,
+29, 29, 29, 29, 29, 29, 29, 29, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+37, 7, 7, 7, 7, 37, 7, 7, 7, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+37, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 21, 21, 64, 21,
+21, 21, 21, 64, 21, 21, 65, 64, 64, 64, 65, 65, 64, 64, 64, 65, 21, 64, 21, 21,
+82, 64, 64, 64, 64, 64, 21, 21, 21, 21, 21, 21, 64, 21, 64, 21, 64, 21, 64, 64,
+64, 64, 85, 65, 64, 64, 64, 64, 65, 68, 68, 68, 68, 65, 21, 21, 65, 65, 64, 64,
+18, 18, 18, 18, 18, 64, 65, 65, 65, 65, 21, 18, 21, 21, 65, 21, 10, 10, 10, 10,
+10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 73, 73, 73, 73, 73, 73, 73, 73,
+73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 64, 65, 73, 73, 73, 73, 10, 21, 21,
+29, 29, 29, 29, 18, 18, 18, 18, 18, 21, 21, 21, 21, 21, 18, 18, 21, 21, 21, 21,
+18, 21, 21, 18, 21, 21, 18, 21, 21, 21, 21, 21, 21, 21, 18, 21, 21, 21, 21, 21,
+21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 18, 18, 21, 21, 18, 21, 18, 21, 21, 21,
+21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 18, 18, 18, 18, 18, 18, 18, 18,
+18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+21, 21, 21, 21, 21, 21, 21, 21, 13, 14, 13, 14, 21, 21, 21, 21, 18, 18, 21, 21,
+21, 21, 21, 21, 21, 13, 14, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+21, 21, 21, 21, 18, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 18,
+18, 18, 18, 18, 18, 18, 18, 18, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 18, 18, 18, 18, 18, 18, 21, 21,
+21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 29,
+29, 29, 29, 29, 29, 29, 29, 29, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 29,
+29, 29, 29, 29, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 21, 21, 21, 21,
+21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 10, 10, 10, 10, 10, 10, 21, 21, 21, 21,
+21, 21, 21, 18, 21, 21, 21, 21, 21, 21, 21, 21, 21, 18, 21, 21, 21, 21, 21, 21,
+21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 18, 18, 18, 18,
+18, 18, 18, 18, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 18,
+21, 21, 21, 21, 21, 21, 21, 21, 13, 14, 13, 14, 13, 14, 13, 14, 13, 14, 13, 14,
+13, 14, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 21, 21, 21, 21,
+21, 21, 21, 21, 21, 21, 21, 21, 18, 18, 18, 18, 18, 13, 14, 18, 18, 18, 18, 18,
+18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 13, 14, 13, 14, 13, 14, 13, 14, 13, 14,
+18, 18, 18, 13, 14, 13, 14, 13, 14, 13, 14, 13, 14, 13, 14, 13, 14, 13, 14, 13,
+14, 13, 14, 13, 14, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+13, 14, 13, 14, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+13, 14, 18, 18, 18, 18, 18, 18, 18, 21, 21, 18, 18, 18, 18, 18, 18, 21, 21, 21,
+21, 21, 21, 21, 29, 29, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+21, 21, 29, 21, 21, 21, 21, 21, 21, 21, 21, 21, 64, 65, 64, 64, 64, 65, 65, 64,
+65, 64, 65, 64, 65, 64, 64, 64, 64, 65, 64, 65, 65, 64, 65, 65, 65, 65, 65, 65,
+67, 67, 64, 64, 64, 65, 64, 65, 65, 21, 21, 21, 21, 21, 21, 64, 65, 64, 65, 37,
+37, 37, 64, 65, 29, 29, 29, 29, 29, 17, 17, 17, 17, 10, 17, 17, 65, 65, 65, 65,
+65, 65, 29, 65, 29, 29, 29, 29, 29, 65, 29, 29, 68, 68, 68, 68, 68, 68, 68, 68,
+29, 29, 29, 29, 29, 29, 29, 67, 17, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+29, 29, 29, 37, 68, 68, 68, 68, 68, 68, 68, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+68, 68, 68, 68, 68, 68, 68, 29, 68, 68, 68, 68, 68, 68, 68, 29, 17, 17, 15, 16,
+15, 16, 17, 17, 17, 15, 16, 17, 15, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 12,
+17, 17, 12, 17, 15, 16, 17, 17, 15, 16, 13, 14, 13, 14, 13, 14, 13, 14, 17, 17,
+17, 17, 17, 3, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 12, 12, 17, 17, 17, 17,
+12, 17, 13, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 21, 21, 17, 17,
+17, 13, 14, 13, 14, 13, 14, 13, 14, 12, 29, 29, 21, 21, 21, 21, 21, 21, 21, 21,
+21, 21, 29, 21, 21, 21, 21, 21, 21, 21, 21, 21, 29, 29, 29, 29, 29, 29, 29, 29,
+29, 29, 29, 29, 21, 21, 21, 21, 21, 21, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+22, 17, 17, 17, 21, 67, 68, 73, 13, 14, 13, 14, 13, 14, 13, 14, 13, 14, 21, 21,
+13, 14, 13, 14, 13, 14, 13, 14, 12, 13, 14, 14, 21, 73, 73, 73, 73, 73, 73, 73,
+73, 73, 37, 37, 37, 37, 38, 38, 12, 67, 67, 67, 67, 67, 21, 21, 73, 73, 73, 67,
+68, 17, 21, 21, 68, 68, 68, 68, 68, 68, 68, 29, 29, 37, 37, 148, 148, 67, 67, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 17, 67, 67, 67, 68, 29, 29, 29, 29,
+29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 21, 21, 10, 10, 10, 10, 21, 21,
+21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 29, 29, 29, 29, 29, 29, 29, 29,
+29, 29, 29, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 29,
+10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+21, 21, 21, 21, 10, 10, 10, 10, 10, 10, 10, 10, 21, 10, 10, 10, 10, 10, 10, 10,
+10, 10, 10, 10, 10, 10, 10, 10, 68, 68, 68, 68, 68, 67, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 67, 17, 17, 17,
+40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 68, 68, 29, 29, 29, 29, 64, 65, 64, 65,
+64, 65, 64, 65, 64, 65, 64, 65, 64, 65, 68, 37, 7, 7, 7, 17, 37, 37, 37, 37,
+37, 37, 37, 37, 37, 37, 17, 67, 64, 65, 64, 65, 64, 65, 64, 65, 64, 65, 64, 65,
+67, 67, 37, 37, 68, 68, 68, 68, 68, 68, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+37, 37, 17, 17, 17, 17, 17, 17, 29, 29, 29, 29, 29, 29, 29, 29, 20, 20, 20, 20,
+20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 67,
+67, 67, 67, 67, 67, 67, 67, 67, 20, 20, 64, 65, 64, 65, 64, 65, 64, 65, 64, 65,
+64, 65, 64, 65, 65, 65, 64, 65, 64, 65, 64, 65, 64, 65, 64, 65, 64, 65, 64, 65,
+67, 65, 65, 65, 65, 65, 65, 65, 65, 64, 65, 64, 65, 64, 64, 65, 64, 65, 64, 65,
+64, 65, 64, 65, 67, 20, 20, 64, 65, 64, 65, 68, 64, 65, 64, 65, 65, 65, 64, 65,
+64, 65, 64, 65, 64, 65, 64, 65, 64, 65, 64, 65, 64, 65, 64, 65, 64, 65, 64, 64,
+64, 64, 64, 65, 64, 64, 64, 64, 64, 65, 64, 65, 64, 65, 64, 65, 64, 65, 64, 65,
+64, 65, 64, 65, 64, 64, 64, 64, 65, 64, 65, 29, 29, 29, 29, 29, 64, 65, 29, 65,
+29, 65, 64, 65, 64, 65, 29, 29, 29, 29, 29, 29, 29, 29, 67, 67, 67, 64, 65, 68,
+67, 67, 65, 68, 68, 68, 68, 68, 68, 68, 37, 68, 68, 68, 37, 68, 68, 68, 68, 37,
+68, 68, 68, 68, 68, 68, 68, 38, 38, 37, 37, 38, 21, 21, 21, 21, 37, 29, 29, 29,
+10, 10, 10, 10, 10, 10, 21, 21, 19, 21, 29, 29, 29, 29, 29, 29, 68, 68, 68, 68,
+17, 17, 17, 17, 29, 29, 29, 29, 29, 29, 29, 29, 38, 38, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 38, 38, 38, 38, 38, 38, 38, 38,
+38, 38, 38, 38, 38, 38, 38, 38, 37, 37, 29, 29, 29, 29, 29, 29, 29, 29, 17, 17,
+37, 37, 68, 68, 68, 68, 68, 68, 17, 17, 17, 68, 17, 68, 68, 37, 68, 68, 68, 68,
+68, 68, 37, 37, 37, 37, 37, 37, 37, 37, 17, 17, 68, 68, 68, 68, 68, 68, 68, 37,
+37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 38, 38, 29, 29, 29, 29, 29, 29, 29, 29,
+29, 29, 29, 17, 68, 68, 68, 37, 38, 38, 37, 37, 37, 37, 38, 38, 37, 37, 38, 38,
+38, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 29, 67, 40, 40, 40, 40,
+40, 40, 40, 40, 40, 40, 29, 29, 29, 29, 17, 17, 68, 68, 68, 68, 68, 37, 67, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 68, 68,
+68, 68, 68, 29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 37, 37, 37, 37, 37, 37, 38,
+38, 37, 37, 38, 38, 37, 37, 29, 29, 29, 29, 29, 29, 29, 29, 29, 68, 68, 68, 37,
+68, 68, 68, 68, 68, 68, 68, 68, 37, 38, 29, 29, 40, 40, 40, 40, 40, 40, 40, 40,
+40, 40, 29, 29, 17, 17, 17, 17, 67, 68, 68, 68, 68, 68, 68, 21, 21, 21, 68, 38,
+37, 38, 68, 68, 37, 68, 37, 37, 37, 68, 68, 37, 37, 68, 68, 68, 68, 68, 37, 37,
+68, 37, 68, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+29, 29, 29, 29, 29, 29, 29, 68, 68, 67, 17, 17, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 38, 37, 37, 38, 38, 17, 17, 68, 67, 67, 38, 37, 29, 29, 29, 29, 29,
+29, 29, 29, 29, 29, 68, 68, 68, 68, 68, 68, 29, 29, 68, 68, 68, 68, 68, 68, 29,
+29, 68, 68, 68, 68, 68, 68, 29, 29, 29, 29, 29, 29, 29, 29, 29, 65, 65, 65, 65,
+65, 65, 65, 65, 65, 65, 65, 20, 67, 67, 67, 67, 65, 65, 65, 65, 65, 65, 65, 65,
+65, 67, 20, 20, 29, 29, 29, 29, 68, 68, 68, 38, 38, 37, 38, 38, 37, 38, 38, 17,
+38, 37, 29, 29, 68, 68, 68, 68, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+68, 68, 68, 68, 68, 68, 68, 29, 29, 29, 29, 68, 68, 68, 68, 68, 27, 27, 27, 27,
+27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 28, 28, 28, 28, 28, 28, 28, 28,
+28, 28, 28, 28, 28, 28, 28, 28, 65, 65, 65, 65, 65, 65, 65, 29, 29, 29, 29, 29,
+29, 29, 29, 29, 29, 29, 29, 65, 65, 65, 65, 65, 29, 29, 29, 29, 29, 68, 37, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 18, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 29, 68, 68, 68, 68, 68, 29, 68, 29, 68, 68, 29, 68, 68, 29, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+20, 20, 20, 20, 20, 20, 20, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+29, 29, 29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 132, 132, 132, 132, 132, 132, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 14, 13, 29, 29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 29, 29, 29, 29, 29, 29, 29, 21, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 132, 132, 19, 21, 21, 21, 17, 17, 17, 17, 17, 17, 17, 13,
+14, 17, 29, 29, 29, 29, 29, 29, 17, 12, 12, 43, 43, 13, 14, 13, 14, 13, 14, 13,
+14, 13, 14, 13, 14, 13, 14, 13, 14, 17, 17, 13, 14, 17, 17, 17, 17, 43, 43, 43,
+17, 17, 17, 29, 17, 17, 17, 17, 12, 13, 14, 13, 14, 13, 14, 17, 17, 17, 18, 12,
+18, 18, 18, 29, 17, 19, 17, 17, 29, 29, 29, 29, 132, 68, 132, 68, 132, 29, 132, 68,
+132, 68, 132, 68, 132, 68, 132, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 29, 29, 26, 29, 17, 17, 17, 19, 17, 17, 17, 13, 14, 17, 18, 17, 12, 17, 17,
+40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 17, 17, 18, 18, 18, 17, 17, 64, 64, 64,
+64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+64, 64, 64, 13, 17, 14, 20, 43, 20, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 13, 18, 14, 18, 13,
+14, 17, 13, 14, 17, 17, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 67, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 99, 99, 29, 29, 68, 68, 68, 68, 68, 68, 29, 29, 68, 68,
+68, 68, 68, 68, 29, 29, 68, 68, 68, 68, 68, 68, 29, 29, 68, 68, 68, 29, 29, 29,
+19, 19, 18, 20, 21, 19, 19, 29, 21, 18, 18, 18, 18, 21, 21, 29, 29, 29, 29, 29,
+29, 29, 29, 29, 29, 26, 26, 26, 21, 21, 29, 29, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 29,
+68, 68, 29, 68, 17, 17, 17, 29, 29, 29, 29, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+10, 10, 10, 10, 29, 29, 29, 21, 21, 21, 21, 21, 21, 21, 21, 21, 73, 73, 73, 73,
+73, 10, 10, 10, 10, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+21, 21, 10, 10, 21, 21, 21, 29, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+21, 29, 29, 29, 21, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 37, 29, 29, 37, 10, 10, 10,
+10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+10, 10, 10, 10, 29, 29, 29, 29, 10, 10, 10, 10, 29, 29, 29, 29, 29, 29, 29, 29,
+29, 68, 68, 68, 68, 73, 68, 68, 68, 68, 68, 68, 68, 68, 73, 29, 29, 29, 29, 29,
+68, 68, 68, 68, 68, 68, 37, 37, 37, 37, 37, 29, 29, 29, 29, 29, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 29, 17, 68, 68, 68, 68, 29, 29, 29, 29,
+68, 68, 68, 68, 68, 68, 68, 68, 17, 73, 73, 73, 73, 73, 29, 29, 29, 29, 29, 29,
+29, 29, 29, 29, 64, 64, 64, 64, 64, 64, 64, 64, 65, 65, 65, 65, 65, 65, 65, 65,
+64, 64, 64, 64, 29, 29, 29, 29, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+65, 65, 65, 65, 65, 65, 65, 65, 29, 29, 29, 29, 68, 68, 68, 68, 68, 68, 68, 68,
+29, 29, 29, 29, 29, 29, 29, 29, 68, 68, 68, 68, 29, 29, 29, 29, 29, 29, 29, 29,
+29, 29, 29, 17, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 29, 64, 64, 64, 64,
+64, 64, 64, 29, 64, 64, 29, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 29, 65,
+65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 29, 65, 65, 65, 65, 65,
+65, 65, 29, 65, 65, 29, 29, 29, 67, 67, 67, 67, 67, 67, 29, 67, 67, 67, 67, 67,
+67, 67, 67, 67, 67, 29, 67, 67, 67, 67, 67, 67, 67, 67, 67, 29, 29, 29, 29, 29,
+68, 68, 68, 68, 68, 68, 29, 29, 68, 29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 29, 68, 68, 29, 29, 29, 68, 29, 29, 68, 68, 68, 68, 68, 68, 68, 29, 17,
+10, 10, 10, 10, 10, 10, 10, 10, 68, 68, 68, 68, 68, 68, 68, 21, 21, 10, 10, 10,
+10, 10, 10, 10, 29, 29, 29, 29, 29, 29, 29, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+68, 68, 68, 29, 68, 68, 29, 29, 29, 29, 29, 10, 10, 10, 10, 10, 68, 68, 68, 68,
+68, 68, 10, 10, 10, 10, 10, 10, 29, 29, 29, 17, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 29, 29, 29, 29, 29, 17, 68, 68, 68, 68, 68, 68, 68, 68, 29, 29, 29, 29,
+10, 10, 68, 68, 29, 29, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+68, 37, 37, 37, 29, 37, 37, 29, 29, 29, 29, 29, 37, 37, 37, 37, 68, 68, 68, 68,
+29, 68, 68, 68, 29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 29, 29,
+37, 37, 37, 29, 29, 29, 29, 37, 10, 10, 10, 10, 10, 10, 10, 10, 10, 29, 29, 29,
+29, 29, 29, 29, 17, 17, 17, 17, 17, 17, 17, 17, 17, 29, 29, 29, 29, 29, 29, 29,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 10, 10, 17, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 10, 10, 10, 68, 68, 68, 68, 68, 68, 68, 68,
+21, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 37, 37, 29, 29, 29, 29, 10,
+10, 10, 10, 10, 17, 17, 17, 17, 17, 17, 17, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+68, 68, 68, 68, 68, 68, 29, 29, 29, 17, 17, 17, 17, 17, 17, 17, 68, 68, 68, 68,
+68, 68, 29, 29, 10, 10, 10, 10, 10, 10, 10, 10, 68, 68, 68, 29, 29, 29, 29, 29,
+10, 10, 10, 10, 10, 10, 10, 10, 68, 68, 29, 29, 29, 29, 29, 29, 29, 17, 17, 17,
+17, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 10, 10, 10, 10, 10, 10, 10,
+64, 64, 64, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 65, 65, 65, 29,
+29, 29, 29, 29, 29, 29, 10, 10, 10, 10, 10, 10, 68, 68, 68, 68, 37, 37, 37, 37,
+29, 29, 29, 29, 29, 29, 29, 29, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+10, 10, 10, 29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 29, 37, 37, 12, 29, 29,
+68, 68, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+29, 29, 29, 29, 29, 29, 29, 29, 29, 37, 37, 37, 10, 10, 10, 10, 10, 10, 10, 68,
+29, 29, 29, 29, 29, 29, 29, 29, 68, 68, 68, 68, 68, 68, 37, 37, 37, 37, 37, 37,
+37, 37, 37, 37, 37, 10, 10, 10, 10, 17, 17, 17, 17, 17, 29, 29, 29, 29, 29, 29,
+68, 68, 37, 37, 37, 37, 17, 17, 17, 17, 29, 29, 29, 29, 29, 29, 68, 68, 68, 68,
+68, 10, 10, 10, 10, 10, 10, 10, 29, 29, 29, 29, 38, 37, 38, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 37, 37, 37, 37,
+37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 17, 17, 17, 17, 17, 17, 17, 29, 29,
+10, 10, 10, 10, 10, 10, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 37, 68, 68, 37,
+37, 68, 29, 29, 29, 29, 29, 29, 29, 29, 29, 37, 38, 38, 38, 37, 37, 37, 37, 38,
+38, 37, 37, 17, 17, 26, 17, 17, 17, 17, 37, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+29, 26, 29, 29, 37, 37, 37, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 37, 37, 37, 37, 37, 38, 37, 37, 37, 37, 37, 37, 37,
+37, 29, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 17, 17, 17, 17, 68, 38, 38, 68,
+29, 29, 29, 29, 29, 29, 29, 29, 68, 68, 68, 37, 17, 17, 68, 29, 29, 29, 29, 29,
+29, 29, 29, 29, 68, 68, 68, 38, 38, 38, 37, 37, 37, 37, 37, 37, 37, 37, 37, 38,
+38, 68, 68, 68, 68, 17, 17, 17, 17, 37, 37, 37, 37, 17, 38, 37, 40, 40, 40, 40,
+40, 40, 40, 40, 40, 40, 68, 17, 68, 17, 17, 17, 29, 10, 10, 10, 10, 10, 10, 10,
+10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 29, 29, 29, 29, 29, 29, 29,
+29, 29, 29, 29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 38, 38, 38, 37,
+37, 37, 38, 38, 37, 38, 37, 37, 17, 17, 17, 17, 17, 17, 37, 68, 68, 37, 29, 29,
+29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 68, 68, 68, 68, 68, 68, 68, 29,
+68, 29, 68, 68, 68, 68, 29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 17, 29, 29, 29, 29, 29, 29,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 37, 38, 38, 38, 37,
+37, 37, 37, 37, 37, 37, 37, 29, 29, 29, 29, 29, 37, 37, 38, 38, 29, 68, 68, 68,
+68, 68, 68, 68, 68, 29, 29, 68, 68, 29, 68, 68, 29, 68, 68, 68, 68, 68, 29, 37,
+37, 68, 38, 38, 37, 38, 38, 38, 38, 29, 29, 38, 38, 29, 29, 38, 38, 38, 29, 29,
+68, 29, 29, 29, 29, 29, 29, 38, 29, 29, 29, 29, 29, 68, 68, 68, 68, 68, 38, 38,
+29, 29, 37, 37, 37, 37, 37, 37, 37, 29, 29, 29, 37, 37, 37, 37, 37, 29, 29, 29,
+29, 29, 29, 29, 29, 29, 29, 29, 68, 68, 68, 68, 68, 38, 38, 38, 37, 37, 37, 37,
+37, 37, 37, 37, 38, 38, 37, 37, 37, 38, 37, 68, 68, 68, 68, 17, 17, 17, 17, 17,
+40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 17, 17, 29, 17, 37, 68, 38, 38, 38, 37,
+37, 37, 37, 37, 37, 38, 37, 38, 38, 38, 38, 37, 37, 38, 37, 37, 68, 68, 17, 68,
+29, 29, 29, 29, 29, 29, 29, 29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 68, 38, 38, 38, 37, 37, 37, 37, 29, 29, 38, 38, 38, 38, 37, 37, 38, 37,
+37, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+17, 17, 17, 17, 68, 68, 68, 68, 37, 37, 29, 29, 38, 38, 38, 37, 37, 37, 37, 37,
+37, 37, 37, 38, 38, 37, 38, 37, 37, 17, 17, 17, 68, 29, 29, 29, 29, 29, 29, 29,
+29, 29, 29, 29, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 29, 29, 29,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 37, 38, 37, 38, 38, 37, 37, 37, 37,
+37, 37, 38, 37, 68, 17, 29, 29, 29, 29, 29, 29, 38, 38, 37, 37, 37, 37, 38, 37,
+37, 37, 37, 37, 29, 29, 29, 29, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 10, 10,
+17, 17, 17, 21, 37, 37, 37, 37, 37, 37, 37, 37, 38, 37, 37, 17, 29, 29, 29, 29,
+10, 10, 10, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 68, 68, 68, 68, 68,
+68, 68, 68, 29, 29, 68, 29, 29, 68, 68, 68, 68, 68, 68, 68, 68, 29, 68, 68, 29,
+68, 68, 68, 68, 68, 68, 68, 68, 38, 38, 38, 38, 38, 38, 29, 38, 38, 29, 29, 37,
+37, 38, 37, 68, 38, 68, 38, 37, 17, 17, 17, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+68, 68, 68, 68, 68, 68, 68, 68, 29, 29, 68, 68, 68, 68, 68, 68, 68, 38, 38, 38,
+37, 37, 37, 37, 29, 29, 37, 37, 38, 38, 38, 38, 37, 68, 17, 68, 38, 29, 29, 29,
+29, 29, 29, 29, 29, 29, 29, 29, 68, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 68,
+68, 68, 68, 68, 68, 68, 68, 37, 37, 37, 37, 37, 37, 38, 68, 37, 37, 37, 37, 17,
+17, 17, 17, 17, 17, 17, 17, 37, 29, 29, 29, 29, 29, 29, 29, 29, 68, 37, 37, 37,
+37, 37, 37, 38, 38, 37, 37, 37, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 38, 37, 37, 17, 17,
+17, 68, 17, 17, 17, 17, 17, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 29, 29, 29, 29, 29, 29, 37, 37, 37, 37,
+37, 37, 37, 29, 37, 37, 37, 37, 37, 37, 38, 37, 68, 17, 17, 17, 17, 17, 29, 29,
+29, 29, 29, 29, 29, 29, 29, 29, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+10, 29, 29, 29, 17, 17, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+29, 29, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+37, 37, 37, 37, 29, 38, 37, 37, 37, 37, 37, 37, 37, 38, 37, 37, 38, 37, 37, 29,
+29, 29, 29, 29, 29, 29, 29, 29, 68, 68, 68, 68, 68, 68, 68, 29, 68, 68, 29, 68,
+68, 68, 68, 68, 68, 37, 37, 37, 37, 37, 37, 29, 29, 29, 37, 29, 37, 37, 29, 37,
+37, 37, 37, 37, 37, 37, 68, 37, 29, 29, 29, 29, 29, 29, 29, 29, 68, 68, 68, 68,
+68, 68, 29, 68, 68, 29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 38, 38, 38, 38, 38, 29, 37, 37, 29, 38, 38, 37, 38, 37, 68, 29, 29, 29,
+29, 29, 29, 29, 68, 68, 68, 37, 37, 38, 38, 17, 17, 29, 29, 29, 29, 29, 29, 29,
+37, 37, 68, 38, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+38, 38, 37, 37, 37, 37, 37, 29, 29, 29, 38, 38, 37, 38, 37, 17, 17, 17, 17, 17,
+17, 17, 17, 17, 17, 17, 17, 17, 10, 10, 10, 10, 10, 21, 21, 21, 21, 21, 21, 21,
+21, 19, 19, 19, 19, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+21, 21, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 17, 73, 73, 73, 73,
+73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 29, 17, 17, 17, 17, 17, 29, 29, 29,
+29, 29, 29, 29, 29, 29, 29, 29, 68, 17, 17, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+29, 29, 29, 29, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+37, 68, 68, 68, 68, 68, 68, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+37, 37, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 37, 37, 37, 37, 37, 17, 29, 29,
+29, 29, 29, 29, 29, 29, 29, 29, 37, 37, 37, 37, 37, 37, 37, 17, 17, 17, 17, 17,
+21, 21, 21, 21, 67, 67, 67, 67, 17, 21, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 29, 10, 10, 10, 10, 10, 10, 10, 29, 68,
+68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+29, 29, 29, 29, 29, 68, 68, 68, 10, 10, 10, 10, 10, 10, 10, 17, 17, 17, 17, 29,
+29, 29, 29, 29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 29, 29, 29, 29, 37,
+68, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+29, 29, 29, 29, 29, 29, 29, 37, 37, 37, 37, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+67, 67, 67, 67, 67, 67, 17, 67, 37, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+38, 38, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 67, 67, 67, 67,
+29, 67, 67, 67, 67, 67, 67, 67, 29, 67, 67, 29, 68, 68, 68, 29, 29, 29, 29, 29,
+29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 68, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+29, 29, 29, 29, 68, 68, 68, 29, 29, 68, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+29, 29, 29, 29, 68, 68, 68, 68, 29, 29, 29, 29, 29, 29, 29, 29, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 29, 29, 21, 37, 37, 17, 26, 26, 26, 26, 29, 29, 29, 29,
+29, 29, 29, 29, 29, 29, 29, 29, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+37, 37, 29, 29, 37, 37, 37, 37, 37, 37, 37, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+21, 21, 21, 21, 21, 21, 21, 29, 29, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+21, 38, 38, 37, 37, 37, 21, 21, 21, 38, 38, 38, 38, 38, 38, 26, 26, 26, 26, 26,
+26, 26, 26, 37, 37, 37, 37, 37, 37, 37, 37, 21, 21, 37, 37, 37, 37, 37, 37, 37,
+21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 37, 37, 37, 37, 21, 21,
+21, 21, 37, 37, 37, 21, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 10, 10, 10, 10,
+29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 64, 64, 64, 64, 64, 64, 64, 64,
+64, 64, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 64, 64, 64, 64, 64, 64, 64, 64,
+64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 65, 65,
+65, 65, 65, 65, 65, 29, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 64, 64, 65, 65,
+65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+65, 65, 65, 65, 64, 29, 64, 64, 29, 29, 64, 29, 29, 64, 64, 29, 29, 64, 64, 64,
+64, 29, 64, 64, 64, 64, 64, 64, 64, 64, 65, 65, 65, 65, 29, 65, 29, 65, 65, 65,
+65, 65, 65, 65, 29, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+64, 64, 29, 64, 64, 64, 64, 29, 29, 64, 64, 64, 64, 64, 64, 64, 64, 29, 64, 64,
+64, 64, 64, 64, 64, 29, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 64, 64, 29, 64,
+64, 64, 64, 29, 64, 64, 64, 64, 64, 29, 64, 29, 29, 29, 64, 64, 64, 64, 64, 64,
+64, 29, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+65, 65, 65, 65, 65, 65, 65, 65, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 65, 65,
+65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 29, 29, 64, 64, 64, 64,
+64, 64, 64, 64, 64, 18, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 18, 65, 65, 65, 65, 65, 65, 64, 64,
+64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+64, 64, 64, 18, 65, 65, 65, 65, 65, 65, 65, 65, 65, 18, 65, 65, 65, 65, 65, 65,
+64, 64, 64, 64, 64, 64, 64, 64, 64, 18, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 18, 65, 65, 65, 65,
+65, 65, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+64, 64, 64, 64, 64, 64, 64, 18, 65, 65, 65, 65, 65, 65, 65, 65, 65, 18, 65, 65,
+65, 65, 65, 65, 64, 64, 64, 64, 64, 64, 64, 64, 64, 18, 65, 65, 65, 65, 65, 65,
+65, 65, 65, 18, 65, 65, 65, 65, 65, 65, 64, 65, 29, 29, 40, 40, 40, 40, 40, 40,
+40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 37, 37, 37, 37, 37, 37, 37, 21,
+21, 21, 21, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+37, 21, 21, 21, 21, 21, 21, 21, 21, 37, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+21, 21, 21, 21, 37, 21, 21, 17, 17, 17, 17, 17, 29, 29, 29, 29, 29, 29, 29, 29,
+29, 29, 29, 29, 29, 29, 29, 37, 37, 37, 37, 37, 29, 37, 37, 37, 37, 37, 37, 37,
+37, 37, 37, 37, 37, 37, 37, 37, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 68, 65,
+65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 29,
+29, 29, 29, 29, 29, 65, 65, 65, 65, 65, 65, 29, 29, 29, 29, 29, 37, 37, 37, 37,
+37, 37, 37, 29, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+37, 29, 29, 37, 37, 37, 37, 37, 37, 37, 29, 37, 37, 29, 37, 37, 37, 37, 37, 29,
+29, 29, 29, 29, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 29, 29,
+29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 37, 37, 37, 37, 37,
+37, 37, 37, 67, 67, 67, 67, 67, 67, 67, 29, 29, 40, 40, 40, 40, 40, 40, 40, 40,
+40, 40, 29, 29, 29, 29, 68, 21, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+68, 68, 37, 29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 37, 37, 37, 37,
+40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 29, 29, 29, 29, 29, 19, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 68, 67, 37, 37, 37, 37, 68, 68, 68, 68, 68, 68, 68, 29,
+68, 68, 68, 68, 29, 68, 68, 29, 68, 68, 68, 68, 68, 29, 29, 10, 10, 10, 10, 10,
+10, 10, 10, 10, 65, 65, 65, 65, 37, 37, 37, 37, 37, 37, 37, 67, 29, 29, 29, 29,
+10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 21, 10, 10, 10, 19, 10, 10, 10,
+10, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 10, 10, 10, 10, 10, 10, 10, 10,
+10, 10, 10, 10, 10, 10, 21, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+10, 10, 29, 29, 68, 68, 68, 68, 29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+29, 68, 68, 29, 68, 29, 29, 68, 29, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 29,
+68, 68, 68, 68, 29, 68, 29, 68, 29, 29, 29, 29, 29, 29, 68, 29, 29, 29, 29, 68,
+29, 68, 29, 68, 29, 68, 68, 68, 29, 68, 68, 29, 68, 29, 29, 68, 29, 68, 29, 68,
+29, 68, 29, 68, 29, 68, 68, 29, 68, 29, 29, 68, 68, 68, 68, 29, 68, 68, 68, 68,
+68, 68, 68, 29, 68, 68, 68, 68, 29, 68, 68, 68, 68, 29, 68, 29, 68, 68, 68, 68,
+68, 68, 68, 68, 68, 68, 29, 68, 68, 68, 68, 68, 29, 68, 68, 68, 29, 68, 68, 68,
+68, 68, 29, 68, 68, 68, 68, 68, 18, 18, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+29, 29, 29, 29, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 29, 29, 29, 29,
+29, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 10, 10, 10, 10,
+10, 10, 10, 10, 10, 10, 10, 10, 10, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+21, 21, 21, 21, 21, 21, 29, 29, 29, 29, 29, 29, 29, 29, 21, 21, 21, 21, 21, 21,
+21, 21, 21, 21, 21, 21, 21, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+21, 21, 21, 21, 21, 21, 21, 21, 21, 29, 29, 29, 29, 29, 29, 29, 21, 21, 29, 29,
+29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 21, 21, 21, 21, 21, 21, 21, 21,
+21, 21, 21, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 21, 29, 29, 29, 29,
+21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 29, 29, 29, 29, 21, 21, 21, 21, 21,
+21, 21, 21, 21, 21, 21, 21, 21, 29, 29, 29, 29, 29, 29, 29, 29, 21, 21, 21, 21,
+21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 29, 21, 21, 21, 21, 21, 21, 21, 29, 29,
+29, 29, 29, 29, 29, 29, 21, 21, 21, 21, 21, 29, 21, 21, 21, 21, 21, 21, 21, 21,
+21, 21, 21, 21, 29, 26, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 29, 29,
 };
 
-const uint16_t catTableIndex[] = {
-// catTable index 2
-0, 0, 16, 32, 48, 64, 80, 96, 0, 0, 112, 128, 144, 160, 176, 192, 208, 208, 208, 224,
-240, 208, 208, 256, 272, 288, 304, 320, 336, 352, 208, 368, 208, 208, 208, 384, 400, 176, 176, 176,
-176, 416, 176, 432, 448, 464, 480, 496, 512, 512, 512, 512, 512, 512, 512, 528, 544, 560, 576, 176,
-592, 608, 208, 624, 144, 144, 144, 176, 176, 176, 208, 208, 640, 208, 208, 208, 656, 208, 208, 208,
-208, 208, 208, 672, 144, 688, 176, 176, 704, 720, 512, 736, 752, 768, 784, 800, 816, 832, 768, 768,
-848, 512, 864, 880, 768, 768, 768, 768, 768, 896, 912, 928, 944, 960, 768, 512, 976, 768, 768, 768,
-768, 768, 992, 1008, 1024, 768, 1040, 1056, 768, 1072, 1088, 1104, 768, 1120, 1136, 768, 1152, 1168, 768, 768,
-1184, 512, 1200, 512, 1216, 768, 768, 1232, 1248, 1264, 1280, 1296, 1312, 1328, 1344, 1360, 1376, 1392, 1408, 1424,
-1440, 1328, 1344, 1456, 1472, 1488, 1504, 1520, 1536, 1552, 1344, 1568, 1584, 1600, 1408, 1616, 1632, 1328, 1344, 1648,
-1664, 1680, 1408, 1696, 1712, 1728, 1744, 1760, 1776, 1792, 1504, 1808, 1824, 1840, 1344, 1856, 1872, 1888, 1408, 1904,
-1920, 1840, 1344, 1936, 1952, 1968, 1408, 1984, 2000, 1840, 768, 2016, 2032, 2048, 1408, 2064, 2080, 2096, 768, 2112,
-2128, 2144, 1504, 2160, 2176, 768, 768, 2192, 2208, 2224, 2240, 2240, 2256, 768, 2272, 2288, 2304, 2320, 2240, 2240,
-2336, 2352, 2368, 2384, 2400, 768, 2416, 2432, 2448, 2464, 512, 2480, 2496, 2512, 2240, 2240, 768, 768, 2528, 2544,
-2560, 2576, 2592, 2608, 2624, 2640, 144, 144, 2656, 176, 176, 2672, 768, 768, 768, 768, 768, 768, 768, 768,
-768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 2688, 2704, 768, 768, 2688, 768, 768, 2720,
-2736, 2752, 768, 768, 768, 2736, 768, 768, 768, 2768, 2784, 2800, 768, 2816, 144, 144, 144, 144, 144, 2832,
-2848, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
-768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 2864, 768,
-2880, 2896, 768, 768, 768, 768, 2912, 2928, 768, 2944, 768, 2960, 768, 2976, 2992, 3008, 768, 768, 768, 3024,
-3040, 3056, 3072, 3088, 3104, 3072, 768, 768, 3120, 768, 768, 3136, 3152, 768, 3168, 768, 768, 768, 768, 3184,
-768, 3200, 3216, 3232, 3248, 768, 3264, 3280, 768, 768, 3296, 768, 3312, 3328, 3344, 3344, 768, 3360, 768, 768,
-768, 3376, 3392, 3408, 3072, 3072, 3424, 3440, 3456, 2240, 2240, 2240, 3472, 768, 768, 3488, 3504, 2560, 3520, 3536,
-3552, 768, 3568, 1024, 768, 768, 3584, 3600, 768, 768, 3616, 3632, 3648, 1024, 768, 3664, 3680, 144, 144, 3696,
-3712, 3728, 3744, 3760, 176, 176, 3776, 432, 432, 432, 3792, 3808, 176, 3824, 432, 432, 512, 512, 512, 512,
-208, 208, 208, 208, 208, 208, 208, 208, 208, 3840, 208, 208, 208, 208, 208, 208, 3856, 3872, 3856, 3856,
-3872, 3888, 3856, 3904, 3920, 3920, 3920, 3936, 3952, 3968, 3984, 4000, 4016, 4032, 4048, 4064, 4080, 4096, 4112, 4128,
-4144, 4160, 4176, 4176, 4192, 4208, 4224, 4240, 4256, 4272, 4288, 4304, 4320, 4336, 4352, 4352, 4368, 4384, 4400, 3344,
-4416, 4432, 3344, 4448, 4464, 4464, 4464, 4464, 4464, 4464, 4464, 4464, 4464, 4464, 4464, 4464, 4464, 4464, 4464, 4464,
-4480, 3344, 4496, 3344, 3344, 3344, 3344, 4512, 3344, 4528, 4464, 4544, 3344, 4560, 4576, 3344, 3344, 3344, 4592, 2240,
-4608, 2240, 4336, 4336, 4336, 4624, 3344, 3344, 3344, 3344, 4640, 4336, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344,
-3344, 3344, 3344, 4656, 4672, 3344, 3344, 4688, 3344, 3344, 3344, 3344, 3344, 3344, 4704, 3344, 3344, 3344, 3344, 3344,
-3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 4720, 4736, 4336, 4752, 3344, 3344, 4768, 4464, 4784, 4464,
-3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 4464, 4464, 4464, 4464,
-4464, 4464, 4464, 4464, 4800, 4816, 4464, 4464, 4464, 4832, 4464, 4848, 4464, 4464, 4464, 4464, 4464, 4464, 4464, 4464,
-4464, 4464, 4464, 4464, 4464, 4464, 4464, 4464, 3344, 3344, 3344, 4464, 4864, 3344, 3344, 4880, 3344, 4896, 3344, 3344,
-3344, 3344, 3344, 3344, 144, 144, 144, 176, 176, 176, 4912, 4928, 208, 208, 208, 208, 208, 208, 4944, 4960,
-176, 176, 4976, 768, 768, 768, 4992, 5008, 768, 5024, 5040, 5040, 5040, 5040, 512, 512, 5056, 5072, 5088, 5104,
-5120, 5136, 2240, 2240, 3344, 5152, 3344, 3344, 3344, 3344, 3344, 5168, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344,
-3344, 3344, 3344, 3344, 3344, 5184, 2240, 3344, 5200, 5216, 5232, 5248, 2176, 768, 768, 768, 768, 5264, 2848, 768,
-768, 768, 768, 5280, 5296, 768, 768, 2176, 768, 768, 768, 768, 3200, 5312, 768, 768, 3344, 3344, 5328, 768,
-3344, 5344, 5360, 3344, 5376, 5392, 3344, 3344, 5360, 3344, 3344, 5392, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344,
-3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 768, 768, 768, 768, 768, 768, 768, 768,
-768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
-768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
-768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 3344, 3344, 3344, 3344, 768, 5408, 768, 768,
-768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
-768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 2416, 3344, 3344, 3344,
-4592, 768, 768, 3664, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
-5424, 768, 5440, 2240, 208, 208, 5456, 5472, 208, 5488, 768, 768, 768, 768, 5504, 5520, 496, 5536, 5552, 5568,
-208, 208, 208, 5584, 5600, 5616, 5632, 5648, 5664, 5680, 2240, 5696, 5712, 768, 5728, 5744, 768, 768, 768, 5760,
-5776, 768, 768, 5792, 5808, 3072, 512, 5824, 1024, 768, 5840, 768, 5856, 5872, 768, 2416, 1216, 768, 768, 5888,
-5904, 5920, 5936, 5952, 768, 768, 5968, 5984, 6000, 6016, 768, 6032, 768, 768, 768, 6048, 6064, 6080, 6096, 6112,
-6128, 6144, 5040, 176, 176, 6160, 6176, 176, 176, 176, 176, 176, 768, 768, 6192, 3072, 768, 768, 768, 768,
-768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
-768, 768, 6208, 768, 6224, 768, 768, 3296, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240,
-6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240, 6240,
-6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256,
-6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256,
-6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
-768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 3264, 768, 768, 768, 768, 768, 768, 3312, 2240, 2240,
-6272, 6288, 6304, 6320, 6336, 768, 768, 768, 768, 768, 768, 6352, 6368, 6384, 768, 768, 768, 768, 768, 768,
-768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 6400, 3344, 768, 768, 768,
-768, 6416, 768, 768, 6432, 2240, 2240, 6448, 512, 6464, 512, 6480, 6496, 6512, 6528, 6544, 768, 768, 768, 768,
-768, 768, 768, 6560, 6576, 32, 48, 64, 80, 6592, 6608, 6624, 768, 6640, 768, 3200, 6656, 6672, 6688, 6704,
-6720, 768, 2752, 6736, 3264, 3264, 2240, 2240, 768, 768, 768, 768, 768, 768, 768, 1136, 6752, 4336, 4336, 6768,
-4352, 4352, 4352, 6784, 6800, 6816, 6832, 2240, 2240, 3344, 3344, 6848, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240,
-768, 2416, 768, 768, 768, 1600, 6864, 6880, 768, 768, 6896, 768, 6912, 768, 768, 6928, 768, 6944, 768, 768,
-6960, 6976, 2240, 2240, 144, 144, 6992, 176, 176, 768, 768, 768, 768, 3264, 3072, 144, 144, 7008, 176, 7024,
-768, 768, 7040, 768, 768, 768, 7056, 7072, 7072, 7088, 7104, 7120, 2240, 2240, 2240, 2240, 768, 768, 768, 768,
-768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 5024, 768, 3184, 7040, 2240,
-7136, 432, 432, 7152, 2240, 2240, 2240, 2240, 7168, 768, 768, 7184, 768, 7200, 768, 7216, 768, 3200, 7232, 2240,
-2240, 2240, 768, 7248, 768, 7264, 768, 7280, 2240, 2240, 2240, 2240, 768, 768, 768, 7296, 4336, 7312, 4336, 4336,
-7328, 7344, 768, 7360, 7376, 7392, 768, 7408, 768, 7424, 2240, 2240, 7440, 768, 7456, 7472, 768, 768, 768, 7488,
-768, 7504, 768, 7520, 768, 7536, 7552, 2240, 2240, 2240, 2240, 2240, 768, 768, 768, 768, 3136, 2240, 2240, 2240,
-144, 144, 144, 7568, 176, 176, 176, 7584, 768, 768, 7600, 3072, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240,
-2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 4336, 7616, 768, 768, 7632, 7648, 2240, 2240, 2240, 7664,
-768, 7424, 7680, 768, 992, 7696, 2240, 768, 7712, 2240, 2240, 768, 7728, 2240, 768, 5024, 7744, 768, 768, 7760,
-7776, 7312, 7792, 7808, 3552, 768, 768, 7824, 7840, 768, 3136, 3072, 7856, 768, 7872, 7888, 7904, 768, 768, 7920,
-3552, 768, 768, 7936, 7952, 7968, 7984, 8000, 768, 1552, 8016, 8032, 8048, 2240, 2240, 2240, 8064, 8080, 8096, 768,
-768, 8112, 8128, 3072, 8144, 1328, 1344, 8160, 8176, 8192, 8208, 8224, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240,
-768, 768, 768, 8240, 8256, 8272, 7648, 2240, 768, 768, 768, 8288, 8304, 3072, 2240, 2240, 2240, 2240, 2240, 2240,
-2240, 2240, 2240, 2240, 768, 768, 8320, 8336, 8352, 8368, 2240, 2240, 768, 768, 768, 8384, 8400, 3072, 8416, 2240,
-768, 768, 8432, 8448, 3072, 2240, 2240, 2240, 768, 2768, 8464, 8480, 5024, 2240, 2240, 2240, 2240, 2240, 2240, 2240,
-2240, 2240, 2240, 2240, 768, 768, 8016, 8496, 2240, 2240, 2240, 2240, 2240, 2240, 144, 144, 176, 176, 2368, 8512,
-8528, 8544, 768, 8560, 8576, 3072, 2240, 2240, 2240, 2240, 8592, 768, 768, 8608, 8624, 2240, 8640, 768, 768, 8656,
-8672, 8688, 768, 768, 8704, 8720, 8736, 768, 768, 768, 768, 3136, 8752, 2240, 2240, 2240, 2240, 2240, 2240, 2240,
-2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 1344, 768, 8320, 8768, 8784, 2368, 2800, 8800, 768, 8816, 8832, 8848,
-2240, 2240, 2240, 2240, 8864, 768, 768, 8880, 8896, 3072, 8912, 768, 8928, 8944, 3072, 2240, 2240, 2240, 2240, 2240,
-2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 768, 8960, 8976, 1840, 768, 8992,
-9008, 3072, 2240, 2240, 2240, 2240, 2240, 1600, 4336, 9024, 9040, 9056, 768, 768, 768, 768, 768, 768, 768, 768,
-768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 3312, 2240, 2240,
-2240, 2240, 2240, 2240, 4352, 4352, 4352, 4352, 4352, 4352, 9072, 9088, 768, 768, 768, 768, 768, 768, 768, 768,
-768, 768, 768, 768, 6208, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240,
-2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240,
-2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240,
-2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 768, 768, 768, 768, 768, 768, 9104,
-768, 768, 768, 9120, 9136, 9152, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240,
-2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 768, 768, 768, 768, 5024, 2240, 2240, 2240,
-2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240,
-2240, 2240, 2240, 2240, 768, 768, 768, 3136, 768, 3200, 5920, 768, 768, 768, 768, 3200, 3072, 768, 3264, 9168,
-768, 768, 768, 9184, 9200, 9216, 9232, 9248, 768, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240,
-144, 144, 176, 176, 4336, 9264, 2240, 2240, 2240, 2240, 2240, 2240, 768, 768, 768, 768, 9280, 9296, 9312, 9312,
-9328, 9344, 2240, 2240, 2240, 2240, 9360, 9376, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
-768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 7040,
-768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 3184, 2240, 2240, 3136, 2240, 2240, 2240,
-2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240,
-2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240,
-2240, 2240, 2240, 9392, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
-768, 768, 9408, 9424, 2240, 9440, 9456, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
-768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 3296, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240,
-2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 768, 768, 768, 768, 768, 768, 1136, 2416, 3136, 9472, 9488, 2240,
-2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240,
-2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 512, 512, 9504, 512,
-9520, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 5168, 2240, 2240, 2240, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344,
-3344, 3344, 3344, 3344, 3344, 3344, 3344, 5184, 3344, 3344, 9536, 3344, 3344, 3344, 9552, 9568, 9584, 3344, 9600, 3344,
-3344, 3344, 4608, 2240, 3344, 3344, 3344, 3344, 9616, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 4336, 9632, 4336, 9632,
-3344, 3344, 3344, 3344, 3344, 4592, 4336, 7376, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 144, 9648, 176, 9664,
-9680, 9696, 3856, 144, 9712, 9728, 9744, 9760, 9776, 144, 9648, 176, 9792, 9808, 176, 9824, 9840, 9856, 9872, 144,
-9888, 176, 144, 9648, 176, 9664, 9680, 176, 3856, 144, 9712, 9872, 144, 9888, 176, 144, 9648, 176, 9904, 144,
-9920, 9936, 9952, 9968, 176, 9984, 144, 10000, 10016, 10032, 10048, 176, 10064, 144, 10080, 176, 10096, 10112, 10112, 10112,
-3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344,
-3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 512, 512, 512, 10128, 512, 512, 10144, 10160,
-10176, 10192, 720, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240,
-2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240,
-10208, 10224, 10240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 10256, 10272, 10288, 432,
-432, 432, 10304, 2240, 10320, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 768, 768, 2416, 10336, 10352, 2240, 2240, 2240,
-2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 768, 10368, 2240,
-768, 768, 10384, 10400, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240,
-2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 768, 10416, 3072, 2240, 2240, 2240, 2240,
-2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240,
-2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240,
-2240, 2240, 10432, 3200, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 10448, 9520, 2240, 2240,
-144, 144, 9712, 176, 10464, 5920, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240,
-2240, 2240, 2240, 7984, 4336, 4336, 10480, 10496, 2240, 2240, 2240, 2240, 7984, 4336, 10512, 10528, 2240, 2240, 2240, 2240,
-2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 10544, 768, 10560, 10576, 10592, 10608, 10624, 10640, 10656, 3296, 10672, 3296,
-2240, 2240, 2240, 10688, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240,
-3344, 3344, 10704, 3344, 3344, 3344, 3344, 3344, 3344, 5168, 5344, 10720, 10720, 10720, 3344, 5184, 10736, 3344, 3344, 3344,
-3344, 3344, 3344, 3344, 3344, 3344, 10752, 2240, 2240, 2240, 10768, 3344, 10784, 3344, 3344, 10704, 10800, 10816, 5184, 2240,
-2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344,
-3344, 3344, 3344, 10832, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 10848, 6816, 6816,
-3344, 3344, 3344, 3344, 3344, 3344, 3344, 10864, 3344, 3344, 3344, 3344, 3344, 2816, 10704, 6832, 10704, 3344, 3344, 3344,
-10880, 2816, 3344, 3344, 10880, 3344, 10752, 10816, 2240, 2240, 2240, 2240, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344,
-3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 5168, 10752, 6816, 10800, 3344, 3344, 10896,
-10912, 10704, 10800, 10800, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 3344, 10928, 3344, 3344, 4608, 2240, 2240, 3072,
-768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 2240, 2240, 768, 768, 768, 768,
-768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
-768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 3312, 768, 768, 768, 768, 768, 768, 768, 768,
-768, 768, 768, 768, 768, 3264, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
-768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
-768, 768, 768, 768, 768, 768, 7648, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
-768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
-768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 1600, 768,
-768, 768, 768, 768, 768, 3264, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240,
-2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 768, 3264, 2240, 2240, 2240, 2240, 2240, 2240,
-2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240, 2240,
-2240, 2240, 2240, 2240, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
-768, 768, 768, 768, 1136, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
-768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
-768, 768, 768, 2240, 2240, 2240, 2240, 2240, 10944, 2240, 9120, 9120, 9120, 9120, 9120, 9120, 2240, 2240, 2240, 2240,
-2240, 2240, 2240, 2240, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 512, 2240,
-6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256,
-6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 6256, 10960,
+const uint16_t CharacterPropertyTableIndex[] = {
+// CharacterPropertyTable index 2
+0, 16, 32, 48, 0, 64, 80, 0, 96, 112, 0, 0, 128, 144, 160, 144, 176, 0, 0, 192,
+208, 224, 240, 256, 272, 288, 304, 320, 336, 352, 368, 384, 400, 288, 304, 416, 432, 448, 464, 480,
+496, 512, 304, 528, 544, 560, 368, 576, 592, 288, 304, 608, 624, 640, 368, 656, 672, 688, 704, 720,
+736, 752, 464, 768, 784, 800, 304, 816, 832, 848, 368, 864, 880, 800, 304, 896, 912, 928, 368, 944,
+960, 800, 0, 976, 992, 1008, 368, 1024, 1040, 1056, 0, 1072, 1088, 1104, 464, 1120, 1136, 0, 0, 1152,
+1168, 1184, 1200, 1200, 1216, 0, 1232, 1248, 1264, 1280, 1200, 1200, 1296, 1312, 1328, 1344, 1360, 0, 1376, 1392,
+1408, 1424, 144, 1440, 1456, 1472, 1200, 1200, 0, 0, 1488, 1504, 1520, 1536, 1552, 1568, 1584, 1600, 1616, 1616,
+1632, 1648, 1648, 1664, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 1680, 1696, 0, 0, 1680, 0, 0, 1712, 1728, 1744, 0, 0, 0, 1728, 0, 0,
+0, 1760, 1776, 1792, 0, 1808, 1616, 1616, 1616, 1616, 1616, 1824, 1840, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1856, 0, 1872, 1888, 0, 0, 0, 0, 1904, 1920,
+0, 1936, 0, 1952, 0, 1968, 1984, 2000, 0, 0, 0, 2016, 2032, 2048, 2064, 2080, 2096, 2064, 0, 0,
+2112, 0, 0, 2128, 2144, 0, 2160, 0, 0, 0, 0, 2176, 0, 2192, 2208, 2224, 2240, 0, 2256, 2272,
+0, 0, 2288, 0, 2304, 2320, 2336, 2336, 0, 2352, 0, 0, 0, 2368, 2384, 2400, 2064, 2064, 2416, 2432,
+2448, 1200, 1200, 1200, 2464, 0, 0, 2480, 2496, 1520, 2512, 2528, 2544, 0, 2560, 2576, 0, 0, 2592, 2608,
+0, 0, 2624, 2640, 2656, 2576, 0, 2672, 2688, 1616, 1616, 2704, 2720, 2736, 2752, 2768, 1648, 1648, 2784, 2800,
+2800, 2800, 2816, 2832, 1648, 2848, 2800, 2800, 144, 144, 144, 144, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864,
+2864, 2880, 2864, 2864, 2864, 2864, 2864, 2864, 2896, 2912, 2896, 2896, 2912, 2928, 2896, 2944, 2960, 2960, 2960, 2976,
+2992, 3008, 3024, 3040, 3056, 3072, 3088, 3104, 3120, 3136, 3152, 3168, 3184, 3200, 3216, 3216, 3232, 3248, 3264, 3280,
+3296, 3312, 3328, 3344, 3360, 3376, 3392, 3392, 3408, 3424, 3440, 2336, 3456, 3472, 2336, 3488, 3504, 3504, 3504, 3504,
+3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3520, 2336, 3536, 2336, 2336, 2336, 2336, 3552,
+2336, 3568, 3504, 3584, 2336, 3600, 3616, 2336, 2336, 2336, 3632, 1200, 3648, 1200, 3376, 3376, 3376, 3664, 2336, 2336,
+2336, 2336, 3680, 3376, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 3696, 3712, 2336, 2336, 3728,
+2336, 2336, 2336, 2336, 2336, 2336, 3744, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336,
+2336, 2336, 3760, 3776, 3376, 3792, 2336, 2336, 3808, 3504, 3824, 3504, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336,
+2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3840, 3856, 3504, 3504,
+3504, 3872, 3504, 3888, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504, 3504,
+2336, 2336, 2336, 3504, 3904, 2336, 2336, 3920, 2336, 3936, 2336, 2336, 2336, 2336, 2336, 2336, 1616, 1616, 1616, 1648,
+1648, 1648, 3952, 3968, 2864, 2864, 2864, 2864, 2864, 2864, 3984, 4000, 1648, 1648, 4016, 0, 0, 0, 4032, 4048,
+0, 4064, 4080, 4080, 4080, 4080, 144, 144, 4096, 4112, 4128, 4144, 4160, 4176, 1200, 1200, 2336, 4192, 2336, 2336,
+2336, 2336, 2336, 4208, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 4224, 1200, 2336,
+4240, 4256, 4272, 4288, 1136, 0, 0, 0, 0, 4304, 1840, 0, 0, 0, 0, 4320, 4336, 0, 0, 1136,
+0, 0, 0, 0, 2192, 4352, 0, 0, 2336, 2336, 4368, 0, 2336, 4384, 4400, 2336, 4416, 4432, 2336, 2336,
+4400, 2336, 2336, 4432, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336,
+2336, 2336, 2336, 2336, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 2336, 2336, 2336, 2336, 0, 4448, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 1376, 2336, 2336, 2336, 3632, 0, 0, 2672, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4464, 0, 4480, 1200, 2864, 2864, 4496, 4512,
+2864, 4528, 0, 0, 0, 0, 4544, 4560, 4576, 4592, 4608, 4624, 2864, 2864, 2864, 4640, 4656, 4672, 4688, 4704,
+4720, 4736, 1200, 4752, 4768, 0, 4784, 4800, 0, 0, 0, 4816, 4832, 0, 0, 4848, 4864, 2064, 144, 4880,
+2576, 0, 4896, 0, 4912, 4928, 0, 1376, 176, 0, 0, 4944, 4960, 4976, 4992, 5008, 0, 0, 5024, 5040,
+5056, 5072, 0, 5088, 0, 0, 0, 5104, 5120, 5136, 5152, 5168, 5184, 5200, 4080, 1648, 1648, 5216, 5232, 1648,
+1648, 1648, 1648, 1648, 0, 0, 5248, 2064, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5264, 0, 5280, 0, 0, 2288,
+5296, 5296, 5296, 5296, 5296, 5296, 5296, 5296, 5296, 5296, 5296, 5296, 5296, 5296, 5296, 5296, 5296, 5296, 5296, 5296,
+5296, 5296, 5296, 5296, 5296, 5296, 5296, 5296, 5296, 5296, 5296, 5296, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312,
+5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312,
+5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 2256, 0, 0, 0, 0, 0, 0, 2304, 1200, 1200, 5328, 5344, 5360, 5376, 5392, 0, 0, 0,
+0, 0, 0, 5408, 5424, 5440, 0, 0, 0, 0, 0, 0, 0, 5456, 5472, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 5488, 2336, 0, 0, 0, 0, 5504, 0, 0, 5520, 1200, 1200, 5536,
+144, 5552, 144, 5568, 5584, 5600, 5616, 5632, 0, 0, 0, 0, 0, 0, 0, 5648, 5664, 5680, 5696, 5712,
+5728, 5744, 5760, 5776, 0, 5792, 0, 2192, 5808, 5824, 5840, 5856, 5872, 0, 1744, 5888, 2256, 2256, 1200, 1200,
+0, 0, 0, 0, 0, 0, 0, 80, 5904, 3376, 3376, 5920, 3392, 3392, 3392, 5936, 5952, 5968, 5984, 1200,
+1200, 2336, 2336, 6000, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 0, 1376, 0, 0, 0, 560, 6016, 6032,
+0, 0, 6048, 0, 6064, 0, 0, 6080, 0, 6096, 0, 0, 6112, 6128, 1200, 1200, 1616, 1616, 6144, 1648,
+1648, 0, 0, 0, 0, 2256, 2064, 1616, 1616, 6160, 1648, 6176, 0, 0, 6192, 0, 0, 0, 6208, 6224,
+6224, 6240, 6256, 6272, 1200, 1200, 1200, 1200, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 4064, 0, 2176, 6192, 1200, 6288, 2800, 2800, 6304, 1200, 1200, 1200, 1200,
+6320, 0, 0, 6336, 0, 6352, 0, 6368, 0, 2192, 6384, 1200, 1200, 1200, 0, 6400, 0, 6416, 0, 6432,
+1200, 1200, 1200, 1200, 0, 0, 0, 6448, 3376, 6464, 3376, 3376, 6480, 6496, 0, 6512, 6528, 6544, 0, 6560,
+0, 6576, 1200, 1200, 6592, 0, 6608, 6624, 0, 0, 0, 6640, 0, 6656, 0, 6672, 0, 6688, 6704, 1200,
+1200, 1200, 1200, 1200, 0, 0, 0, 0, 2128, 1200, 1200, 1200, 1616, 1616, 1616, 6720, 1648, 1648, 1648, 6736,
+0, 0, 6752, 2064, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
+1200, 1200, 3376, 6768, 0, 0, 6784, 6800, 1200, 1200, 1200, 6816, 0, 6576, 6832, 0, 6848, 6864, 1200, 0,
+6880, 1200, 1200, 0, 6896, 1200, 0, 4064, 6912, 0, 0, 6928, 6944, 6464, 6960, 6976, 2544, 0, 0, 6992,
+7008, 0, 2128, 2064, 7024, 0, 7040, 7056, 7072, 0, 0, 7088, 2544, 0, 0, 7104, 7120, 7136, 7152, 7168,
+0, 512, 7184, 7200, 7216, 1200, 1200, 1200, 7232, 7248, 7264, 0, 0, 7280, 7296, 2064, 7312, 288, 304, 7328,
+7344, 7360, 7376, 7392, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 0, 0, 0, 7408, 7424, 7440, 6800, 1200,
+0, 0, 0, 7456, 7472, 2064, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 0, 0, 7488, 7504,
+7520, 7536, 1200, 1200, 0, 0, 0, 7552, 7568, 2064, 7584, 1200, 0, 0, 7600, 7616, 2064, 1200, 1200, 1200,
+0, 1760, 7632, 7648, 4064, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 0, 0, 7184, 7664,
+1200, 1200, 1200, 1200, 1200, 1200, 1616, 1616, 1648, 1648, 1328, 7680, 7696, 7712, 0, 7728, 7744, 2064, 1200, 1200,
+1200, 1200, 7760, 0, 0, 7776, 7792, 1200, 7808, 0, 0, 7824, 7840, 7856, 0, 0, 7872, 7888, 7904, 0,
+0, 0, 0, 2128, 7920, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
+304, 0, 7488, 7936, 7952, 1328, 7968, 7984, 0, 8000, 8016, 8032, 1200, 1200, 1200, 1200, 8048, 0, 0, 8064,
+8080, 2064, 8096, 0, 8112, 8128, 2064, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
+1200, 1200, 1200, 1200, 1200, 1200, 0, 8144, 8160, 800, 0, 8176, 8192, 2064, 1200, 1200, 1200, 1200, 1200, 560,
+3376, 8208, 8224, 8240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 2304, 1200, 1200, 1200, 1200, 1200, 1200, 3392, 3392, 3392, 3392,
+3392, 3392, 8256, 8272, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5264, 1200, 1200, 1200,
+1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
+1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
+1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
+1200, 1200, 1200, 1200, 1200, 0, 0, 0, 0, 0, 0, 8288, 0, 0, 0, 8304, 8320, 8336, 1200, 1200,
+1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
+1200, 1200, 1200, 1200, 0, 0, 0, 0, 4064, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
+1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 0, 0, 0, 2128,
+0, 2192, 4976, 0, 0, 0, 0, 2192, 2064, 0, 2256, 8352, 0, 0, 0, 8368, 8384, 8400, 8416, 8432,
+0, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1616, 1616, 1648, 1648, 3376, 8448, 1200, 1200,
+1200, 1200, 1200, 1200, 0, 0, 0, 0, 8464, 8480, 8496, 8496, 8512, 8528, 1200, 1200, 1200, 1200, 8544, 8560,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6192, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 2176, 1200, 1200, 2128, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
+1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
+1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 8576, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8592, 8608, 1200, 8624, 8640, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 2288, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
+0, 0, 0, 0, 0, 0, 80, 1376, 2128, 8656, 8672, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
+1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
+1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 144, 144, 8688, 144, 8704, 2336, 2336, 2336, 2336, 2336, 2336, 2336,
+4208, 1200, 1200, 1200, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 4224,
+2336, 2336, 8720, 2336, 2336, 2336, 8736, 8752, 8768, 2336, 8784, 2336, 2336, 2336, 3648, 1200, 2336, 2336, 2336, 2336,
+8800, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 3376, 8816, 3376, 8816, 2336, 2336, 2336, 2336, 2336, 3632, 3376, 6528,
+1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1616, 8832, 1648, 8848, 8864, 8880, 2896, 1616, 8896, 8912, 8928, 8944,
+8960, 1616, 8832, 1648, 8976, 8992, 1648, 9008, 9024, 9040, 9056, 1616, 9072, 1648, 1616, 8832, 1648, 8848, 8864, 1648,
+2896, 1616, 8896, 9056, 1616, 9072, 1648, 1616, 8832, 1648, 9088, 1616, 9104, 9120, 9136, 9152, 1648, 9168, 1616, 9184,
+9200, 9216, 9232, 1648, 9248, 1616, 9264, 1648, 9280, 9296, 9296, 9296, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336,
+2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336,
+2336, 2336, 2336, 2336, 144, 144, 144, 9312, 144, 144, 9328, 9344, 9360, 9376, 9392, 1200, 1200, 1200, 1200, 1200,
+1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
+1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 9408, 9424, 9440, 1200, 1200, 1200, 1200, 1200,
+1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 9456, 9472, 9488, 2800, 2800, 2800, 9504, 1200, 9520, 1200, 1200, 1200,
+1200, 1200, 1200, 1200, 0, 0, 1376, 9536, 9552, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
+1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 0, 9568, 1200, 0, 0, 9584, 9600, 1200, 1200, 1200, 1200,
+1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
+1200, 1200, 1200, 1200, 1200, 0, 9616, 2064, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
+1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
+1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 9632, 2192, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 9648, 8704, 1200, 1200, 1616, 1616, 8896, 1648, 9664, 4976, 1200, 1200,
+1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 7152, 3376, 3376, 9680, 9696,
+1200, 1200, 1200, 1200, 7152, 3376, 9712, 9728, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
+9744, 0, 9760, 9776, 9792, 9808, 9824, 9840, 9856, 2288, 9872, 2288, 1200, 1200, 1200, 9888, 1200, 1200, 1200, 1200,
+1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 2336, 2336, 9904, 2336, 2336, 2336, 2336, 2336,
+2336, 4208, 4384, 9920, 9920, 9920, 2336, 4224, 9936, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 9952, 1200,
+1200, 1200, 9968, 2336, 9984, 2336, 2336, 9904, 10000, 10016, 4224, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
+2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 10032, 2336, 2336, 2336, 2336,
+2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 10048, 5968, 5968, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 10064,
+2336, 2336, 2336, 2336, 2336, 1808, 9904, 5984, 9904, 2336, 2336, 2336, 10080, 1808, 2336, 2336, 10080, 2336, 9952, 10016,
+1200, 1200, 1200, 1200, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336, 2336,
+2336, 2336, 2336, 2336, 2336, 4208, 9952, 5968, 10000, 2336, 2336, 10096, 10112, 9904, 10000, 10000, 2336, 2336, 2336, 2336,
+2336, 2336, 2336, 2336, 2336, 10128, 2336, 2336, 3648, 1200, 1200, 2064, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 1200, 1200, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 2304, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2256, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6800, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 560, 0, 0, 0, 0, 0, 0, 2256, 1200, 1200,
+1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
+1200, 1200, 1200, 1200, 0, 2256, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,
+1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1200, 1200, 1200, 1200, 1200,
+10144, 1200, 8304, 8304, 8304, 8304, 8304, 8304, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200, 144, 144, 144, 144,
+144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 1200, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312,
+5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312, 5312,
+5312, 5312, 5312, 10160,
 };
 
 const uint16_t CatTableRLE_BMP[] = {
@@ -752,192 +1085,30 @@ const uint16_t CatTableRLE_BMP[] = {
 50, 45, 46, 49, 45, 46, 81, 324, 35, 1444, 67, 996, 125, 196, 93, 196, 93, 196, 93, 100,
 125, 83, 50, 52, 53, 83, 61, 53, 146, 85, 349, 122, 85, 93,
 };
-
-#endif
 //--Autogenerated -- end of section automatically generated
 
-constexpr int maxUnicode = 0x10ffff;
-constexpr int maskCategory = 0x1F;
+constexpr uint32_t maxUnicode = 0x10ffff;
 
-}
-
-#if CharacterCategoryUseRangeList
-// Each element in catRanges is the start of a range of Unicode characters in
-// one general category.
-// The value is comprised of a 21-bit character value shifted 5 bits and a 5 bit
-// category matching the CharacterCategory enumeration.
-// Initial version has 3249 entries and adds about 13K to the executable.
-// The array is in ascending order so can be searched using binary search.
-// Therefore the average call takes log2(3249) = 12 comparisons.
-// For speed, it may be useful to make a linear table for the common values,
-// possibly for 0..0xff for most Western European text or 0..0xfff for most
-// alphabetic languages.
-
-CharacterCategory CategoriseCharacter(int character) noexcept {
-	if (character < 0 || character > maxUnicode) {
-		return ccCn;
-	}
-	const int baseValue = character * (maskCategory + 1) + maskCategory;
-	const int *placeAfter = std::lower_bound(catRanges, std::end(catRanges), baseValue);
-	return static_cast<CharacterCategory>(*(placeAfter - 1) & maskCategory);
-}
-
-#else
 //function++Autogenerated -- start of section automatically generated
-CharacterCategory CategoriseCharacter(int character) noexcept {
-	if (character < 0 || character > maxUnicode) {
-		return ccCn;
-	}
-	character = (catTable[character >> 9] << 8) | (character & 511);
-	character = catTableIndex[character >> 4] | (character & 15);
-	character = (catTable[(character >> 1) + 2176] << 1) | (character & 1);
-	return static_cast<CharacterCategory>(catTable[character + 7664]);
-}
-//function--Autogenerated -- end of section automatically generated
-#endif
-
-// Implementation of character sets recommended for identifiers in Unicode Standard Annex #31.
-// https://unicode.org/reports/tr31/
-
-namespace {
-
-enum class OtherID { oidNone, oidStart, oidContinue };
-
-// Some characters are treated as valid for identifiers even
-// though most characters from their category are not.
-// Values copied from https://www.unicode.org/Public/12.1.0/ucd/PropList.txt
-OtherID OtherIDOfCharacter(int character) noexcept {
-	if (
-		(character == 0x1885) ||	// MONGOLIAN LETTER ALI GALI BALUDA
-		(character == 0x1886) ||	// MONGOLIAN LETTER ALI GALI THREE BALUDA
-		(character == 0x2118) ||	// SCRIPT CAPITAL P
-		(character == 0x212E) ||	// ESTIMATED SYMBOL
-		(character == 0x309B) ||	// KATAKANA-HIRAGANA VOICED SOUND MARK
-		(character == 0x309C)) {	// KATAKANA-HIRAGANA SEMI-VOICED SOUND MARK
-		return OtherID::oidStart;
-	}
-	if (
-		(character == 0x00B7) ||	// MIDDLE DOT
-		(character == 0x0387) ||	// GREEK ANO TELEIA
-		((character >= 0x1369) && (character <= 0x1371)) ||	// ETHIOPIC DIGIT ONE..ETHIOPIC DIGIT NINE
-		(character == 0x19DA)) {	// NEW TAI LUE THAM DIGIT ONE
-		return OtherID::oidContinue;
-	}
-	return OtherID::oidNone;
-}
-
-// Determine if a character is in  Ll|Lu|Lt|Lm|Lo|Nl|Mn|Mc|Nd|Pc and has
-// Pattern_Syntax|Pattern_White_Space.
-// As of Unicode 12, only VERTICAL TILDE which is in Lm and has Pattern_Syntax matches.
-// Should really generate from PropList.txt a list of Pattern_Syntax and Pattern_White_Space.
-constexpr bool IsIdPattern(int character) noexcept {
-	return character == 0x2E2F;
-}
-
-bool OmitXidStart(int character) noexcept {
-	switch (character) {
-	case 0x037A:	// GREEK YPOGEGRAMMENI
-	case 0x0E33:	// THAI CHARACTER SARA AM
-	case 0x0EB3:	// LAO VOWEL SIGN AM
-	case 0x309B:	// KATAKANA-HIRAGANA VOICED SOUND MARK
-	case 0x309C:	// KATAKANA-HIRAGANA SEMI-VOICED SOUND MARK
-	case 0xFC5E:	// ARABIC LIGATURE SHADDA WITH DAMMATAN ISOLATED FORM
-	case 0xFC5F:	// ARABIC LIGATURE SHADDA WITH KASRATAN ISOLATED FORM
-	case 0xFC60:	// ARABIC LIGATURE SHADDA WITH FATHA ISOLATED FORM
-	case 0xFC61:	// ARABIC LIGATURE SHADDA WITH DAMMA ISOLATED FORM
-	case 0xFC62:	// ARABIC LIGATURE SHADDA WITH KASRA ISOLATED FORM
-	case 0xFC63:	// ARABIC LIGATURE SHADDA WITH SUPERSCRIPT ALEF ISOLATED FORM
-	case 0xFDFA:	// ARABIC LIGATURE SALLALLAHOU ALAYHE WASALLAM
-	case 0xFDFB:	// ARABIC LIGATURE JALLAJALALOUHOU
-	case 0xFE70:	// ARABIC FATHATAN ISOLATED FORM
-	case 0xFE72:	// ARABIC DAMMATAN ISOLATED FORM
-	case 0xFE74:	// ARABIC KASRATAN ISOLATED FORM
-	case 0xFE76:	// ARABIC FATHA ISOLATED FORM
-	case 0xFE78:	// ARABIC DAMMA ISOLATED FORM
-	case 0xFE7A:	// ARABIC KASRA ISOLATED FORM
-	case 0xFE7C:	// ARABIC SHADDA ISOLATED FORM
-	case 0xFE7E:	// ARABIC SUKUN ISOLATED FORM
-	case 0xFF9E:	// HALFWIDTH KATAKANA VOICED SOUND MARK
-	case 0xFF9F:	// HALFWIDTH KATAKANA SEMI-VOICED SOUND MARK
-		return true;
-	default:
-		return false;
+inline CharacterProperty LookupCharacterProperty(uint32_t ch) noexcept {
+	if (ch < sizeof(CharacterPropertyLatin)) {
+		return CharacterPropertyLatin[ch];
 	}
-}
-
-bool OmitXidContinue(int character) noexcept {
-	switch (character) {
-	case 0x037A:	// GREEK YPOGEGRAMMENI
-	case 0x309B:	// KATAKANA-HIRAGANA VOICED SOUND MARK
-	case 0x309C:	// KATAKANA-HIRAGANA SEMI-VOICED SOUND MARK
-	case 0xFC5E:	// ARABIC LIGATURE SHADDA WITH DAMMATAN ISOLATED FORM
-	case 0xFC5F:	// ARABIC LIGATURE SHADDA WITH KASRATAN ISOLATED FORM
-	case 0xFC60:	// ARABIC LIGATURE SHADDA WITH FATHA ISOLATED FORM
-	case 0xFC61:	// ARABIC LIGATURE SHADDA WITH DAMMA ISOLATED FORM
-	case 0xFC62:	// ARABIC LIGATURE SHADDA WITH KASRA ISOLATED FORM
-	case 0xFC63:	// ARABIC LIGATURE SHADDA WITH SUPERSCRIPT ALEF ISOLATED FORM
-	case 0xFDFA:	// ARABIC LIGATURE SALLALLAHOU ALAYHE WASALLAM
-	case 0xFDFB:	// ARABIC LIGATURE JALLAJALALOUHOU
-	case 0xFE70:	// ARABIC FATHATAN ISOLATED FORM
-	case 0xFE72:	// ARABIC DAMMATAN ISOLATED FORM
-	case 0xFE74:	// ARABIC KASRATAN ISOLATED FORM
-	case 0xFE76:	// ARABIC FATHA ISOLATED FORM
-	case 0xFE78:	// ARABIC DAMMA ISOLATED FORM
-	case 0xFE7A:	// ARABIC KASRA ISOLATED FORM
-	case 0xFE7C:	// ARABIC SHADDA ISOLATED FORM
-	case 0xFE7E:	// ARABIC SUKUN ISOLATED FORM
-		return true;
-	default:
-		return false;
-	}
-}
-
-}
-
-// UAX #31 defines ID_Start as
-// [[:L:][:Nl:][:Other_ID_Start:]--[:Pattern_Syntax:]--[:Pattern_White_Space:]]
-bool IsIdStart(int character) noexcept {
-	if (IsIdPattern(character)) {
-		return false;
-	}
-	const OtherID oid = OtherIDOfCharacter(character);
-	if (oid == OtherID::oidStart) {
-		return true;
+	if (ch > maxUnicode) {
+		return ccCn;
 	}
-	const CharacterCategory c = CategoriseCharacter(character);
-	return (c == ccLl || c == ccLu || c == ccLt || c == ccLm || c == ccLo
-		|| c == ccNl);
-}
 
-// UAX #31 defines ID_Continue as
-// [[:ID_Start:][:Mn:][:Mc:][:Nd:][:Pc:][:Other_ID_Continue:]--[:Pattern_Syntax:]--[:Pattern_White_Space:]]
-bool IsIdContinue(int character) noexcept {
-	if (IsIdPattern(character)) {
-		return false;
-	}
-	const OtherID oid = OtherIDOfCharacter(character);
-	if (oid != OtherID::oidNone) {
-		return true;
-	}
-	const CharacterCategory c = CategoriseCharacter(character);
-	return (c == ccLl || c == ccLu || c == ccLt || c == ccLm || c == ccLo
-		|| c == ccNl || c == ccMn || c == ccMc || c == ccNd || c == ccPc);
+	ch -= sizeof(CharacterPropertyLatin);
+	ch = (CharacterPropertyTable[ch >> 9] << 8) | (ch & 511);
+	ch = CharacterPropertyTableIndex[ch >> 4] | (ch & 15);
+	return CharacterPropertyTable[ch + 2172];
 }
+//function--Autogenerated -- end of section automatically generated
 
-// XID_Start is ID_Start modified for Normalization Form KC in UAX #31
-bool IsXidStart(int character) noexcept {
-	if (OmitXidStart(character)) {
-		return false;
-	}
-	return IsIdStart(character);
 }
 
-// XID_Continue is ID_Continue modified for Normalization Form KC in UAX #31
-bool IsXidContinue(int character) noexcept {
-	if (OmitXidContinue(character)) {
-		return false;
-	}
-	return IsIdContinue(character);
+CharacterProperty GetCharacterProperty(int character) noexcept {
+	return LookupCharacterProperty(character);
 }
 
 CharacterCategoryMap::CharacterCategoryMap() {
@@ -949,23 +1120,6 @@ int CharacterCategoryMap::Size() const noexcept {
 }
 
 void CharacterCategoryMap::Optimize(int countCharacters) {
-#if CharacterCategoryUseRangeList
-	int characters = std::clamp(countCharacters, 256, maxUnicode + 1);
-	dense.resize(characters);
-
-	int index = 1;
-	int current = catRanges[0];
-	unsigned char *p = dense.data();
-	do {
-		const int next = catRanges[index++];
-		const unsigned char category = current & maskCategory;
-		const int count = std::min((next >> 5) - (current >> 5), characters);
-		current = next;
-		memset(p, category, count);
-		p += count;
-		characters -= count;
-	} while (characters != 0);
-#else
 	// only support BMP, see ExpandRLE() in CharClassify.cxx
 	int characters = std::clamp(countCharacters, 256, 0xffff + 1);
 	dense.resize(characters);
@@ -980,7 +1134,6 @@ void CharacterCategoryMap::Optimize(int countCharacters) {
 		p += count;
 		characters -= count;
 	} while (characters != 0);
-#endif
 }
 
 }
@@ -1,6 +1,6 @@
 // Scintilla source code edit control
 /** @file CharacterCategory.h
- ** Returns the Unicode general category of a character.
+ ** Returns the Unicode general category and identifier class of a character.
  **/
 // Copyright 2013 by Neil Hodgson <neilh@scintilla.org>
 // The License.txt file describes the conditions under which this software may be distributed.
@@ -18,13 +18,55 @@ enum CharacterCategory {
 	ccCc, ccCf, ccCs, ccCo, ccCn
 };
 
-CharacterCategory CategoriseCharacter(int character) noexcept;
+// Character property combines general category (low 5 bits) with identifier class
+// (high 3 bits) from UAX #31, both are resolved with a single table lookup.
+using CharacterProperty = unsigned char;
+
+//++Autogenerated -- start of section automatically generated
+constexpr int identifierClassShift = 5;
+constexpr int maskIdStart = 0b00011100;
+constexpr int maskIdContinue = 0b00011110;
+constexpr int maskXidStart = 0b00000100;
+constexpr int maskXidContinue = 0b00001110;
+//--Autogenerated -- end of section automatically generated
+constexpr int maskCategory = 0x1F;
+
+CharacterProperty GetCharacterProperty(int character) noexcept;
+
+constexpr CharacterCategory CategoryOfProperty(CharacterProperty property) noexcept {
+	return static_cast<CharacterCategory>(property & maskCategory);
+}
 
 // Common definitions of allowable characters in identifiers from UAX #31.
-bool IsIdStart(int character) noexcept;
-bool IsIdContinue(int character) noexcept;
-bool IsXidStart(int character) noexcept;
-bool IsXidContinue(int character) noexcept;
+constexpr bool IsIdStartProperty(CharacterProperty property) noexcept {
+	return (maskIdStart >> (property >> identifierClassShift)) & true;
+}
+constexpr bool IsIdContinueProperty(CharacterProperty property) noexcept {
+	return (maskIdContinue >> (property >> identifierClassShift)) & true;
+}
+constexpr bool IsXidStartProperty(CharacterProperty property) noexcept {
+	return (maskXidStart >> (property >> identifierClassShift)) & true;
+}
+constexpr bool IsXidContinueProperty(CharacterProperty property) noexcept {
+	return (maskXidContinue >> (property >> identifierClassShift)) & true;
+}
+
+inline CharacterCategory CategoriseCharacter(int character) noexcept {
+	return CategoryOfProperty(GetCharacterProperty(character));
+}
+
+inline bool IsIdStart(int character) noexcept {
+	return IsIdStartProperty(GetCharacterProperty(character));
+}
+inline bool IsIdContinue(int character) noexcept {
+	return IsIdContinueProperty(GetCharacterProperty(character));
+}
+inline bool IsXidStart(int character) noexcept {
+	return IsXidStartProperty(GetCharacterProperty(character));
+}
+inline bool IsXidContinue(int character) noexcept {
+	return IsXidContinueProperty(GetCharacterProperty(character));
+}
 
 class CharacterCategoryMap final {
 private:
@@ -35,7 +77,7 @@ public:
 		if (static_cast<size_t>(character) < dense.size()) {
 			return static_cast<CharacterCategory>(dense[character]);
 		}
-		// binary search through ranges
+		// multi-stage table lookup
 		return CategoriseCharacter(character);
 	}
 	int Size() const noexcept;
@@ -13,6 +13,7 @@
 #include <string_view>
 #include <vector>
 //#include <map>
+#include <algorithm>
 
 #include "ILexer.h"
 #include "Scintilla.h"
@@ -23,6 +24,7 @@
 #include "LexAccessor.h"
 #include "Accessor.h"
 #include "LexerModule.h"
+#include "SparseState.h"
 #include "LexerBase.h"
 
 using namespace Lexilla;
@@ -75,7 +77,9 @@ Sci_Position SCI_METHOD LexerBase::WordListSet(int n, int attribute, const char
 }
 
 void SCI_METHOD LexerBase::Lex(Sci_PositionU startPos, Sci_Position lengthDoc, int initStyle, Scintilla::IDocument *pAccess) {
-	Accessor styler(pAccess, props);
+	// line data after start line is outdated by modification
+	lineData.Delete(pAccess->LineFromPosition(startPos));
+	Accessor styler(pAccess, props, &lineData);
 	lexer.fnLexer(startPos, lengthDoc, initStyle, keywordLists, styler);
 	styler.Flush();
 }
@@ -100,7 +104,11 @@ void SCI_METHOD LexerBase::Fold(Sci_PositionU startPos, Sci_Position lengthDoc,
 	}
 }
 
-void * SCI_METHOD LexerBase::PrivateCall(int, void *) noexcept {
+void * SCI_METHOD LexerBase::PrivateCall(int operation, void *pointer) noexcept {
+	if (operation == Scintilla::pcCheckpointMask && lexer.checkpointMask != 0 && pointer != nullptr) {
+		*static_cast<int *>(pointer) = lexer.checkpointMask;
+		return pointer;
+	}
 	return nullptr;
 }
 
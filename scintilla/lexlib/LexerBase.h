@@ -13,6 +13,7 @@ class LexerBase final : public Scintilla::ILexer5 {
 	const LexerModule lexer;
 	PropSetSimple props;
 	WordList keywordLists[KEYWORDSET_MAX];
+	LexerLineData lineData;
 public:
 	explicit LexerBase(const LexerModule *module_);
 	void SCI_METHOD Release() noexcept override;
@@ -12,6 +12,7 @@
 #include <string_view>
 #include <vector>
 //#include <map>
+#include <algorithm>
 
 #include "ILexer.h"
 #include "Scintilla.h"
@@ -22,6 +23,7 @@
 #include "LexAccessor.h"
 #include "Accessor.h"
 #include "LexerModule.h"
+#include "SparseState.h"
 #include "LexerBase.h"
 
 using namespace Lexilla;
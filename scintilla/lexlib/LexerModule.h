@@ -26,17 +26,21 @@ public:
 	LexerFunction const fnFolder;
 	LexerFactoryFunction const fnFactory;
 	const char *const languageName;
+	// non-zero to support relex checkpoint, see Scintilla::pcCheckpointMask.
+	const int checkpointMask;
 
 	constexpr LexerModule(
 		int language_,
 		LexerFunction fnLexer_,
 		const char *languageName_ = nullptr,
-		LexerFunction fnFolder_ = nullptr) noexcept:
+		LexerFunction fnFolder_ = nullptr,
+		int checkpointMask_ = 0) noexcept:
 		language(language_),
 		fnLexer(fnLexer_),
 		fnFolder(fnFolder_),
 		fnFactory(nullptr),
-		languageName(languageName_) {
+		languageName(languageName_),
+		checkpointMask(checkpointMask_) {
 	}
 
 	constexpr LexerModule(
@@ -47,7 +51,8 @@ public:
 		fnLexer(nullptr),
 		fnFolder(nullptr),
 		fnFactory(fnFactory_),
-		languageName(languageName_) {
+		languageName(languageName_),
+		checkpointMask(0) {
 	}
 
 	constexpr int GetLanguage() const noexcept {
@@ -30,7 +30,11 @@ class SparseState {
 	using stateVector = std::vector<State>;
 	stateVector states;
 
-	typename stateVector::iterator Find(Sci_Position position) const {
+	typename stateVector::const_iterator Find(Sci_Position position) const {
+		const State searchValue(position, T());
+		return std::lower_bound(states.begin(), states.end(), searchValue);
+	}
+	typename stateVector::iterator Find(Sci_Position position) {
 		const State searchValue(position, T());
 		return std::lower_bound(states.begin(), states.end(), searchValue);
 	}
@@ -40,7 +44,9 @@ public:
 		positionFirst = positionFirst_;
 	}
 	void Set(Sci_Position position, T value) {
-		Delete(position);
+		if (!states.empty() && states.back().position >= position) {
+			Delete(position);
+		}
 		if (states.empty() || (value != states[states.size() - 1].value)) {
 			states.push_back(State(position, value));
 		}
@@ -50,7 +56,7 @@ public:
 			return T();
 		if (position < states[0].position)
 			return T();
-		typename stateVector::iterator low = Find(position);
+		typename stateVector::const_iterator low = Find(position);
 		if (low == states.end()) {
 			return states[states.size() - 1].value;
 		} else {
@@ -101,4 +107,45 @@ public:
 	}
 };
 
+// Per line lexer data kept by LexerBase between lexing, value continues to following lines until changed.
+// Strings (e.g. here document delimiter) are interned, upper bits of value is index of the string.
+class LexerLineData {
+	SparseState<int> states;
+	std::vector<std::string> strings;
+public:
+	static constexpr int StringIndexShift = 16;
+	static constexpr int StateMask = (1 << StringIndexShift) - 1;
+	// rarely reached, states referencing discarded strings are also discarded
+	static constexpr size_t MaxStringCount = 1024;
+
+	int ValueAt(Sci_Position line) const {
+		return states.ValueAt(line);
+	}
+	void Set(Sci_Position line, int value) {
+		states.Set(line, value);
+	}
+	void Delete(Sci_Position line) {
+		states.Delete(line);
+	}
+	int Intern(std::string_view text) {
+		for (size_t index = strings.size(); index != 0; index--) {
+			if (strings[index - 1] == text) {
+				return static_cast<int>(index - 1);
+			}
+		}
+		if (strings.size() >= MaxStringCount) {
+			strings.clear();
+			states = SparseState<int>();
+		}
+		strings.emplace_back(text);
+		return static_cast<int>(strings.size() - 1);
+	}
+	std::string_view StringAt(int index) const noexcept {
+		if (static_cast<size_t>(index) < strings.size()) {
+			return strings[index];
+		}
+		return {};
+	}
+};
+
 }
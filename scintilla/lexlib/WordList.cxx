@@ -18,43 +18,51 @@ using range_t = WordList::range_t;
 
 namespace {
 
+// treat space and C0 control characters as word separators.
+constexpr bool IsWordEnd(char ch) noexcept {
+	return static_cast<unsigned char>(ch) <= ' ';
+}
+
+constexpr unsigned char WordChar(char ch) noexcept {
+	return IsWordEnd(ch) ? '\0' : static_cast<unsigned char>(ch);
+}
+
+inline size_t WordLength(const char *s) noexcept {
+	const char * const start = s;
+	while (!IsWordEnd(*s)) {
+		++s;
+	}
+	return s - start;
+}
+
 /**
- * Creates an array that points into each word in the string and puts \0 terminators
- * after each word.
+ * Creates an array that points into each word in the string, the string is not modified,
+ * so static list can be referenced without copy.
  */
-inline char **ArrayFromWordList(char *wordlist, size_t slen, range_t *len) {
-	unsigned char prev = 1;
+inline const char **ArrayFromWordList(const char *wordlist, size_t slen, range_t *len) {
+	bool prev = true;
 	range_t words = 0;
-	// treat space and C0 control characters as word separators.
 
-	char * const end = wordlist + slen;
-	char *s = wordlist;
+	const char * const end = wordlist + slen;
+	const char *s = wordlist;
 	while (s < end) {
-		const unsigned char ch = *s++;
-		const bool curr = ch <= ' ';
-		if (!curr && prev) {
-			words++;
-		}
+		const bool curr = IsWordEnd(*s++);
+		words += !curr && prev;
 		prev = curr;
 	}
 
-	char **keywords = new char *[words + 1];
+	const char **keywords = new const char *[words + 1];
 	range_t wordsStore = 0;
 	if (words) {
-		prev = '\0';
+		prev = true;
 		s = wordlist;
 		while (s < end) {
-			unsigned char ch = *s;
-			if (ch > ' ') {
-				if (!prev) {
-					keywords[wordsStore] = s;
-					wordsStore++;
-				}
-			} else {
-				*s = '\0';
-				ch = '\0';
+			const bool curr = IsWordEnd(*s);
+			if (!curr && prev) {
+				keywords[wordsStore] = s;
+				wordsStore++;
 			}
-			prev = ch;
+			prev = curr;
 			++s;
 		}
 	}
@@ -121,24 +129,33 @@ bool WordList::Set(const char *s, KeywordAttr attribute) {
 	// 2. the comparison is expensive than rebuild the list, especially for a long list.
 
 	Clear();
-	const size_t lenS = strlen(s) + 1;
-	list = new char[lenS];
-	memcpy(list, s, lenS);
-	if (attribute & KeywordAttr_MakeLower) {
-		char *p = list;
-		while (*p) {
-			if (*p >= 'A' && *p <= 'Z') {
-				*p |= 'a' - 'A';
+	const size_t lenS = strlen(s);
+	// presorted list is generated by tools/KeywordCore.py as static string literal,
+	// which outlives the lexer, so words can directly point into it.
+	if ((attribute & (KeywordAttr_MakeLower | KeywordAttr_PreSorted)) != KeywordAttr_PreSorted) {
+		list = new char[lenS + 1];
+		memcpy(list, s, lenS + 1);
+		if (attribute & KeywordAttr_MakeLower) {
+			char *p = list;
+			while (*p) {
+				if (*p >= 'A' && *p <= 'Z') {
+					*p |= 'a' - 'A';
+				}
+				++p;
 			}
-			++p;
 		}
+		s = list;
 	}
 
 	range_t len = 0;
-	words = ArrayFromWordList(list, lenS - 1, &len);
+	words = ArrayFromWordList(s, lenS, &len);
 	if (!(attribute & KeywordAttr_PreSorted)) {
 		std::sort(words, words + len, [](const char *a, const char *b) noexcept {
-			return strcmp(a, b) < 0;
+			while (!IsWordEnd(*a) && *a == *b) {
+				a++;
+				b++;
+			}
+			return WordChar(*a) < WordChar(*b);
 		});
 	}
 
@@ -176,11 +193,11 @@ bool WordList::InList(const char *s) const noexcept {
 			do {
 				const char *a = words[range.start] + 1;
 				const char *b = s + 1;
-				while (*a && *a == *b) {
+				while (!IsWordEnd(*a) && *a == *b) {
 					a++;
 					b++;
 				}
-				if (!*a && !*b) {
+				if (IsWordEnd(*a) && !*b) {
 					return true;
 				}
 			} while (range.Next());
@@ -190,11 +207,11 @@ bool WordList::InList(const char *s) const noexcept {
 				const range_t mid = range.start + step;
 				const char *a = words[mid] + 1;
 				const char *b = s + 1;
-				while (*a && *a == *b) {
+				while (!IsWordEnd(*a) && *a == *b) {
 					a++;
 					b++;
 				}
-				const int diff = static_cast<unsigned char>(*a) - static_cast<unsigned char>(*b);
+				const int diff = WordChar(*a) - static_cast<unsigned char>(*b);
 				if (diff == 0) {
 					return true;
 				}
@@ -214,11 +231,11 @@ bool WordList::InList(const char *s) const noexcept {
 		do {
 			const char *a = words[range.start] + 1;
 			const char *b = s;
-			while (*a && *a == *b) {
+			while (!IsWordEnd(*a) && *a == *b) {
 				a++;
 				b++;
 			}
-			if (!*a) {
+			if (IsWordEnd(*a)) {
 				return true;
 			}
 		} while (range.Next());
@@ -248,11 +265,11 @@ bool WordList::InListPrefixed(const char *s, const char marker) const noexcept {
 			do {
 				const char *a = words[range.start] + 1;
 				const char *b = s + 1;
-				while (*a && *a == *b) {
+				while (!IsWordEnd(*a) && *a == *b) {
 					a++;
 					b++;
 				}
-				if ((!*a || *a == marker) && !*b) {
+				if ((IsWordEnd(*a) || *a == marker) && !*b) {
 					return true;
 				}
 			} while (range.Next());
@@ -262,11 +279,11 @@ bool WordList::InListPrefixed(const char *s, const char marker) const noexcept {
 				const range_t mid = range.start + step;
 				const char *a = words[mid] + 1;
 				const char *b = s + 1;
-				while (*a && *a == *b) {
+				while (!IsWordEnd(*a) && *a == *b) {
 					a++;
 					b++;
 				}
-				const int diff = static_cast<unsigned char>(*a) - static_cast<unsigned char>(*b);
+				const int diff = WordChar(*a) - static_cast<unsigned char>(*b);
 				if (diff == 0 || diff == static_cast<unsigned char>(marker)) {
 					return true;
 				}
@@ -286,11 +303,11 @@ bool WordList::InListPrefixed(const char *s, const char marker) const noexcept {
 		do {
 			const char *a = words[range.start] + 1;
 			const char *b = s;
-			while (*a && *a == *b) {
+			while (!IsWordEnd(*a) && *a == *b) {
 				a++;
 				b++;
 			}
-			if (!*a) {
+			if (IsWordEnd(*a)) {
 				return true;
 			}
 		} while (range.Next());
@@ -322,7 +339,7 @@ bool WordList::InListAbbreviated(const char *s, const char marker) const noexcep
 				isSubword = true;
 				a++;
 			}
-			while (*a && *a == *b) {
+			while (!IsWordEnd(*a) && *a == *b) {
 				a++;
 				if (*a == marker) {
 					isSubword = true;
@@ -330,7 +347,7 @@ bool WordList::InListAbbreviated(const char *s, const char marker) const noexcep
 				}
 				b++;
 			}
-			if ((!*a || isSubword) && !*b) {
+			if ((IsWordEnd(*a) || isSubword) && !*b) {
 				return true;
 			}
 		} while (range.Next());
@@ -342,11 +359,11 @@ bool WordList::InListAbbreviated(const char *s, const char marker) const noexcep
 		do {
 			const char *a = words[range.start] + 1;
 			const char *b = s;
-			while (*a && *a == *b) {
+			while (!IsWordEnd(*a) && *a == *b) {
 				a++;
 				b++;
 			}
-			if (!*a) {
+			if (IsWordEnd(*a)) {
 				return true;
 			}
 		} while (range.Next());
@@ -375,11 +392,11 @@ bool WordList::InListAbridged(const char *s, const char marker) const noexcept {
 		do {
 			const char *a = words[range.start];
 			const char *b = s;
-			while (*a && *a == *b) {
+			while (!IsWordEnd(*a) && *a == *b) {
 				a++;
 				if (*a == marker) {
 					a++;
-					const size_t suffixLengthA = strlen(a);
+					const size_t suffixLengthA = WordLength(a);
 					const size_t suffixLengthB = strlen(b);
 					if (suffixLengthA >= suffixLengthB) {
 						break;
@@ -388,7 +405,7 @@ bool WordList::InListAbridged(const char *s, const char marker) const noexcept {
 				}
 				b++;
 			}
-			if (!*a && !*b) {
+			if (IsWordEnd(*a) && !*b) {
 				return true;
 			}
 		} while (range.Next());
@@ -404,18 +421,18 @@ bool WordList::InListAbridged(const char *s, const char marker) const noexcept {
 		do {
 			const char *a = words[range.start] + 1;
 			const char *b = s;
-			const size_t suffixLengthA = strlen(a);
+			const size_t suffixLengthA = WordLength(a);
 			const size_t suffixLengthB = strlen(b);
 			if (suffixLengthA > suffixLengthB) {
 				continue;
 			}
 			b = b + suffixLengthB - suffixLengthA;
 
-			while (*a && *a == *b) {
+			while (!IsWordEnd(*a) && *a == *b) {
 				a++;
 				b++;
 			}
-			if (!*a && !*b) {
+			if (IsWordEnd(*a) && !*b) {
 				return true;
 			}
 		} while (range.Next());
@@ -23,7 +23,9 @@ public:
 
 private:
 	// Each word contains at least one character - an empty word acts as sentinel at the end.
-	char **words = nullptr;
+	// Words are terminated by space, C0 control character or NUL, they either point into
+	// the owned copy (list) or directly into the presorted static list passed to Set().
+	const char **words = nullptr;
 	char *list = nullptr;
 	//range_t len = 0;
 #if 1
@@ -64,6 +66,7 @@ public:
 	bool InListPrefixed(const char *s, char marker) const noexcept;
 	bool InListAbbreviated(const char *s, char marker) const noexcept;
 	bool InListAbridged(const char *s, char marker) const noexcept;
+	// returned word is terminated by space, C0 control character or NUL.
 	const char *WordAt(range_t n) const noexcept;
 };
 
@@ -361,41 +361,120 @@ def updateCharClassifyTable(filename, headfile):
 	Regenerate(filename, "//", output)
 	Regenerate(headfile, "//", head_output)
 
-def updateCharacterCategoryTable(filename):
-	categories = findCategories("../lexlib/CharacterCategory.h")
+# Identifier class from UAX #31, combined with general category into character property.
+# https://unicode.org/reports/tr31/
+class IdentifierClass(IntEnum):
+	Other = 0
+	Continue = 1			# ID_Continue and XID_Continue
+	Start = 2				# ID_Start, ID_Continue, XID_Start and XID_Continue
+	StartXidContinue = 3	# ID_Start, ID_Continue and XID_Continue
+	StartNotXid = 4			# ID_Start and ID_Continue
+
+IdentifierClassShift = 5
+LatinCharacterCount = 0x800
+
+# Values copied from https://www.unicode.org/Public/12.1.0/ucd/PropList.txt
+OtherIdStart = [
+	0x1885, # MONGOLIAN LETTER ALI GALI BALUDA
+	0x1886, # MONGOLIAN LETTER ALI GALI THREE BALUDA
+	0x2118, # SCRIPT CAPITAL P
+	0x212E, # ESTIMATED SYMBOL
+	0x309B, # KATAKANA-HIRAGANA VOICED SOUND MARK
+	0x309C, # KATAKANA-HIRAGANA SEMI-VOICED SOUND MARK
+]
+OtherIdContinue = [
+	0x00B7, # MIDDLE DOT
+	0x0387, # GREEK ANO TELEIA
+	*range(0x1369, 0x1371 + 1), # ETHIOPIC DIGIT ONE..ETHIOPIC DIGIT NINE
+	0x19DA, # NEW TAI LUE THAM DIGIT ONE
+]
+# character in Ll|Lu|Lt|Lm|Lo|Nl|Mn|Mc|Nd|Pc and has Pattern_Syntax|Pattern_White_Space.
+IdPattern = [
+	0x2E2F, # VERTICAL TILDE
+]
+# characters modified for Normalization Form KC
+OmitXidContinue = [
+	0x037A, # GREEK YPOGEGRAMMENI
+	0x309B, # KATAKANA-HIRAGANA VOICED SOUND MARK
+	0x309C, # KATAKANA-HIRAGANA SEMI-VOICED SOUND MARK
+	*range(0xFC5E, 0xFC63 + 1), # ARABIC LIGATURE SHADDA WITH DAMMATAN ISOLATED FORM..ARABIC LIGATURE SHADDA WITH SUPERSCRIPT ALEF ISOLATED FORM
+	0xFDFA, # ARABIC LIGATURE SALLALLAHOU ALAYHE WASALLAM
+	0xFDFB, # ARABIC LIGATURE JALLAJALALOUHOU
+	*range(0xFE70, 0xFE7E + 1, 2), # ARABIC FATHATAN ISOLATED FORM..ARABIC SUKUN ISOLATED FORM
+]
+OmitXidStart = OmitXidContinue + [
+	0x0E33, # THAI CHARACTER SARA AM
+	0x0EB3, # LAO VOWEL SIGN AM
+	0xFF9E, # HALFWIDTH KATAKANA VOICED SOUND MARK
+	0xFF9F, # HALFWIDTH KATAKANA SEMI-VOICED SOUND MARK
+]
+
+def getIdentifierClass(category, ch):
+	if ch in IdPattern:
+		return IdentifierClass.Other
+	# [[:L:][:Nl:][:Other_ID_Start:]--[:Pattern_Syntax:]--[:Pattern_White_Space:]]
+	if category in ('Lu', 'Ll', 'Lt', 'Lm', 'Lo', 'Nl') or ch in OtherIdStart:
+		if ch in OmitXidContinue:
+			return IdentifierClass.StartNotXid
+		if ch in OmitXidStart:
+			return IdentifierClass.StartXidContinue
+		return IdentifierClass.Start
+	# [[:ID_Start:][:Mn:][:Mc:][:Nd:][:Pc:][:Other_ID_Continue:]--[:Pattern_Syntax:]--[:Pattern_White_Space:]]
+	if category in ('Mn', 'Mc', 'Nd', 'Pc') or ch in OtherIdContinue:
+		assert ch not in OmitXidContinue
+		return IdentifierClass.Continue
+	return IdentifierClass.Other
+
+def getIdentifierClassMask(*classes):
+	mask = 0
+	for value in classes:
+		mask |= 1 << value
+	return f'0b{mask:08b}'
+
+def updateCharacterCategoryTable(filename, headfile):
+	categories = findCategories(headfile)
 	output = [f"// Created with Python {platform.python_version()}, Unicode {unicodedata.unidata_version}"]
+	head_output = [
+		f"constexpr int identifierClassShift = {IdentifierClassShift};",
+		f"constexpr int maskIdStart = {getIdentifierClassMask(IdentifierClass.Start, IdentifierClass.StartXidContinue, IdentifierClass.StartNotXid)};",
+		f"constexpr int maskIdContinue = {getIdentifierClassMask(IdentifierClass.Continue, IdentifierClass.Start, IdentifierClass.StartXidContinue, IdentifierClass.StartNotXid)};",
+		f"constexpr int maskXidStart = {getIdentifierClassMask(IdentifierClass.Start)};",
+		f"constexpr int maskXidContinue = {getIdentifierClassMask(IdentifierClass.Continue, IdentifierClass.Start, IdentifierClass.StartXidContinue)};",
+	]
 
-	indexTable = [0] * UnicodeCharacterCount
+	categoryTable = [0] * UnicodeCharacterCount
+	propertyTable = [0] * UnicodeCharacterCount
 	for ch in range(UnicodeCharacterCount):
 		uch = chr(ch)
 		category = unicodedata.category(uch)
 		value = categories.index(category)
-		indexTable[ch] = value
+		categoryTable[ch] = value
+		propertyTable[ch] = value | (getIdentifierClass(category, ch) << IdentifierClassShift)
 
-	# the sentinel value is used to simplify CharacterMap::Optimize()
-	sentinel = UnicodeCharacterCount*32 + categories.index('Cn')
-	valueBit, rangeList = rangeEncode('catRanges', indexTable, sentinel=sentinel)
-	assert valueBit == 5
-	output.append("#if CharacterCategoryUseRangeList")
-	output.append("const int catRanges[] = {")
-	#output.extend(f"{value}," for value in rangeList)
-	output.append("};")
+	# direct table for Latin, Greek, Cyrillic, Armenian, Hebrew, Arabic and other two bytes UTF-8 characters
 	output.append("")
-	output.append("#else")
+	output.append(f'const uint8_t CharacterPropertyLatin[{LatinCharacterCount:#x}] = {{')
+	output.extend(dumpArray(propertyTable[:LatinCharacterCount], 16, '0x%02X'))
+	output.append("};")
 
 	config = {
-		'tableName': 'catTable',
-		'function': """CharacterCategory CategoriseCharacter(int character) noexcept {
-	if (character < 0 || character > maxUnicode) {
+		'tableName': 'CharacterPropertyTable',
+		'function': """inline CharacterProperty LookupCharacterProperty(uint32_t ch) noexcept {
+	if (ch < sizeof(CharacterPropertyLatin)) {
+		return CharacterPropertyLatin[ch];
+	}
+	if (ch > maxUnicode) {
 		return ccCn;
-	}""",
-		'returnType': 'CharacterCategory',
 	}
-	table, function = buildMultiStageTable('CharacterCategory', indexTable, config=config, level=3)
+
+	ch -= sizeof(CharacterPropertyLatin);""",
+		'returnType': '',
+	}
+	table, function = buildMultiStageTable('CharacterProperty', propertyTable[LatinCharacterCount:], config=config, level=2)
 	output.append("")
 	output.extend(table)
 
-	valueBit, totalBit, data = runLengthEncode('CharacterCategory BMP', indexTable[:BMPCharacterCharacterCount])
+	valueBit, totalBit, data = runLengthEncode('CharacterCategory BMP', categoryTable[:BMPCharacterCharacterCount])
 	assert valueBit == 5
 	assert totalBit == 16
 	output.append("")
@@ -403,11 +482,9 @@ def updateCharacterCategoryTable(filename):
 	output.extend(dumpArray(data, 20))
 	output.append("};")
 
-	output.append("")
-	output.append("#endif")
-
 	Regenerate(filename, "//", output)
 	Regenerate(filename, "//function", function)
+	Regenerate(headfile, "//", head_output)
 
 def getDBCSCharClassify(decode, ch, isReservedOrUDC=None):
 	buf = bytes([ch]) if ch < 256 else bytes([ch >> 8, ch & 0xff])
@@ -521,4 +598,4 @@ if __name__ == '__main__':
 	buildANSICharClassifyTable('../../src/EditEncoding.cpp')
 	updateCharClassifyTable("../src/CharClassify.cxx", "../src/CharClassify.h")
 	updateDBCSCharClassifyTable("../src/CharClassify.cxx")
-	updateCharacterCategoryTable("../lexlib/CharacterCategory.cxx")
+	updateCharacterCategoryTable("../lexlib/CharacterCategory.cxx", "../lexlib/CharacterCategory.h")
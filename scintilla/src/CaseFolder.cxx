@@ -5,11 +5,16 @@
 // Copyright 1998-2013 by Neil Hodgson <neilh@scintilla.org>
 // The License.txt file describes the conditions under which this software may be distributed.
 
+#include <cstdint>
+#include <cstring>
+
 #include <stdexcept>
 #include <string>
 
+#include "VectorISA.h"
 #include "CaseFolder.h"
 #include "CaseConvert.h"
+#include "UniConversion.h"
 
 using namespace Scintilla::Internal;
 
@@ -24,6 +29,43 @@ constexpr unsigned char IndexFromChar(char ch) noexcept {
 	return static_cast<unsigned char>(ch);
 }
 
+// Fold table for FoldText(), built once from case fold conversions.
+struct FoldTextTable {
+	// folded character for U+0080..U+07FF, zero when folded into multiple characters.
+	uint16_t twoByte[0x800];
+	// bit set for each 256 characters block in U+0800..U+FFFF that contains characters to be folded.
+	uint32_t threeByteBlock[256/32];
+
+	FoldTextTable() noexcept {
+		for (int ch = 0; ch < 0x800; ch++) {
+			int value = ch;
+			if (const char *conversion = CaseConvert(ch, CaseConversion::fold)) {
+				const unsigned char *us = reinterpret_cast<const unsigned char *>(conversion);
+				value = (strlen(conversion) == static_cast<size_t>(UTF8BytesOfLead(us[0]))) ? UnicodeFromUTF8(us) : 0;
+			}
+			twoByte[ch] = static_cast<uint16_t>(value);
+		}
+		memset(threeByteBlock, 0, sizeof(threeByteBlock));
+		for (int ch = 0x800; ch < 0x10000; ch++) {
+			if (CaseConvert(ch, CaseConversion::fold)) {
+				threeByteBlock[ch >> 13] |= 1U << ((ch >> 8) & 31);
+			}
+		}
+	}
+	bool ThreeByteBlockFolded(int ch) const noexcept {
+		return (threeByteBlock[ch >> 13] >> ((ch >> 8) & 31)) & true;
+	}
+};
+
+const FoldTextTable &GetFoldTextTable() {
+	static const FoldTextTable table;
+	return table;
+}
+
+}
+
+size_t CaseFolder::FoldText([[maybe_unused]] char *folded, [[maybe_unused]] uint32_t *starts, [[maybe_unused]] const char *mixed, [[maybe_unused]] size_t lenMixed) const {
+	return 0;
 }
 
 CaseFolderTable::CaseFolderTable() noexcept {
@@ -59,3 +101,97 @@ size_t CaseFolderUnicode::Fold(char *folded, size_t sizeFolded, const char *mixe
 		return converter->CaseConvertString(folded, sizeFolded, mixed, lenMixed);
 	}
 }
+
+// Same result as calling Fold() for each character, but with SSE2 for runs of ASCII,
+// table lookup for two bytes characters (Latin, Greek, Cyrillic, Armenian, etc.),
+// and quick skip for three bytes characters in blocks without case (e.g. CJK).
+// ASCII is folded with default mapping, SetTranslation() is not used for UTF-8.
+size_t CaseFolderUnicode::FoldText(char *folded, uint32_t *starts, const char *mixed, size_t lenMixed) const {
+	const FoldTextTable &table = GetFoldTextTable();
+	const unsigned char *us = reinterpret_cast<const unsigned char *>(mixed);
+	size_t lenFolded = 0;
+	size_t index = 0;
+	while (index < lenMixed) {
+		const unsigned char leadByte = us[index];
+		if (UTF8IsAscii(leadByte)) {
+#if NP2_USE_SSE2
+			if (index + sizeof(__m128i) <= lenMixed) {
+				__m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(us + index));
+				if (_mm_movemask_epi8(chunk) == 0) {
+					const __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(chunk, _mm_set1_epi8('Z' + 1)));
+					chunk = _mm_add_epi8(chunk, _mm_and_si128(upper, _mm_set1_epi8('a' - 'A')));
+					_mm_storeu_si128(reinterpret_cast<__m128i *>(folded + lenFolded), chunk);
+					__m128i offset = _mm_add_epi32(_mm_set1_epi32(static_cast<int>(index)), _mm_setr_epi32(0, 1, 2, 3));
+					for (size_t i = 0; i < sizeof(__m128i); i += 4) {
+						_mm_storeu_si128(reinterpret_cast<__m128i *>(starts + lenFolded + i), offset);
+						offset = _mm_add_epi32(offset, _mm_set1_epi32(4));
+					}
+					index += sizeof(__m128i);
+					lenFolded += sizeof(__m128i);
+					continue;
+				}
+			}
+#endif
+			folded[lenFolded] = static_cast<char>(MakeLowerCase(leadByte));
+			starts[lenFolded++] = static_cast<uint32_t>(index++);
+			continue;
+		}
+
+		// character is folded character, zero to use case conversion, negative to copy as is.
+		size_t width = 1;
+		int character = -1;
+		const size_t remain = lenMixed - index;
+		if (leadByte >= 0xC2 && leadByte < 0xE0 && remain >= 2 && UTF8IsTrailByte(us[index + 1])) {
+			character = table.twoByte[((leadByte & 0x1F) << 6) | (us[index + 1] & 0x3F)];
+			if (character >= 0x80 && character < 0x800) {
+				// most common case: folded character is still two bytes
+				folded[lenFolded] = static_cast<char>(0xC0 | (character >> 6));
+				folded[lenFolded + 1] = static_cast<char>(0x80 | (character & 0x3F));
+				starts[lenFolded] = static_cast<uint32_t>(index);
+				starts[lenFolded + 1] = foldedContinuation;
+				lenFolded += 2;
+				index += 2;
+				continue;
+			}
+			width = 2;
+		} else {
+			unsigned char bytes[UTF8MaxBytes + 1]{ leadByte };
+			const int widthCharBytes = UTF8BytesOfLead(leadByte);
+			for (int b = 1; b < widthCharBytes; b++) {
+				bytes[b] = (static_cast<size_t>(b) < remain) ? us[index + b] : 0;
+			}
+			// non-character is invalid but still treated as single character
+			const int classified = UTF8ClassifyMulti(bytes, widthCharBytes);
+			width = classified & UTF8MaskWidth;
+			if (!(classified & UTF8MaskInvalid)) {
+				if (width == 4 || table.ThreeByteBlockFolded(UnicodeFromUTF8(bytes))) {
+					character = 0;
+				}
+			}
+		}
+
+		const char *source = mixed + index;
+		size_t lenChar = width;
+		char buffer[UTF8MaxBytes + 1];
+		if (character > 0) {
+			UTF8FromUTF32Character(character, buffer);
+			source = buffer;
+			lenChar = UTF8BytesOfLead(static_cast<unsigned char>(buffer[0]));
+		} else if (character == 0) {
+			const char *conversion = CaseConvert(UnicodeFromUTF8(us + index), CaseConversion::fold);
+			if (conversion) {
+				source = conversion;
+				lenChar = strlen(conversion);
+			}
+		}
+		memcpy(folded + lenFolded, source, lenChar);
+		starts[lenFolded] = static_cast<uint32_t>(index);
+		for (size_t i = 1; i < lenChar; i++) {
+			starts[lenFolded + i] = foldedContinuation;
+		}
+		lenFolded += lenChar;
+		index += width;
+	}
+	starts[lenFolded] = static_cast<uint32_t>(lenMixed);
+	return lenFolded;
+}
@@ -18,8 +18,20 @@ public:
 	CaseFolder &operator=(CaseFolder &&) = delete;
 	virtual ~CaseFolder() = default;
 	virtual size_t Fold(char *folded, size_t sizeFolded, const char *mixed, size_t lenMixed) = 0;
+	// Fold whole UTF-8 text for case-insensitive search, folded text is searched directly
+	// and starts is used to map positions in folded text back to mixed text:
+	// starts[i] is offset in mixed of the character folded into folded[i] when folded[i]
+	// is the first byte of that folded character, otherwise foldedContinuation,
+	// starts[result] is lenMixed.
+	// folded and starts should have space for lenMixed*maxFoldTextExpansion + 1 items.
+	// Returns 0 when not supported, then caller should call Fold() for each character.
+	virtual size_t FoldText(char *folded, uint32_t *starts, const char *mixed, size_t lenMixed) const;
 };
 
+// same as maxExpansionCaseConversion
+constexpr size_t maxFoldTextExpansion = 3;
+constexpr uint32_t foldedContinuation = UINT32_MAX;
+
 class CaseFolderTable : public CaseFolder {
 protected:
 	char mapping[256];
@@ -36,6 +48,7 @@ class CaseFolderUnicode final : public CaseFolderTable {
 public:
 	CaseFolderUnicode();
 	size_t Fold(char *folded, size_t sizeFolded, const char *mixed, size_t lenMixed) override;
+	size_t FoldText(char *folded, uint32_t *starts, const char *mixed, size_t lenMixed) const override;
 };
 
 }
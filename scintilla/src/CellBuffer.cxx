@@ -344,8 +344,301 @@ SplitView::SplitView(const SplitVector<char> &instance) noexcept {
 	segment2 = instance.ElementPointer(length1) - length1;
 }
 
-CellBuffer::CellBuffer(bool hasStyles_, bool largeDocument_) :
-	hasStyles(hasStyles_), largeDocument(largeDocument_) {
+namespace {
+
+// run-length encode styles into pairs of (style, run length - 1)
+std::string EncodeStyles(std::string_view styles) {
+	std::string data;
+	const char *ptr = styles.data();
+	const char * const end = ptr + styles.length();
+	while (ptr < end) {
+		const char style = *ptr;
+		const char *runEnd = ptr + std::min<ptrdiff_t>(end - ptr, UINT8_MAX + 1);
+		const char *next = ptr + 1;
+		while (next < runEnd && *next == style) {
+			++next;
+		}
+		data.push_back(style);
+		data.push_back(static_cast<char>(next - ptr - 1));
+		ptr = next;
+	}
+	return data;
+}
+
+}
+
+CompressedStyles::CompressedStyles() : starts(256) {
+	blocks.emplace_back();
+}
+
+CompressedStyles::~CompressedStyles() noexcept = default;
+
+Sci::Position CompressedStyles::BlockFromPosition(Sci::Position position) const noexcept {
+	if (position >= cachedStart && position < cachedEnd) {
+		return cachedBlock;
+	}
+	const Sci::Position block = starts.PartitionFromPosition(position);
+	cachedBlock = block;
+	cachedStart = starts.PositionFromPartition(block);
+	cachedEnd = starts.PositionFromPartition(block + 1);
+	return block;
+}
+
+char *CompressedStyles::Decode(Sci::Position block) const {
+	Block &blk = blocks[block];
+	if (blk.encoded) {
+		std::string data;
+		data.reserve(starts.PositionFromPartition(block + 1) - starts.PositionFromPartition(block));
+		const char *ptr = blk.data.data();
+		const char * const end = ptr + blk.data.length();
+		while (ptr < end) {
+			data.append(static_cast<uint8_t>(ptr[1]) + 1, ptr[0]);
+			ptr += 2;
+		}
+		blk.data = std::move(data);
+		blk.encoded = false;
+	}
+	blk.lastUse = ++useClock;
+	if (!blk.hot) {
+		blk.hot = true;
+		hotBlocks.push_back(block);
+		if (hotBlocks.size() > maxDecodedBlocks) {
+			EncodeLeastRecentlyUsed();
+		}
+	}
+	return blk.data.data();
+}
+
+void CompressedStyles::EncodeLeastRecentlyUsed() const {
+	auto oldest = hotBlocks.begin();
+	for (auto it = hotBlocks.begin() + 1; it != hotBlocks.end(); ++it) {
+		if (blocks[*it].lastUse < blocks[*oldest].lastUse) {
+			oldest = it;
+		}
+	}
+
+	Block &blk = blocks[*oldest];
+	hotBlocks.erase(oldest);
+	blk.hot = false;
+	std::string data = EncodeStyles(blk.data);
+	// keep incompressible block decoded
+	if (data.length() < blk.data.length()) {
+		data.shrink_to_fit();
+		blk.data = std::move(data);
+		blk.encoded = true;
+	}
+}
+
+void CompressedStyles::ShiftHotBlocks(Sci::Position block, Sci::Position delta) noexcept {
+	for (Sci::Position &index : hotBlocks) {
+		if (index >= block) {
+			index += delta;
+		}
+	}
+}
+
+void CompressedStyles::SplitBlock(Sci::Position block, Sci::Position offset) {
+	Decode(block);
+	Block tail;
+	tail.data = blocks[block].data.substr(offset);
+	blocks[block].data.resize(offset);
+	blocks[block].data.shrink_to_fit();
+	const Sci::Position position = starts.PositionFromPartition(block) + offset;
+	starts.InsertPartition(block + 1, position);
+	blocks.insert(blocks.begin() + block + 1, std::move(tail));
+	ShiftHotBlocks(block + 1, 1);
+	cachedEnd = 0;
+	Decode(block + 1);
+}
+
+void CompressedStyles::RemoveEmptyBlock(Sci::Position block) {
+	// first partition always starts at zero, merge empty first block with next block
+	starts.RemovePartition((block == 0) ? 1 : block);
+	if (blocks[block].hot) {
+		hotBlocks.erase(std::find(hotBlocks.begin(), hotBlocks.end(), block));
+	}
+	blocks.erase(blocks.begin() + block);
+	ShiftHotBlocks(block + 1, -1);
+	cachedEnd = 0;
+}
+
+void CompressedStyles::InsertBlocks(Sci::Position index, Sci::Position position, Sci::Position insertLength, char value) {
+	// new blocks are encoded, filled with pairs of (value, UINT8_MAX)
+	const Sci::Position count = (insertLength + blockSize - 1) / blockSize;
+	std::vector<Block> inserted(count);
+	Sci::Position remaining = insertLength;
+	for (Block &blk : inserted) {
+		const Sci::Position length = std::min(remaining, blockSize);
+		remaining -= length;
+		const std::string run{value, static_cast<char>(UINT8_MAX)};
+		for (Sci::Position i = 0; i < length / (UINT8_MAX + 1); i++) {
+			blk.data += run;
+		}
+		if (const Sci::Position tail = length % (UINT8_MAX + 1); tail != 0) {
+			blk.data.push_back(value);
+			blk.data.push_back(static_cast<char>(tail - 1));
+		}
+		blk.encoded = true;
+	}
+
+	if (index == 0) {
+		// grow first block, then split new blocks from it
+		starts.InsertText(0, insertLength);
+		for (Sci::Position i = 1; i <= count; i++) {
+			starts.InsertPartition(i, std::min(i*blockSize, insertLength));
+		}
+	} else {
+		starts.InsertText(index - 1, insertLength);
+		for (Sci::Position i = 0; i < count; i++) {
+			starts.InsertPartition(index + i, position + i*blockSize);
+		}
+	}
+	blocks.insert(blocks.begin() + index, std::make_move_iterator(inserted.begin()), std::make_move_iterator(inserted.end()));
+	ShiftHotBlocks(index, count);
+	cachedEnd = 0;
+}
+
+char CompressedStyles::ValueAt(Sci::Position position) const {
+	if (!IsValidIndex(position, Length())) {
+		return '\0';
+	}
+	const Sci::Position block = BlockFromPosition(position);
+	return Decode(block)[position - cachedStart];
+}
+
+bool CompressedStyles::UpdateValueAt(Sci::Position position, char value) {
+	if (!IsValidIndex(position, Length())) {
+		return false;
+	}
+	const Sci::Position block = BlockFromPosition(position);
+	char *data = Decode(block) + (position - cachedStart);
+	if (*data != value) {
+		*data = value;
+		return true;
+	}
+	return false;
+}
+
+void CompressedStyles::GetRange(char *buffer, Sci::Position position, Sci::Position retrieveLength) const noexcept {
+	while (retrieveLength > 0) {
+		const Sci::Position block = BlockFromPosition(position);
+		Sci::Position offset = position - cachedStart;
+		const Sci::Position length = std::min(retrieveLength, cachedEnd - position);
+		const Block &blk = blocks[block];
+		if (blk.encoded) {
+			// expand runs without decoding the block
+			const char *ptr = blk.data.data();
+			Sci::Position remaining = length;
+			char *out = buffer;
+			while (remaining != 0) {
+				const Sci::Position run = static_cast<uint8_t>(ptr[1]) + 1;
+				if (offset < run) {
+					const Sci::Position count = std::min(run - offset, remaining);
+					memset(out, ptr[0], count);
+					out += count;
+					remaining -= count;
+					offset = 0;
+				} else {
+					offset -= run;
+				}
+				ptr += 2;
+			}
+		} else {
+			memcpy(buffer, blk.data.data() + offset, length);
+		}
+		buffer += length;
+		position += length;
+		retrieveLength -= length;
+	}
+}
+
+const char *CompressedStyles::RangePointer(Sci::Position position, Sci::Position rangeLength) {
+	const Sci::Position block = BlockFromPosition(position);
+	if (position + rangeLength <= cachedEnd) {
+		return Decode(block) + (position - cachedStart);
+	}
+	// range crosses blocks
+	rangeBuffer.resize(rangeLength);
+	GetRange(rangeBuffer.data(), position, rangeLength);
+	return rangeBuffer.data();
+}
+
+void CompressedStyles::InsertValue(Sci::Position position, Sci::Position insertLength, char value) {
+	if (insertLength <= 0) {
+		return;
+	}
+	const Sci::Position block = BlockFromPosition(position);
+	const Sci::Position start = cachedStart;
+	const Sci::Position end = cachedEnd;
+	if (insertLength < blockSize) {
+		Decode(block);
+		std::string &data = blocks[block].data;
+		data.insert(position - start, insertLength, value);
+		starts.InsertText(block, insertLength);
+		cachedEnd = 0;
+		if (static_cast<Sci::Position>(data.length()) >= 2*blockSize) {
+			SplitBlock(block, data.length() / 2);
+		}
+		return;
+	}
+
+	Sci::Position index = block;
+	if (position == end) {
+		index = block + 1;
+	} else if (position != start) {
+		SplitBlock(block, position - start);
+		index = block + 1;
+	}
+	InsertBlocks(index, position, insertLength, value);
+	if (start == end) {
+		// remove the empty block for empty document
+		RemoveEmptyBlock(block);
+	}
+}
+
+void CompressedStyles::DeleteRange(Sci::Position position, Sci::Position deleteLength) {
+	while (deleteLength > 0) {
+		const Sci::Position block = BlockFromPosition(position);
+		const Sci::Position start = cachedStart;
+		const Sci::Position end = cachedEnd;
+		const Sci::Position length = std::min(deleteLength, end - position);
+		if (position == start && length == end - start && blocks.size() > 1) {
+			starts.InsertText(block, -length);
+			RemoveEmptyBlock(block);
+		} else {
+			Decode(block);
+			blocks[block].data.erase(position - start, length);
+			starts.InsertText(block, -length);
+		}
+		cachedEnd = 0;
+		deleteLength -= length;
+	}
+}
+
+void CompressedStyles::DeleteAll() {
+	starts.DeleteAll();
+	blocks.clear();
+	blocks.emplace_back();
+	hotBlocks.clear();
+	rangeBuffer.clear();
+	rangeBuffer.shrink_to_fit();
+	cachedEnd = 0;
+}
+
+size_t CompressedStyles::MemoryUsage() const noexcept {
+	size_t size = sizeof(CompressedStyles) + blocks.capacity()*sizeof(Block) + rangeBuffer.capacity()
+		+ (starts.Partitions() + 1)*sizeof(Sci::Position);
+	for (const Block &blk : blocks) {
+		size += blk.data.capacity();
+	}
+	return size;
+}
+
+CellBuffer::CellBuffer(bool hasStyles_, bool largeDocument_, bool compressStyles_, bool lazyLineIndex_) :
+	hasStyles(hasStyles_), largeDocument(largeDocument_), lazyLineIndex(lazyLineIndex_) {
+	if (compressStyles_) {
+		compressedStyles = std::make_unique<CompressedStyles>();
+	}
 	readOnly = false;
 	utf8Substance = false;
 	utf8LineEnds = LineEndType::Default;
@@ -355,6 +648,7 @@ CellBuffer::CellBuffer(bool hasStyles_, bool largeDocument_) :
 		plv = std::make_unique<LineVector<Sci::Position>>();
 	else
 		plv = std::make_unique<LineVector<int>>();
+	lineIndexEnd = 0;
 }
 
 CellBuffer::~CellBuffer() noexcept = default;
@@ -382,6 +676,19 @@ void CellBuffer::GetCharRange(char *buffer, Sci::Position position, Sci::Positio
 }
 
 char CellBuffer::StyleAt(Sci::Position position) const noexcept {
+	if (compressedStyles) {
+		if (!hasStyles || !IsValidIndex(position, substance.Length())) {
+			return '\0';
+		}
+		try {
+			return compressedStyles->ValueAt(position);
+		} catch (...) {
+			// failed to decode the block, read the run directly
+			char value = '\0';
+			compressedStyles->GetRange(&value, position, 1);
+			return value;
+		}
+	}
 	return hasStyles ? style.ValueAt(position) : '\0';
 }
 
@@ -393,11 +700,15 @@ void CellBuffer::GetStyleRange(unsigned char *buffer, Sci::Position position, Sc
 		std::fill_n(buffer, lengthRetrieve, static_cast<unsigned char>(0));
 		return;
 	}
-	if ((position + lengthRetrieve) > style.Length()) {
+	if ((position + lengthRetrieve) > substance.Length()) {
 		//Platform::DebugPrintf("Bad GetStyleRange %.0f for %.0f of %.0f\n",
 		//					static_cast<double>(position),
 		//					static_cast<double>(lengthRetrieve),
-		//					static_cast<double>(style.Length()));
+		//					static_cast<double>(substance.Length()));
+		return;
+	}
+	if (compressedStyles) {
+		compressedStyles->GetRange(reinterpret_cast<char *>(buffer), position, lengthRetrieve);
 		return;
 	}
 	style.GetRange(reinterpret_cast<char *>(buffer), position, lengthRetrieve);
@@ -411,10 +722,23 @@ const char *CellBuffer::RangePointer(Sci::Position position, Sci::Position range
 	return substance.RangePointer(position, rangeLength);
 }
 
-const char *CellBuffer::StyleRangePointer(Sci::Position position, Sci::Position rangeLength) noexcept {
+const char *CellBuffer::StyleRangePointer(Sci::Position position, Sci::Position rangeLength) {
+	if (compressedStyles) {
+		return hasStyles ? compressedStyles->RangePointer(position, rangeLength) : nullptr;
+	}
 	return hasStyles ? style.RangePointer(position, rangeLength) : nullptr;
 }
 
+size_t CellBuffer::StyleMemoryUsage() const noexcept {
+	if (!hasStyles) {
+		return 0;
+	}
+	if (compressedStyles) {
+		return compressedStyles->MemoryUsage();
+	}
+	return style.Length();
+}
+
 Sci::Position CellBuffer::GapPosition() const noexcept {
 	return substance.GapPosition();
 }
@@ -442,16 +766,19 @@ const char *CellBuffer::InsertString(Sci::Position position, const char *s, Sci:
 	return data;
 }
 
-bool CellBuffer::SetStyleAt(Sci::Position position, char styleValue) noexcept {
+bool CellBuffer::SetStyleAt(Sci::Position position, char styleValue) {
+	if (compressedStyles) {
+		return compressedStyles->UpdateValueAt(position, styleValue);
+	}
 	return style.UpdateValueAt(position, styleValue);
 }
 
-bool CellBuffer::SetStyleFor(Sci::Position position, Sci::Position lengthStyle, char styleValue) noexcept {
+bool CellBuffer::SetStyleFor(Sci::Position position, Sci::Position lengthStyle, char styleValue) {
 	bool changed = false;
 	PLATFORM_ASSERT(lengthStyle == 0 ||
-		(lengthStyle > 0 && lengthStyle + position <= style.Length()));
+		(lengthStyle > 0 && lengthStyle + position <= substance.Length()));
 	while (lengthStyle--) {
-		if (style.UpdateValueAt(position, styleValue)) {
+		if (SetStyleAt(position, styleValue)) {
 			changed = true;
 		}
 		position++;
@@ -487,7 +814,7 @@ void CellBuffer::Allocate(Sci::Position newSize) {
 	//	throw std::runtime_error("CellBuffer::Allocate: size of standard document limited to 2G.");
 	//}
 	substance.ReAllocate(newSize);
-	if (hasStyles) {
+	if (hasStyles && !compressedStyles) {
 		style.ReAllocate(newSize);
 	}
 }
@@ -495,7 +822,13 @@ void CellBuffer::Allocate(Sci::Position newSize) {
 bool CellBuffer::EnsureStyleBuffer(bool hasStyles_) {
 	if (hasStyles != hasStyles_) {
 		hasStyles = hasStyles_;
-		if (hasStyles_) {
+		if (compressedStyles) {
+			if (hasStyles_) {
+				compressedStyles->InsertValue(0, substance.Length(), 0);
+			} else {
+				compressedStyles->DeleteAll();
+			}
+		} else if (hasStyles_) {
 			style.InsertValue(0, substance.Length(), 0);
 		} else {
 			style.DeleteAll();
@@ -721,6 +1054,12 @@ void CellBuffer::ResetLineEnds() {
 		chBeforePrev = chPrev;
 		chPrev = ch;
 	}
+	ResetLineIndex();
+}
+
+void CellBuffer::ResetLineIndex() noexcept {
+	lineIndexEnd = substance.Length();
+	lineCheckpoints.clear();
 }
 
 namespace {
@@ -738,6 +1077,34 @@ CountWidths CountCharacterWidthsUTF8(std::string_view sv) noexcept {
 	return cw;
 }
 
+// count CR, LF and CR+LF in [ptr, end), chNext is the character after end.
+Sci::Line CountLineEnds(const char *ptr, const char *end, char chNext) noexcept {
+	Sci::Line count = 0;
+#if NP2_USE_SSE2
+	if (ptr + sizeof(__m128i) < end) {
+		const __m128i vectCR = _mm_set1_epi8('\r');
+		const __m128i vectLF = _mm_set1_epi8('\n');
+		do {
+			const __m128i chunk = _mm_loadu_si128((const __m128i *)ptr);
+			// CR followed by LF is counted by the LF
+			const __m128i next = _mm_loadu_si128((const __m128i *)(ptr + 1));
+			const uint32_t maskLF = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, vectLF));
+			const uint32_t maskCR = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, vectCR))
+				& ~static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(next, vectLF)));
+			count += np2_popcount(maskLF | maskCR);
+			ptr += sizeof(__m128i);
+		} while (ptr + sizeof(__m128i) < end);
+	}
+#endif
+	while (ptr < end) {
+		const char ch = *ptr++;
+		if (ch == '\n' || (ch == '\r' && ((ptr < end) ? *ptr : chNext) != '\n')) {
+			count++;
+		}
+	}
+	return count;
+}
+
 }
 
 bool CellBuffer::MaintainingLineCharacterIndex() const noexcept {
@@ -764,6 +1131,14 @@ void CellBuffer::BasicInsertString(const Sci::Position position, const char * co
 		return;
 	PLATFORM_ASSERT(insertLength > 0);
 
+	// text appended to lazy indexed document is split into lines later by IndexLines()
+	const Sci::Position length = substance.Length();
+	const bool deferLineEnds = lazyLineIndex && position == length && utf8LineEnds == LineEndType::Default
+		&& !MaintainingLineCharacterIndex() && !(substance.ValueAt(position - 1) == '\r' && *s == '\n');
+	if (!deferLineEnds && lineIndexEnd < length) {
+		IndexLines(length);
+	}
+
 	const unsigned char chAfter = substance.ValueAt(position);
 	bool breakingUTF8LineEnd = false;
 	if (utf8LineEnds != LineEndType::Default && UTF8IsTrailByte(chAfter)) {
@@ -788,7 +1163,17 @@ void CellBuffer::BasicInsertString(const Sci::Position position, const char * co
 
 	substance.InsertFromArray(position, s, 0, insertLength);
 	if (hasStyles) {
-		style.InsertValue(position, insertLength, 0);
+		if (compressedStyles) {
+			compressedStyles->InsertValue(position, insertLength, 0);
+		} else {
+			style.InsertValue(position, insertLength, 0);
+		}
+	}
+	if (deferLineEnds) {
+		plv->InsertText(plv->Lines() - 1, insertLength);
+		// last checkpoint block may be extended
+		lineCheckpoints.resize(std::min<size_t>(lineCheckpoints.size(), position/lineCheckpointSize));
+		return;
 	}
 
 	const bool atLineStart = plv->LineStart(lineInsert - 1) == position;
@@ -1182,6 +1567,7 @@ void CellBuffer::BasicInsertString(const Sci::Position position, const char * co
 			RecalculateIndexLineStarts(linePosition, lineInsert - 1);
 		}
 	}
+	ResetLineIndex();
 }
 
 void CellBuffer::BasicDeleteChars(const Sci::Position position, const Sci::Position deleteLength) {
@@ -1195,6 +1581,9 @@ void CellBuffer::BasicDeleteChars(const Sci::Position position, const Sci::Posit
 		// than to delete each line.
 		plv->Init();
 	} else {
+		if (lineIndexEnd < substance.Length()) {
+			IndexLines(substance.Length());
+		}
 		// Have to fix up line positions before doing deletion as looking at text in buffer
 		// to work out which lines have been removed
 
@@ -1279,8 +1668,148 @@ void CellBuffer::BasicDeleteChars(const Sci::Position position, const Sci::Posit
 		RecalculateIndexLineStarts(lineRecalculateStart, lineRecalculateStart);
 	}
 	if (hasStyles) {
-		style.DeleteRange(position, deleteLength);
+		if (compressedStyles) {
+			compressedStyles->DeleteRange(position, deleteLength);
+		} else {
+			style.DeleteRange(position, deleteLength);
+		}
+	}
+	ResetLineIndex();
+}
+
+// Index line ends before limit and the first line end after it for lazy indexed document,
+// returns number of lines added.
+Sci::Line CellBuffer::IndexLines(Sci::Position limit) {
+	const Sci::Position length = substance.Length();
+	const Sci::Position start = lineIndexEnd;
+	if (limit <= start || start >= length) {
+		return 0;
+	}
+	assert(!MaintainingLineCharacterIndex());
+
+	constexpr size_t PositionBlockSize = 256;
+	Sci::Position positions[PositionBlockSize];
+	size_t nPositions = 0;
+	const Sci::Line linesBefore = plv->Lines();
+	Sci::Line lineInsert = linesBefore;
+
+	const char * const text = substance.RangePointer(start, length - start);
+	const char * const end = text + (length - start);
+	const char * const stop = text + (std::min(limit, length) - start);
+	const char *ptr = text;
+	const char *lineStart = text;
+	while (ptr < end && lineStart < stop) {
+#if NP2_USE_SSE2
+		if (ptr + sizeof(__m128i) < end) {
+			const __m128i chunk = _mm_loadu_si128((const __m128i *)ptr);
+			const __m128i next = _mm_loadu_si128((const __m128i *)(ptr + 1));
+			uint32_t mask = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n')));
+			// CR not followed by LF
+			mask |= _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\r')))
+				& ~static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(next, _mm_set1_epi8('\n'))));
+			if (mask) {
+				if (nPositions > PositionBlockSize - sizeof(__m128i)) {
+					plv->InsertLines(lineInsert, positions, nPositions, false);
+					lineInsert += nPositions;
+					nPositions = 0;
+				}
+				const Sci::Position offset = start + (ptr - text) + 1;
+				uint32_t trailing;
+				do {
+					trailing = np2_ctz(mask);
+					mask &= mask - 1;
+					positions[nPositions++] = offset + trailing;
+				} while (mask);
+				lineStart = ptr + trailing + 1;
+			}
+			ptr += sizeof(__m128i);
+			continue;
+		}
+#endif
+		const char ch = *ptr++;
+		if (ch == '\n' || (ch == '\r' && (ptr == end || *ptr != '\n'))) {
+			if (nPositions == PositionBlockSize) {
+				plv->InsertLines(lineInsert, positions, nPositions, false);
+				lineInsert += nPositions;
+				nPositions = 0;
+			}
+			positions[nPositions++] = start + (ptr - text);
+			lineStart = ptr;
+		}
+	}
+	if (nPositions != 0) {
+		plv->InsertLines(lineInsert, positions, nPositions, false);
+		lineInsert += nPositions;
+	}
+	lineIndexEnd = start + (ptr - text);
+	return lineInsert - linesBefore;
+}
+
+// Count line ends for checkpoint blocks before limit.
+void CellBuffer::CountLineCheckpoints(Sci::Position limit) {
+	const Sci::Position length = substance.Length();
+	limit = std::min(limit, length);
+	Sci::Position blockStart = static_cast<Sci::Position>(lineCheckpoints.size())*lineCheckpointSize;
+	while (blockStart < limit) {
+		const Sci::Position blockEnd = std::min(blockStart + lineCheckpointSize, length);
+		Sci::Line count;
+		if (blockEnd <= lineIndexEnd) {
+			count = plv->LineFromPosition(blockEnd);
+		} else {
+			const Sci::Position start = std::max(blockStart, lineIndexEnd);
+			count = (blockStart <= lineIndexEnd) ? plv->Lines() - 1 : lineCheckpoints.back();
+			const char *text = substance.RangePointer(start, blockEnd - start);
+			count += CountLineEnds(text, text + (blockEnd - start), substance.ValueAt(blockEnd));
+		}
+		lineCheckpoints.push_back(count);
+		blockStart = blockEnd;
+	}
+}
+
+// Returns position for IndexLines() to index at least lineEnds line ends,
+// found from checkpoints without indexing text before it.
+Sci::Position CellBuffer::LineIndexLimit(Sci::Line lineEnds) {
+	const Sci::Position length = substance.Length();
+	if (lineEnds < plv->Lines() || lineIndexEnd >= length) {
+		return lineIndexEnd;
+	}
+	// use index instead of iterator, as counting more checkpoints reallocates the vector
+	size_t index = std::lower_bound(lineCheckpoints.begin(), lineCheckpoints.end(), lineEnds) - lineCheckpoints.begin();
+	while (index == lineCheckpoints.size()) {
+		const Sci::Position counted = static_cast<Sci::Position>(lineCheckpoints.size())*lineCheckpointSize;
+		if (counted >= length) {
+			return length;
+		}
+		// one checkpoint is added for next block
+		CountLineCheckpoints(counted + lineCheckpointSize);
+		if (lineCheckpoints.back() < lineEnds) {
+			index++;
+		}
+	}
+	const Sci::Position blockEnd = static_cast<Sci::Position>(index + 1)*lineCheckpointSize;
+	return std::min(blockEnd, length);
+}
+
+// Line count for lazy indexed document, extrapolated from average line length of counted text.
+Sci::Line CellBuffer::LinesEstimate() const noexcept {
+	const Sci::Line lines = plv->Lines();
+	const Sci::Position length = substance.Length();
+	if (lineIndexEnd >= length) {
+		return lines;
+	}
+	Sci::Line counted = lines - 1;
+	Sci::Position countedEnd = lineIndexEnd;
+	if (!lineCheckpoints.empty()) {
+		const Sci::Position blockEnd = std::min(static_cast<Sci::Position>(lineCheckpoints.size())*lineCheckpointSize, length);
+		if (blockEnd > countedEnd) {
+			counted = lineCheckpoints.back();
+			countedEnd = blockEnd;
+		}
+	}
+	if (countedEnd == 0 || countedEnd >= length) {
+		return counted + 1;
 	}
+	return counted + 1 + static_cast<Sci::Line>(static_cast<double>(length - countedEnd)*counted/countedEnd);
 }
 
 bool CellBuffer::SetUndoCollection(bool collectUndo) noexcept {
@@ -61,6 +61,63 @@ struct SplitView {
 	}
 };
 
+/**
+ * Style storage for large document that splits styles into blocks.
+ * Blocks not recently used are run-length encoded, and decoded on demand.
+ */
+class CompressedStyles {
+public:
+	static constexpr Sci::Position blockSize = 64*1024;
+	static constexpr size_t maxDecodedBlocks = 32;
+
+	CompressedStyles();
+	// Deleted so CompressedStyles objects can not be copied.
+	CompressedStyles(const CompressedStyles &) = delete;
+	CompressedStyles(CompressedStyles &&) = delete;
+	void operator=(const CompressedStyles &) = delete;
+	void operator=(CompressedStyles &&) = delete;
+	~CompressedStyles() noexcept;
+
+	Sci::Position Length() const noexcept {
+		return starts.Length();
+	}
+	// may decode the block, which allocates
+	char ValueAt(Sci::Position position) const;
+	bool UpdateValueAt(Sci::Position position, char value);
+	const char *RangePointer(Sci::Position position, Sci::Position rangeLength);
+	// reads runs of encoded block directly, never allocates
+	void GetRange(char *buffer, Sci::Position position, Sci::Position retrieveLength) const noexcept;
+	void InsertValue(Sci::Position position, Sci::Position insertLength, char value);
+	void DeleteRange(Sci::Position position, Sci::Position deleteLength);
+	void DeleteAll();
+	size_t MemoryUsage() const noexcept;
+
+private:
+	struct Block {
+		std::string data;	// styles, or pairs of (style, run length - 1) when encoded
+		uint32_t lastUse = 0;
+		bool encoded = false;
+		bool hot = false;	// recently used, will be encoded again when evicted from hotBlocks
+	};
+	Partitioning<Sci::Position> starts;
+	mutable std::vector<Block> blocks;
+	mutable std::vector<Sci::Position> hotBlocks;
+	std::string rangeBuffer;
+	mutable uint32_t useClock = 0;
+	// cache of last accessed block
+	mutable Sci::Position cachedBlock = -1;
+	mutable Sci::Position cachedStart = 0;
+	mutable Sci::Position cachedEnd = 0;
+
+	Sci::Position BlockFromPosition(Sci::Position position) const noexcept;
+	char *Decode(Sci::Position block) const;
+	void EncodeLeastRecentlyUsed() const;
+	void InsertBlocks(Sci::Position index, Sci::Position position, Sci::Position insertLength, char value);
+	void SplitBlock(Sci::Position block, Sci::Position offset);
+	void RemoveEmptyBlock(Sci::Position block);
+	void ShiftHotBlocks(Sci::Position block, Sci::Position delta) noexcept;
+};
+
 /**
  * Holder for an expandable array of characters that supports undo and line markers.
  * Based on article "Data Structures in a Bit-Mapped Text Editor"
@@ -70,11 +127,13 @@ class CellBuffer {
 private:
 	bool hasStyles;
 	const bool largeDocument;
+	const bool lazyLineIndex;
 	bool readOnly;
 	bool utf8Substance;
 	Scintilla::LineEndType utf8LineEnds;
 	SplitVector<char> substance;
 	SplitVector<char> style;
+	std::unique_ptr<CompressedStyles> compressedStyles;
 
 	bool collectingUndo;
 	std::unique_ptr<UndoHistory> uh;
@@ -83,6 +142,12 @@ private:
 
 	std::unique_ptr<ILineVector> plv;
 
+	// Lazy line index: line ends after lineIndexEnd are not indexed yet,
+	// that text is treated as part of last line.
+	Sci::Position lineIndexEnd;
+	// sparse checkpoints: count of line ends before end of each checkpoint block
+	std::vector<Sci::Line> lineCheckpoints;
+
 	bool UTF8LineEndOverlaps(Sci::Position position) const noexcept;
 	bool UTF8IsCharacterBoundary(Sci::Position position) const;
 	void ResetLineEnds();
@@ -91,9 +156,12 @@ private:
 	/// Actions without undo
 	void BasicInsertString(Sci::Position position, const char *s, Sci::Position insertLength);
 	void BasicDeleteChars(Sci::Position position, Sci::Position deleteLength);
+	void ResetLineIndex() noexcept;
 
 public:
-	CellBuffer(bool hasStyles_, bool largeDocument_);
+	static constexpr Sci::Position lineCheckpointSize = 4*1024*1024;
+
+	CellBuffer(bool hasStyles_, bool largeDocument_, bool compressStyles_ = false, bool lazyLineIndex_ = false);
 	// Deleted so CellBuffer objects can not be copied.
 	CellBuffer(const CellBuffer &) = delete;
 	CellBuffer(CellBuffer &&) = delete;
@@ -109,7 +177,7 @@ public:
 	void GetStyleRange(unsigned char *buffer, Sci::Position position, Sci::Position lengthRetrieve) const noexcept;
 	const char *BufferPointer();
 	const char *RangePointer(Sci::Position position, Sci::Position rangeLength) noexcept;
-	const char *StyleRangePointer(Sci::Position position, Sci::Position rangeLength) noexcept;
+	const char *StyleRangePointer(Sci::Position position, Sci::Position rangeLength);
 	Sci::Position GapPosition() const noexcept;
 	SplitView AllView() const noexcept;
 
@@ -139,12 +207,22 @@ public:
 	Sci::Line LineFromPositionIndex(Sci::Position pos, Scintilla::LineCharacterIndexType lineCharacterIndex) const noexcept;
 	void InsertLine(Sci::Line line, Sci::Position position, bool lineStart);
 	void RemoveLine(Sci::Line line);
+	bool IsLineIndexComplete() const noexcept {
+		return lineIndexEnd >= substance.Length();
+	}
+	Sci::Position LineIndexEnd() const noexcept {
+		return lineIndexEnd;
+	}
+	Sci::Line IndexLines(Sci::Position limit);
+	void CountLineCheckpoints(Sci::Position limit);
+	Sci::Position LineIndexLimit(Sci::Line lineEnds);
+	Sci::Line LinesEstimate() const noexcept;
 	const char *InsertString(Sci::Position position, const char *s, Sci::Position insertLength, bool &startSequence);
 
 	/// Setting styles for positions outside the range of the buffer is safe and has no effect.
 	/// @return true if the style of a character is changed.
-	bool SetStyleAt(Sci::Position position, char styleValue) noexcept;
-	bool SetStyleFor(Sci::Position position, Sci::Position lengthStyle, char styleValue) noexcept;
+	bool SetStyleAt(Sci::Position position, char styleValue);
+	bool SetStyleFor(Sci::Position position, Sci::Position lengthStyle, char styleValue);
 
 	const char *DeleteChars(Sci::Position position, Sci::Position deleteLength, bool &startSequence);
 
@@ -160,6 +238,10 @@ public:
 	bool HasStyles() const noexcept {
 		return hasStyles;
 	}
+	bool IsStylesCompressed() const noexcept {
+		return compressedStyles != nullptr;
+	}
+	size_t StyleMemoryUsage() const noexcept;
 
 	/// The save point is a marker in the undo stack where the container has stated that
 	/// the buffer was saved. Undo and redo can move over the save point.
@@ -38,11 +38,13 @@
 #include "ILexer.h"
 
 #include "Debugging.h"
-//#include "VectorISA.h"
+#include "VectorISA.h"
+#include "VectorKernels.h"
 
 #include "CharacterSet.h"
 //#include "CharacterCategory.h"
 #include "Position.h"
+#include "UniqueString.h"
 #include "SplitVector.h"
 #include "Partitioning.h"
 #include "RunStyles.h"
@@ -94,6 +96,10 @@ void LexInterface::Colourise(Sci::Position start, Sci::Position end) {
 	}
 }
 
+bool LexInterface::GetCheckpointMask(int &mask) const {
+	return instance && instance->PrivateCall(pcCheckpointMask, &mask) != nullptr;
+}
+
 bool LexInterface::UseContainerLexing() const noexcept {
 	return !instance;
 }
@@ -141,7 +147,8 @@ CharacterExtracted::CharacterExtracted(const unsigned char *charBytes, size_t wi
 }
 
 Document::Document(DocumentOption options) :
-	cb(!FlagSet(options, DocumentOption::StylesNone), FlagSet(options, DocumentOption::TextLarge)),
+	cb(!FlagSet(options, DocumentOption::StylesNone), FlagSet(options, DocumentOption::TextLarge), FlagSet(options, DocumentOption::StylesCompressed), FlagSet(options, DocumentOption::ViewOnly)),
+	viewOnly(FlagSet(options, DocumentOption::ViewOnly)),
 	durationStyleOneUnit(1e-6) {
 	refCount = 0;
 #ifdef _WIN32
@@ -152,6 +159,9 @@ Document::Document(DocumentOption options) :
 	dbcsCodePage = CpUtf8;
 	lineEndBitSet = LineEndType::Default;
 	endStyled = 0;
+	staleStyledEnd = 0;
+	modifiedStyledEnd = 0;
+	styleWindowStart = 0;
 	styleClock = 0;
 	enteredModification = 0;
 	enteredStyling = 0;
@@ -351,7 +361,7 @@ void Document::TentativeUndo() {
 				}
 				cb.PerformUndoStep();
 				if (action.at != ActionType::container) {
-					ModifiedAt(action.position);
+					ModifiedText(action.position, (action.at == ActionType::remove) ? action.lenData : -action.lenData);
 				}
 
 				ModificationFlags modFlags = ModificationFlags::Undo;
@@ -1287,8 +1297,31 @@ EncodingFamily Document::CodePageFamily() const noexcept {
 }
 
 void Document::ModifiedAt(Sci::Position pos) noexcept {
+	staleStyledEnd = 0;
+	if (endStyled > pos)
+		endStyled = pos;
+	if (styleWindowStart > endStyled)
+		styleWindowStart = endStyled;
+}
+
+// Text inserted (lengthChange > 0) or deleted at pos, styles after the modification are kept as stale.
+void Document::ModifiedText(Sci::Position pos, Sci::Position lengthChange) noexcept {
+	const Sci::Position styledEnd = std::max(endStyled, staleStyledEnd);
+	if (pos < styledEnd) {
+		Sci::Position modifiedEnd = pos + std::max<Sci::Position>(lengthChange, 0);
+		if (staleStyledEnd > endStyled && modifiedStyledEnd > pos) {
+			modifiedEnd = std::max(modifiedEnd, modifiedStyledEnd + lengthChange);
+		}
+		modifiedStyledEnd = modifiedEnd;
+		staleStyledEnd = std::max(pos, styledEnd + lengthChange);
+	}
+	if (pos != 0 && pos >= LengthNoExcept()) {
+		--pos;
+	}
 	if (endStyled > pos)
 		endStyled = pos;
+	if (styleWindowStart > endStyled)
+		styleWindowStart = endStyled;
 }
 
 void Document::CheckReadOnly() noexcept {
@@ -1337,10 +1370,7 @@ bool Document::DeleteChars(Sci::Position pos, Sci::Position len) {
 			const char *text = cb.DeleteChars(pos, len, startSequence);
 			if (startSavePoint && cb.IsCollectingUndo())
 				NotifySavePoint(false);
-			if ((pos < LengthNoExcept()) || (pos == 0))
-				ModifiedAt(pos);
-			else
-				ModifiedAt(pos - 1);
+			ModifiedText(pos, -len);
 			NotifyModified(
 				DocModification(
 					ModificationFlags::DeleteText | ModificationFlags::User |
@@ -1417,7 +1447,7 @@ Sci::Position Document::InsertString(Sci::Position position, const char *s, Sci:
 #endif
 	if (startSavePoint && cb.IsCollectingUndo())
 		NotifySavePoint(false);
-	ModifiedAt(position);
+	ModifiedText(position, insertLength);
 	NotifyModified(
 		DocModification(
 			ModificationFlags::InsertText | ModificationFlags::User |
@@ -1483,7 +1513,7 @@ Sci::Position Document::Undo() {
 				}
 				cb.PerformUndoStep();
 				if (action.at != ActionType::container) {
-					ModifiedAt(action.position);
+					ModifiedText(action.position, (action.at == ActionType::remove) ? action.lenData : -action.lenData);
 					newPos = action.position;
 				}
 
@@ -1550,7 +1580,7 @@ Sci::Position Document::Redo() {
 				}
 				cb.PerformRedoStep();
 				if (action.at != ActionType::container) {
-					ModifiedAt(action.position);
+					ModifiedText(action.position, (action.at == ActionType::insert) ? action.lenData : -action.lenData);
 					newPos = action.position;
 				}
 
@@ -1687,10 +1717,102 @@ Sci::Position Document::GetColumn(Sci::Position pos) const noexcept {
 	return column;
 }
 
+namespace {
+
+// Count characters (and columns) for text started before limit, text after limit is only used
+// to classify character that crosses limit. invalid UTF-8 byte is counted as one character.
+// Returns offset after last counted character, which may exceed limit.
+template <bool withColumn>
+size_t CountCharactersInBuffer(const char *s, size_t limit, size_t length, bool utf8, int tabInChars, Sci::Position &count, Sci::Position &column) noexcept {
+	size_t index = 0;
+	while (index < limit) {
+#if NP2_USE_SSE2
+		if (index + sizeof(__m128i) <= limit) {
+			const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + index));
+			uint32_t mask = _mm_movemask_epi8(chunk);
+			if constexpr (withColumn) {
+				mask |= _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\t')));
+			}
+			if (mask == 0) {
+				count += sizeof(__m128i);
+				if constexpr (withColumn) {
+					column += sizeof(__m128i);
+				}
+				index += sizeof(__m128i);
+				continue;
+			}
+			// skip leading ASCII characters
+			const uint32_t trailing = np2::ctz(mask);
+			count += trailing;
+			if constexpr (withColumn) {
+				column += trailing;
+			}
+			index += trailing;
+		}
+#endif
+		const unsigned char ch = s[index];
+		++count;
+		if (UTF8IsAscii(ch) || !utf8) {
+			++index;
+			if constexpr (withColumn) {
+				column = (ch == '\t') ? NextTab(column, tabInChars) : (column + 1);
+			}
+		} else {
+			const int utf8status = UTF8ClassifyMulti(reinterpret_cast<const unsigned char *>(s + index), length - index);
+			index += (utf8status & UTF8MaskInvalid) ? 1 : (utf8status & UTF8MaskWidth);
+			if constexpr (withColumn) {
+				++column;
+			}
+		}
+	}
+	return index;
+}
+
+template <bool withColumn>
+void CountCharactersInRange(const CellBuffer &cb, Sci::Position startPos, Sci::Position endPos, bool utf8, int tabInChars, Sci::Position &count, Sci::Position &column) noexcept {
+	constexpr Sci::Position chunkSize = 4096;
+	char buffer[chunkSize + UTF8MaxBytes];
+	const Sci::Position lengthDoc = cb.Length();
+	while (startPos < endPos) {
+		const Sci::Position limit = std::min(chunkSize, endPos - startPos);
+		// retrieve enough bytes to classify character at the end of chunk
+		const Sci::Position length = std::min(limit + UTF8MaxBytes, lengthDoc - startPos);
+		cb.GetCharRange(buffer, startPos, length);
+		startPos += CountCharactersInBuffer<withColumn>(buffer, limit, length, utf8, tabInChars, count, column);
+	}
+}
+
+}
+
 Sci::Position Document::CountCharacters(Sci::Position startPos, Sci::Position endPos) const noexcept {
 	startPos = MovePositionOutsideChar(startPos, 1, false);
 	endPos = MovePositionOutsideChar(endPos, -1, false);
+	if (startPos >= endPos) {
+		return 0;
+	}
+	if (dbcsCodePage == 0) {
+		return endPos - startPos;
+	}
+
 	Sci::Position count = 0;
+	if (CpUtf8 == dbcsCodePage) {
+		Sci::Position column = 0;
+		if (FlagSet(cb.LineCharacterIndex(), LineCharacterIndexType::Utf32)) {
+			// only count partial lines at both ends
+			const Sci::Line lineStart = SciLineFromPosition(startPos) + 1;
+			const Sci::Line lineEnd = SciLineFromPosition(endPos);
+			if (lineStart <= lineEnd) {
+				const Sci::Position posLineStart = LineStart(lineStart);
+				const Sci::Position posLineEnd = LineStart(lineEnd);
+				CountCharactersInRange<false>(cb, startPos, posLineStart, true, tabInChars, count, column);
+				count += cb.IndexLineStart(lineEnd, LineCharacterIndexType::Utf32) - cb.IndexLineStart(lineStart, LineCharacterIndexType::Utf32);
+				startPos = posLineEnd;
+			}
+		}
+		CountCharactersInRange<false>(cb, startPos, endPos, true, tabInChars, count, column);
+		return count;
+	}
+
 	Sci::Position i = startPos;
 	while (i < endPos) {
 		count++;
@@ -1706,20 +1828,24 @@ void Document::CountCharactersAndColumns(sptr_t lParam) const noexcept {
 	Sci::Position count = ft->chrgText.cpMin;
 	Sci::Position column = ft->chrgText.cpMax;
 
-	Sci::Position i = startPos;
-	while (i < endPos) {
-		const unsigned char ch = cb.UCharAt(i);
-		if (ch == '\t') {
-			column = NextTab(column, tabInChars);
-			i++;
-		} else if (UTF8IsAscii(ch)) {
-			column++;
-			i++;
-		} else {
-			column++;
-			i = NextPosition(i, 1);
+	if (CpUtf8 == dbcsCodePage || dbcsCodePage == 0) {
+		CountCharactersInRange<true>(cb, startPos, endPos, dbcsCodePage != 0, tabInChars, count, column);
+	} else {
+		Sci::Position i = startPos;
+		while (i < endPos) {
+			const unsigned char ch = cb.UCharAt(i);
+			if (ch == '\t') {
+				column = NextTab(column, tabInChars);
+				i++;
+			} else if (UTF8IsAscii(ch)) {
+				column++;
+				i++;
+			} else {
+				column++;
+				i = NextPosition(i, 1);
+			}
+			count++;
 		}
-		count++;
 	}
 
 	ft->chrgText.cpMin = count;
@@ -1856,7 +1982,9 @@ std::string_view Document::EOLString() const noexcept {
 
 DocumentOption Document::Options() const noexcept {
 	return (IsLarge() ? DocumentOption::TextLarge : DocumentOption::Default) |
-		(cb.HasStyles() ? DocumentOption::Default : DocumentOption::StylesNone);
+		(cb.HasStyles() ? DocumentOption::Default : DocumentOption::StylesNone) |
+		(cb.IsStylesCompressed() ? DocumentOption::StylesCompressed : DocumentOption::Default) |
+		(viewOnly ? DocumentOption::ViewOnly : DocumentOption::Default);
 }
 
 bool Document::IsWhiteLine(Sci::Line line) const noexcept {
@@ -2280,6 +2408,12 @@ Sci::Position Document::FindText(Sci::Position minPos, Sci::Position maxPos, con
 			constexpr size_t maxFoldingExpansion = 4;
 			searchThing.Allocate((lengthFind + 1) * UTF8MaxBytes * maxFoldingExpansion + 1);
 			const size_t lenSearch = pcf->Fold(searchThing.data(), searchThing.size(), search, lengthFind);
+			if (direction >= 0 && lenSearch != 0) {
+				const auto found = FindFoldedText(pos, endPos, std::string_view{searchThing.data(), lenSearch}, word, wordStart, length);
+				if (found) {
+					return *found;
+				}
+			}
 			const unsigned char * const searchData = reinterpret_cast<const unsigned char *>(searchThing.data());
 			//while (forward ? (pos < endPos) : (pos >= endPos)) {
 			while ((direction ^ (pos - endPos)) < 0) {
@@ -2428,6 +2562,71 @@ Sci::Position Document::FindText(Sci::Position minPos, Sci::Position maxPos, con
 	return -1;
 }
 
+// Forward case-insensitive search for UTF-8 document: fold the document chunk by chunk
+// into scratch buffer, search folded text with SIMD substring kernel, then map match
+// back to document positions. Same result as folding character by character in FindText(),
+// returns std::nullopt when case folder doesn't support FoldText().
+std::optional<Sci::Position> Document::FindFoldedText(Sci::Position startPos, Sci::Position endPos, std::string_view search, bool word, bool wordStart, Sci::Position *length) const {
+	// a match occupies at most UTF8MaxBytes for each folded byte.
+	const Sci::Position overlap = static_cast<Sci::Position>(search.length()) * UTF8MaxBytes;
+	// chunk size is doubled for each chunk, so dense matches (e.g. Mark All) don't fold too much text.
+	constexpr Sci::Position maxChunkSize = 64*1024;
+	Sci::Position chunkSize = std::max<Sci::Position>(256, 2*overlap);
+	std::unique_ptr<char[]> mixed;
+	std::unique_ptr<char[]> folded;
+	std::unique_ptr<uint32_t[]> starts;
+	Sci::Position allocated = 0;
+
+	Sci::Position chunkStart = startPos;
+	while (chunkStart < endPos) {
+		Sci::Position chunkEnd = endPos;
+		if (chunkEnd - chunkStart > chunkSize) {
+			chunkEnd = MovePositionOutsideChar(chunkStart + chunkSize, -1, false);
+		}
+		const Sci::Position lenMixed = chunkEnd - chunkStart;
+		if (lenMixed > allocated) {
+			allocated = lenMixed;
+			mixed = make_unique_for_overwrite<char[]>(allocated);
+			folded = make_unique_for_overwrite<char[]>(allocated*maxFoldTextExpansion + 1);
+			starts = make_unique_for_overwrite<uint32_t[]>(allocated*maxFoldTextExpansion + 1);
+		}
+		cb.GetCharRange(mixed.get(), chunkStart, lenMixed);
+		const size_t lenFolded = pcf->FoldText(folded.get(), starts.get(), mixed.get(), lenMixed);
+		if (lenFolded == 0) {
+			return std::nullopt;
+		}
+
+		const char * const foldedText = folded.get();
+		size_t offset = 0;
+		while (offset + search.length() <= lenFolded) {
+			const char *found = np2::vectorKernels.FindSubstring(foldedText + offset, lenFolded - offset, search.data(), search.length());
+			if (found == nullptr) {
+				break;
+			}
+			const size_t index = found - foldedText;
+			const uint32_t start = starts[index];
+			const uint32_t end = starts[index + search.length()];
+			// match should begin and end at character boundary
+			if (start != foldedContinuation && end != foldedContinuation) {
+				const Sci::Position pos = chunkStart + start;
+				if (MatchesWordOptions(word, wordStart, pos, end - start)) {
+					*length = end - start;
+					return pos;
+				}
+			}
+			offset = index + 1;
+		}
+		if (chunkEnd >= endPos) {
+			break;
+		}
+		// match crossing chunk end starts within overlap bytes before it
+		const Sci::Position next = std::max(chunkEnd - overlap, chunkStart + 1);
+		chunkStart = MovePositionOutsideChar(next, 1, false);
+		chunkSize = std::max(chunkSize, std::min(2*chunkSize, maxChunkSize));
+	}
+	return -1;
+}
+
 const char *Document::SubstituteByPosition(const char *text, Sci::Position *length) {
 	if (regex)
 		return regex->SubstituteByPosition(this, text, length);
@@ -2440,6 +2639,8 @@ LineCharacterIndexType Document::LineCharacterIndex() const noexcept {
 }
 
 void Document::AllocateLineCharacterIndex(LineCharacterIndexType lineCharacterIndex) {
+	// character index is maintained for every line
+	IndexLines(LengthNoExcept());
 	cb.AllocateLineCharacterIndex(lineCharacterIndex);
 }
 
@@ -2451,6 +2652,35 @@ void Document::AllocateLines(Sci::Line lines) {
 	cb.AllocateLines(lines);
 }
 
+// Lazy line index for view only document: text after indexed lines is treated as part of last line,
+// indexing splits it into lines without modifying text.
+bool Document::IndexLines(Sci::Position limit) {
+	const Sci::Line lineLast = LinesTotal() - 1;
+	const Sci::Line linesAdded = cb.IndexLines(limit);
+	if (linesAdded == 0) {
+		return false;
+	}
+	const DocModification mh(ModificationFlags::None, LineStart(lineLast + 1), 0, linesAdded, nullptr, lineLast);
+	NotifyModified(mh);
+	return true;
+}
+
+bool Document::IndexLinesTo(Sci::Line line) {
+	if (cb.IsLineIndexComplete() || line < LinesTotal() - 1) {
+		return false;
+	}
+	// index line ends up to end of the line
+	return IndexLines(cb.LineIndexLimit(line + 1));
+}
+
+Sci::Position Document::IndexLinesStep(Sci::Position length) {
+	const Sci::Position start = cb.LineIndexEnd();
+	// counting line ends is much faster than building line index
+	cb.CountLineCheckpoints(start + 4*length);
+	IndexLines(start + length);
+	return cb.LineIndexEnd();
+}
+
 void Document::SetDefaultCharClasses(bool includeWordClass) noexcept {
 	charClass.SetDefaultCharClasses(includeWordClass);
 }
@@ -2478,6 +2708,10 @@ int Document::CharacterCategoryOptimization() const noexcept {
 #endif
 
 void SCI_METHOD Document::StartStyling(Sci_Position position) noexcept {
+	if (!(pli && pli->PerformingStyle())) {
+		// restarted by container or SCI_CLEARDOCUMENTSTYLE, stale styles are not from the lexer
+		staleStyledEnd = 0;
+	}
 	endStyled = position;
 }
 
@@ -2527,11 +2761,21 @@ bool SCI_METHOD Document::SetStyles(Sci_Position length, const unsigned char *st
 }
 
 void Document::EnsureStyledTo(Sci::Position pos) {
+	if (viewOnly && enteredStyling == 0) {
+		MoveStyleWindow(pos);
+	}
 	if ((enteredStyling == 0) && (pos > GetEndStyled())) {
 		IncrementStyleClock();
 		if (pli && !pli->UseContainerLexing()) {
 			const Sci::Position endStyledTo = LineStartPosition(GetEndStyled());
-			pli->Colourise(endStyledTo, pos);
+			int checkpointMask = 0;
+			if (staleStyledEnd > endStyled && pos > modifiedStyledEnd && pli->GetCheckpointMask(checkpointMask)) {
+				ColouriseToCheckpoint(endStyledTo, pos, checkpointMask);
+			} else {
+				pli->Colourise(endStyledTo, pos);
+			}
+			// lexer may have changed fold level for the line contains endStyled
+			modifiedStyledEnd = std::max(modifiedStyledEnd, endStyled);
 		} else {
 			// Ask the watchers to style, and stop as soon as one responds.
 			for (auto it = watchers.begin();
@@ -2542,17 +2786,84 @@ void Document::EnsureStyledTo(Sci::Position pos) {
 	}
 }
 
+// Lex lines after the modification in growing chunks, stop at first checkpoint where
+// line state, fold levels and style at line end are same as lexing before the modification,
+// then styles until staleStyledEnd are still valid.
+void Document::ColouriseToCheckpoint(Sci::Position start, Sci::Position end, int checkpointMask) {
+	constexpr Sci::Line maxChunkLines = 256;
+	const Sci::Line lineModified = SciLineFromPosition(modifiedStyledEnd);
+	Sci::Line line = SciLineFromPosition(start);
+	Sci::Line chunkLines = 2;
+	while (start < end) {
+		// per line data for the line contains modification end may come from its adjacent line
+		const Sci::Line lineNext = std::max(line + chunkLines, lineModified + 2);
+		const Sci::Position chunkEnd = LineStart(lineNext);
+		if (chunkEnd >= end || chunkEnd >= staleStyledEnd) {
+			pli->Colourise(start, end);
+			return;
+		}
+
+		const Sci::Line lineLast = lineNext - 1;
+		const int lineState = GetLineState(lineLast);
+		const int level = GetLevel(lineLast);
+		const int levelNext = GetLevel(lineNext);
+		const unsigned char style = StyleAt(chunkEnd - 1);
+		pli->Colourise(start, chunkEnd);
+		if (endStyled < chunkEnd) {
+			return;	// reentrant styling
+		}
+		if (endStyled == chunkEnd && (lineState & checkpointMask) == 0
+			&& lineState == GetLineState(lineLast) && style == StyleAt(chunkEnd - 1)
+			&& level == GetLevel(lineLast) && levelNext == GetLevel(lineNext)) {
+			endStyled = staleStyledEnd;
+			return;
+		}
+		// next chunk starts from last line, so it's folded again after following line been lexed
+		line = lineLast;
+		start = LineStart(line);
+		chunkLines = std::min(chunkLines*2, maxChunkLines);
+	}
+}
+
+// View only document only keeps styles for a window before the requested position,
+// styles outside the window are reset to default and lexing restarts from window start.
+void Document::MoveStyleWindow(Sci::Position pos) {
+	constexpr Sci::Position styleWindowSize = 1024*1024;
+	Sci::Position clearStart = styleWindowStart;
+	Sci::Position clearEnd = endStyled;
+	if (pos > endStyled + styleWindowSize || (styleWindowStart != 0 && pos < styleWindowStart + styleWindowSize/2)) {
+		// jump forward or scroll backward, discard whole window
+		styleWindowStart = LineStart(SciLineFromPosition(std::max<Sci::Position>(pos - styleWindowSize, 0)));
+		endStyled = styleWindowStart;
+		staleStyledEnd = 0;
+	} else if (pos > styleWindowStart + 2*styleWindowSize) {
+		// scroll forward, discard styles far before pos
+		styleWindowStart = LineStart(SciLineFromPosition(pos - styleWindowSize));
+		clearEnd = std::min(styleWindowStart, endStyled);
+	} else {
+		return;
+	}
+	if (clearEnd > clearStart && cb.SetStyleFor(clearStart, clearEnd - clearStart, 0)) {
+		const DocModification mh(ModificationFlags::ChangeStyle, clearStart, clearEnd - clearStart);
+		NotifyModified(mh);
+	}
+}
+
 void Document::StyleToAdjustingLineDuration(Sci::Position pos) {
 	const Sci::Position stylingStart = GetEndStyled();
 	const ElapsedPeriod epStyling;
 	EnsureStyledTo(pos);
-	const Sci::Position bytesBeingStyled = GetEndStyled() - stylingStart;
+	// styles after pos may be kept by relex checkpoint without lexing
+	const Sci::Position bytesBeingStyled = std::min(GetEndStyled(), std::max(pos, stylingStart)) - stylingStart;
 	durationStyleOneUnit.AddSample(bytesBeingStyled, epStyling.Duration());
 }
 
 void Document::LexerChanged(bool hasStyles_) { //! removed in Scintilla 5.3
 	if (cb.EnsureStyleBuffer(hasStyles_)) {
 		endStyled = 0;
+		staleStyledEnd = 0;
+		styleWindowStart = 0;
+		braceIndex.Clear();
 	}
 }
 
@@ -2775,8 +3086,12 @@ void Document::NotifySavePoint(bool atSavePoint) noexcept {
 void Document::NotifyModified(DocModification mh) {
 	if (FlagSet(mh.modificationType, ModificationFlags::InsertText)) {
 		decorations->InsertSpace(mh.position, mh.length);
+		braceIndex.InsertText(mh.position, mh.length);
 	} else if (FlagSet(mh.modificationType, ModificationFlags::DeleteText)) {
 		decorations->DeleteRange(mh.position, mh.length);
+		braceIndex.DeleteText(mh.position, mh.length);
+	} else if (FlagSet(mh.modificationType, ModificationFlags::ChangeStyle)) {
+		braceIndex.StyleChanged(mh.position, mh.length);
 	}
 	for (const auto &watcher : watchers) {
 		watcher.watcher->NotifyModified(this, mh, watcher.userData);
@@ -2930,16 +3245,232 @@ static constexpr char BraceOpposite(char ch) noexcept {
 	return '\0';
 }
 
+void BraceIndex::Reset(Sci::Position length) {
+	valid = false;
+	partitions.DeleteAll();
+	const Sci::Position blockCount = std::max<Sci::Position>((length + blockSize - 1)/blockSize, 1);
+	partitions.ReAllocate(blockCount);
+	for (Sci::Position block = 1; block < blockCount; block++) {
+		partitions.InsertPartition(block, block*blockSize);
+	}
+	partitions.SetPartitionStartPosition(blockCount, length);
+	for (BraceSlot &slot : slots) {
+		slot.blocks.assign(blockCount, BraceBlock{});
+	}
+	valid = true;
+}
+
+void BraceIndex::InvalidateBlock(Sci::Position block) noexcept {
+	for (BraceSlot &slot : slots) {
+		slot.blocks[block].minForward = BraceBlock::invalid;
+	}
+}
+
+void BraceIndex::SplitBlock(Sci::Position block) {
+	// keep blocks small after large insertion or merging on deletion
+	Sci::Position start = partitions.PositionFromPartition(block);
+	const Sci::Position end = partitions.PositionFromPartition(block + 1);
+	while (end - start >= 2*blockSize) {
+		start += blockSize;
+		block++;
+		partitions.InsertPartition(block, start);
+		for (BraceSlot &slot : slots) {
+			slot.blocks.insert(slot.blocks.begin() + block, BraceBlock{});
+		}
+	}
+}
+
+void BraceIndex::InsertText(Sci::Position position, Sci::Position insertLength) noexcept {
+	if (!valid) {
+		return;
+	}
+	try {
+		// text is inserted into the block containing position, blocks after it are shifted
+		const Sci::Position block = partitions.PartitionFromPosition(position);
+		partitions.InsertText(block, insertLength);
+		InvalidateBlock(block);
+		SplitBlock(block);
+	} catch (...) {
+		Clear();
+	}
+}
+
+void BraceIndex::DeleteText(Sci::Position position, Sci::Position deleteLength) noexcept {
+	if (!valid) {
+		return;
+	}
+	try {
+		// blocks starting inside deleted range are merged into the block containing position
+		const Sci::Position first = partitions.PartitionFromPosition(position);
+		const Sci::Position last = partitions.PartitionFromPosition(position + deleteLength);
+		for (Sci::Position block = last; block > first; block--) {
+			partitions.RemovePartition(block);
+		}
+		if (last > first) {
+			for (BraceSlot &slot : slots) {
+				slot.blocks.erase(slot.blocks.begin() + first + 1, slot.blocks.begin() + last + 1);
+			}
+		}
+		partitions.InsertText(first, -deleteLength);
+		InvalidateBlock(first);
+		SplitBlock(first);
+	} catch (...) {
+		Clear();
+	}
+}
+
+void BraceIndex::StyleChanged(Sci::Position position, Sci::Position length) noexcept {
+	if (!valid) {
+		return;
+	}
+	const Sci::Position first = partitions.PartitionFromPosition(position);
+	const Sci::Position last = partitions.PartitionFromPosition(position + length);
+	for (Sci::Position block = first; block <= last; block++) {
+		InvalidateBlock(block);
+	}
+}
+
+void BraceIndex::Clear() noexcept {
+	valid = false;
+	for (BraceSlot &slot : slots) {
+		slot.blocks.clear();
+	}
+}
+
+const BraceIndex::BraceBlock &BraceIndex::BuildBlock(const CellBuffer &cb, BraceSlot &slot, Sci::Position block, char chOpen, char chClose) {
+	BraceBlock &summary = slot.blocks[block];
+	if (summary.minForward != BraceBlock::invalid) {
+		return summary;
+	}
+
+	constexpr Sci::Position chunkSize = 4096;
+	char chars[chunkSize];
+	unsigned char styles[chunkSize];
+	const unsigned char style = static_cast<unsigned char>(slot.style);
+	int32_t depth = 0;
+	int32_t minBefore = 0;	// minimum depth before each brace
+	int32_t minAfter = INT32_MAX;	// minimum depth after each brace
+	Sci::Position position = partitions.PositionFromPartition(block);
+	const Sci::Position endPos = partitions.PositionFromPartition(block + 1);
+	while (position < endPos) {
+		const Sci::Position lengthChunk = std::min(chunkSize, endPos - position);
+		cb.GetCharRange(chars, position, lengthChunk);
+		const char *ptr = chars;
+		const char * const end = chars + lengthChunk;
+		bool stylesRetrieved = false;
+		while (ptr < end) {
+			const char ch = *ptr++;
+			if (ch == chOpen || ch == chClose) {
+				if (!stylesRetrieved) {
+					stylesRetrieved = true;
+					cb.GetStyleRange(styles, position, lengthChunk);
+				}
+				if (styles[ptr - chars - 1] == style) {
+					minBefore = std::min(minBefore, depth);
+					depth += (ch == chOpen) ? 1 : -1;
+					minAfter = std::min(minAfter, depth);
+				}
+			}
+		}
+		position += lengthChunk;
+	}
+
+	summary.net = depth;
+	// depth after first brace when scanning forward, depth after last brace when scanning backward
+	summary.minForward = (minAfter == INT32_MAX) ? 0 : minAfter;
+	summary.minBackward = minBefore - depth;
+	return summary;
+}
+
+Sci::Position BraceIndex::Find(const CellBuffer &cb, Sci::Position position, char chBrace, char chSeek, unsigned char style, Sci::Position endStyled) {
+	const Sci::Position length = cb.Length();
+	if (!IsValidIndex(position, length)) {
+		return -1;
+	}
+	if (!valid || partitions.Length() != length) {
+		Reset(length);
+	}
+
+	const bool forward = chBrace < chSeek;
+	const char chOpen = forward ? chBrace : chSeek;
+	const char chClose = forward ? chSeek : chBrace;
+	// index for (), [], {} and <>
+	const int index = (chOpen == '(') ? 0 : ((chOpen == '<') ? 3 : (1 + ((chOpen >> 5) & 1)));
+	BraceSlot &slot = slots[index];
+	if (slot.style != style) {
+		slot.style = style;
+		slot.blocks.assign(partitions.Partitions(), BraceBlock{});
+	}
+
+	int depth = 1;
+	Sci::Position block = partitions.PartitionFromPosition(position);
+	if (forward) {
+		while (position < length) {
+			const Sci::Position start = partitions.PositionFromPartition(block);
+			const Sci::Position end = partitions.PositionFromPartition(block + 1);
+			if (position == start && end <= endStyled) {
+				const BraceBlock &summary = BuildBlock(cb, slot, block, chOpen, chClose);
+				if (depth + summary.minForward > 0) {
+					depth += summary.net;
+					position = end;
+					block++;
+					continue;
+				}
+			}
+			for (; position < end; position++) {
+				const char ch = cb.CharAt(position);
+				if ((ch == chBrace || ch == chSeek) && (position > endStyled || static_cast<unsigned char>(cb.StyleAt(position)) == style)) {
+					depth += (ch == chBrace) ? 1 : -1;
+					if (depth == 0) {
+						return position;
+					}
+				}
+			}
+			block++;
+		}
+	} else {
+		while (position >= 0) {
+			const Sci::Position start = partitions.PositionFromPartition(block);
+			const Sci::Position end = partitions.PositionFromPartition(block + 1);
+			if (position == end - 1 && end <= endStyled) {
+				const BraceBlock &summary = BuildBlock(cb, slot, block, chOpen, chClose);
+				if (depth + summary.minBackward > 0) {
+					depth -= summary.net;
+					position = start - 1;
+					block--;
+					continue;
+				}
+			}
+			for (; position >= start; position--) {
+				const char ch = cb.CharAt(position);
+				if ((ch == chBrace || ch == chSeek) && (position > endStyled || static_cast<unsigned char>(cb.StyleAt(position)) == style)) {
+					depth += (ch == chBrace) ? 1 : -1;
+					if (depth == 0) {
+						return position;
+					}
+				}
+			}
+			block--;
+		}
+	}
+	return -1;
+}
+
 // TODO: should be able to extend styled region to find matching brace
-Sci::Position Document::BraceMatch(Sci::Position position, Sci::Position /*maxReStyle*/, Sci::Position startPos, bool useStartPos) const noexcept {
+Sci::Position Document::BraceMatch(Sci::Position position, Sci::Position /*maxReStyle*/, Sci::Position startPos, bool useStartPos) {
 	const char chBrace = CharAt(position);
 	const char chSeek = BraceOpposite(chBrace);
 	if (chSeek == '\0')
 		return -1;
 	const int styBrace = StyleIndexAt(position);
 	const int direction = (chBrace < chSeek) ? 1 : -1;
-	int depth = 1;
 	position = useStartPos ? startPos : NextPosition(position, direction);
+	if (CpUtf8 == dbcsCodePage || 0 == dbcsCodePage) {
+		// brace is ASCII, never appears inside multi-byte UTF-8 character
+		return braceIndex.Find(cb, position, chBrace, chSeek, static_cast<unsigned char>(styBrace), endStyled);
+	}
+
+	int depth = 1;
 	const Sci::Position length = LengthNoExcept();
 	while (IsValidIndex(position, length)) {
 		const char chAtPos = CharAt(position);
@@ -195,6 +195,10 @@ public:
 	LexInterface &operator=(LexInterface &&) = delete;
 	virtual ~LexInterface() noexcept;
 	void Colourise(Sci::Position start, Sci::Position end);
+	bool PerformingStyle() const noexcept {
+		return performingStyle;
+	}
+	bool GetCheckpointMask(int &mask) const;
 	virtual Scintilla::LineEndType LineEndTypesSupported() const noexcept;
 	bool UseContainerLexing() const noexcept;
 };
@@ -229,6 +233,47 @@ public:
 	int ActionsInAllowedTime(double secondsAllowed) const noexcept;
 };
 
+/**
+ * The BraceIndex class caches per block depth summary for brace pairs with specific style,
+ * so brace matching in huge document can skip whole blocks that can't contain the match.
+ * Summary for a block is built on demand when the block is fully styled, and discarded
+ * when text or style inside the block is changed. Block boundaries move with inserted and
+ * deleted text, so summaries of other blocks are kept.
+ */
+class BraceIndex {
+public:
+	static constexpr Sci::Position blockSize = 64*1024;
+
+	void InsertText(Sci::Position position, Sci::Position insertLength) noexcept;
+	void DeleteText(Sci::Position position, Sci::Position deleteLength) noexcept;
+	void StyleChanged(Sci::Position position, Sci::Position length) noexcept;
+	void Clear() noexcept;
+	// only valid for single byte and UTF-8 document, where brace never appears inside multi-byte character.
+	Sci::Position Find(const CellBuffer &cb, Sci::Position position, char chBrace, char chSeek, unsigned char style, Sci::Position endStyled);
+
+private:
+	struct BraceBlock {
+		static constexpr int32_t invalid = INT32_MAX;
+		int32_t net = 0;			// depth change from open brace
+		int32_t minForward = invalid;	// minimum depth change when scanning forward
+		int32_t minBackward = 0;	// minimum depth change when scanning backward
+	};
+	struct BraceSlot {
+		int style = -1;
+		std::vector<BraceBlock> blocks;
+	};
+	// block boundaries shared by all slots, only valid after first Find()
+	Partitioning<Sci::Position> partitions;
+	bool valid = false;
+	// slots for (), [], {} and <>
+	BraceSlot slots[4];
+
+	void Reset(Sci::Position length);
+	void InvalidateBlock(Sci::Position block) noexcept;
+	void SplitBlock(Sci::Position block);
+	const BraceBlock &BuildBlock(const CellBuffer &cb, BraceSlot &slot, Sci::Position block, char chOpen, char chClose);
+};
+
  /**
  * A whole character (code point) with a value and width in bytes.
  * For UTF-8, the value is the code point value.
@@ -277,6 +322,12 @@ private:
 #endif
 	std::unique_ptr<CaseFolder> pcf;
 	Sci::Position endStyled;
+	// styles in [endStyled, staleStyledEnd) are from lexing before the modification ended at modifiedStyledEnd,
+	// they are kept when lexer state after the modification converged to previous lexing.
+	Sci::Position staleStyledEnd;
+	Sci::Position modifiedStyledEnd;
+	// view only document: start of styled window, styles before it are reset to default
+	Sci::Position styleWindowStart;
 	int styleClock;
 	int enteredModification;
 	int enteredStyling;
@@ -285,6 +336,7 @@ private:
 	std::optional<bool> delaySavePoint;
 	bool matchesValid;
 	bool insertionSet;
+	const bool viewOnly;
 	std::string insertion;
 
 	std::vector<WatcherWithUserData> watchers;
@@ -304,6 +356,10 @@ private:
 	std::unique_ptr<RegexSearchBase> regex;
 	std::unique_ptr<LexInterface> pli;
 	std::unique_ptr<DBCSCharClassify> dbcsCharClass;
+	BraceIndex braceIndex;
+
+	void ModifiedText(Sci::Position pos, Sci::Position lengthChange) noexcept;
+	void ColouriseToCheckpoint(Sci::Position start, Sci::Position end, int checkpointMask);
 
 public:
 
@@ -416,7 +472,7 @@ public:
 		cb.DeleteUndoHistory();
 	}
 	bool SetUndoCollection(bool collectUndo) noexcept {
-		return cb.SetUndoCollection(collectUndo);
+		return cb.SetUndoCollection(collectUndo && !viewOnly);
 	}
 	bool IsCollectingUndo() const noexcept {
 		return cb.IsCollectingUndo();
@@ -464,7 +520,7 @@ public:
 	void ChangeLastUndoActionText(size_t length, const char *text);
 
 	void ChangeHistorySet(bool enable) {
-		cb.ChangeHistorySet(enable);
+		cb.ChangeHistorySet(enable && !viewOnly);
 	}
 	[[nodiscard]] int EditionAt(Sci::Position pos) const noexcept {
 		return cb.EditionAt(pos);
@@ -485,7 +541,7 @@ public:
 	const char *RangePointer(Sci::Position position, Sci::Position rangeLength) noexcept {
 		return cb.RangePointer(position, rangeLength);
 	}
-	const char *StyleRangePointer(Sci::Position position, Sci::Position rangeLength) noexcept {
+	const char *StyleRangePointer(Sci::Position position, Sci::Position rangeLength) {
 		return cb.StyleRangePointer(position, rangeLength);
 	}
 	Sci::Position GapPosition() const noexcept {
@@ -598,6 +654,18 @@ public:
 		return cb.Lines();
 	}
 	void AllocateLines(Sci::Line lines);
+	bool IsLineIndexComplete() const noexcept {
+		return cb.IsLineIndexComplete();
+	}
+	Sci::Line LinesEstimate() const noexcept {
+		return cb.LinesEstimate();
+	}
+	Sci::Position LineIndexEnd() const noexcept {
+		return cb.LineIndexEnd();
+	}
+	bool IndexLines(Sci::Position limit);
+	bool IndexLinesTo(Sci::Line line);
+	Sci::Position IndexLinesStep(Sci::Position length);
 
 	void SetDefaultCharClasses(bool includeWordClass) noexcept;
 	void SetCharClasses(const unsigned char *chars, CharacterClass newCharClass) noexcept;
@@ -614,6 +682,7 @@ public:
 		return endStyled;
 	}
 	void EnsureStyledTo(Sci::Position pos);
+	void MoveStyleWindow(Sci::Position pos);
 	void StyleToAdjustingLineDuration(Sci::Position pos);
 	void LexerChanged(bool hasStyles_);
 	int GetStyleClock() const noexcept {
@@ -663,12 +732,13 @@ public:
 	int IndentSize() const noexcept {
 		return actualIndentInChars;
 	}
-	Sci::Position BraceMatch(Sci::Position position, Sci::Position maxReStyle, Sci::Position startPos, bool useStartPos) const noexcept;
+	Sci::Position BraceMatch(Sci::Position position, Sci::Position maxReStyle, Sci::Position startPos, bool useStartPos);
 
 private:
 	void NotifyModifyAttempt() noexcept;
 	void NotifySavePoint(bool atSavePoint) noexcept;
 	void NotifyModified(DocModification mh);
+	std::optional<Sci::Position> FindFoldedText(Sci::Position startPos, Sci::Position endPos, std::string_view search, bool word, bool wordStart, Sci::Position *length) const;
 };
 
 class DelaySavePoint {
@@ -83,10 +83,8 @@ EditModel::EditModel() : durationWrapOneUnit(0.01 / 64), durationWrapOneThread(0
 	pdoc->AddRef();
 	pcs = ContractionStateCreate(pdoc->IsLarge());
 
-	SYSTEM_INFO info;
-	GetNativeSystemInfo(&info);
-	hardwareConcurrency = info.dwNumberOfProcessors;
-	idleTaskTimer = CreateWaitableTimer(nullptr, true, nullptr);
+	hardwareConcurrency = GetHardwareConcurrency();
+	idleTaskTimer = CreateIdleTaskTimer();
 	SetIdleTaskTime(IdleLineWrapTime);
 	UpdateParallelLayoutThreshold();
 }
@@ -94,7 +92,7 @@ EditModel::EditModel() : durationWrapOneUnit(0.01 / 64), durationWrapOneThread(0
 EditModel::~EditModel() {
 	pdoc->Release();
 	pdoc = nullptr;
-	CloseHandle(idleTaskTimer);
+	CloseIdleTaskTimer(idleTaskTimer);
 }
 
 bool EditModel::BidirectionalEnabled() const noexcept {
@@ -137,9 +135,7 @@ MarkerMask EditModel::GetMark(Sci::Line line) const noexcept {
 }
 
 void EditModel::SetIdleTaskTime(uint32_t milliseconds) const noexcept {
-	LARGE_INTEGER dueTime;
-	dueTime.QuadPart = -INT64_C(10*1000)*milliseconds; // convert to 100ns
-	SetWaitableTimer(idleTaskTimer, &dueTime, 0, nullptr, nullptr, false);
+	SetIdleTaskTimer(idleTaskTimer, milliseconds);
 }
 
 bool EditModel::IdleTaskTimeExpired() const noexcept {
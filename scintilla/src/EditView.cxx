@@ -234,10 +234,16 @@ EditView::EditView() {
 	bufferedDraw = true;
 	phasesDraw = PhasesDraw::Two;
 	lineWidthMaxSeen = 0;
+	textTopLine = -1;
+	textXOffset = 0;
+	textInvalidTop = 0;
+	textInvalidBottom = 0;
 	additionalCaretsBlink = true;
 	additionalCaretsVisible = true;
 	imeCaretBlockOverride = false;
 	llc.SetLevel(LineCache::Caret);
+	preLayoutScreens = 1;
+	ResetPreLayoutStatistics();
 	tabArrowHeight = 4;
 	customDrawTabArrow = nullptr;
 	customDrawWrapMarker = nullptr;
@@ -309,6 +315,9 @@ void EditView::LinesAddedOrRemoved(Sci::Line lineOfPos, Sci::Line linesAdded) co
 
 void EditView::DropGraphics() noexcept {
 	pixmapLine.reset();
+	pixmapText.reset();
+	pixmapTextScroll.reset();
+	textTopLine = -1;
 	pixmapIndentGuide.reset();
 	pixmapIndentGuideHighlight.reset();
 }
@@ -331,16 +340,71 @@ void EditView::RefreshPixMaps(Surface *surfaceWindow, const ViewStyle &vsDraw) {
 	}
 }
 
+void EditView::InvalidateText(PRectangle rc) noexcept {
+	const int top = static_cast<int>(rc.top);
+	const int bottom = static_cast<int>(std::ceil(rc.bottom));
+	if (textInvalidTop >= textInvalidBottom) {
+		textInvalidTop = top;
+		textInvalidBottom = bottom;
+	} else {
+		textInvalidTop = std::min(textInvalidTop, top);
+		textInvalidBottom = std::max(textInvalidBottom, bottom);
+	}
+}
+
+void EditView::TextScrolled(int pixelsToMove) noexcept {
+	// lines invalidated before scrolling are moved, cover both old and new place.
+	if (textInvalidTop < textInvalidBottom) {
+		if (pixelsToMove > 0) {
+			textInvalidBottom += pixelsToMove;
+		} else {
+			textInvalidTop += pixelsToMove;
+		}
+	}
+}
+
+// Shift pixmapText by lines scrolled after last paint, returns false when whole text area needs to be painted.
+bool EditView::ShiftTextPixMap(const EditModel &model, const ViewStyle &vsDraw, PRectangle rcText, int &exposedTop, int &exposedBottom) {
+	exposedTop = 0;
+	exposedBottom = 0;
+	if (textTopLine < 0 || textXOffset != model.xOffset) {
+		return false;
+	}
+	const Sci::Line linesToMove = textTopLine - model.TopLineOfMain();
+	if (std::abs(linesToMove) * vsDraw.lineHeight >= rcText.Height()) {
+		return false;
+	}
+	if (linesToMove != 0) {
+		const int pixelsToMove = static_cast<int>(linesToMove) * vsDraw.lineHeight;
+		PRectangle rcDest = rcText;
+		Point from(rcText.left, rcText.top);
+		if (pixelsToMove > 0) {
+			rcDest.top += pixelsToMove;
+			exposedTop = static_cast<int>(rcText.top);
+			exposedBottom = exposedTop + pixelsToMove;
+		} else {
+			rcDest.bottom += pixelsToMove;
+			from.y -= pixelsToMove;
+			exposedTop = static_cast<int>(rcDest.bottom);
+			exposedBottom = static_cast<int>(rcText.bottom);
+		}
+		// copy into another pixmap as source and destination are overlapped
+		pixmapTextScroll->Copy(rcDest, from, *pixmapText);
+		pixmapTextScroll->FlushDrawing();
+		pixmapText.swap(pixmapTextScroll);
+	}
+	return true;
+}
+
 LineLayout *EditView::RetrieveLineLayout(Sci::Line lineNumber, const EditModel &model) {
 	const Sci::Position posLineStart = model.pdoc->LineStart(lineNumber);
 	const Sci::Position posLineEnd = model.pdoc->LineStart(lineNumber + 1);
 	PLATFORM_ASSERT(posLineEnd >= posLineStart);
 	const Sci::Position caretPosition = model.sel.MainCaret();
 	const Sci::Line lineCaret = model.pdoc->SciLineFromPosition(caretPosition);
-	const Sci::Line topLine = model.pcs->DocFromDisplay(model.TopLineOfMain());
 	LineLayout *ll = llc.Retrieve(lineNumber, lineCaret,
 		static_cast<int>(posLineEnd - posLineStart), model.pdoc->GetStyleClock(),
-		model.LinesOnScreen() + 1, model.pdoc->LinesTotal(), topLine);
+		model.LinesOnScreen() + 1);
 	if (lineNumber == lineCaret) {
 		ll->caretPosition = static_cast<int>(caretPosition - posLineStart);
 	} else {
@@ -360,6 +424,17 @@ inline void UpdateMaximum(std::atomic<T> &maximum, const T &value) noexcept {
 	while(prev < value && !maximum.compare_exchange_weak(prev, value)) {}
 }
 
+std::unique_ptr<Surface> CreateMeasurementSurface(const ViewStyle &vstyle, const EditModel &model) {
+	// if (!surface->SupportsFeature(Supports::ThreadSafeMeasureWidths))
+	if (vstyle.technology == Technology::Default) {
+		std::unique_ptr<Surface> surf = Surface::Allocate(Technology::Default);
+		surf->Init(nullptr);
+		surf->SetMode(model.CurrentSurfaceMode());
+		return surf;
+	}
+	return {};
+}
+
 struct LayoutWorker {
 	LineLayout * const ll;
 	const ViewStyle &vstyle;
@@ -509,21 +584,10 @@ struct LayoutWorker {
 		return 1;
 	}
 
-	std::unique_ptr<Surface> CreateMeasurementSurface() const {
-		// if (!surface->SupportsFeature(Supports::ThreadSafeMeasureWidths))
-		if (vstyle.technology == Technology::Default) {
-			std::unique_ptr<Surface> surf = Surface::Allocate(Technology::Default);
-			surf->Init(nullptr);
-			surf->SetMode(model.CurrentSurfaceMode());
-			return surf;
-		}
-		return {};
-	}
-
 	void DoWork() {
 		uint32_t finished = 0;
 		void * const idleTaskTimer = model.idleTaskTimer;
-		const std::unique_ptr<Surface> surf{CreateMeasurementSurface()};
+		const std::unique_ptr<Surface> surf{CreateMeasurementSurface(vstyle, model)};
 		Surface * const surface = surf ? surf.get() : sharedSurface;
 
 		int processed = 0;
@@ -569,23 +633,116 @@ struct LayoutWorker {
 #endif
 };
 
+struct PreLayoutLine {
+	LineLayout *ll;
+	LineLayout::ValidLevel validity;
+};
+
+// Lay out lines around the visible lines before they are painted, each line is laid out
+// by one thread, lines are short enough to not be split by LayoutWorker.
+// Text and styles are already copied by EditView::FillLineLayout() on the UI thread.
+struct PreLayoutWorker {
+	EditView &view;
+	const EditModel &model;
+	const ViewStyle &vstyle;
+	Surface * const sharedSurface;
+	const std::vector<PreLayoutLine> &lines;
+	std::atomic<uint32_t> nextIndex = 0;
+
+#if USE_WIN32_WORK_ITEM
+	HANDLE finishedEvent = nullptr;
+	std::atomic<uint32_t> runningThread = 0;
+#endif
+
+	static constexpr uint32_t minLinesPerThread = 8;
+
+	void Start() {
+		const uint32_t threadCount = std::min(static_cast<uint32_t>(lines.size()) / minLinesPerThread, model.hardwareConcurrency);
+		if (threadCount <= 1) {
+			LayoutLines(sharedSurface);
+			return;
+		}
+#if USE_STD_ASYNC_FUTURE
+		std::vector<std::future<void>> features;
+		for (uint32_t i = 0; i < threadCount; i++) {
+			features.push_back(std::async(std::launch::async, [this] {
+				DoWork();
+			}));
+		}
+		for (std::future<void> &f : features) {
+			f.wait();
+		}
+
+#elif USE_WIN32_PTP_WORK
+		PTP_WORK work = CreateThreadpoolWork(WorkCallback, this, nullptr);
+		for (uint32_t i = 0; i < threadCount; i++) {
+			SubmitThreadpoolWork(work);
+		}
+		WaitForThreadpoolWorkCallbacks(work, FALSE);
+		CloseThreadpoolWork(work);
+
+#else
+		runningThread.store(threadCount, std::memory_order_relaxed);
+		finishedEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+		for (uint32_t i = 0; i < threadCount; i++) {
+			QueueUserWorkItem(ThreadProc, this, WT_EXECUTEDEFAULT);
+		}
+		WaitForSingleObject(finishedEvent, INFINITE);
+		CloseHandle(finishedEvent);
+#endif // USE_WIN32_WORK_ITEM
+	}
+
+	void LayoutLines(Surface *surface) {
+		while (true) {
+			const uint32_t index = nextIndex.fetch_add(1, std::memory_order_relaxed);
+			if (index >= lines.size()) {
+				break;
+			}
+			const PreLayoutLine &line = lines[index];
+			view.MeasureLine(model, surface, vstyle, line.ll, model.wrapWidth, LayoutLineOption::CallerMultiThreaded, 0, line.validity);
+		}
+	}
+
+	void DoWork() {
+		const std::unique_ptr<Surface> surf{CreateMeasurementSurface(vstyle, model)};
+		LayoutLines(surf ? surf.get() : sharedSurface);
+#if USE_WIN32_WORK_ITEM
+		const uint32_t prev = runningThread.fetch_sub(1, std::memory_order_release);
+		if (prev == 1) {
+			SetEvent(finishedEvent);
+		}
+#endif
+	}
+
+#if USE_WIN32_PTP_WORK
+	static VOID CALLBACK WorkCallback([[maybe_unused]] PTP_CALLBACK_INSTANCE instance, PVOID context, [[maybe_unused]] PTP_WORK work) {
+		PreLayoutWorker *worker = static_cast<PreLayoutWorker *>(context);
+		worker->DoWork();
+	}
+#elif USE_WIN32_WORK_ITEM
+	static DWORD WINAPI ThreadProc(LPVOID lpParameter) {
+		PreLayoutWorker *worker = static_cast<PreLayoutWorker *>(lpParameter);
+		worker->DoWork();
+		return 0;
+	}
+#endif
+};
+
 }
 
 /**
-* Fill in the LineLayout data for the given line.
-* Copy the given @a line and its styles from the document into local arrays.
-* Also determine the x position at which each character starts.
+* Copy the line of @a ll and its styles from the document into local arrays when they are changed.
+* Document accessors may move the gap or update the style cache, so this must be called on the UI thread.
+* @return the validity that MeasureLine() continues from.
 */
-uint64_t EditView::LayoutLine(const EditModel &model, Surface *surface, const ViewStyle &vstyle, LineLayout *ll, int width, LayoutLineOption option, int posInLine) {
-	uint64_t wrappedBytes = 0; // only care about time spend on MeasureWidths()
+LineLayout::ValidLevel EditView::FillLineLayout(const EditModel &model, const ViewStyle &vstyle, LineLayout *ll, int width) {
 	const Sci::Line line = ll->LineNumber();
 	PLATFORM_ASSERT(line < model.pdoc->LinesTotal());
 	PLATFORM_ASSERT(ll->chars);
 	const Sci::Position posLineStart = model.pdoc->LineStart(line);
 	// If the line is very long, limit the treatment to a length that should fit in the viewport
 	const Sci::Position posLineEnd = std::min(model.pdoc->LineStart(line + 1), posLineStart + ll->maxLineLength);
-	// Hard to cope when too narrow, so just assume there is space
-	width = std::max(width, 20);
+	width = LineLayout::LayoutWidth(width);
 
 	auto validity = ll->validity;
 	if (validity == LineLayout::ValidLevel::checkTextAndStyle) {
@@ -634,6 +791,7 @@ uint64_t EditView::LayoutLine(const EditModel &model, Surface *surface, const Vi
 		// Layout the line, determining the position of each character,
 		// with an extra element at the end for the end of the line.
 		ll->ClearPositions();
+		ll->InvalidateTextBreaks();
 		ll->lastSegmentEnd = 0;
 		ll->numCharsInLine = numCharsInLine;
 		ll->numCharsBeforeEOL = numCharsBeforeEOL;
@@ -655,6 +813,18 @@ uint64_t EditView::LayoutLine(const EditModel &model, Surface *surface, const Vi
 			ll->edgeColumn = static_cast<int>(edgePosition);
 		}
 	}
+	return validity;
+}
+
+/**
+* Determine the x position at which each character of @a ll starts and wrap it.
+* Only reads the document, so it can be called from worker threads after FillLineLayout().
+*/
+uint64_t EditView::MeasureLine(const EditModel &model, Surface *surface, const ViewStyle &vstyle, LineLayout *ll, int width, LayoutLineOption option, int posInLine, LineLayout::ValidLevel validity) {
+	uint64_t wrappedBytes = 0; // only care about time spend on MeasureWidths()
+	const Sci::Line line = ll->LineNumber();
+	const Sci::Position posLineStart = model.pdoc->LineStart(line);
+	width = LineLayout::LayoutWidth(width);
 
 	const bool partialLine = validity == LineLayout::ValidLevel::lines
 		&& ll->PartialPosition() && width == ll->widthLine;
@@ -692,14 +862,6 @@ uint64_t EditView::LayoutLine(const EditModel &model, Surface *surface, const Vi
 		const int endPos = ts.end();
 		const uint32_t bytes = endPos - ll->lastSegmentEnd;
 		wrappedBytes = bytes | (static_cast<uint64_t>(bytes / threadCount) << 32);
-#if 0
-		if (bytes > LayoutWorker::blockSize) {
-			const double duration = period.Duration()*1e3;
-			printf("layout line=%zd segment=(%u / %zu), posInLine=(%d / %d) (%u / %u, %u), duration=%f, %f\n", line + 1,
-				finishedCount, worker.segmentList.size(), worker.maxPosInLine, ll->maxLineLength,
-				bytes, threadCount, bytes / threadCount, duration, model.durationWrapOneThread.Duration()*1e3);
-		}
-#endif
 		ll->lastSegmentEnd = endPos;
 		if (endPos == ll->numCharsInLine) {
 			// Small hack to make lines that end with italics not cut off the edge of the last character
@@ -769,6 +931,106 @@ uint64_t EditView::LayoutLine(const EditModel &model, Surface *surface, const Vi
 	return wrappedBytes;
 }
 
+/**
+* Fill in the LineLayout data for the given line.
+* Copy the given @a line and its styles from the document into local arrays.
+* Also determine the x position at which each character starts.
+*/
+uint64_t EditView::LayoutLine(const EditModel &model, Surface *surface, const ViewStyle &vstyle, LineLayout *ll, int width, LayoutLineOption option, int posInLine) {
+	const LineLayout::ValidLevel validity = FillLineLayout(model, vstyle, ll, width);
+	return MeasureLine(model, surface, vstyle, ll, width, option, posInLine, validity);
+}
+
+/**
+* Lay out lines around the visible lines in idle time, so scrolling or paging in @a direction
+* (negative for up) finds them in the layout cache. Lines are laid out only when they are styled
+* and can be cached without evicting visible lines.
+* @return true when there are more lines to lay out.
+*/
+bool EditView::PreLayoutLines(const EditModel &model, Surface *surface, const ViewStyle &vstyle, int direction) {
+	const Sci::Line linesOnScreen = model.LinesOnScreen() + 1;
+	const Sci::Line linesTotal = model.pdoc->LinesTotal();
+	const Sci::Line capacity = llc.PreLayoutCapacity(linesOnScreen);
+	if (preLayoutScreens <= 0 || capacity <= 0) {
+		return false;
+	}
+
+	// lines in scrolling direction first
+	const Sci::Line ahead = std::min(linesOnScreen * preLayoutScreens, capacity);
+	const Sci::Line behind = std::min(linesOnScreen * preLayoutScreens, capacity - ahead);
+	const Sci::Line topLine = model.TopLineOfMain();
+	const Sci::Line lineTop = model.pcs->DocFromDisplay(topLine);
+	const Sci::Line lineAfter = model.pcs->DocFromDisplay(topLine + linesOnScreen - 1) + 1;
+	Sci::Line upStart = std::max<Sci::Line>(lineTop - ((direction < 0) ? ahead : behind), 0);
+	Sci::Line downEnd = std::min(lineAfter + ((direction < 0) ? behind : ahead), linesTotal);
+	// all lines from upStart to downEnd must fit in the cache together
+	const Sci::Line span = capacity + linesOnScreen;
+	if (direction < 0) {
+		upStart = std::max(upStart, lineAfter - span);
+		downEnd = std::min(downEnd, upStart + span);
+	} else {
+		downEnd = std::min(downEnd, lineTop + span);
+		upStart = std::max(upStart, std::max(downEnd, lineAfter) - span);
+	}
+
+	// limit work in one idle call like Editor::WrapLines()
+	const uint32_t threadCount = std::max(model.hardwareConcurrency, 1U);
+	const Sci::Position bytesAllowed = static_cast<Sci::Position>(model.durationWrapOneUnit.ActionsInAllowedTime(0.01)) * threadCount;
+	const Sci::Position endStyled = model.pdoc->GetEndStyled();
+	Sci::Position bytes = 0;
+	bool more = false;
+	std::vector<PreLayoutLine> lines;
+	for (int pass = 0; pass < 2 && !more; pass++) {
+		const bool down = (pass == 0) == (direction >= 0);
+		Sci::Line line = down ? lineAfter : lineTop - 1;
+		while (down ? (line < downEnd) : (line >= upStart)) {
+			const Sci::Line lineDoc = line;
+			line += down ? 1 : -1;
+			if (!model.pcs->GetVisible(lineDoc)) {
+				continue;
+			}
+			const Sci::Position posLineStart = model.pdoc->LineStart(lineDoc);
+			const Sci::Position posLineEnd = model.pdoc->LineStart(lineDoc + 1);
+			if (posLineEnd > endStyled) {
+				// wait for idle styling
+				if (down) {
+					break;
+				}
+				continue;
+			}
+			const Sci::Position lengthLine = posLineEnd - posLineStart;
+			if (lengthLine >= static_cast<Sci::Position>(model.minParallelLayoutLength) || LineLayoutCache::IsHugeLine(static_cast<unsigned>(lengthLine))) {
+				// long line is laid out by multiple threads when it's painted
+				continue;
+			}
+			if (bytes >= bytesAllowed) {
+				more = true;
+				break;
+			}
+			LineLayout * const ll = RetrieveLineLayout(lineDoc, model);
+			if (ll->LaidOut(model.wrapWidth)) {
+				continue;
+			}
+			// copy text and styles here, workers only measure and wrap
+			const LineLayout::ValidLevel validity = FillLineLayout(model, vstyle, ll, model.wrapWidth);
+			if (validity == LineLayout::ValidLevel::lines && ll->widthLine == LineLayout::LayoutWidth(model.wrapWidth)) {
+				ll->validity = validity;
+				continue;
+			}
+			ll->preLaidOut = true;
+			lines.push_back({ll, validity});
+			bytes += lengthLine;
+		}
+	}
+
+	if (!lines.empty()) {
+		PreLayoutWorker worker{ *this, model, vstyle, surface, lines };
+		worker.Start();
+		preLayoutLines += lines.size();
+	}
+	return more;
+}
+
 // Fill the LineLayout bidirectional data fields according to each char style
 
 void EditView::UpdateBidiData(const EditModel &model, const ViewStyle &vstyle, LineLayout *ll) {
@@ -2711,7 +2973,6 @@ void EditView::PaintText(Surface *surfaceWindow, const EditModel &model, const V
 
 		const Point ptOrigin = model.GetVisibleOriginInMain();
 
-		const int screenLinePaintFirst = static_cast<int>(rcArea.top) / vsDraw.lineHeight;
 		const int xStart = vsDraw.textStart - model.xOffset + static_cast<int>(ptOrigin.x);
 
 		const SelectionPosition posCaret = model.posDrag.IsValid() ? model.posDrag : model.sel.RangeMain().caret;
@@ -2735,6 +2996,44 @@ void EditView::PaintText(Surface *surfaceWindow, const EditModel &model, const V
 			surfaceWindow->SetClip(rcClipText);
 		}
 
+		// With cached text area, lines are painted into pixmapText, only lines exposed by
+		// scrolling and lines invalidated after last paint are painted.
+		Surface *surfaceText = surfaceWindow;
+		const bool textPixMap = pixmapText && vsDraw.marginInside && pixmapText->Initialised();
+		bool textCached = false;
+		int paintTop = static_cast<int>(rcArea.top);
+		int paintBottom = static_cast<int>(rcArea.bottom);
+		int exposedTop = 0;
+		int exposedBottom = 0;
+		const int invalidTop = textInvalidTop;
+		const int invalidBottom = textInvalidBottom;
+		PRectangle rcTextCopy = rcTextArea;
+		if (textPixMap) {
+			rcTextCopy.left -= leftTextOverlap;
+			textCached = ShiftTextPixMap(model, vsDraw, rcTextCopy, exposedTop, exposedBottom);
+			// after shifting, pixmapText is the other pixmap
+			surfaceText = pixmapText.get();
+			if (textCached) {
+				paintTop = static_cast<int>(rcClient.bottom);
+				paintBottom = static_cast<int>(rcClient.top);
+				if (exposedTop < exposedBottom) {
+					paintTop = exposedTop;
+					paintBottom = exposedBottom;
+				}
+				if (invalidTop < invalidBottom) {
+					paintTop = std::min(paintTop, invalidTop);
+					paintBottom = std::max(paintBottom, invalidBottom);
+				}
+				// invalidated lines moved by scrolling may be outside client area
+				paintTop = std::max(paintTop, static_cast<int>(rcClient.top));
+				paintBottom = std::min(paintBottom, static_cast<int>(rcClient.bottom));
+			} else {
+				paintTop = static_cast<int>(rcClient.top);
+				paintBottom = static_cast<int>(rcClient.bottom);
+			}
+		}
+		const int screenLinePaintFirst = paintTop / vsDraw.lineHeight;
+
 		// Loop on visible lines
 #if defined(TIME_PAINTING)
 		double durLayout = 0.0;
@@ -2771,7 +3070,17 @@ void EditView::PaintText(Surface *surfaceWindow, const EditModel &model, const V
 				ypos += screenLinePaintFirst * vsDraw.lineHeight;
 			int yposScreen = screenLinePaintFirst * vsDraw.lineHeight;
 			Sci::Line visibleLine = model.TopLineOfMain() + screenLinePaintFirst;
-			while (visibleLine < model.pcs->LinesDisplayed() && yposScreen < rcArea.bottom) {
+			while (visibleLine < model.pcs->LinesDisplayed() && yposScreen < paintBottom) {
+				if (textCached) {
+					const int yposBottom = yposScreen + vsDraw.lineHeight;
+					if (!(yposScreen < exposedBottom && yposBottom > exposedTop)
+						&& !(yposScreen < invalidBottom && yposBottom > invalidTop)) {
+						// pixels of this line are still valid
+						yposScreen = yposBottom;
+						visibleLine++;
+						continue;
+					}
+				}
 
 				const Sci::Line lineDoc = model.pcs->DocFromDisplay(visibleLine);
 				// Only visible lines should be handled by the code within the loop
@@ -2787,6 +3096,12 @@ void EditView::PaintText(Surface *surfaceWindow, const EditModel &model, const V
 				if (lineDoc != lineDocPrevious) {
 					lineDocPrevious = lineDoc;
 					ll = RetrieveLineLayout(lineDoc, model);
+					if (ll->LaidOut(model.wrapWidth)) {
+						preLayoutHits += ll->preLaidOut;
+					} else {
+						++layoutMisses;
+					}
+					ll->preLaidOut = false;
 					LayoutLine(model, surface, vsDraw, ll, model.wrapWidth, LayoutLineOption::KeepPosition);
 				}
 #if defined(TIME_PAINTING)
@@ -2841,7 +3156,7 @@ void EditView::PaintText(Surface *surfaceWindow, const EditModel &model, const V
 							static_cast<int>(rcClient.right - vsDraw.rightMarginWidth),
 							yposScreen + vsDraw.lineHeight);
 						pixmapLine->FlushDrawing();
-						surfaceWindow->Copy(rcCopyArea, from, *pixmapLine);
+						surfaceText->Copy(rcCopyArea, from, *pixmapLine);
 					}
 
 					lineWidthMaxSeen = std::max(
@@ -2869,24 +3184,39 @@ void EditView::PaintText(Surface *surfaceWindow, const EditModel &model, const V
 		rcBeyondEOF.right = rcBeyondEOF.right - ((vsDraw.marginInside) ? vsDraw.rightMarginWidth : 0);
 		rcBeyondEOF.top = static_cast<XYPOSITION>((model.pcs->LinesDisplayed() - model.TopLineOfMain()) * vsDraw.lineHeight);
 		if (rcBeyondEOF.top < rcBeyondEOF.bottom) {
-			surfaceWindow->FillRectangleAligned(rcBeyondEOF, Fill(vsDraw.styles[StyleDefault].back));
+			surfaceText->FillRectangleAligned(rcBeyondEOF, Fill(vsDraw.styles[StyleDefault].back));
 			if (vsDraw.edgeState == EdgeVisualStyle::Line) {
 				const int edgeX = static_cast<int>(vsDraw.theEdge.column * vsDraw.aveCharWidth);
 				rcBeyondEOF.left = static_cast<XYPOSITION>(edgeX + xStart);
 				rcBeyondEOF.right = rcBeyondEOF.left + 1;
-				surfaceWindow->FillRectangleAligned(rcBeyondEOF, Fill(vsDraw.theEdge.colour));
+				surfaceText->FillRectangleAligned(rcBeyondEOF, Fill(vsDraw.theEdge.colour));
 			} else if (vsDraw.edgeState == EdgeVisualStyle::MultiLine) {
 				for (size_t edge = 0; edge < vsDraw.theMultiEdge.size(); edge++) {
 					if (vsDraw.theMultiEdge[edge].column >= 0) {
 						const int edgeX = static_cast<int>(vsDraw.theMultiEdge[edge].column * vsDraw.aveCharWidth);
 						rcBeyondEOF.left = static_cast<XYPOSITION>(edgeX + xStart);
 						rcBeyondEOF.right = rcBeyondEOF.left + 1;
-						surfaceWindow->FillRectangleAligned(rcBeyondEOF, Fill(vsDraw.theMultiEdge[edge].colour));
+						surfaceText->FillRectangleAligned(rcBeyondEOF, Fill(vsDraw.theMultiEdge[edge].colour));
 					}
 				}
 			}
 		}
 
+		if (textPixMap) {
+			pixmapText->FlushDrawing();
+			rcTextCopy.top = std::max(rcTextCopy.top, rcArea.top);
+			rcTextCopy.bottom = std::min(rcTextCopy.bottom, rcArea.bottom);
+			rcTextCopy.left = std::max(rcTextCopy.left, rcArea.left);
+			rcTextCopy.right = std::min(rcTextCopy.right, rcArea.right);
+			if (rcTextCopy.top < rcTextCopy.bottom && rcTextCopy.left < rcTextCopy.right) {
+				surfaceWindow->Copy(rcTextCopy, Point(rcTextCopy.left, rcTextCopy.top), *pixmapText);
+			}
+			textTopLine = model.TopLineOfMain();
+			textXOffset = model.xOffset;
+			textInvalidTop = 0;
+			textInvalidBottom = 0;
+		}
+
 		if (clipping)
 			surfaceWindow->PopClip();
 
@@ -95,11 +95,27 @@ public:
 	bool imeCaretBlockOverride;
 
 	std::unique_ptr<Surface> pixmapLine;
+	/** In bufferedDraw mode, text area of last paint is kept in pixmapText. After scrolling
+	* it's shifted, then only exposed lines and invalidated lines are painted.
+	* GDI only: ScintillaWin clears bufferedDraw for DirectWrite. */
+	std::unique_ptr<Surface> pixmapText;
+	std::unique_ptr<Surface> pixmapTextScroll;
+	Sci::Line textTopLine;	// top line of pixmapText, -1 when whole text area needs to be painted
+	int textXOffset;
+	int textInvalidTop;		// lines invalidated after last paint
+	int textInvalidBottom;
 	std::unique_ptr<Surface> pixmapIndentGuide;
 	std::unique_ptr<Surface> pixmapIndentGuideHighlight;
 
 	LineLayoutCache llc;
 	PositionCache posCache;
+	/** Number of screens laid out ahead of and behind the visible lines in idle time, 0 to disable.
+	* Lines are laid out on worker threads into llc, limited to lines that fit in the cache. */
+	int preLayoutScreens;
+	// pre-layout statistics for painted lines, hit rate is preLayoutHits/(preLayoutHits + layoutMisses).
+	size_t preLayoutLines;	// lines laid out ahead of painting
+	size_t preLayoutHits;	// painted lines already laid out ahead
+	size_t layoutMisses;	// painted lines that needed layout
 	PrintParameters printParameters;
 
 	int tabArrowHeight; // draw arrow heads this many pixels above/below line midpoint
@@ -131,10 +147,24 @@ public:
 
 	void DropGraphics() noexcept;
 	void RefreshPixMaps(Surface *surfaceWindow, const ViewStyle &vsDraw);
+	void InvalidateText(PRectangle rc) noexcept;
+	void InvalidateAllText() noexcept {
+		textTopLine = -1;
+	}
+	void TextScrolled(int pixelsToMove) noexcept;
 
 	LineLayout *RetrieveLineLayout(Sci::Line lineNumber, const EditModel &model);
+	LineLayout::ValidLevel FillLineLayout(const EditModel &model, const ViewStyle &vstyle, LineLayout *ll, int width);
+	uint64_t MeasureLine(const EditModel &model, Surface *surface, const ViewStyle &vstyle,
+		LineLayout *ll, int width, LayoutLineOption option, int posInLine, LineLayout::ValidLevel validity);
 	uint64_t LayoutLine(const EditModel &model, Surface *surface, const ViewStyle &vstyle,
 		LineLayout *ll, int width, LayoutLineOption option, int posInLine = 0);
+	bool PreLayoutLines(const EditModel &model, Surface *surface, const ViewStyle &vstyle, int direction);
+	void ResetPreLayoutStatistics() noexcept {
+		preLayoutLines = 0;
+		preLayoutHits = 0;
+		layoutMisses = 0;
+	}
 
 	static void UpdateBidiData(const EditModel &model, const ViewStyle &vstyle, LineLayout *ll);
 
@@ -166,6 +196,7 @@ private:
 		Sci::Line line, int xStart, PRectangle rcLine, int subLine, Sci::Line lineVisible) const;
 	void SCICALL DrawLine(Surface *surface, const EditModel &model, const ViewStyle &vsDraw, const LineLayout *ll,
 		Sci::Line line, Sci::Line lineVisible, int xStart, PRectangle rcLine, int subLine, DrawPhase phase);
+	bool ShiftTextPixMap(const EditModel &model, const ViewStyle &vsDraw, PRectangle rcText, int &exposedTop, int &exposedBottom);
 
 public:
 	void SCICALL PaintText(Surface *surfaceWindow, const EditModel &model, const ViewStyle &vsDraw,
@@ -187,6 +187,8 @@ Editor::Editor() {
 	willRedrawAll = false;
 	idleStyling = IdleStyling::None;
 	needIdleStyling = false;
+	needPreLayout = false;
+	preLayoutDirection = 1;
 
 	recordingMacro = false;
 	convertPastes = true;
@@ -413,6 +415,8 @@ Sci::Line Editor::LineFromLocation(Point pt) const noexcept {
 
 void Editor::SetTopLine(Sci::Line topLineNew) noexcept {
 	if ((topLine != topLineNew) && (topLineNew >= 0)) {
+		preLayoutDirection = (topLineNew < topLine) ? -1 : 1;
+		needPreLayout = true;
 		topLine = topLineNew;
 		ContainerNeedsUpdate(Update::VScroll);
 	}
@@ -426,6 +430,8 @@ void Editor::SetTopLine(Sci::Line topLineNew) noexcept {
 bool Editor::AbandonPaint() noexcept {
 	if ((paintState == PaintState::painting) && !paintingAllText) {
 		paintState = PaintState::abandoned;
+		// changes during abandoned paint are not recorded, cached text pixels may be stale
+		view.InvalidateAllText();
 	}
 	return paintState == PaintState::abandoned;
 }
@@ -445,6 +451,7 @@ void Editor::RedrawRect(PRectangle rc) noexcept {
 		rc.right = rcClient.right;
 
 	if ((rc.bottom > rc.top) && (rc.right > rc.left)) {
+		view.InvalidateText(rc);
 		wMain.InvalidateRectangle(rc);
 	}
 }
@@ -454,6 +461,7 @@ void Editor::DiscardOverdraw() noexcept {
 }
 
 void Editor::Redraw() noexcept {
+	view.InvalidateAllText();
 	if (redrawPendingText) {
 		return;
 	}
@@ -508,6 +516,9 @@ void Editor::RedrawSelMargin(Sci::Line line, bool allAfter) noexcept {
 		rcMarkers.Move(-ptOrigin.x, -ptOrigin.y);
 		wMargin.InvalidateRectangle(rcMarkers);
 	} else {
+		if (markersInText) {
+			view.InvalidateText(rcMarkers);
+		}
 		wMain.InvalidateRectangle(rcMarkers);
 		if (rcMarkers == rcMarkersFull) {
 			redrawPendingMargin = true;
@@ -952,9 +963,15 @@ void Editor::ScrollTo(Sci::Line line, bool moveThumb) {
 	}
 }
 
-void Editor::ScrollText(Sci::Line /* linesToMove */) {
+void Editor::ScrollText(Sci::Line linesToMove) {
 	//Platform::DebugPrintf("Editor::ScrollText %d\n", linesToMove);
-	Redraw();
+	// keep text area of last paint, EditView::PaintText() will shift it and paint exposed lines.
+	view.TextScrolled(static_cast<int>(linesToMove) * vs.lineHeight);
+	const PRectangle rcClient = GetClientRectangle();
+	wMain.InvalidateRectangle(rcClient);
+	if (HasMarginWindow()) {
+		wMargin.InvalidateAll();
+	}
 }
 
 void Editor::HorizontalScrollTo(int xPos) {
@@ -1125,6 +1142,10 @@ slop | strict | jumps | even | Caret can go to the margin                 | When
 */
 
 Editor::XYScrollPosition Editor::XYScrollToMakeVisible(SelectionRange range, const XYScrollOptions options, CaretPolicies policies) {
+	if (!pdoc->IsLineIndexComplete()) {
+		// lines of caret and anchor are needed to locate them
+		pdoc->IndexLines(std::max(range.caret.Position(), range.anchor.Position()) + 1);
+	}
 	const PRectangle rcClient = GetTextRectangle();
 	const Point ptOrigin = GetVisibleOriginInMain();
 	const Point pt = LocationFromPosition(range.caret) + ptOrigin;
@@ -1752,6 +1773,11 @@ void Editor::RefreshPixMaps(Surface *surfaceWindow) {
 		if (!view.pixmapLine) {
 			view.pixmapLine = surfaceWindow->AllocatePixMap(static_cast<int>(rcClient.Width()), vs.lineHeight);
 		}
+		if (!view.pixmapText && vs.marginInside) {
+			view.pixmapText = surfaceWindow->AllocatePixMap(static_cast<int>(rcClient.Width()), static_cast<int>(rcClient.Height()));
+			view.pixmapTextScroll = surfaceWindow->AllocatePixMap(static_cast<int>(rcClient.Width()), static_cast<int>(rcClient.Height()));
+			view.InvalidateAllText();
+		}
 		if (!marginView.pixmapSelMargin) {
 			marginView.pixmapSelMargin = surfaceWindow->AllocatePixMap(vs.fixedColumnWidth,
 				static_cast<int>(rcClient.Height()));
@@ -1773,6 +1799,14 @@ void Editor::Paint(Surface *surfaceWindow, PRectangle rcArea) {
 
 	paintAbandonedByStyling = false;
 
+	if (!pdoc->IsLineIndexComplete()) {
+		// index lines for visible area and next page
+		const Sci::Line lineBottom = pcs->DocFromDisplay(topLine) + 2*LinesOnScreen();
+		if (pdoc->IndexLinesTo(lineBottom) && AbandonPaint()) {
+			return;
+		}
+	}
+
 	StyleAreaBounded(rcArea, false);
 
 	const PRectangle rcClient = GetClientRectangle();
@@ -1850,6 +1884,10 @@ void Editor::Paint(Surface *surfaceWindow, PRectangle rcArea) {
 	if (!view.bufferedDraw)
 		surfaceWindow->PopClip();
 
+	if (needPreLayout) {
+		// lay out lines around the view after painting
+		SetIdle(true);
+	}
 	NotifyPainted();
 }
 
@@ -2768,6 +2806,10 @@ void Editor::NotifyModified(Document *, DocModification mh, void *) {
 				pcs->DeleteLines(lineOfPos, -mh.linesAdded);
 			}
 			view.LinesAddedOrRemoved(lineOfPos, mh.linesAdded);
+			if (!FlagSet(mh.modificationType, ModificationFlags::InsertText | ModificationFlags::DeleteText)) {
+				// last line split by lazy line index
+				view.llc.Invalidate(LineLayout::ValidLevel::checkTextAndStyle);
+			}
 		}
 		if (FlagSet(mh.modificationType, ModificationFlags::ChangeAnnotation)) {
 			const Sci::Line lineDoc = pdoc->SciLineFromPosition(mh.position);
@@ -5139,6 +5181,8 @@ bool Editor::Idle() {
 		needWrap = wrapPending.NeedsWrap();
 	} else if (needIdleStyling) {
 		IdleStyle();
+	} else if (needPreLayout) {
+		IdlePreLayout();
 	}
 
 	// Add more idle things to do here, but make sure idleDone is
@@ -5146,7 +5190,7 @@ bool Editor::Idle() {
 	// false will stop calling this idle function until SetIdle() is
 	// called again.
 
-	const bool idleDone = !needWrap && !needIdleStyling; // && thatDone && theOtherThingDone...
+	const bool idleDone = !needWrap && !needIdleStyling && !needPreLayout; // && thatDone && theOtherThingDone...
 
 	return !idleDone;
 }
@@ -5291,6 +5335,17 @@ void Editor::IdleStyle() {
 	}
 }
 
+void Editor::IdlePreLayout() {
+	needPreLayout = false;
+	if (paintState == PaintState::notPainting && view.preLayoutScreens > 0) {
+		RefreshStyleData();
+		const AutoSurface surface(this);
+		if (surface) {
+			needPreLayout = view.PreLayoutLines(*this, surface, vs, preLayoutDirection);
+		}
+	}
+}
+
 void Editor::IdleWork() {
 	// Style the line after the modification as this allows modifications that change just the
 	// line of the modification to heal instead of propagating to the rest of the window.
@@ -5339,6 +5394,10 @@ void Editor::CheckForChangeOutsidePaint(Range r) noexcept {
 		const PRectangle rcText = GetTextRectangle();
 		rcRange.top = std::max(rcRange.top, rcText.top);
 		rcRange.bottom = std::min(rcRange.bottom, rcText.bottom);
+		if (rcRange.top < rcRange.bottom) {
+			// NotifyModified() doesn't invalidate while painting, cached pixels of these rows are changed
+			view.InvalidateText(rcRange);
+		}
 
 		if (!PaintContains(rcRange)) {
 			AbandonPaint();
@@ -6247,6 +6306,19 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 		pdoc->AllocateLines(wParam);
 		break;
 
+	case Message::IndexLines:
+		return pdoc->IndexLinesStep(wParam);
+
+	case Message::IndexLinesTo:
+		pdoc->IndexLinesTo(wParam);
+		break;
+
+	case Message::GetLineCountEstimate:
+		return pdoc->LinesEstimate();
+
+	case Message::GetLineIndexEnd:
+		return pdoc->LineIndexEnd();
+
 	case Message::GetModify:
 		return !pdoc->IsSavePoint();
 
@@ -7069,6 +7141,38 @@ sptr_t Editor::WndProc(Message iMessage, uptr_t wParam, sptr_t lParam) {
 	case Message::GetLayoutCache:
 		return static_cast<sptr_t>(view.llc.GetLevel());
 
+	case Message::SetLayoutCacheBudget:
+		view.llc.SetMemoryBudget(wParam);
+		break;
+
+	case Message::GetLayoutCacheBudget:
+		return static_cast<sptr_t>(view.llc.GetMemoryBudget());
+
+	case Message::GetLayoutCacheStatistic: {
+		const sptr_t value = (wParam <= static_cast<uptr_t>(LineLayoutCache::Statistic::memory))
+			? view.llc.GetStatistic(static_cast<LineLayoutCache::Statistic>(wParam)) : 0;
+		if (lParam) {
+			view.llc.ResetStatistics();
+		}
+		return value;
+	}
+
+	case Message::SetPreLayoutScreens:
+		view.preLayoutScreens = std::max(static_cast<int>(wParam), 0);
+		break;
+
+	case Message::GetPreLayoutScreens:
+		return view.preLayoutScreens;
+
+	case Message::GetPreLayoutStatistic: {
+		const size_t statistic[] = { view.preLayoutLines, view.preLayoutHits, view.layoutMisses };
+		const sptr_t value = (wParam < std::size(statistic)) ? statistic[wParam] : 0;
+		if (lParam) {
+			view.ResetPreLayoutStatistics();
+		}
+		return value;
+	}
+
 	case Message::SetPositionCache:
 		view.posCache.SetSize(wParam);
 		break;
@@ -277,6 +277,8 @@ protected:	// ScintillaBase subclass needs access to much of Editor
 	WorkNeeded workNeeded;
 	Scintilla::IdleStyling idleStyling;
 	bool needIdleStyling;
+	bool needPreLayout;
+	int preLayoutDirection;	// last scrolling direction, negative for up
 
 	bool recordingMacro;
 	bool convertPastes;
@@ -580,6 +582,7 @@ protected:	// ScintillaBase subclass needs access to much of Editor
 		return (idleStyling == Scintilla::IdleStyling::None) || (idleStyling == Scintilla::IdleStyling::AfterVisible);
 	}
 	void IdleStyle();
+	void IdlePreLayout();
 	virtual void IdleWork();
 	virtual void QueueIdleWork(WorkItems items, Sci::Position upTo = 0) noexcept;
 
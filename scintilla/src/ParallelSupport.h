@@ -2,13 +2,26 @@
 // See License.txt for details about distribution and modification.
 #pragma once
 
+#if defined(_WIN32)
 #include <windows.h>
+#else
+// headless build for tests and benchmarks
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <shared_mutex>
+#include <thread>
+#endif
 
 #ifndef _WIN32_WINNT_VISTA
 #define _WIN32_WINNT_VISTA	0x0600
 #endif
 
+#if defined(_WIN32)
 #define USE_STD_ASYNC_FUTURE	0
+#else
+#define USE_STD_ASYNC_FUTURE	1
+#endif
 #if USE_STD_ASYNC_FUTURE
 #define USE_WIN32_PTP_WORK		0
 #define USE_WIN32_WORK_ITEM		0
@@ -22,10 +35,58 @@
 
 namespace Scintilla::Internal {
 
-inline bool WaitableTimerExpired(HANDLE timer) noexcept {
+#if defined(_WIN32)
+inline uint32_t GetHardwareConcurrency() noexcept {
+	SYSTEM_INFO info;
+	GetNativeSystemInfo(&info);
+	return info.dwNumberOfProcessors;
+}
+
+// manual-reset waitable timer
+inline void *CreateIdleTaskTimer() noexcept {
+	return CreateWaitableTimer(nullptr, true, nullptr);
+}
+
+inline void CloseIdleTaskTimer(void *timer) noexcept {
+	CloseHandle(timer);
+}
+
+inline void SetIdleTaskTimer(void *timer, uint32_t milliseconds) noexcept {
+	LARGE_INTEGER dueTime;
+	dueTime.QuadPart = -INT64_C(10*1000)*milliseconds; // convert to 100ns
+	SetWaitableTimer(timer, &dueTime, 0, nullptr, nullptr, false);
+}
+
+inline bool WaitableTimerExpired(void *timer) noexcept {
 	return WaitForSingleObject(timer, 0) == WAIT_OBJECT_0;
 }
 
+#else
+inline uint32_t GetHardwareConcurrency() noexcept {
+	const uint32_t count = std::thread::hardware_concurrency();
+	return (count == 0) ? 1 : count;
+}
+
+// timer handle points to due time of steady_clock
+inline void *CreateIdleTaskTimer() {
+	return new std::atomic<int64_t>{INT64_MAX};
+}
+
+inline void CloseIdleTaskTimer(void *timer) noexcept {
+	delete static_cast<std::atomic<int64_t> *>(timer);
+}
+
+inline void SetIdleTaskTimer(void *timer, uint32_t milliseconds) noexcept {
+	const auto dueTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(milliseconds);
+	static_cast<std::atomic<int64_t> *>(timer)->store(dueTime.time_since_epoch().count(), std::memory_order_relaxed);
+}
+
+inline bool WaitableTimerExpired(void *timer) noexcept {
+	const int64_t dueTime = static_cast<const std::atomic<int64_t> *>(timer)->load(std::memory_order_relaxed);
+	return std::chrono::steady_clock::now().time_since_epoch().count() >= dueTime;
+}
+#endif
+
 // MSVC Code Analysis
 #ifndef _Acquires_lock_
 #define _Acquires_lock_(x)
@@ -37,7 +98,10 @@ inline bool WaitableTimerExpired(HANDLE timer) noexcept {
 #endif
 
 // std::shared_mutex
-#if _WIN32_WINNT >= _WIN32_WINNT_VISTA
+#if !defined(_WIN32)
+using NativeMutex = std::shared_mutex;
+
+#elif _WIN32_WINNT >= _WIN32_WINNT_VISTA
 class NativeMutex {
 	SRWLOCK srwLock = SRWLOCK_INIT;
 public:
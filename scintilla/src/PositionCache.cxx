@@ -33,6 +33,7 @@
 #include "Geometry.h"
 #include "Platform.h"
 #include "VectorISA.h"
+#include "VectorKernels.h"
 
 #include "CharacterSet.h"
 //#include "CharacterCategory.h"
@@ -79,9 +80,11 @@ LineLayout::LineLayout(Sci::Line lineNumber_, int maxLineLength_) :
 	xHighlightGuide(0),
 	highlightColumn(false),
 	containsCaret(false),
+	preLaidOut(false),
 	bracePreviousStyles{},
 	edgeColumn(0),
 	caretPosition(0),
+	textBreaksVersion(0),
 	widthLine(wrapWidthInfinite),
 	lines(1),
 	wrapIndent(0) {
@@ -146,6 +149,18 @@ bool LineLayout::CanHold(Sci::Line lineDoc, int lineLength_) const noexcept {
 	return (lineNumber == lineDoc) && (lineLength_ <= maxLineLength);
 }
 
+size_t LineLayout::MemoryUsage() const noexcept {
+	size_t memory = sizeof(LineLayout) + lenLineStarts*sizeof(int) + textBreaks.capacity()*sizeof(TextBreak);
+	if (maxLineLength >= 0) {
+		const size_t lineAllocation = maxLineLength + 1;
+		memory += lineAllocation*(sizeof(char) + sizeof(unsigned char)) + (lineAllocation + 1)*sizeof(XYPOSITION);
+		if (bidiData) {
+			memory += sizeof(BidiData) + lineAllocation*(sizeof(std::shared_ptr<Font>) + sizeof(XYPOSITION));
+		}
+	}
+	return memory;
+}
+
 int LineLayout::LineStart(int line) const noexcept {
 	if (line <= 0) {
 		return 0;
@@ -227,14 +242,20 @@ void LineLayout::SetBracesHighlight(Range rangeLine, const Sci::Position braces[
 		const Sci::Position braceOffset = braces[0] - rangeLine.start;
 		if (braceOffset < numCharsInLine) {
 			bracePreviousStyles[0] = styles[braceOffset];
-			styles[braceOffset] = bracesMatchStyle;
+			if (styles[braceOffset] != bracesMatchStyle) {
+				styles[braceOffset] = bracesMatchStyle;
+				InvalidateTextBreaks();
+			}
 		}
 	}
 	if (!ignoreStyle && rangeLine.ContainsCharacter(braces[1])) {
 		const Sci::Position braceOffset = braces[1] - rangeLine.start;
 		if (braceOffset < numCharsInLine) {
 			bracePreviousStyles[1] = styles[braceOffset];
-			styles[braceOffset] = bracesMatchStyle;
+			if (styles[braceOffset] != bracesMatchStyle) {
+				styles[braceOffset] = bracesMatchStyle;
+				InvalidateTextBreaks();
+			}
 		}
 	}
 	if ((braces[0] >= rangeLine.start && braces[1] <= rangeLine.end) ||
@@ -246,14 +267,16 @@ void LineLayout::SetBracesHighlight(Range rangeLine, const Sci::Position braces[
 void LineLayout::RestoreBracesHighlight(Range rangeLine, const Sci::Position braces[], bool ignoreStyle) noexcept {
 	if (!ignoreStyle && rangeLine.ContainsCharacter(braces[0])) {
 		const Sci::Position braceOffset = braces[0] - rangeLine.start;
-		if (braceOffset < numCharsInLine) {
+		if (braceOffset < numCharsInLine && styles[braceOffset] != bracePreviousStyles[0]) {
 			styles[braceOffset] = bracePreviousStyles[0];
+			InvalidateTextBreaks();
 		}
 	}
 	if (!ignoreStyle && rangeLine.ContainsCharacter(braces[1])) {
 		const Sci::Position braceOffset = braces[1] - rangeLine.start;
-		if (braceOffset < numCharsInLine) {
+		if (braceOffset < numCharsInLine && styles[braceOffset] != bracePreviousStyles[1]) {
 			styles[braceOffset] = bracePreviousStyles[1];
+			InvalidateTextBreaks();
 		}
 	}
 	xHighlightGuide = 0;
@@ -400,6 +423,8 @@ void LineLayout::WrapLine(const Document *pdoc, Sci::Position posLineStart, Wrap
 	}
 
 	const bool isUtf8 = CpUtf8 == pdoc->dbcsCodePage;
+	// ASCII byte is always whole character in UTF-8 and single byte encoding
+	const bool asciiWhole = isUtf8 || pdoc->dbcsCodePage == 0;
 	while (p < lastSegmentEnd) {
 		while (p < lastSegmentEnd && positions[p + 1] < startOffset) {
 			p++;
@@ -430,13 +455,15 @@ void LineLayout::WrapLine(const Document *pdoc, Sci::Position posLineStart, Wrap
 						break;
 					}
 
-					const Sci::Position posBefore = pdoc->MovePositionOutsideChar(pos + posLineStart - 1, -1) - posLineStart;
+					const unsigned char chBefore = chars[pos - 1];
+					const bool asciiBefore = asciiWhole && UTF8IsAscii(chBefore);
+					const Sci::Position posBefore = asciiBefore ? (pos - 1) : (pdoc->MovePositionOutsideChar(pos + posLineStart - 1, -1) - posLineStart);
 					if (wrapState == Wrap::Auto) {
 						// word boundary
 						// TODO: Unicode Line Breaking Algorithm https://www.unicode.org/reports/tr14/
 						const WrapBreak wbPos = wbPrev;
 						const CharacterClass ccPos = ccPrev;
-						const int chPrevious = pdoc->CharacterAfter(posBefore + posLineStart).character;
+						const int chPrevious = asciiBefore ? chBefore : pdoc->CharacterAfter(posBefore + posLineStart).character;
 						ccPrev = pdoc->WordCharacterClass(chPrevious);
 						wbPrev = GetWrapBreakEx(chPrevious, isUtf8);
 						if (wbPrev != WrapBreak::Before && wbPos != WrapBreak::After) {
@@ -561,7 +588,9 @@ bool SignificantLines::LineMayCache(Sci::Line line) const noexcept {
 }
 
 LineLayoutCache::LineLayoutCache() noexcept:
-	lastCaretSlot(SIZE_MAX),
+	newest(npos), oldest(npos), freeEntry(npos), lastRetrieved(npos),
+	lineCount(0), memoryUsed(0), memoryBudget(defaultMemoryBudget),
+	hits(0), misses(0), evictions(0),
 	level(LineCache::None),
 	maxValidity(LineLayout::ValidLevel::invalid), styleClock(-1) {
 }
@@ -598,48 +627,9 @@ inline size_t NextPowerOfTwo(size_t x) noexcept {
 
 #if 1
 // test for ASCII only since all C0 control character has special representation.
-#if NP2_USE_SSE2
 inline bool AllGraphicASCII(std::string_view text) noexcept {
-	const char *ptr = text.data();
-	const size_t length = text.length();
-	const char * const end = ptr + length;
-	if (length >= sizeof(__m128i)) {
-		const char * const xend = end - sizeof(__m128i);
-		do {
-			const __m128i chunk = _mm_loadu_si128((const __m128i *)ptr);
-			if (_mm_movemask_epi8(chunk)) {
-				return false;
-			}
-			ptr += sizeof(__m128i);
-		} while (ptr <= xend);
-	}
-#if 0//NP2_USE_AVX2
-	if (const uint32_t remain = length & (sizeof(__m128i) - 1)) {
-		const __m128i chunk = _mm_loadu_si128((const __m128i *)ptr);
-		if (bit_zero_high_u32(_mm_movemask_epi8(chunk), remain)) {
-			return false;
-		}
-	}
-#else
-	for (; ptr < end; ptr++) {
-		if (*ptr & 0x80) {
-			return false;
-		}
-	}
-#endif
-	return true;
-}
-
-#else
-constexpr bool AllGraphicASCII(std::string_view text) noexcept {
-	for (const unsigned char ch : text) {
-		if (ch & 0x80) {
-			return false;
-		}
-	}
-	return true;
+	return np2::vectorKernels.AllASCII(text.data(), text.length());
 }
-#endif
 
 #else
 #if NP2_USE_SSE2
@@ -692,46 +682,163 @@ constexpr bool AllGraphicASCII(std::string_view text) noexcept {
 
 }
 
-void LineLayoutCache::AllocateForLevel(Sci::Line linesOnScreen, Sci::Line linesInDoc) {
-	// round up cache size to avoid rapidly resizing when linesOnScreen or linesInDoc changed.
-	size_t lengthForLevel = 0;
-	if (level == LineCache::Page) {
-		// see comment in Retrieve() method.
-		lengthForLevel = 1 + NP2_align_up(4*linesOnScreen, 64);
-	} else if (level == LineCache::Caret) {
-		lengthForLevel = 2;
-	} else if (level == LineCache::Document) {
-		lengthForLevel = NP2_align_up(linesInDoc, 64);
+size_t LineLayoutCache::MaxLines(Sci::Line linesOnScreen) const noexcept {
+	switch (level) {
+	case LineCache::Page:
+		// room for lines recently scrolled away or jumped from, in addition to KeepLines().
+		return static_cast<size_t>(NP2_align_up(8*linesOnScreen, 64));
+	case LineCache::Document:
+		return npos;
+	default:
+		return 2;
+	}
+}
+
+size_t LineLayoutCache::KeepLines(Sci::Line linesOnScreen) const noexcept {
+	// caret line, visible lines and pre-laid-out lines are kept regardless of memory budget,
+	// so pointers returned for them stay valid while they are laid out.
+	return std::min<size_t>(MaxLines(linesOnScreen), 1 + 4*linesOnScreen);
+}
+
+uint32_t LineLayoutCache::Find(Sci::Line lineNumber) const noexcept {
+	if (!buckets.empty()) {
+		// lines are mostly consecutive, line number itself spreads them over buckets.
+		uint32_t index = buckets[static_cast<size_t>(lineNumber) & (buckets.size() - 1)];
+		while (index != npos) {
+			const Entry &entry = entries[index];
+			if (entry.ll->LineNumber() == lineNumber) {
+				break;
+			}
+			index = entry.next;
+		}
+		return index;
+	}
+	return npos;
+}
+
+void LineLayoutCache::Account(uint32_t index) noexcept {
+	// layout grows after Retrieve() returned, e.g. line starts for wrapping and text breaks for drawing.
+	Entry &entry = entries[index];
+	const size_t memory = entry.ll->MemoryUsage();
+	memoryUsed = memoryUsed - entry.memory + memory;
+	entry.memory = memory;
+}
+
+void LineLayoutCache::Unlink(uint32_t index) noexcept {
+	const Entry &entry = entries[index];
+	if (entry.newer != npos) {
+		entries[entry.newer].older = entry.older;
+	} else {
+		newest = entry.older;
+	}
+	if (entry.older != npos) {
+		entries[entry.older].newer = entry.newer;
+	} else {
+		oldest = entry.newer;
+	}
+}
+
+void LineLayoutCache::LinkNewest(uint32_t index) noexcept {
+	Entry &entry = entries[index];
+	entry.newer = npos;
+	entry.older = newest;
+	if (newest != npos) {
+		entries[newest].newer = index;
+	} else {
+		oldest = index;
+	}
+	newest = index;
+}
+
+void LineLayoutCache::Rehash(size_t count) {
+	buckets.assign(std::max<size_t>(NextPowerOfTwo(count), 64), npos);
+	const size_t mask = buckets.size() - 1;
+	for (uint32_t index = newest; index != npos; index = entries[index].older) {
+		Entry &entry = entries[index];
+		uint32_t &head = buckets[static_cast<size_t>(entry.ll->LineNumber()) & mask];
+		entry.next = head;
+		head = index;
+	}
+}
+
+void LineLayoutCache::Evict(uint32_t index) noexcept {
+	Entry &entry = entries[index];
+	uint32_t *link = &buckets[static_cast<size_t>(entry.ll->LineNumber()) & (buckets.size() - 1)];
+	while (*link != index) {
+		link = &entries[*link].next;
+	}
+	*link = entry.next;
+	Unlink(index);
+	memoryUsed -= entry.memory;
+	entry.memory = 0;
+	entry.ll.reset();
+	entry.next = freeEntry;
+	freeEntry = index;
+	if (lastRetrieved == index) {
+		lastRetrieved = npos;
+	}
+	--lineCount;
+	++evictions;
+}
+
+void LineLayoutCache::EvictFor(Sci::Line lineCaret, Sci::Line linesOnScreen) noexcept {
+	// make room for one more line
+	const size_t maxLines = MaxLines(linesOnScreen);
+	const size_t keepLines = KeepLines(linesOnScreen);
+	bool caretKept = false;
+	while (lineCount != 0 && (lineCount >= maxLines || (memoryUsed > memoryBudget && lineCount >= keepLines))) {
+		if (!caretKept && entries[oldest].ll->LineNumber() == lineCaret) {
+			// caret line is rapidly retrieved when caret blinking.
+			caretKept = true;
+			const uint32_t index = oldest;
+			Unlink(index);
+			LinkNewest(index);
+			continue;
+		}
+		Evict(oldest);
+	}
+}
+
+uint32_t LineLayoutCache::Insert(std::unique_ptr<LineLayout> ll) {
+	uint32_t index = freeEntry;
+	if (index != npos) {
+		freeEntry = entries[index].next;
+	} else {
+		index = static_cast<uint32_t>(entries.size());
+		entries.emplace_back();
 	}
-	if (lengthForLevel != shortCache.size()) {
-		maxValidity = LineLayout::ValidLevel::lines;
-		shortCache.resize(lengthForLevel);
-		//printf("%s level=%d, size=%zu/%zu, LineLayout=%zu/%zu, BidiData=%zu, XYPOSITION=%zu\n",
-		//	__func__, level, shortCache.size(), shortCache.capacity(), sizeof(LineLayout),
-		//	sizeof(std::unique_ptr<LineLayout>), sizeof(BidiData), sizeof(XYPOSITION));
+	if (2*(lineCount + 1) > buckets.size()) {
+		Rehash(4*(lineCount + 1));
 	}
-	PLATFORM_ASSERT(shortCache.size() >= lengthForLevel);
+	Entry &entry = entries[index];
+	uint32_t &head = buckets[static_cast<size_t>(ll->LineNumber()) & (buckets.size() - 1)];
+	entry.ll = std::move(ll);
+	entry.memory = 0;
+	entry.next = head;
+	head = index;
+	LinkNewest(index);
+	++lineCount;
+	return index;
 }
 
 void LineLayoutCache::Deallocate() noexcept {
 	maxValidity = LineLayout::ValidLevel::invalid;
-	lastCaretSlot = SIZE_MAX;
-	shortCache.clear();
-	longCache.clear();
+	entries.clear();
+	buckets.clear();
+	newest = npos;
+	oldest = npos;
+	freeEntry = npos;
+	lastRetrieved = npos;
+	lineCount = 0;
+	memoryUsed = 0;
 }
 
 void LineLayoutCache::Invalidate(LineLayout::ValidLevel validity_) noexcept {
 	if (maxValidity > validity_) {
 		maxValidity = validity_;
-		for (const auto &ll : shortCache) {
-			if (ll) {
-				ll->Invalidate(validity_);
-			}
-		}
-		for (const auto &ll : longCache) {
-			if (ll) {
-				ll->Invalidate(validity_);
-			}
+		for (uint32_t index = newest; index != npos; index = entries[index].older) {
+			entries[index].ll->Invalidate(validity_);
+			Account(index);
 		}
 	}
 }
@@ -739,85 +846,72 @@ void LineLayoutCache::Invalidate(LineLayout::ValidLevel validity_) noexcept {
 void LineLayoutCache::SetLevel(LineCache level_) noexcept {
 	if (level != level_) {
 		level = level_;
-		maxValidity = LineLayout::ValidLevel::invalid;
-		lastCaretSlot = SIZE_MAX;
-		shortCache.clear();
-		longCache.clear();
+		Deallocate();
+	}
+}
+
+void LineLayoutCache::SetMemoryBudget(size_t bytes) noexcept {
+	memoryBudget = bytes;
+}
+
+size_t LineLayoutCache::GetStatistic(Statistic statistic) const noexcept {
+	switch (statistic) {
+	case Statistic::hits:
+		return hits;
+	case Statistic::misses:
+		return misses;
+	case Statistic::evictions:
+		return evictions;
+	case Statistic::lines:
+		return lineCount;
+	case Statistic::memory:
+		return memoryUsed;
+	default:
+		return 0;
+	}
+}
+
+Sci::Line LineLayoutCache::PreLayoutCapacity(Sci::Line linesOnScreen) const noexcept {
+	if (level == LineCache::Page || level == LineCache::Document) {
+		// lines newer than caret line and visible lines are not evicted, see EvictFor() method.
+		return std::max<Sci::Line>(static_cast<Sci::Line>(KeepLines(linesOnScreen)) - linesOnScreen - 1, 0);
 	}
+	return 0;
 }
 
 LineLayout *LineLayoutCache::Retrieve(Sci::Line lineNumber, Sci::Line lineCaret, int maxChars, int styleClock_,
-	Sci::Line linesOnScreen, Sci::Line linesInDoc, Sci::Line topLine) {
-	AllocateForLevel(linesOnScreen, linesInDoc);
+	Sci::Line linesOnScreen) {
 	if (styleClock != styleClock_) {
 		Invalidate(LineLayout::ValidLevel::checkTextAndStyle);
 		styleClock = styleClock_;
 	}
 	maxValidity = LineLayout::ValidLevel::lines;
-
-	size_t pos = 0;
-	LineLayout *ret = nullptr;
-	const int useLongCache = UseLongCache(maxChars);
-	if (useLongCache) {
-		for (const auto &ll : longCache) {
-			if (ll->LineNumber() == lineNumber) {
-				ret = ll.get();
-				break;
-			}
-		}
-	} else if (level == LineCache::Page) {
-		// two arenas, each with two pages to ensure cache efficiency on scrolling.
-		// first arena for lines near top visible line.
-		// second arena for other lines, e.g. folded lines near top visible line.
-		// TODO: use/cleanup second arena after some periods, e.g. after Editor::WrapLines() finished.
-		const size_t diff = std::abs(lineNumber - topLine);
-		const size_t gap = shortCache.size() / 2;
-		pos = 1 + (lineNumber % gap) + ((diff < gap) ? 0 : gap);
-		// first slot reserved for caret line, which is rapidly retrieved when caret blinking.
-		if (lineNumber == lineCaret) {
-			if (lastCaretSlot == 0 && shortCache[0]->LineNumber() == lineCaret) {
-				pos = 0;
-			} else {
-				lastCaretSlot = pos;
-			}
-		} else if (pos == lastCaretSlot) {
-			// save cache for caret line.
-			lastCaretSlot = 0;
-			std::swap(shortCache[0], shortCache[pos]);
-		}
-	} else if (level == LineCache::Caret) {
-		pos = lineNumber != lineCaret;
-	} else if (level == LineCache::Document) {
-		pos = lineNumber;
+	if (lastRetrieved != npos) {
+		Account(lastRetrieved);
 	}
 
-	if (!useLongCache) {
-		ret = shortCache[pos].get();
-	}
-	if (ret) {
-		if (!ret->CanHold(lineNumber, maxChars)) {
-			//printf("USE line=%zd/%zd, caret=%zd/%zd top=%zd, pos=%zu, clock=%d\n",
-			//	lineNumber, ret->lineNumber, lineCaret, lastCaretSlot, topLine, pos, styleClock_);
-			ret->Free();
-			new (ret) LineLayout(lineNumber, maxChars);
+	uint32_t index = Find(lineNumber);
+	if (index != npos) {
+		LineLayout * const ll = entries[index].ll.get();
+		if (ll->CanHold(lineNumber, maxChars)) {
+			++hits;
 		} else {
-			//printf("HIT line=%zd, caret=%zd/%zd top=%zd, pos=%zu, clock=%d, validity=%d\n",
-			//	lineNumber, lineCaret, lastCaretSlot, topLine, pos, styleClock_, ret->validity);
+			++misses;
+			// reuse the object, pointer for the line is unchanged.
+			ll->~LineLayout();
+			new (ll) LineLayout(lineNumber, maxChars);
 		}
+		Unlink(index);
+		LinkNewest(index);
 	} else {
-		//printf("NEW line=%zd, caret=%zd/%zd top=%zd, pos=%zu, clock=%d\n",
-		//	lineNumber, lineCaret, lastCaretSlot, topLine, pos, styleClock_);
-		auto ll = std::make_unique<LineLayout>(lineNumber, maxChars);
-		ret = ll.get();
-		if (useLongCache) {
-			longCache.push_back(std::move(ll));
-		} else {
-			shortCache[pos].swap(ll);
-		}
+		++misses;
+		EvictFor(lineCaret, linesOnScreen);
+		index = Insert(std::make_unique<LineLayout>(lineNumber, maxChars));
 	}
 
-	// LineLineCache::None is not supported, we only use LineCache::Page.
-	return ret;
+	lastRetrieved = index;
+	Account(index);
+	return entries[index].ll.get();
 }
 
 namespace {
@@ -845,6 +939,52 @@ inline unsigned int KeyFromString(std::string_view charBytes) noexcept {
 
 constexpr unsigned int representationKeyCrLf = ('\r' << 8) | '\n';
 
+constexpr bool IsGraphicASCII(unsigned char ch) noexcept {
+	return ch >= ' ' && ch <= '~';
+}
+
+// Find end of graphic ASCII run that has same style as previous byte (pos > 0),
+// BreakFinder::Next() only needs to check characters after the run one by one.
+int SkipGraphicASCIIRun(const char *chars, const unsigned char *styles, int pos, int end) noexcept {
+#if NP2_USE_AVX2
+	const __m256i vectSpace = _mm256_set1_epi8(' ' - 1);
+	const __m256i vectDel = _mm256_set1_epi8('\x7f');
+	while (pos + static_cast<int>(sizeof(__m256i)) <= end) {
+		const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(chars + pos));
+		const __m256i style = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(styles + pos));
+		const __m256i stylePrev = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(styles + pos - 1));
+		// signed compare also excludes non-ASCII bytes
+		__m256i plain = _mm256_andnot_si256(_mm256_cmpeq_epi8(chunk, vectDel), _mm256_cmpgt_epi8(chunk, vectSpace));
+		plain = _mm256_and_si256(plain, _mm256_cmpeq_epi8(style, stylePrev));
+		const uint32_t mask = ~static_cast<uint32_t>(_mm256_movemask_epi8(plain));
+		if (mask) {
+			return pos + np2_ctz(mask);
+		}
+		pos += sizeof(__m256i);
+	}
+#elif NP2_USE_SSE2
+	const __m128i vectSpace = _mm_set1_epi8(' ' - 1);
+	const __m128i vectDel = _mm_set1_epi8('\x7f');
+	while (pos + static_cast<int>(sizeof(__m128i)) <= end) {
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(chars + pos));
+		const __m128i style = _mm_loadu_si128(reinterpret_cast<const __m128i *>(styles + pos));
+		const __m128i stylePrev = _mm_loadu_si128(reinterpret_cast<const __m128i *>(styles + pos - 1));
+		// signed compare also excludes non-ASCII bytes
+		__m128i plain = _mm_andnot_si128(_mm_cmpeq_epi8(chunk, vectDel), _mm_cmpgt_epi8(chunk, vectSpace));
+		plain = _mm_and_si128(plain, _mm_cmpeq_epi8(style, stylePrev));
+		const uint32_t mask = _mm_movemask_epi8(plain) ^ 0xffff;
+		if (mask) {
+			return pos + np2_ctz(mask);
+		}
+		pos += sizeof(__m128i);
+	}
+#endif
+	while (pos < end && IsGraphicASCII(chars[pos]) && styles[pos] == styles[pos - 1]) {
+		++pos;
+	}
+	return pos;
+}
+
 }
 
 void SpecialRepresentations::SetRepresentation(std::string_view charBytes, std::string_view value) {
@@ -855,6 +995,8 @@ void SpecialRepresentations::SetRepresentation(std::string_view charBytes, std::
 			// New entry so increment for first byte
 			const unsigned char ucStart = charBytes[0];
 			startByteHasReprs[ucStart]++;
+			graphicASCIIReprs += IsGraphicASCII(ucStart);
+			version++;
 			if (key > maxKey) {
 				maxKey = key;
 			}
@@ -898,6 +1040,8 @@ void SpecialRepresentations::ClearRepresentation(std::string_view charBytes) {
 			mapReprs.erase(it);
 			const unsigned char ucStart = charBytes[0];
 			startByteHasReprs[ucStart]--;
+			graphicASCIIReprs -= IsGraphicASCII(ucStart);
+			version++;
 			if (key == maxKey && startByteHasReprs[ucStart] == 0) {
 				maxKey = mapReprs.empty() ? 0 : mapReprs.crbegin()->first;
 			}
@@ -936,6 +1080,8 @@ void SpecialRepresentations::Clear() noexcept {
 	constexpr unsigned char none = 0;
 	std::fill(startByteHasReprs, std::end(startByteHasReprs), none);
 	maxKey = 0;
+	graphicASCIIReprs = 0;
+	version++;
 	crlf = false;
 }
 
@@ -1023,7 +1169,10 @@ BreakFinder::BreakFinder(const LineLayout *ll_, const Selection *psel, Range lin
 	saeNext(0),
 	pdoc(model.pdoc),
 	encodingFamily(pdoc->CodePageFamily()),
-	reprs(model.reprs.get()) {
+	reprs(model.reprs.get()),
+	cachedBreaks(false),
+	textBreak(nullptr),
+	textBreakEnd(nullptr) {
 
 	// Search for first visible break
 	// First find the first visible character
@@ -1087,67 +1236,172 @@ BreakFinder::BreakFinder(const LineLayout *ll_, const Selection *psel, Range lin
 	Insert(ll->edgeColumn);
 	Insert(endPos);
 	saeNext = (!selAndEdge.empty()) ? selAndEdge[0] : -1;
+
+	// text and styles are not changed during repaint, reuse breaks found in previous paint.
+	if (breakFor != BreakFor::Layout && ll->numCharsInLine <= lengthCacheTextBreaks) {
+		if (ll->textBreaksVersion != reprs->Version()) {
+			BuildTextBreaks();
+		}
+		const std::vector<TextBreak> &breaks = ll->textBreaks;
+		cachedBreaks = true;
+		textBreak = breaks.data();
+		textBreakEnd = textBreak + breaks.size();
+		textBreak = std::lower_bound(textBreak, textBreakEnd, nextBreak, [](const TextBreak &tb, int pos) noexcept {
+			return tb.position < pos;
+		});
+	}
 }
 
 BreakFinder::~BreakFinder() = default;
 
+// Find style changes and representations for whole line, same as the loop in Next() without selection and edge.
+void BreakFinder::BuildTextBreaks() const {
+	std::vector<TextBreak> &breaks = ll->textBreaks;
+	breaks.clear();
+	const int length = ll->numCharsInLine;
+	const bool plainASCII = !reprs->MayContainsGraphicASCII();
+	int pos = 0;
+	while (pos < length) {
+		if (plainASCII && pos > 0) {
+			pos = SkipGraphicASCIIRun(ll->chars.get(), ll->styles.get(), pos, length);
+			if (pos >= length) {
+				break;
+			}
+		}
+		int charWidth = 1;
+		const char * const chars = &ll->chars[pos];
+		const unsigned char ch = chars[0];
+		if (!UTF8IsAscii(ch) && encodingFamily != EncodingFamily::eightBit) {
+			if (encodingFamily == EncodingFamily::unicode) {
+				charWidth = UTF8DrawBytes(chars, length - pos);
+			} else {
+				charWidth = pdoc->DBCSDrawBytes(chars, length - pos);
+			}
+		}
+		const Representation *repr = nullptr;
+		if (reprs->MayContains(ch)) {
+			if (ch == '\r' && reprs->ContainsCrLf() && chars[1] == '\n') {
+				charWidth = 2;
+			}
+			repr = reprs->GetRepresentation(std::string_view(chars, charWidth));
+		}
+		if (repr || ((pos > 0) && (ll->styles[pos] != ll->styles[pos - 1]))) {
+			breaks.push_back({pos, charWidth, repr});
+		}
+		pos += charWidth;
+	}
+	ll->textBreaksVersion = reprs->Version();
+}
+
+// Same as the loop in Next(), but only stops at cached text breaks and selection or edge.
+int BreakFinder::NextCachedBreak(int prev, const Representation *&repr) noexcept {
+	int pos = prev;
+	while (pos < endPos) {
+		while (textBreak != textBreakEnd && textBreak->position < pos) {
+			++textBreak;
+		}
+		int next = endPos;
+		if (textBreak != textBreakEnd) {
+			next = std::min(next, textBreak->position);
+		}
+		if (saeNext >= pos) {
+			next = std::min(next, saeNext);
+		}
+		if (next >= endPos) {
+			return endPos;
+		}
+
+		pos = next;
+		const bool cached = textBreak != textBreakEnd && textBreak->position == pos;
+		repr = cached ? textBreak->representation : nullptr;
+		while ((pos >= saeNext) && (saeNext < endPos)) {
+			saeCurrentPos++;
+			saeNext = static_cast<int>((saeCurrentPos < selAndEdge.size()) ? selAndEdge[saeCurrentPos] : endPos);
+		}
+		if ((pos > prev) || repr) {
+			if (pos == prev) {
+				pos += textBreak->width;
+			} else {
+				repr = nullptr;
+			}
+			return pos;
+		}
+		// following breaks are at character start, so step into current character is fine
+		pos += cached ? textBreak->width : 1;
+	}
+	return pos;
+}
+
 TextSegment BreakFinder::Next() {
 	if (subBreak < 0) {
 		const int prev = nextBreak;
 		const Representation *repr = nullptr;
-		while (nextBreak < endPos) {
-			int charWidth = 1;
-			const char * const chars = &ll->chars[nextBreak];
-			const unsigned char ch = chars[0];
-			//bool characterStyleConsistent = true;	// All bytes of character in same style?
-			if (!UTF8IsAscii(ch) && encodingFamily != EncodingFamily::eightBit) {
-				if (encodingFamily == EncodingFamily::unicode) {
-					charWidth = UTF8DrawBytes(chars, endPos - nextBreak);
-				} else {
-					charWidth = pdoc->DBCSDrawBytes(chars, endPos - nextBreak);
+		if (cachedBreaks) {
+			nextBreak = NextCachedBreak(prev, repr);
+		} else {
+			const bool plainASCII = !reprs->MayContainsGraphicASCII();
+			while (nextBreak < endPos) {
+				if (plainASCII && nextBreak > prev) {
+					// skip graphic ASCII run before next selection or edge break
+					const int end = (saeNext >= nextBreak) ? std::min(saeNext, endPos) : endPos;
+					nextBreak = SkipGraphicASCIIRun(ll->chars.get(), ll->styles.get(), nextBreak, end);
+					if (nextBreak >= endPos) {
+						break;
+					}
 				}
-				//for (int trail = 1; trail < charWidth; trail++) {
-				//	if (ll->styles[nextBreak] != ll->styles[nextBreak + trail]) {
-				//		characterStyleConsistent = false;
-				//	}
-				//}
-			}
-			//if (!characterStyleConsistent) {
-			//	if (nextBreak == prev) {
-			//		// Show first character representation bytes since it has inconsistent styles.
-			//		charWidth = 1;
-			//	} else {
-			//		// Return segment before nextBreak but allow to be split up if too long
-			//		// If not split up, next call will hit the above 'charWidth = 1;' and display bytes.
-			//		break;
-			//	}
- 			//}
-			repr = nullptr;
-			if (reprs->MayContains(ch)) {
-				// Special case \r\n line ends if there is a representation
-				if (ch == '\r' && reprs->ContainsCrLf() && chars[1] == '\n') {
-					charWidth = 2;
+				int charWidth = 1;
+				const char * const chars = &ll->chars[nextBreak];
+				const unsigned char ch = chars[0];
+				//bool characterStyleConsistent = true;	// All bytes of character in same style?
+				if (!UTF8IsAscii(ch) && encodingFamily != EncodingFamily::eightBit) {
+					if (encodingFamily == EncodingFamily::unicode) {
+						charWidth = UTF8DrawBytes(chars, endPos - nextBreak);
+					} else {
+						charWidth = pdoc->DBCSDrawBytes(chars, endPos - nextBreak);
+					}
+					//for (int trail = 1; trail < charWidth; trail++) {
+					//	if (ll->styles[nextBreak] != ll->styles[nextBreak + trail]) {
+					//		characterStyleConsistent = false;
+					//	}
+					//}
 				}
-				repr = reprs->GetRepresentation(std::string_view(chars, charWidth));
-			}
-			if (((nextBreak > 0) && (ll->styles[nextBreak] != ll->styles[nextBreak - 1])) ||
-				repr ||
-				(nextBreak == saeNext)) {
-				while ((nextBreak >= saeNext) && (saeNext < endPos)) {
-					saeCurrentPos++;
-					saeNext = static_cast<int>((saeCurrentPos < selAndEdge.size()) ? selAndEdge[saeCurrentPos] : endPos);
+				//if (!characterStyleConsistent) {
+				//	if (nextBreak == prev) {
+				//		// Show first character representation bytes since it has inconsistent styles.
+				//		charWidth = 1;
+				//	} else {
+				//		// Return segment before nextBreak but allow to be split up if too long
+				//		// If not split up, next call will hit the above 'charWidth = 1;' and display bytes.
+				//		break;
+				//	}
+	 			//}
+				repr = nullptr;
+				if (reprs->MayContains(ch)) {
+					// Special case \r\n line ends if there is a representation
+					if (ch == '\r' && reprs->ContainsCrLf() && chars[1] == '\n') {
+						charWidth = 2;
+					}
+					repr = reprs->GetRepresentation(std::string_view(chars, charWidth));
 				}
-				if ((nextBreak > prev) || repr) {
-					// Have a segment to report
-					if (nextBreak == prev) {
-						nextBreak += charWidth;
-					} else {
-						repr = nullptr;	// Optimize -> should remember repr
+				if (((nextBreak > 0) && (ll->styles[nextBreak] != ll->styles[nextBreak - 1])) ||
+					repr ||
+					(nextBreak == saeNext)) {
+					while ((nextBreak >= saeNext) && (saeNext < endPos)) {
+						saeCurrentPos++;
+						saeNext = static_cast<int>((saeCurrentPos < selAndEdge.size()) ? selAndEdge[saeCurrentPos] : endPos);
+					}
+					if ((nextBreak > prev) || repr) {
+						// Have a segment to report
+						if (nextBreak == prev) {
+							nextBreak += charWidth;
+						} else {
+							repr = nullptr;	// Optimize -> should remember repr
+						}
+						break;
 					}
-					break;
 				}
+				nextBreak += charWidth;
 			}
-			nextBreak += charWidth;
 		}
 
 		const int lengthSegment = nextBreak - prev;
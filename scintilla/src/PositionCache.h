@@ -40,6 +40,16 @@ public:
 	void Resize(size_t maxLineLength_);
 };
 
+class Representation;
+class SpecialRepresentations;
+
+// Position where BreakFinder stops for style change or representation.
+struct TextBreak {
+	int position;
+	int width;
+	const Representation *representation;
+};
+
 /**
  */
 class LineLayout final {
@@ -52,6 +62,10 @@ public:
 	enum {
 		wrapWidthInfinite = 0x7ffffff
 	};
+	// Hard to cope when too narrow, so just assume there is space
+	static constexpr int LayoutWidth(int width) noexcept {
+		return (width < 20) ? 20 : width;
+	}
 
 	int maxLineLength;
 	int lastSegmentEnd;
@@ -63,6 +77,7 @@ public:
 	int xHighlightGuide;
 	bool highlightColumn;
 	bool containsCaret;
+	bool preLaidOut;	// laid out ahead of painting, cleared when painted
 	unsigned char bracePreviousStyles[2];
 	int edgeColumn;
 	int caretPosition;
@@ -72,6 +87,11 @@ public:
 
 	std::unique_ptr<BidiData> bidiData;
 
+	// Cached style and representation breaks for drawing, valid while textBreaksVersion
+	// equals version of representations, reset when chars or styles are changed.
+	mutable std::vector<TextBreak> textBreaks;
+	mutable unsigned int textBreaksVersion;
+
 	// Wrapped line support
 	int widthLine;
 	int lines;
@@ -90,13 +110,22 @@ public:
 	void Free() noexcept;
 	void ClearPositions() const noexcept;
 	void Invalidate(ValidLevel validity_) noexcept;
+	void InvalidateTextBreaks() noexcept {
+		textBreaksVersion = 0;
+	}
 	Sci::Line LineNumber() const noexcept {
 		return lineNumber;
 	}
 	bool PartialPosition() const noexcept {
 		return lastSegmentEnd < numCharsInLine;
 	}
+	// fully laid out and wrapped for wrap width
+	bool LaidOut(int width) const noexcept {
+		return validity == ValidLevel::lines && widthLine == LayoutWidth(width);
+	}
 	bool CanHold(Sci::Line lineDoc, int lineLength_) const noexcept;
+	// bytes allocated for this layout, including per character arrays.
+	size_t MemoryUsage() const noexcept;
 	int LineStart(int line) const noexcept;
 	int LineLength(int line) const noexcept;
 	enum class Scope {
@@ -161,17 +190,50 @@ struct SignificantLines {
 };
 
 /**
+ * Line layouts indexed by line number in a hash table and evicted in least recently used order
+ * when the cache exceeds its byte budget or the number of lines allowed for the level.
  */
 class LineLayoutCache final {
 private:
-	std::vector<std::unique_ptr<LineLayout>> shortCache;
-	std::vector<std::unique_ptr<LineLayout>> longCache;
-	size_t lastCaretSlot;
+	static constexpr uint32_t npos = UINT32_MAX;
+	struct Entry {
+		std::unique_ptr<LineLayout> ll;
+		size_t memory;	// MemoryUsage() when last retrieved
+		uint32_t newer;	// least recently used list
+		uint32_t older;
+		uint32_t next;	// next entry in same bucket, or next free entry
+	};
+	std::vector<Entry> entries;
+	std::vector<uint32_t> buckets;
+	uint32_t newest;
+	uint32_t oldest;
+	uint32_t freeEntry;
+	uint32_t lastRetrieved;
+	size_t lineCount;
+	size_t memoryUsed;
+	size_t memoryBudget;
+	size_t hits;
+	size_t misses;
+	size_t evictions;
 	Scintilla::LineCache level;
 	LineLayout::ValidLevel maxValidity;
 	int styleClock;
-	void AllocateForLevel(Sci::Line linesOnScreen, Sci::Line linesInDoc);
+	size_t MaxLines(Sci::Line linesOnScreen) const noexcept;
+	size_t KeepLines(Sci::Line linesOnScreen) const noexcept;
+	uint32_t Find(Sci::Line lineNumber) const noexcept;
+	void Account(uint32_t index) noexcept;
+	void Unlink(uint32_t index) noexcept;
+	void LinkNewest(uint32_t index) noexcept;
+	void Rehash(size_t count);
+	void Evict(uint32_t index) noexcept;
+	void EvictFor(Sci::Line lineCaret, Sci::Line linesOnScreen) noexcept;
+	uint32_t Insert(std::unique_ptr<LineLayout> ll);
 public:
+	enum class Statistic {
+		hits, misses, evictions, lines, memory
+	};
+	static constexpr size_t defaultMemoryBudget = 32*1024*1024;
+
 	LineLayoutCache() noexcept;
 	// Deleted so LineLayoutCache objects can not be copied.
 	LineLayoutCache(const LineLayoutCache &) = delete;
@@ -185,15 +247,28 @@ public:
 	Scintilla::LineCache GetLevel() const noexcept {
 		return level;
 	}
+	// lines beyond the most recently used ones are evicted when memory usage exceeds the budget.
+	void SetMemoryBudget(size_t bytes) noexcept;
+	size_t GetMemoryBudget() const noexcept {
+		return memoryBudget;
+	}
+	size_t GetStatistic(Statistic statistic) const noexcept;
+	void ResetStatistics() noexcept {
+		hits = 0;
+		misses = 0;
+		evictions = 0;
+	}
+	// number of lines around the screen that can be laid out without evicting visible lines.
+	Sci::Line PreLayoutCapacity(Sci::Line linesOnScreen) const noexcept;
 	LineLayout* SCICALL Retrieve(Sci::Line lineNumber, Sci::Line lineCaret, int maxChars, int styleClock_,
-		Sci::Line linesOnScreen, Sci::Line linesInDoc, Sci::Line topLine);
+		Sci::Line linesOnScreen);
 	LineLayout* Retrieve(Sci::Line lineNumber, const SignificantLines &significantLines, int maxChars) {
 		return Retrieve(lineNumber, significantLines.lineCaret,
-			maxChars, significantLines.styleClock,
-			significantLines.linesOnScreen, significantLines.linesTotal, significantLines.lineTop);
+			maxChars, significantLines.styleClock, significantLines.linesOnScreen);
 	}
 
-	static constexpr int UseLongCache(unsigned maxChars) noexcept {
+	// layout for huge line takes dozens of megabytes, it's only created when the line is needed.
+	static constexpr int IsHugeLine(unsigned maxChars) noexcept {
 		return maxChars >> (20 + 1); // 2MiB
 	}
 };
@@ -240,6 +315,8 @@ class SpecialRepresentations {
 	std::map<unsigned int, Representation> mapReprs;
 	unsigned char startByteHasReprs[0x100] {};
 	unsigned int maxKey = 0;
+	unsigned int graphicASCIIReprs = 0;
+	unsigned int version = 1;
 	bool crlf = false;
 public:
 	void SetRepresentation(std::string_view charBytes, std::string_view value);
@@ -254,6 +331,14 @@ public:
 	bool MayContains(unsigned char ch) const noexcept {
 		return startByteHasReprs[ch] != 0;
 	}
+	// whether any character between space and tilde has representation.
+	bool MayContainsGraphicASCII() const noexcept {
+		return graphicASCIIReprs != 0;
+	}
+	// changed when representation is added or removed.
+	unsigned int Version() const noexcept {
+		return version;
+	}
 	void Clear() noexcept;
 	void SetDefaultRepresentations(int dbcsCodePage);
 };
@@ -283,7 +368,12 @@ class BreakFinder {
 	const Document *pdoc;
 	const EncodingFamily encodingFamily;
 	const SpecialRepresentations *reprs;
+	bool cachedBreaks;
+	const TextBreak *textBreak;
+	const TextBreak *textBreakEnd;
 	void Insert(Sci::Position val);
+	void BuildTextBreaks() const;
+	int NextCachedBreak(int prev, const Representation *&repr) noexcept;
 public:
 	// If a whole run is longer than lengthStartSubdivision then subdivide
 	// into smaller runs at spaces or punctuation.
@@ -294,6 +384,10 @@ public:
 	enum {
 		lengthEachSubdivision = 1024
 	};
+	// Only cache text breaks for drawing lines not longer than this.
+	enum {
+		lengthCacheTextBreaks = 64*1024
+	};
 	enum class BreakFor {
 		Text = 0,
 		Selection = 1,
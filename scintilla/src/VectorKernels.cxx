@@ -0,0 +1,1225 @@
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+// Runtime dispatched byte classification kernels, see VectorKernels.h.
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "VectorKernels.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+	#define NP2_KERNEL_X86	1
+	#if defined(__x86_64__) || defined(_M_X64)
+		#define NP2_KERNEL_AVX512	1
+	#else
+		#define NP2_KERNEL_AVX512	0
+	#endif
+	#include <immintrin.h>
+	#if defined(_MSC_VER) && !defined(__clang__)
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+	#endif
+#else
+	// TODO: use ARM Neon
+	#define NP2_KERNEL_X86	0
+	#define NP2_KERNEL_AVX512	0
+#endif
+
+// GCC and Clang only allow intrinsics for instruction sets enabled on current function,
+// MSVC allows all intrinsics without /arch option.
+#if defined(__GNUC__) || defined(__clang__)
+	#define NP2_TARGET_SSSE3	__attribute__((__target__("ssse3")))
+	#define NP2_TARGET_AVX2		__attribute__((__target__("avx2,bmi,bmi2,popcnt")))
+	#define NP2_TARGET_AVX512	__attribute__((__target__("avx512f,avx512bw,avx2,bmi,bmi2,popcnt")))
+	#define NP2_ALWAYS_INLINE	__attribute__((__always_inline__)) inline
+	#define np2_ctz32(x)		__builtin_ctz(x)
+	#define np2_ctz64(x)		__builtin_ctzll(x)
+	#define np2_popcnt64(x)		__builtin_popcountll(x)
+#else
+	#define NP2_TARGET_SSSE3
+	#define NP2_TARGET_AVX2
+	#define NP2_TARGET_AVX512
+	#define NP2_ALWAYS_INLINE	__forceinline
+	#define np2_ctz64(x)		_tzcnt_u64(x)
+	inline uint32_t np2_ctz32(uint32_t value) noexcept {
+		unsigned long trailing;
+		_BitScanForward(&trailing, value);
+		return trailing;
+	}
+	#if defined(_WIN64)
+		#define np2_popcnt64(x)	__popcnt64(x)
+	#else
+		#define np2_popcnt64(x)	(__popcnt((uint32_t)(x)) + __popcnt((uint32_t)((x) >> 32)))
+	#endif
+#endif
+
+namespace np2 {
+
+namespace {
+
+// https://graphics.stanford.edu/~seander/bithacks.html#CountBitsSetParallel
+// used by scalar and SSE2 variants, POPCNT instruction is only assumed for AVX2.
+constexpr uint32_t bth_popcount64(uint64_t v) noexcept {
+	v = v - ((v >> 1) & UINT64_C(0x5555555555555555));
+	v = (v & UINT64_C(0x3333333333333333)) + ((v >> 2) & UINT64_C(0x3333333333333333));
+	return static_cast<uint32_t>((((v + (v >> 4)) & UINT64_C(0x0F0F0F0F0F0F0F0F)) * UINT64_C(0x0101010101010101)) >> 56);
+}
+
+inline uint64_t LoadU64(const void *ptr) noexcept {
+	uint64_t value;
+	memcpy(&value, ptr, sizeof(value));
+	return value;
+}
+
+//=============================================================================
+// line ending counting, each vector variant builds 64 bit CR and LF masks for 64 bytes.
+// '\r' and '\n' is not reused (e.g. as trailing byte in DBCS) by any known encoding,
+// it's safe to check whole data byte by byte.
+
+// Split CR and LF masks into CR+LF, CR alone and LF alone masks, returns whether last byte is CR.
+inline bool SplitLineEndingMask(uint64_t &maskCR, uint64_t &maskLF, uint64_t &maskCRLF) noexcept {
+	const bool lastCR = (maskCR >> 63) != 0;
+	// maskCR and maskLF never have some bit set, after shifting maskCR by 1 bit,
+	// the bits both set in maskCR and maskLF represents CR+LF;
+	// the bits only set in maskCR or maskLF represents individual CR or LF.
+	maskCR <<= 1;
+	maskCRLF = maskCR & maskLF;					// CR+LF
+	const uint64_t maskCR_LF = maskCR ^ maskLF;	// CR alone or LF alone
+	maskLF = maskCR_LF & maskLF;				// LF alone
+	maskCR = maskCR_LF ^ maskLF;				// CR alone (with one position offset)
+	return lastCR;
+}
+
+void CountLineEndings_Scalar(const char *data, size_t length, LineEndingCount &count) noexcept {
+	const uint8_t *ptr = reinterpret_cast<const uint8_t *>(data);
+	const uint8_t * const end = ptr + length;
+	constexpr uint32_t mask = ((1 << '\r') - 1) ^ (1 << '\n');
+	while (ptr < end) {
+		const uint8_t ch = *ptr++;
+		if (ch > '\r' || ((mask >> ch) & 1) != 0) {
+			continue;
+		}
+		if (ch == '\n') {
+			++count.LF;
+		} else if (ptr < end && *ptr == '\n') {
+			++ptr;
+			++count.CRLF;
+		} else {
+			++count.CR;
+		}
+	}
+}
+
+//=============================================================================
+// UTF-8 validation
+// Copyright (c) 2008-2010 Bjoern Hoehrmann <bjoern@hoehrmann.de>
+// See https://bjoern.hoehrmann.de/utf-8/decoder/dfa/ for details.
+
+enum {
+	UTF8_ACCEPT = 0,
+	UTF8_REJECT = 12,
+};
+
+constexpr uint8_t utf8_dfa[] = {
+	// The first part of the table maps bytes to character classes that
+	// to reduce the size of the transition table and create bitmasks.
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,  9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+	 7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,  7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+	 8,8,2,2,2,2,2,2,2,2,2,2,2,2,2,2,  2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+	10,3,3,3,3,3,3,3,3,3,3,3,3,4,3,3, 11,6,6,6,5,8,8,8,8,8,8,8,8,8,8,8,
+
+	// The second part is a transition table that maps a combination
+	// of a state of the automaton and a character class to a state.
+	 0,12,24,36,60,96,84,12,12,12,48,72, 12,12,12,12,12,12,12,12,12,12,12,12,
+	12, 0,12,12,12,12,12, 0,12, 0,12,12, 12,24,12,12,12,12,12,24,12,24,12,12,
+	12,12,12,12,12,12,12,24,12,12,12,12, 12,24,12,12,12,12,12,12,12,24,12,12,
+	12,12,12,12,12,12,12,36,12,36,12,12, 12,36,12,12,12,12,12,36,12,36,12,12,
+	12,36,12,12,12,12,12,12,12,12,12,12,
+};
+
+bool IsValidUTF8_Scalar(const char *data, size_t length) noexcept {
+	const uint8_t *pt = reinterpret_cast<const uint8_t *>(data);
+	const uint8_t * const end = pt + length;
+	uint32_t state = UTF8_ACCEPT;
+	while (pt + sizeof(uint64_t) <= end) {
+		const uint64_t val = LoadU64(pt);
+		if (val & UINT64_C(0x8080808080808080)) {
+			state = utf8_dfa[256 + state + utf8_dfa[val & 255]];
+			state = utf8_dfa[256 + state + utf8_dfa[(val >> 8) & 255]];
+			state = utf8_dfa[256 + state + utf8_dfa[(val >> 16) & 255]];
+			state = utf8_dfa[256 + state + utf8_dfa[(val >> 24) & 255]];
+			state = utf8_dfa[256 + state + utf8_dfa[(val >> 32) & 255]];
+			state = utf8_dfa[256 + state + utf8_dfa[(val >> 40) & 255]];
+			state = utf8_dfa[256 + state + utf8_dfa[(val >> 48) & 255]];
+			state = utf8_dfa[256 + state + utf8_dfa[val >> 56]];
+			if (state == UTF8_REJECT) {
+				return false;
+			}
+		} else if (state != UTF8_ACCEPT) {
+			return false;
+		}
+		pt += sizeof(uint64_t);
+	}
+
+	while (pt < end) {
+		state = utf8_dfa[256 + state + utf8_dfa[*pt++]];
+	}
+	return state == UTF8_ACCEPT;
+}
+
+bool AllASCII_Scalar(const char *data, size_t length) noexcept {
+	const char * const end = data + length;
+	for (; data + sizeof(uint64_t) <= end; data += sizeof(uint64_t)) {
+		if (LoadU64(data) & UINT64_C(0x8080808080808080)) {
+			return false;
+		}
+	}
+	for (; data < end; data++) {
+		if (*data & 0x80) {
+			return false;
+		}
+	}
+	return true;
+}
+
+const char *FindSubstring_Scalar(const char *data, size_t length, const char *pattern, size_t patternLength) noexcept {
+	if (patternLength > length) {
+		return nullptr;
+	}
+	const char * const last = data + length - patternLength;
+	const char first = *pattern;
+	while (data <= last) {
+		data = static_cast<const char *>(memchr(data, first, last - data + 1));
+		if (data == nullptr) {
+			break;
+		}
+		if (memcmp(data + 1, pattern + 1, patternLength - 1) == 0) {
+			return data;
+		}
+		++data;
+	}
+	return nullptr;
+}
+
+//=============================================================================
+// binary detection
+// C0 control characters are not reused in most text encodings, and do not appear in normal text files.
+// Most binary files have reserved fields (mostly zeros) or small values in the header.
+
+constexpr uint32_t MaxControlCharacterCount = 8;
+
+constexpr bool IsC0ControlChar(uint8_t ch) noexcept {
+	return ch < 32 && static_cast<uint8_t>(ch - 0x09) > (0x0d - 0x09);
+}
+
+// check control character mask for 64 bytes block, returns true for binary data.
+inline bool CheckControlMask(uint64_t mask, uint32_t maskCount, uint64_t &lastMask, uint32_t &count) noexcept {
+	const bool adjacent = (mask & ((mask << 1) | lastMask)) != 0;
+	lastMask = mask >> 63;
+	count += maskCount;
+	return adjacent || count >= MaxControlCharacterCount;
+}
+
+bool MaybeBinary_Scalar(const char *data, size_t length) noexcept {
+	const uint8_t *ptr = reinterpret_cast<const uint8_t *>(data);
+	const uint8_t * const end = ptr + length;
+	uint32_t count = 0;
+	while (ptr < end) {
+		if (IsC0ControlChar(*ptr++)) {
+			++count;
+			if (count >= MaxControlCharacterCount || (ptr < end && IsC0ControlChar(*ptr))) {
+				return true;
+			}
+			++ptr;
+		}
+	}
+	return false;
+}
+
+#if NP2_KERNEL_X86
+//=============================================================================
+// SSE2 variants
+
+void CountLineEndings_SSE2(const char *data, size_t length, LineEndingCount &count) noexcept {
+	const uint8_t *ptr = reinterpret_cast<const uint8_t *>(data);
+	const uint8_t * const end = ptr + length;
+	const __m128i vectCR = _mm_set1_epi8('\r');
+	const __m128i vectLF = _mm_set1_epi8('\n');
+	alignas(16) uint8_t buffer[4*sizeof(__m128i)];
+	while (ptr < end) {
+		const uint8_t *block = ptr;
+		if (ptr + 4*sizeof(__m128i) >= end) {
+			// zero padding last block, line starts at random position.
+			memset(buffer, 0, sizeof(buffer));
+			memcpy(buffer, ptr, end - ptr);
+			block = buffer;
+		}
+		const __m128i chunk1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block));
+		const __m128i chunk2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + sizeof(__m128i)));
+		const __m128i chunk3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + 2*sizeof(__m128i)));
+		const __m128i chunk4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + 3*sizeof(__m128i)));
+		ptr += 4*sizeof(__m128i);
+		uint64_t maskCR = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk1, vectCR)))
+			| (static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk2, vectCR))) << sizeof(__m128i));
+		uint64_t maskLF = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk1, vectLF)))
+			| (static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk2, vectLF))) << sizeof(__m128i));
+		maskCR |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk3, vectCR)))
+			| (static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk4, vectCR))) << sizeof(__m128i))) << 4*sizeof(uint64_t);
+		maskLF |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk3, vectLF)))
+			| (static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk4, vectLF))) << sizeof(__m128i))) << 4*sizeof(uint64_t);
+
+		if (maskCR) {
+			uint64_t maskCRLF;
+			if (SplitLineEndingMask(maskCR, maskLF, maskCRLF)) {
+				if (ptr < end && *ptr == '\n') {
+					// CR+LF across boundary
+					++ptr;
+					++count.CRLF;
+				} else {
+					++count.CR;
+				}
+			}
+			if (maskCRLF) {
+				count.CRLF += bth_popcount64(maskCRLF);
+			}
+			if (maskCR) {
+				count.CR += bth_popcount64(maskCR);
+			}
+		}
+		if (maskLF) {
+			count.LF += bth_popcount64(maskLF);
+		}
+	}
+}
+
+// UTF-8 validation with 2x16 bytes ASCII fast path, used when SSSE3 is not available.
+bool IsValidUTF8_SSE2(const char *data, size_t length) noexcept {
+	const uint8_t *pt = reinterpret_cast<const uint8_t *>(data);
+	const uint8_t * const end = pt + length;
+	uint32_t state = UTF8_ACCEPT;
+	while (pt + 2*sizeof(__m128i) <= end) {
+		const __m128i chunk1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pt));
+		const __m128i chunk2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pt + sizeof(__m128i)));
+		const uint32_t mask = _mm_movemask_epi8(chunk1)
+			| (static_cast<uint32_t>(_mm_movemask_epi8(chunk2)) << sizeof(__m128i));
+		if (mask) {
+			// skip leading ASCII
+			const uint8_t *temp = pt + ((state != UTF8_ACCEPT) ? 0 : np2_ctz32(mask));
+			const uint8_t * const endPtr = pt + 2*sizeof(__m128i);
+			do {
+				state = utf8_dfa[256 + state + utf8_dfa[*temp++]];
+			} while (temp < endPtr);
+			if (state == UTF8_REJECT) {
+				return false;
+			}
+		} else if (state != UTF8_ACCEPT) {
+			return false;
+		}
+		pt += 2*sizeof(__m128i);
+	}
+
+	while (pt < end) {
+		state = utf8_dfa[256 + state + utf8_dfa[*pt++]];
+	}
+	return state == UTF8_ACCEPT;
+}
+
+bool AllASCII_SSE2(const char *data, size_t length) noexcept {
+	const char * const end = data + length;
+	for (; data + 4*sizeof(__m128i) <= end; data += 4*sizeof(__m128i)) {
+		const __m128i chunk1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+		const __m128i chunk2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + sizeof(__m128i)));
+		const __m128i chunk3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 2*sizeof(__m128i)));
+		const __m128i chunk4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 3*sizeof(__m128i)));
+		if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(chunk1, chunk2), _mm_or_si128(chunk3, chunk4)))) {
+			return false;
+		}
+	}
+	for (; data + sizeof(__m128i) <= end; data += sizeof(__m128i)) {
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+		if (_mm_movemask_epi8(chunk)) {
+			return false;
+		}
+	}
+	return AllASCII_Scalar(data, end - data);
+}
+
+// http://0x80.pl/articles/simd-strfind.html
+// compare first and last byte of pattern for each position, then verify candidates.
+const char *FindSubstring_SSE2(const char *data, size_t length, const char *pattern, size_t patternLength) noexcept {
+	if (patternLength > length) {
+		return nullptr;
+	}
+	if (patternLength == 1) {
+		return static_cast<const char *>(memchr(data, *pattern, length));
+	}
+	const __m128i first = _mm_set1_epi8(pattern[0]);
+	const __m128i last = _mm_set1_epi8(pattern[patternLength - 1]);
+	size_t index = 0;
+	for (; index + patternLength - 1 + sizeof(__m128i) <= length; index += sizeof(__m128i)) {
+		const __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + index));
+		const __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + index + patternLength - 1));
+		uint32_t mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first, blockFirst), _mm_cmpeq_epi8(last, blockLast)));
+		while (mask) {
+			const char *candidate = data + index + np2_ctz32(mask);
+			if (memcmp(candidate + 1, pattern + 1, patternLength - 2) == 0) {
+				return candidate;
+			}
+			mask &= mask - 1;
+		}
+	}
+	return FindSubstring_Scalar(data + index, length - index, pattern, patternLength);
+}
+
+// mask for C0 control characters, (ch < 32) and not in [9, 13].
+inline uint32_t GetControlMask_SSE2(__m128i chunk) noexcept {
+	const __m128i below = _mm_cmpeq_epi8(_mm_min_epu8(chunk, _mm_set1_epi8(31)), chunk);
+	chunk = _mm_sub_epi8(chunk, _mm_set1_epi8(9));
+	const __m128i space = _mm_cmpeq_epi8(_mm_min_epu8(chunk, _mm_set1_epi8(4)), chunk);
+	return _mm_movemask_epi8(_mm_andnot_si128(space, below));
+}
+
+bool MaybeBinary_SSE2(const char *data, size_t length) noexcept {
+	const uint8_t *ptr = reinterpret_cast<const uint8_t *>(data);
+	const uint8_t * const end = ptr + length;
+	uint64_t lastMask = 0;
+	uint32_t count = 0;
+	alignas(16) uint8_t buffer[4*sizeof(__m128i)];
+	while (ptr < end) {
+		const uint8_t *block = ptr;
+		uint64_t validMask = UINT64_MAX;
+		if (ptr + 4*sizeof(__m128i) > end) {
+			memcpy(buffer, ptr, end - ptr);
+			block = buffer;
+			validMask = (UINT64_C(1) << (end - ptr)) - 1;
+		}
+		ptr += 4*sizeof(__m128i);
+		uint64_t mask = GetControlMask_SSE2(_mm_loadu_si128(reinterpret_cast<const __m128i *>(block)))
+			| (GetControlMask_SSE2(_mm_loadu_si128(reinterpret_cast<const __m128i *>(block + sizeof(__m128i)))) << sizeof(__m128i));
+		mask |= static_cast<uint64_t>(GetControlMask_SSE2(_mm_loadu_si128(reinterpret_cast<const __m128i *>(block + 2*sizeof(__m128i))))
+			| (GetControlMask_SSE2(_mm_loadu_si128(reinterpret_cast<const __m128i *>(block + 3*sizeof(__m128i)))) << sizeof(__m128i))) << 4*sizeof(uint64_t);
+		mask &= validMask;
+		if (CheckControlMask(mask, bth_popcount64(mask), lastMask, count)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+//=============================================================================
+// https://github.com/zwegner/faster-utf8-validator
+// faster-utf8-validator
+// Copyright (c) 2019 Zach Wegner
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// How this validator works:
+//
+//   [[[ UTF-8 refresher: UTF-8 encodes text in sequences of "code points",
+//   each one from 1-4 bytes. For each code point that is longer than one byte,
+//   the code point begins with a unique prefix that specifies how many bytes
+//   follow. All bytes in the code point after this first have a continuation
+//   marker. All code points in UTF-8 will thus look like one of the following
+//   binary sequences, with x meaning "don't care":
+//      1 byte:  0xxxxxxx
+//      2 bytes: 110xxxxx  10xxxxxx
+//      3 bytes: 1110xxxx  10xxxxxx  10xxxxxx
+//      4 bytes: 11110xxx  10xxxxxx  10xxxxxx  10xxxxxx
+//   ]]]
+//
+// This validator works in two basic steps: checking continuation bytes, and
+// handling special cases. Each step works on one vector's worth of input
+// bytes at a time.
+//
+// The continuation bytes are handled in a fairly straightforward manner in
+// the scalar domain. A mask is created from the input byte vector for each
+// of the highest four bits of every byte. The first mask allows us to quickly
+// skip pure ASCII input vectors, which have no bits set. The first and
+// (inverted) second masks together give us every continuation byte (10xxxxxx).
+// The other masks are used to find prefixes of multi-byte code points (110,
+// 1110, 11110). For these, we keep a "required continuation" mask, by shifting
+// these masks 1, 2, and 3 bits respectively forward in the byte stream. That
+// is, we take a mask of all bytes that start with 11, and shift it left one
+// bit forward to get the mask of all the first continuation bytes, then do the
+// same for the second and third continuation bytes. Here's an example input
+// sequence along with the corresponding masks:
+//
+//   bytes:        61 C3 80 62 E0 A0 80 63 F0 90 80 80 00
+//   code points:  61|C3 80|62|E0 A0 80|63|F0 90 80 80|00
+//   # of bytes:   1 |2  - |1 |3  -  - |1 |4  -  -  - |1
+//   cont. mask 1: -  -  1  -  -  1  -  -  -  1  -  -  -
+//   cont. mask 2: -  -  -  -  -  -  1  -  -  -  1  -  -
+//   cont. mask 3: -  -  -  -  -  -  -  -  -  -  -  1  -
+//   cont. mask *: 0  0  1  0  0  1  1  0  0  1  1  1  0
+//
+// The final required continuation mask is then compared with the mask of
+// actual continuation bytes, and must match exactly in valid UTF-8. The only
+// complication in this step is that the shifted masks can cross vector
+// boundaries, so we need to keep a "carry" mask of the bits that were shifted
+// past the boundary in the last loop iteration.
+//
+// Besides the basic prefix coding of UTF-8, there are several invalid byte
+// sequences that need special handling. These are due to three factors:
+// code points that could be described in fewer bytes, code points that are
+// part of a surrogate pair (which are only valid in UTF-16), and code points
+// that are past the highest valid code point U+10FFFF.
+//
+// All of the invalid sequences can be detected by independently observing
+// the first three nibbles of each code point. Since AVX2 can do a 4-bit/16-byte
+// lookup in parallel for all 32 bytes in a vector, we can create bit masks
+// for all of these error conditions, look up the bit masks for the three
+// nibbles for all input bytes, and AND them together to get a final error mask,
+// that must be all zero for valid UTF-8. This is somewhat complicated by
+// needing to shift the error masks from the first and second nibbles forward in
+// the byte stream to line up with the third nibble.
+//
+// We have these possible values for valid UTF-8 sequences, broken down
+// by the first three nibbles:
+//
+//   1st   2nd   3rd   comment
+//   0..7  0..F        ASCII
+//   8..B  0..F        continuation bytes
+//   C     2..F  8..B  C0 xx and C1 xx can be encoded in 1 byte
+//   D     0..F  8..B  D0..DF are valid with a continuation byte
+//   E     0     A..B  E0 8x and E0 9x can be encoded with 2 bytes
+//         1..C  8..B  E1..EC are valid with continuation bytes
+//         D     8..9  ED Ax and ED Bx correspond to surrogate pairs
+//         E..F  8..B  EE..EF are valid with continuation bytes
+//   F     0     9..B  F0 8x can be encoded with 3 bytes
+//         1..3  8..B  F1..F3 are valid with continuation bytes
+//         4     8     F4 8F BF BF is the maximum valid code point
+//
+// That leaves us with these invalid sequences, which would otherwise fit
+// into UTF-8's prefix encoding. Each of these invalid sequences needs to
+// be detected separately, with their own bits in the error mask.
+//
+//   1st   2nd   3rd   error bit
+//   C     0..1  0..F  0x01
+//   E     0     8..9  0x02
+//         D     A..B  0x04
+//   F     0     0..8  0x08
+//         4     9..F  0x10
+//         5..F  0..F  0x20
+//
+// For every possible value of the first, second, and third nibbles, we keep
+// a lookup table that contains the bitwise OR of all errors that that nibble
+// value can cause. For example, the first nibble has zeroes in every entry
+// except for C, E, and F, and the third nibble lookup has the 0x21 bits in
+// every entry, since those errors don't depend on the third nibble. After
+// doing a parallel lookup of the first/second/third nibble values for all
+// bytes, we AND them together. Only when all three have an error bit in common
+// do we fail validation.
+
+NP2_TARGET_SSSE3 NP2_ALWAYS_INLINE
+bool z_validate_vec_ssse3(__m128i bytes, __m128i shifted_bytes, uint32_t *last_cont) noexcept {
+	// Error lookup tables for the first, second, and third nibbles
+	const __m128i error_1 = _mm_setr_epi8(
+		0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00,
+		0x01, 0x00, 0x06, 0x38
+	);
+	const __m128i error_2 = _mm_setr_epi8(
+		0x0B, 0x01, 0x00, 0x00,
+		0x10, 0x20, 0x20, 0x20,
+		0x20, 0x20, 0x20, 0x20,
+		0x20, 0x24, 0x20, 0x20
+	);
+	const __m128i error_3 = _mm_setr_epi8(
+		0x29, 0x29, 0x29, 0x29,
+		0x29, 0x29, 0x29, 0x29,
+		0x2B, 0x33, 0x35, 0x35,
+		0x31, 0x31, 0x31, 0x31
+	);
+
+	// Quick skip for ascii-only input. If there are no bytes with the high bit
+	// set, we don't need to do any more work. We return either valid or
+	// invalid based on whether we expected any continuation bytes here.
+	const uint32_t high = _mm_movemask_epi8(bytes);
+	if (!high) {
+		return *last_cont == 0;
+	}
+
+	// Which bytes are required to be continuation bytes
+	uint32_t req = *last_cont;
+
+	// Compute the continuation byte mask by finding bytes that start with
+	// 11x, 111x, and 1111. For each of these prefixes, we get a bitmask
+	// and shift it forward by 1, 2, or 3.
+	uint32_t set = high;
+	set &= _mm_movemask_epi8(_mm_slli_epi16(bytes, 1));
+	// A bitmask of the actual continuation bytes in the input
+	// Mark continuation bytes: those that have the high bit set but
+	// not the next one
+	const uint32_t cont = high ^ set;
+	// We add the shifted mask here instead of ORing it, see comment
+	// in z_validate_vec_avx2() for why this is safe.
+	req += set << 1;
+	set &= _mm_movemask_epi8(_mm_slli_epi16(bytes, 2));
+	req += set << 2;
+	set &= _mm_movemask_epi8(_mm_slli_epi16(bytes, 3));
+	req += set << 3;
+
+	// Check that continuation bytes match. We must cast req from uint32_t
+	// (which holds the carry mask in the upper half) to uint16_t, which
+	// zeroes out the upper bits
+	if (cont != static_cast<uint16_t>(req)) {
+		return false;
+	}
+
+	// Look up error masks for three consecutive nibbles.
+	const __m128i nibbles = _mm_set1_epi8(0x0F);
+	const __m128i e_1 = _mm_shuffle_epi8(error_1, _mm_and_si128(_mm_srli_epi16(shifted_bytes, 4), nibbles));
+	const __m128i e_2 = _mm_shuffle_epi8(error_2, _mm_and_si128(shifted_bytes, nibbles));
+	__m128i e_3 = _mm_shuffle_epi8(error_3, _mm_and_si128(_mm_srli_epi16(bytes, 4), nibbles));
+
+	// Check if any bits are set in all three error masks
+	e_3 = _mm_and_si128(_mm_and_si128(e_1, e_2), e_3);
+	const int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(e_3, _mm_setzero_si128()));
+	if (mask != 0xFFFF) {
+		return false;
+	}
+
+	// Save continuation bits and input bytes for the next round
+	*last_cont = req >> sizeof(__m128i);
+	return true;
+}
+
+NP2_TARGET_SSSE3
+bool IsValidUTF8_SSSE3(const char *data, size_t len) noexcept {
+	// Keep continuation bits from the previous iteration that carry over to
+	// each input chunk vector
+	uint32_t last_cont = 0;
+
+	size_t offset = 0;
+	// Deal with the input up until the last section of bytes
+	if (len >= sizeof(__m128i)) {
+		// We need a vector of the input byte stream shifted forward one byte.
+		// Since we don't want to read the memory before the data pointer
+		// (which might not even be mapped), for the first chunk of input just
+		// use vector instructions.
+		__m128i shifted_bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+		shifted_bytes = _mm_slli_si128(shifted_bytes, 1);
+
+		// Loop over input in sizeof(__m128i)-byte chunks, as long as we can safely read
+		// that far into memory
+		for (; offset + sizeof(__m128i) < len; offset += sizeof(__m128i)) {
+			if (offset != 0) {
+				// loaded here instead of at loop end to not read past the data
+				shifted_bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + offset - 1));
+			}
+			const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + offset));
+			if (!z_validate_vec_ssse3(bytes, shifted_bytes, &last_cont)) {
+				return false;
+			}
+		}
+	}
+
+	// Deal with any bytes remaining. Rather than making a separate scalar path,
+	// just fill in a buffer, reading bytes only up to len, and load from that.
+	if (offset < len) {
+		uint8_t buffer[sizeof(__m128i) + 1]{};
+		if (offset != 0) {
+			buffer[0] = data[offset - 1];
+		}
+		memcpy(buffer + 1, data + offset, len - offset);
+
+		const __m128i shifted_bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buffer));
+		const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(buffer + 1));
+		if (!z_validate_vec_ssse3(bytes, shifted_bytes, &last_cont)) {
+			return false;
+		}
+	}
+
+	// The input is valid if we don't have any more expected continuation bytes
+	return last_cont == 0;
+}
+
+//=============================================================================
+// AVX2 variants
+
+NP2_TARGET_AVX2 NP2_ALWAYS_INLINE
+bool z_validate_vec_avx2(__m256i bytes, __m256i shifted_bytes, uint32_t *last_cont) noexcept {
+	// Error lookup tables for the first, second, and third nibbles
+	// Simple macro to make a vector lookup table for use with vpshufb. Since
+	// AVX2 is two 16-byte halves, we duplicate the input values.
+#define V_TABLE_16(...)		_mm256_setr_epi8(__VA_ARGS__, __VA_ARGS__)
+	const __m256i error_1 = V_TABLE_16(
+		0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00,
+		0x01, 0x00, 0x06, 0x38
+	);
+	const __m256i error_2 = V_TABLE_16(
+		0x0B, 0x01, 0x00, 0x00,
+		0x10, 0x20, 0x20, 0x20,
+		0x20, 0x20, 0x20, 0x20,
+		0x20, 0x24, 0x20, 0x20
+	);
+	const __m256i error_3 = V_TABLE_16(
+		0x29, 0x29, 0x29, 0x29,
+		0x29, 0x29, 0x29, 0x29,
+		0x2B, 0x33, 0x35, 0x35,
+		0x31, 0x31, 0x31, 0x31
+	);
+#undef V_TABLE_16
+
+	// Quick skip for ascii-only input. If there are no bytes with the high bit
+	// set, we don't need to do any more work. We return either valid or
+	// invalid based on whether we expected any continuation bytes here.
+	const uint32_t high = _mm256_movemask_epi8(bytes);
+	if (!high) {
+		return *last_cont == 0;
+	}
+
+	// Which bytes are required to be continuation bytes
+	uint64_t req = *last_cont;
+
+	// Compute the continuation byte mask by finding bytes that start with
+	// 11x, 111x, and 1111. For each of these prefixes, we get a bitmask
+	// and shift it forward by 1, 2, or 3. This loop should be unrolled by
+	// the compiler, and the (n == 1) branch inside eliminated.
+	uint32_t set = high;
+	set &= _mm256_movemask_epi8(_mm256_slli_epi16(bytes, 1));
+	// A bitmask of the actual continuation bytes in the input
+	// Mark continuation bytes: those that have the high bit set but
+	// not the next one
+	const uint32_t cont = high ^ set;
+
+	// We add the shifted mask here instead of ORing it, which would
+	// be the more natural operation, so that this line can be done
+	// with one lea. While adding could give a different result due
+	// to carries, this will only happen for invalid UTF-8 sequences,
+	// and in a way that won't cause it to pass validation. Reasoning:
+	// Any bits for required continuation bytes come after the bits
+	// for their leader bytes, and are all contiguous. For a carry to
+	// happen, two of these bit sequences would have to overlap. If
+	// this is the case, there is a leader byte before the second set
+	// of required continuation bytes (and thus before the bit that
+	// will be cleared by a carry). This leader byte will not be
+	// in the continuation mask, despite being required. QEDish.
+	req += static_cast<uint64_t>(set) << 1;
+	set &= _mm256_movemask_epi8(_mm256_slli_epi16(bytes, 2));
+	req += static_cast<uint64_t>(set) << 2;
+	set &= _mm256_movemask_epi8(_mm256_slli_epi16(bytes, 3));
+	req += static_cast<uint64_t>(set) << 3;
+
+	// Check that continuation bytes match. We must cast req from uint64_t
+	// (which holds the carry mask in the upper half) to uint32_t, which
+	// zeroes out the upper bits
+	if (cont != static_cast<uint32_t>(req)) {
+		return false;
+	}
+
+	// Look up error masks for three consecutive nibbles.
+	const __m256i nibbles = _mm256_set1_epi8(0x0F);
+	const __m256i e_1 = _mm256_shuffle_epi8(error_1, _mm256_and_si256(_mm256_srli_epi16(shifted_bytes, 4), nibbles));
+	const __m256i e_2 = _mm256_shuffle_epi8(error_2, _mm256_and_si256(shifted_bytes, nibbles));
+	const __m256i e_3 = _mm256_shuffle_epi8(error_3, _mm256_and_si256(_mm256_srli_epi16(bytes, 4), nibbles));
+
+	// Check if any bits are set in all three error masks
+	if (!_mm256_testz_si256(_mm256_and_si256(e_1, e_2), e_3)) {
+		return false;
+	}
+
+	// Save continuation bits and input bytes for the next round
+	*last_cont = static_cast<uint32_t>(req >> sizeof(__m256i));
+	return true;
+}
+
+NP2_TARGET_AVX2
+bool IsValidUTF8_AVX2(const char *data, size_t len) noexcept {
+	// Keep continuation bits from the previous iteration that carry over to
+	// each input chunk vector
+	uint32_t last_cont = 0;
+
+	size_t offset = 0;
+	// Deal with the input up until the last section of bytes
+	if (len >= sizeof(__m256i)) {
+		// We need a vector of the input byte stream shifted forward one byte.
+		// Since we don't want to read the memory before the data pointer
+		// (which might not even be mapped), for the first chunk of input just
+		// use vector instructions.
+		__m256i shifted_bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+		shifted_bytes = _mm256_slli_si256(shifted_bytes, 1);
+
+		// Loop over input in sizeof(__m256i)-byte chunks, as long as we can safely read
+		// that far into memory
+		for (; offset + sizeof(__m256i) < len; offset += sizeof(__m256i)) {
+			if (offset != 0) {
+				// loaded here instead of at loop end to not read past the data
+				shifted_bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + offset - 1));
+			}
+			const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + offset));
+			if (!z_validate_vec_avx2(bytes, shifted_bytes, &last_cont)) {
+				return false;
+			}
+		}
+	}
+
+	// Deal with any bytes remaining. Rather than making a separate scalar path,
+	// just fill in a buffer, reading bytes only up to len, and load from that.
+	if (offset < len) {
+		uint8_t buffer[sizeof(__m256i) + 1]{};
+		if (offset != 0) {
+			buffer[0] = data[offset - 1];
+		}
+		memcpy(buffer + 1, data + offset, len - offset);
+
+		const __m256i shifted_bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(buffer));
+		const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(buffer + 1));
+		if (!z_validate_vec_avx2(bytes, shifted_bytes, &last_cont)) {
+			return false;
+		}
+	}
+
+	// The input is valid if we don't have any more expected continuation bytes
+	return last_cont == 0;
+}
+
+NP2_TARGET_AVX2
+void CountLineEndings_AVX2(const char *data, size_t length, LineEndingCount &count) noexcept {
+	const uint8_t *ptr = reinterpret_cast<const uint8_t *>(data);
+	const uint8_t * const end = ptr + length;
+	const __m256i vectCR = _mm256_set1_epi8('\r');
+	const __m256i vectLF = _mm256_set1_epi8('\n');
+	alignas(32) uint8_t buffer[2*sizeof(__m256i)];
+	while (ptr < end) {
+		const uint8_t *block = ptr;
+		if (ptr + 2*sizeof(__m256i) >= end) {
+			// zero padding last block, line starts at random position.
+			memset(buffer, 0, sizeof(buffer));
+			memcpy(buffer, ptr, end - ptr);
+			block = buffer;
+		}
+		const __m256i chunk1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block));
+		const __m256i chunk2 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(block + sizeof(__m256i)));
+		ptr += 2*sizeof(__m256i);
+		uint64_t maskCR = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk1, vectCR)));
+		uint64_t maskLF = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk1, vectLF)));
+		maskCR |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk2, vectCR)))) << sizeof(__m256i);
+		maskLF |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk2, vectLF)))) << sizeof(__m256i);
+
+		if (maskCR) {
+			uint64_t maskCRLF;
+			if (SplitLineEndingMask(maskCR, maskLF, maskCRLF)) {
+				if (ptr < end && *ptr == '\n') {
+					// CR+LF across boundary
+					++ptr;
+					++count.CRLF;
+				} else {
+					++count.CR;
+				}
+			}
+			if (maskCRLF) {
+				count.CRLF += np2_popcnt64(maskCRLF);
+			}
+			if (maskCR) {
+				count.CR += np2_popcnt64(maskCR);
+			}
+		}
+		if (maskLF) {
+			count.LF += np2_popcnt64(maskLF);
+		}
+	}
+}
+
+NP2_TARGET_AVX2
+bool AllASCII_AVX2(const char *data, size_t length) noexcept {
+	const char * const end = data + length;
+	for (; data + 2*sizeof(__m256i) <= end; data += 2*sizeof(__m256i)) {
+		const __m256i chunk1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+		const __m256i chunk2 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + sizeof(__m256i)));
+		if (_mm256_movemask_epi8(_mm256_or_si256(chunk1, chunk2))) {
+			return false;
+		}
+	}
+	if (data + sizeof(__m256i) <= end) {
+		const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+		if (_mm256_movemask_epi8(chunk)) {
+			return false;
+		}
+		data += sizeof(__m256i);
+	}
+	if (const uint32_t remain = static_cast<uint32_t>(end - data)) {
+		alignas(32) char buffer[sizeof(__m256i)]{};
+		memcpy(buffer, data, remain);
+		const __m256i chunk = _mm256_load_si256(reinterpret_cast<const __m256i *>(buffer));
+		if (_mm256_movemask_epi8(chunk)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+NP2_TARGET_AVX2
+const char *FindSubstring_AVX2(const char *data, size_t length, const char *pattern, size_t patternLength) noexcept {
+	if (patternLength > length) {
+		return nullptr;
+	}
+	if (patternLength == 1) {
+		return static_cast<const char *>(memchr(data, *pattern, length));
+	}
+	const __m256i first = _mm256_set1_epi8(pattern[0]);
+	const __m256i last = _mm256_set1_epi8(pattern[patternLength - 1]);
+	size_t index = 0;
+	for (; index + patternLength - 1 + sizeof(__m256i) <= length; index += sizeof(__m256i)) {
+		const __m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + index));
+		const __m256i blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + index + patternLength - 1));
+		uint32_t mask = _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(first, blockFirst), _mm256_cmpeq_epi8(last, blockLast)));
+		while (mask) {
+			const char *candidate = data + index + np2_ctz32(mask);
+			if (memcmp(candidate + 1, pattern + 1, patternLength - 2) == 0) {
+				return candidate;
+			}
+			mask = _blsr_u32(mask);
+		}
+	}
+	return FindSubstring_SSE2(data + index, length - index, pattern, patternLength);
+}
+
+NP2_TARGET_AVX2 NP2_ALWAYS_INLINE
+uint32_t GetControlMask_AVX2(__m256i chunk) noexcept {
+	const __m256i below = _mm256_cmpeq_epi8(_mm256_min_epu8(chunk, _mm256_set1_epi8(31)), chunk);
+	chunk = _mm256_sub_epi8(chunk, _mm256_set1_epi8(9));
+	const __m256i space = _mm256_cmpeq_epi8(_mm256_min_epu8(chunk, _mm256_set1_epi8(4)), chunk);
+	return _mm256_movemask_epi8(_mm256_andnot_si256(space, below));
+}
+
+NP2_TARGET_AVX2
+bool MaybeBinary_AVX2(const char *data, size_t length) noexcept {
+	const uint8_t *ptr = reinterpret_cast<const uint8_t *>(data);
+	const uint8_t * const end = ptr + length;
+	uint64_t lastMask = 0;
+	uint32_t count = 0;
+	alignas(32) uint8_t buffer[2*sizeof(__m256i)];
+	while (ptr < end) {
+		const uint8_t *block = ptr;
+		uint64_t validMask = UINT64_MAX;
+		if (ptr + 2*sizeof(__m256i) > end) {
+			memcpy(buffer, ptr, end - ptr);
+			block = buffer;
+			validMask = _bzhi_u64(validMask, static_cast<uint32_t>(end - ptr));
+		}
+		ptr += 2*sizeof(__m256i);
+		uint64_t mask = GetControlMask_AVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(block)));
+		mask |= static_cast<uint64_t>(GetControlMask_AVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(block + sizeof(__m256i))))) << sizeof(__m256i);
+		mask &= validMask;
+		if (CheckControlMask(mask, static_cast<uint32_t>(np2_popcnt64(mask)), lastMask, count)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+#if NP2_KERNEL_AVX512
+//=============================================================================
+// AVX-512BW variants, compare into 64 bit k-mask, tail is read with masked load
+// instead of copying into zeroed buffer.
+
+NP2_TARGET_AVX512 NP2_ALWAYS_INLINE
+__mmask64 GetLoadMask_AVX512(size_t remain) noexcept {
+	return (remain >= sizeof(__m512i)) ? UINT64_MAX : _bzhi_u64(UINT64_MAX, static_cast<uint32_t>(remain));
+}
+
+NP2_TARGET_AVX512
+void CountLineEndings_AVX512(const char *data, size_t length, LineEndingCount &count) noexcept {
+	const char *ptr = data;
+	const char * const end = ptr + length;
+	const __m512i vectCR = _mm512_set1_epi8('\r');
+	const __m512i vectLF = _mm512_set1_epi8('\n');
+	while (ptr < end) {
+		const __m512i chunk = _mm512_maskz_loadu_epi8(GetLoadMask_AVX512(end - ptr), ptr);
+		ptr += sizeof(__m512i);
+		uint64_t maskCR = _mm512_cmpeq_epi8_mask(chunk, vectCR);
+		uint64_t maskLF = _mm512_cmpeq_epi8_mask(chunk, vectLF);
+
+		if (maskCR) {
+			uint64_t maskCRLF;
+			if (SplitLineEndingMask(maskCR, maskLF, maskCRLF)) {
+				if (ptr < end && *ptr == '\n') {
+					// CR+LF across boundary
+					++ptr;
+					++count.CRLF;
+				} else {
+					++count.CR;
+				}
+			}
+			if (maskCRLF) {
+				count.CRLF += np2_popcnt64(maskCRLF);
+			}
+			if (maskCR) {
+				count.CR += np2_popcnt64(maskCR);
+			}
+		}
+		if (maskLF) {
+			count.LF += np2_popcnt64(maskLF);
+		}
+	}
+}
+
+// same algorithm as z_validate_vec_avx2(), required continuation bits are ORed
+// instead of added, as the 67 bit sum no longer fits into uint64_t.
+NP2_TARGET_AVX512 NP2_ALWAYS_INLINE
+bool z_validate_vec_avx512(__m512i bytes, __m512i shifted_bytes, uint64_t *last_cont) noexcept {
+	// same lookup tables as z_validate_vec_avx2(), repeated for each 128-bit lane
+	// and packed as little endian 32 bit integers.
+	const __m512i error_1 = _mm512_set4_epi32(0x38060001, 0x00000000, 0x00000000, 0x00000000);
+	const __m512i error_2 = _mm512_set4_epi32(0x20202420, 0x20202020, 0x20202010, 0x0000010B);
+	const __m512i error_3 = _mm512_set4_epi32(0x31313131, 0x3535332B, 0x29292929, 0x29292929);
+
+	const uint64_t high = _mm512_movepi8_mask(bytes);
+	if (!high) {
+		return *last_cont == 0;
+	}
+
+	const uint64_t set1 = high & _mm512_movepi8_mask(_mm512_slli_epi16(bytes, 1));
+	const uint64_t set2 = set1 & _mm512_movepi8_mask(_mm512_slli_epi16(bytes, 2));
+	const uint64_t set3 = set2 & _mm512_movepi8_mask(_mm512_slli_epi16(bytes, 3));
+	const uint64_t cont = high ^ set1;
+	const uint64_t req = *last_cont | (set1 << 1) | (set2 << 2) | (set3 << 3);
+	if (cont != req) {
+		return false;
+	}
+
+	const __m512i nibbles = _mm512_set1_epi8(0x0F);
+	const __m512i e_1 = _mm512_shuffle_epi8(error_1, _mm512_and_si512(_mm512_srli_epi16(shifted_bytes, 4), nibbles));
+	const __m512i e_2 = _mm512_shuffle_epi8(error_2, _mm512_and_si512(shifted_bytes, nibbles));
+	const __m512i e_3 = _mm512_shuffle_epi8(error_3, _mm512_and_si512(_mm512_srli_epi16(bytes, 4), nibbles));
+	if (_mm512_test_epi8_mask(_mm512_and_si512(e_1, e_2), e_3)) {
+		return false;
+	}
+
+	*last_cont = (set1 >> 63) | (set2 >> 62) | (set3 >> 61);
+	return true;
+}
+
+NP2_TARGET_AVX512
+bool IsValidUTF8_AVX512(const char *data, size_t len) noexcept {
+	if (len == 0) {
+		return true;
+	}
+	uint64_t last_cont = 0;
+	// first block, shifted bytes starts with zero.
+	alignas(64) char buffer[sizeof(__m512i)]{};
+	memcpy(buffer + 1, data, (len < sizeof(__m512i)) ? len : sizeof(__m512i) - 1);
+	__m512i shifted_bytes = _mm512_load_si512(buffer);
+	size_t offset = 0;
+	while (offset < len) {
+		const __mmask64 mask = GetLoadMask_AVX512(len - offset);
+		if (offset != 0) {
+			shifted_bytes = _mm512_maskz_loadu_epi8(mask, data + offset - 1);
+		}
+		const __m512i bytes = _mm512_maskz_loadu_epi8(mask, data + offset);
+		if (!z_validate_vec_avx512(bytes, shifted_bytes, &last_cont)) {
+			return false;
+		}
+		offset += sizeof(__m512i);
+	}
+	return last_cont == 0;
+}
+
+NP2_TARGET_AVX512
+bool AllASCII_AVX512(const char *data, size_t length) noexcept {
+	const char * const end = data + length;
+	for (; data + 2*sizeof(__m512i) <= end; data += 2*sizeof(__m512i)) {
+		const __m512i chunk1 = _mm512_loadu_si512(data);
+		const __m512i chunk2 = _mm512_loadu_si512(data + sizeof(__m512i));
+		if (_mm512_movepi8_mask(_mm512_or_si512(chunk1, chunk2))) {
+			return false;
+		}
+	}
+	for (; data < end; data += sizeof(__m512i)) {
+		const __m512i chunk = _mm512_maskz_loadu_epi8(GetLoadMask_AVX512(end - data), data);
+		if (_mm512_movepi8_mask(chunk)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+NP2_TARGET_AVX512
+bool MaybeBinary_AVX512(const char *data, size_t length) noexcept {
+	const char * const end = data + length;
+	const __m512i space = _mm512_set1_epi8(' ');
+	const __m512i tab = _mm512_set1_epi8('\t');
+	const __m512i whitespace = _mm512_set1_epi8(0x0d - 0x09 + 1);
+	uint64_t lastMask = 0;
+	uint32_t count = 0;
+	while (data < end) {
+		const __mmask64 valid = GetLoadMask_AVX512(end - data);
+		const __m512i chunk = _mm512_maskz_loadu_epi8(valid, data);
+		data += sizeof(__m512i);
+		__mmask64 mask = _mm512_mask_cmplt_epu8_mask(valid, chunk, space);
+		mask &= ~_mm512_cmplt_epu8_mask(_mm512_sub_epi8(chunk, tab), whitespace);
+		if (CheckControlMask(mask, static_cast<uint32_t>(np2_popcnt64(mask)), lastMask, count)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+NP2_TARGET_AVX512
+const char *FindSubstring_AVX512(const char *data, size_t length, const char *pattern, size_t patternLength) noexcept {
+	if (patternLength > length) {
+		return nullptr;
+	}
+	if (patternLength == 1) {
+		return static_cast<const char *>(memchr(data, *pattern, length));
+	}
+	const __m512i first = _mm512_set1_epi8(pattern[0]);
+	const __m512i last = _mm512_set1_epi8(pattern[patternLength - 1]);
+	size_t index = 0;
+	for (; index + patternLength - 1 + sizeof(__m512i) <= length; index += sizeof(__m512i)) {
+		const __m512i blockFirst = _mm512_loadu_si512(data + index);
+		const __m512i blockLast = _mm512_loadu_si512(data + index + patternLength - 1);
+		uint64_t mask = _mm512_mask_cmpeq_epi8_mask(_mm512_cmpeq_epi8_mask(first, blockFirst), last, blockLast);
+		while (mask) {
+			const char *candidate = data + index + np2_ctz64(mask);
+			if (memcmp(candidate + 1, pattern + 1, patternLength - 2) == 0) {
+				return candidate;
+			}
+			mask = _blsr_u64(mask);
+		}
+	}
+	return FindSubstring_AVX2(data + index, length - index, pattern, patternLength);
+}
+#endif // NP2_KERNEL_AVX512
+
+//=============================================================================
+// CPU detection
+
+struct CPUInfo {
+	uint32_t eax;
+	uint32_t ebx;
+	uint32_t ecx;
+	uint32_t edx;
+};
+
+inline CPUInfo GetCPUInfo(uint32_t leaf, uint32_t subleaf = 0) noexcept {
+	CPUInfo info;
+#if defined(_MSC_VER) && !defined(__clang__)
+	int regs[4];
+	__cpuidex(regs, leaf, subleaf);
+	info = {static_cast<uint32_t>(regs[0]), static_cast<uint32_t>(regs[1]), static_cast<uint32_t>(regs[2]), static_cast<uint32_t>(regs[3])};
+#else
+	__cpuid_count(leaf, subleaf, info.eax, info.ebx, info.ecx, info.edx);
+#endif
+	return info;
+}
+
+// XCR0, register state enabled by operating system
+inline uint64_t GetXCR0() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+	return _xgetbv(0);
+#else
+	uint32_t eax;
+	uint32_t edx;
+	__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+	return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+}
+
+bool cpuHasSSSE3 = false;
+
+ISALevel DetectISALevelImpl() noexcept {
+	const uint32_t maxLeaf = GetCPUInfo(0).eax;
+	const CPUInfo info1 = GetCPUInfo(1);
+	cpuHasSSSE3 = (info1.ecx >> 9) & 1;
+	constexpr uint32_t popcntOSXSaveAVX = (1U << 23) | (1U << 27) | (1U << 28);
+	if (maxLeaf < 7 || (info1.ecx & popcntOSXSaveAVX) != popcntOSXSaveAVX) {
+		return ISALevel::SSE2;
+	}
+	const uint64_t xcr0 = GetXCR0();
+	constexpr uint64_t stateAVX = 0x06;		// XMM and YMM
+	constexpr uint64_t stateAVX512 = 0xE6;	// and opmask, ZMM_Hi256, Hi16_ZMM
+	const CPUInfo info7 = GetCPUInfo(7);
+	constexpr uint32_t bmi1AVX2BMI2 = (1U << 3) | (1U << 5) | (1U << 8);
+	if ((xcr0 & stateAVX) != stateAVX || (info7.ebx & bmi1AVX2BMI2) != bmi1AVX2BMI2) {
+		return ISALevel::SSE2;
+	}
+	constexpr uint32_t avx512FBW = (1U << 16) | (1U << 30);
+	if (!NP2_KERNEL_AVX512 || (xcr0 & stateAVX512) != stateAVX512 || (info7.ebx & avx512FBW) != avx512FBW) {
+		return ISALevel::AVX2;
+	}
+	return ISALevel::AVX512BW;
+}
+
+#else
+constexpr bool cpuHasSSSE3 = false;
+
+constexpr ISALevel DetectISALevelImpl() noexcept {
+	return ISALevel::Scalar;
+}
+#endif // NP2_KERNEL_X86
+
+const ISALevel cpuISALevel = DetectISALevelImpl();
+
+VectorKernels ResolveVectorKernels(ISALevel level) noexcept {
+	switch (level) {
+#if NP2_KERNEL_AVX512
+	case ISALevel::AVX512BW:
+		return {level, CountLineEndings_AVX512, IsValidUTF8_AVX512, AllASCII_AVX512, MaybeBinary_AVX512, FindSubstring_AVX512};
+#endif
+#if NP2_KERNEL_X86
+	case ISALevel::AVX2:
+		return {level, CountLineEndings_AVX2, IsValidUTF8_AVX2, AllASCII_AVX2, MaybeBinary_AVX2, FindSubstring_AVX2};
+	case ISALevel::SSE2:
+		return {level, CountLineEndings_SSE2, cpuHasSSSE3 ? IsValidUTF8_SSSE3 : IsValidUTF8_SSE2, AllASCII_SSE2, MaybeBinary_SSE2, FindSubstring_SSE2};
+#endif
+	default:
+		return {ISALevel::Scalar, CountLineEndings_Scalar, IsValidUTF8_Scalar, AllASCII_Scalar, MaybeBinary_Scalar, FindSubstring_Scalar};
+	}
+}
+
+}
+
+VectorKernels vectorKernels = ResolveVectorKernels(cpuISALevel);
+
+ISALevel DetectISALevel() noexcept {
+	return cpuISALevel;
+}
+
+const char *GetISALevelName(ISALevel level) noexcept {
+	switch (level) {
+	case ISALevel::SSE2:
+		return "SSE2";
+	case ISALevel::AVX2:
+		return "AVX2";
+	case ISALevel::AVX512BW:
+		return "AVX-512BW";
+	default:
+		return "Scalar";
+	}
+}
+
+ISALevel SelectVectorKernels(ISALevel level) noexcept {
+	if (level > cpuISALevel) {
+		level = cpuISALevel;
+	}
+	vectorKernels = ResolveVectorKernels(level);
+	return vectorKernels.level;
+}
+
+}
@@ -0,0 +1,273 @@
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+// Test and benchmark for case-insensitive search on UTF-8 text, compares folding
+// character by character (old Document::FindText()) with CaseFolderUnicode::FoldText()
+// plus SIMD substring search (Document::FindFoldedText()).
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cassert>
+#include <chrono>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+
+#include "VectorISA.h"
+#include "VectorKernels.h"
+#include "CaseFolder.h"
+#include "CaseConvert.h"
+#include "UniConversion.h"
+
+// g++ -std=gnu++20 -DNDEBUG -O2 -Wall -Wextra -I../include -I../src CaseFolderTest.cpp ../src/CaseFolder.cxx ../src/CaseConvert.cxx ../src/UniConversion.cxx ../src/VectorKernels.cxx
+// cl /EHsc /std:c++20 /DNDEBUG /O2 /W4 /I../include /I../src CaseFolderTest.cpp ../src/CaseFolder.cxx ../src/CaseConvert.cxx ../src/UniConversion.cxx ../src/VectorKernels.cxx
+
+using namespace Scintilla::Internal;
+
+namespace {
+
+struct Match {
+	ptrdiff_t pos;
+	ptrdiff_t length;
+	bool operator==(const Match &other) const noexcept {
+		return pos == other.pos && length == other.length;
+	}
+};
+
+// same as UTF-8 branch of Document::FindText() for forward search without word options.
+Match FindCharacterByCharacter(CaseFolder &folder, std::string_view text, ptrdiff_t pos, std::string_view search) {
+	constexpr size_t maxFoldingExpansion = 4;
+	std::vector<char> searchThing((search.length() + 1) * UTF8MaxBytes * maxFoldingExpansion + 1);
+	const size_t lenSearch = folder.Fold(searchThing.data(), searchThing.size(), search.data(), search.length());
+	const unsigned char * const searchData = reinterpret_cast<const unsigned char *>(searchThing.data());
+	const ptrdiff_t endPos = text.length();
+	while (pos < endPos) {
+		int widthFirstCharacter = 1;
+		ptrdiff_t posIndexDocument = pos;
+		size_t indexSearch = 0;
+		bool characterMatches = true;
+		for (;;) {
+			const unsigned char leadByte = (posIndexDocument < endPos) ? text[posIndexDocument] : 0;
+			int widthChar = 1;
+			size_t lenFlat = 1;
+			if (UTF8IsAscii(leadByte)) {
+				if ((posIndexDocument + 1) > endPos) {
+					break;
+				}
+				const char ch = static_cast<char>(leadByte);
+				char folded[2];
+				folder.Fold(folded, sizeof(folded), &ch, 1);
+				characterMatches = searchData[indexSearch] == static_cast<unsigned char>(folded[0]);
+			} else {
+				char bytes[UTF8MaxBytes + 1]{ static_cast<char>(leadByte) };
+				const int widthCharBytes = UTF8BytesOfLead(leadByte);
+				for (int b = 1; b < widthCharBytes; b++) {
+					bytes[b] = (posIndexDocument + b < endPos) ? text[posIndexDocument + b] : 0;
+				}
+				widthChar = UTF8ClassifyMulti(reinterpret_cast<const unsigned char *>(bytes), widthCharBytes) & UTF8MaskWidth;
+				if (!indexSearch) {
+					widthFirstCharacter = widthChar;
+				}
+				if ((posIndexDocument + widthChar) > endPos) {
+					break;
+				}
+				char folded[UTF8MaxBytes * maxFoldingExpansion + 1];
+				lenFlat = folder.Fold(folded, sizeof(folded), bytes, widthChar);
+				characterMatches = 0 == memcmp(folded, searchData + indexSearch, lenFlat);
+			}
+			if (!characterMatches) {
+				break;
+			}
+			posIndexDocument += widthChar;
+			indexSearch += lenFlat;
+			if (indexSearch >= lenSearch) {
+				break;
+			}
+		}
+		if (characterMatches && (indexSearch == lenSearch)) {
+			return {pos, posIndexDocument - pos};
+		}
+		pos += widthFirstCharacter;
+	}
+	return {-1, 0};
+}
+
+// character boundary for chunk end, same as Document::MovePositionOutsideChar(pos, -1)
+ptrdiff_t MoveBackOutsideChar(std::string_view text, ptrdiff_t pos) {
+	ptrdiff_t start = pos;
+	while (start > 0 && start > pos - UTF8MaxBytes && UTF8IsTrailByte(static_cast<unsigned char>(text[start]))) {
+		--start;
+	}
+	const ptrdiff_t width = UTF8DrawBytes(text.data() + start, text.length() - start);
+	return (start + width > pos) ? start : pos;
+}
+
+// same as Document::FindFoldedText() without word options.
+Match FindFoldedText(CaseFolder &folder, std::string_view text, ptrdiff_t startPos, std::string_view searchText) {
+	std::string foldedSearch(searchText.length()*maxFoldTextExpansion + 1, '\0');
+	foldedSearch.resize(folder.Fold(foldedSearch.data(), foldedSearch.size(), searchText.data(), searchText.length()));
+	const std::string_view search = foldedSearch;
+	const ptrdiff_t overlap = static_cast<ptrdiff_t>(search.length()) * UTF8MaxBytes;
+	constexpr ptrdiff_t maxChunkSize = 64*1024;
+	ptrdiff_t chunkSize = std::max<ptrdiff_t>(256, 2*overlap);
+	std::vector<char> folded;
+	std::vector<uint32_t> starts;
+	const ptrdiff_t endPos = text.length();
+	ptrdiff_t chunkStart = startPos;
+	while (chunkStart < endPos) {
+		ptrdiff_t chunkEnd = endPos;
+		if (chunkEnd - chunkStart > chunkSize) {
+			chunkEnd = MoveBackOutsideChar(text, chunkStart + chunkSize);
+		}
+		const ptrdiff_t lenMixed = chunkEnd - chunkStart;
+		if (folded.size() < lenMixed*maxFoldTextExpansion + 1) {
+			folded.resize(lenMixed*maxFoldTextExpansion + 1);
+			starts.resize(lenMixed*maxFoldTextExpansion + 1);
+		}
+		const size_t lenFolded = folder.FoldText(folded.data(), starts.data(), text.data() + chunkStart, lenMixed);
+		const char * const foldedText = folded.data();
+		size_t offset = 0;
+		while (offset + search.length() <= lenFolded) {
+			const char *found = np2::vectorKernels.FindSubstring(foldedText + offset, lenFolded - offset, search.data(), search.length());
+			if (found == nullptr) {
+				break;
+			}
+			const size_t index = found - foldedText;
+			const uint32_t start = starts[index];
+			const uint32_t end = starts[index + search.length()];
+			if (start != foldedContinuation && end != foldedContinuation) {
+				return {chunkStart + start, static_cast<ptrdiff_t>(end - start)};
+			}
+			offset = index + 1;
+		}
+		if (chunkEnd >= endPos) {
+			break;
+		}
+		const ptrdiff_t next = std::max(chunkEnd - overlap, chunkStart + 1);
+		chunkStart = next;
+		while (chunkStart < endPos && MoveBackOutsideChar(text, chunkStart) != chunkStart) {
+			++chunkStart;
+		}
+		chunkSize = std::max(chunkSize, std::min(2*chunkSize, maxChunkSize));
+	}
+	return {-1, 0};
+}
+
+// find all matches like Mark All.
+template <typename Finder>
+std::vector<Match> FindAll(std::string_view text, std::string_view search, Finder finder) {
+	std::vector<Match> matches;
+	ptrdiff_t pos = 0;
+	for (;;) {
+		const Match match = finder(text, pos, search);
+		if (match.pos < 0) {
+			break;
+		}
+		matches.push_back(match);
+		pos = match.pos + std::max<ptrdiff_t>(match.length, 1);
+	}
+	return matches;
+}
+
+std::string RandomText(std::mt19937 &rng, const std::vector<std::string> &words, size_t length) {
+	std::uniform_int_distribution<size_t> pick{0, words.size() - 1};
+	std::string text;
+	while (text.size() < length) {
+		text += words[pick(rng)];
+		text += (pick(rng) & 7) ? " " : ".\r\n";
+	}
+	return text;
+}
+
+const std::vector<std::string> asciiWords = {
+	"The", "quick", "brown", "FOX", "jumps", "over", "lazy", "DOG", "Search", "text", "Kelvin",
+};
+const std::vector<std::string> cyrillicWords = {
+	"\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82", // Привет
+	"\xD0\xBC\xD0\xB8\xD1\x80", // мир
+	"\xD0\x9F\xD0\xA0\xD0\x98\xD0\x92\xD0\x95\xD0\xA2", // ПРИВЕТ
+	"\xD0\xBF\xD0\xBE\xD0\xB8\xD1\x81\xD0\xBA", // поиск
+	"\xD0\xA2\xD0\xB5\xD0\xBA\xD1\x81\xD1\x82", // Текст
+	"\xD0\x81\xD0\xB6", // Ёж
+};
+const std::vector<std::string> greekWords = {
+	"\xCE\x9A\xCE\xB1\xCE\xBB\xCE\xB7\xCE\xBC\xCE\xAD\xCF\x81\xCE\xB1", // Καλημέρα
+	"\xCE\xBA\xCF\x8C\xCF\x83\xCE\xBC\xCE\xB5", // κόσμε
+	"\xCE\xA3\xCE\x99\xCE\xA3\xCE\xA5\xCE\xA6\xCE\x9F\xCE\xA3", // ΣΙΣΥΦΟΣ
+	"\xCF\x82\xCE\x90", // ςΐ, folded into multiple characters
+};
+const std::vector<std::string> mixedWords = {
+	"\xE4\xB8\xAD\xE6\x96\x87", // 中文
+	"\xE2\x84\xAA", // KELVIN SIGN, folded into k
+	"\xC5\xBF", // LATIN SMALL LETTER LONG S, folded into s
+	"\xC4\xB0", // LATIN CAPITAL LETTER I WITH DOT ABOVE
+	"\xF0\x90\x90\x80", // DESERET CAPITAL LETTER LONG I
+	"\xEF\xBF\xBE", // non-character
+	"\xC3", "\x80", // invalid
+	"Sk", "ss", "\xC3\x9F", // ß
+};
+
+using Clock = std::chrono::steady_clock;
+
+void Benchmark(const char *name, CaseFolderUnicode &folder, const std::string &text, std::string_view search) {
+	auto start = Clock::now();
+	const std::vector<Match> expected = FindAll(text, search, [&folder](std::string_view text, ptrdiff_t pos, std::string_view search) {
+		return FindCharacterByCharacter(folder, text, pos, search);
+	});
+	const double oldTime = std::chrono::duration<double>(Clock::now() - start).count();
+	start = Clock::now();
+	const std::vector<Match> matches = FindAll(text, search, [&folder](std::string_view text, ptrdiff_t pos, std::string_view search) {
+		return FindFoldedText(folder, text, pos, search);
+	});
+	const double newTime = std::chrono::duration<double>(Clock::now() - start).count();
+	const double size = text.size()/1048576.0;
+	printf("%-8s %8.2f MiB/s => %8.2f MiB/s, %zu matches%s\n", name, size/oldTime, size/newTime,
+		matches.size(), (matches == expected) ? "" : " MISMATCH");
+	if (matches != expected) {
+		exit(EXIT_FAILURE);
+	}
+}
+
+}
+
+int main(int argc, char *argv[]) {
+	CaseFolderUnicode folder;
+	std::mt19937 rng{20240701};
+
+	// random short text and patterns with all special cases
+	std::vector<std::string> words = mixedWords;
+	words.insert(words.end(), asciiWords.begin(), asciiWords.end());
+	words.insert(words.end(), cyrillicWords.begin(), cyrillicWords.end());
+	words.insert(words.end(), greekWords.begin(), greekWords.end());
+	size_t checked = 0;
+	for (int round = 0; round < 3000; round++) {
+		const std::string text = RandomText(rng, words, round % 300);
+		std::string search = RandomText(rng, words, 1 + round % 7);
+		search.resize(1 + round % 9);
+		auto finder = [&folder](std::string_view text, ptrdiff_t pos, std::string_view search) {
+			return FindFoldedText(folder, text, pos, search);
+		};
+		auto expected = [&folder](std::string_view text, ptrdiff_t pos, std::string_view search) {
+			return FindCharacterByCharacter(folder, text, pos, search);
+		};
+		if (FindAll(text, search, finder) != FindAll(text, search, expected)) {
+			printf("mismatch at round %d\n", round);
+			return EXIT_FAILURE;
+		}
+		++checked;
+	}
+	printf("checked %zu texts\n", checked);
+
+	const size_t length = (argc > 1) ? atoi(argv[1])*1024*1024 : 8*1024*1024;
+	Benchmark("ASCII", folder, RandomText(rng, asciiWords, length), "lazy dog.");
+	Benchmark("Cyrillic", folder, RandomText(rng, cyrillicWords, length), "\xD0\xBF\xD0\xBE\xD0\xB8\xD1\x81\xD0\xBA."); // поиск.
+	Benchmark("Greek", folder, RandomText(rng, greekWords, length), "\xCE\xBA\xCF\x8C\xCF\x83\xCE\xBC\xCE\xB5."); // κόσμε.
+	Benchmark("Mixed", folder, RandomText(rng, words, length), "\xE4\xB8\xAD\xE6\x96\x87."); // 中文.
+	return 0;
+}
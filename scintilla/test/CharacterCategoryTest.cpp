@@ -0,0 +1,85 @@
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+// Test and benchmark for character property table used by CategoriseCharacter() and IsIdStart() family.
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cassert>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "CharacterCategory.h"
+
+// g++ -std=gnu++17 -O2 -Wall -Wextra -I../lexlib CharacterCategoryTest.cpp ../lexlib/CharacterCategory.cxx
+// cl /EHsc /std:c++17 /O2 /W4 /I../lexlib CharacterCategoryTest.cpp ../lexlib/CharacterCategory.cxx
+
+using namespace Lexilla;
+
+namespace {
+
+void TestKnownProperty() {
+	assert(CategoriseCharacter('A') == ccLu && IsIdStart('A') && IsXidContinue('A'));
+	assert(CategoriseCharacter('0') == ccNd && !IsIdStart('0') && IsIdContinue('0'));
+	assert(CategoriseCharacter('_') == ccPc && !IsXidStart('_') && IsXidContinue('_'));
+	assert(CategoriseCharacter(' ') == ccZs && !IsIdContinue(' '));
+	assert(CategoriseCharacter(0x0416) == ccLu && IsXidStart(0x0416));		// CYRILLIC CAPITAL LETTER ZHE
+	assert(CategoriseCharacter(0x4E2D) == ccLo && IsXidStart(0x4E2D));		// CJK UNIFIED IDEOGRAPH-4E2D
+	assert(CategoriseCharacter(0x3002) == ccPo && !IsIdContinue(0x3002));	// IDEOGRAPHIC FULL STOP
+	assert(CategoriseCharacter(0x1F600) == ccSo);							// GRINNING FACE
+	assert(CategoriseCharacter(0xE000) == ccCo && CategoriseCharacter(0xD800) == ccCs);
+	// Other_ID_Start, Other_ID_Continue and Pattern_Syntax
+	assert(CategoriseCharacter(0x2118) == ccSm && IsIdStart(0x2118));		// SCRIPT CAPITAL P
+	assert(CategoriseCharacter(0x00B7) == ccPo && !IsIdStart(0x00B7) && IsXidContinue(0x00B7));	// MIDDLE DOT
+	assert(CategoriseCharacter(0x2E2F) == ccLm && !IsIdStart(0x2E2F) && !IsIdContinue(0x2E2F));	// VERTICAL TILDE
+	// modified for NFKC
+	assert(IsIdStart(0x037A) && !IsXidStart(0x037A) && !IsXidContinue(0x037A));	// GREEK YPOGEGRAMMENI
+	assert(IsIdStart(0x0E33) && !IsXidStart(0x0E33) && IsXidContinue(0x0E33));	// THAI CHARACTER SARA AM
+	// out of range
+	assert(CategoriseCharacter(-1) == ccCn && CategoriseCharacter(0x110000) == ccCn && !IsIdContinue(0x110000));
+}
+
+// code points from given blocks, mixed with ASCII space and punctuation like source code.
+std::vector<int> RandomText(std::mt19937 &rng, size_t length, int first, int last) {
+	std::uniform_int_distribution<int> letter{first, last};
+	std::uniform_int_distribution<int> pick{0, 7};
+	std::vector<int> text;
+	text.reserve(length);
+	while (text.size() < length) {
+		const int value = pick(rng);
+		text.push_back((value == 0) ? ' ' : ((value == 1) ? '_' : letter(rng)));
+	}
+	return text;
+}
+
+using Clock = std::chrono::steady_clock;
+
+void Benchmark(const char *name, const std::vector<int> &text, int repeat) {
+	size_t found = 0;
+	const auto start = Clock::now();
+	for (int i = 0; i < repeat; i++) {
+		for (const int ch : text) {
+			found += IsIdContinue(ch);
+		}
+	}
+	const double duration = std::chrono::duration<double>(Clock::now() - start).count();
+	const double count = text.size()*static_cast<double>(repeat)/1e6;
+	printf("%-10s %8.2f M/s (%zu)\n", name, count/duration, found);
+}
+
+}
+
+int main(int argc, char *argv[]) {
+	TestKnownProperty();
+
+	std::mt19937 rng{20240601};
+	const int repeat = (argc > 1) ? atoi(argv[1]) : 100;
+	constexpr size_t length = 1 << 16;
+	Benchmark("ASCII", RandomText(rng, length, 'a', 'z'), repeat);
+	Benchmark("Cyrillic", RandomText(rng, length, 0x0410, 0x044F), repeat);
+	Benchmark("Greek", RandomText(rng, length, 0x0391, 0x03C9), repeat);
+	Benchmark("CJK", RandomText(rng, length, 0x4E00, 0x9FFF), repeat);
+	Benchmark("Hangul", RandomText(rng, length, 0xAC00, 0xD7A3), repeat);
+	return 0;
+}
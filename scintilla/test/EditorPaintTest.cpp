@@ -0,0 +1,421 @@
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+// Headless Editor painting into recording Surface, checks lines painted by scrolling cache of
+// EditView::PaintText() and compares its text area with full repaint, then benchmarks painting
+// frames while scrolling through EditView and MarginView layout and paint, without a window.
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cassert>
+#include <cmath>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <set>
+#include <forward_list>
+#include <optional>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+
+#include "ParallelSupport.h"
+#include "ScintillaTypes.h"
+#include "ScintillaMessages.h"
+#include "ScintillaStructures.h"
+#include "ILoader.h"
+#include "ILexer.h"
+#include "Scintilla.h"
+
+#include "SurfaceRecording.h"
+#include "CharacterSet.h"
+#include "Position.h"
+#include "UniqueString.h"
+#include "SplitVector.h"
+#include "Partitioning.h"
+#include "RunStyles.h"
+#include "ContractionState.h"
+#include "CellBuffer.h"
+#include "PerLine.h"
+#include "KeyMap.h"
+#include "Indicator.h"
+#include "LineMarker.h"
+#include "Style.h"
+#include "ViewStyle.h"
+#include "CharClassify.h"
+#include "Decoration.h"
+#include "CaseFolder.h"
+#include "Document.h"
+#include "UniConversion.h"
+#include "Selection.h"
+#include "PositionCache.h"
+#include "EditModel.h"
+#include "MarginView.h"
+#include "EditView.h"
+#include "Editor.h"
+
+// EDITOR_SRC="../src/Editor.cxx ../src/EditView.cxx ../src/EditModel.cxx ../src/MarginView.cxx ../src/PositionCache.cxx ../src/Selection.cxx ../src/ViewStyle.cxx ../src/Style.cxx ../src/Indicator.cxx ../src/LineMarker.cxx ../src/XPM.cxx ../src/KeyMap.cxx ../src/Document.cxx ../src/CellBuffer.cxx ../src/ChangeHistory.cxx ../src/UndoHistory.cxx ../src/PerLine.cxx ../src/RunStyles.cxx ../src/Decoration.cxx ../src/ContractionState.cxx ../src/CharClassify.cxx ../src/CaseFolder.cxx ../src/CaseConvert.cxx ../src/UniConversion.cxx ../src/UniqueString.cxx ../src/RESearch.cxx ../src/Geometry.cxx ../src/VectorKernels.cxx"
+// g++ -std=gnu++20 -O2 -Wall -Wextra -pthread -DSURFACE_RECORDING_PLATFORM -I../include -I../src -I../lexlib EditorPaintTest.cpp SurfaceRecording.cpp $EDITOR_SRC
+// cl /EHsc /std:c++20 /O2 /W4 /DSURFACE_RECORDING_PLATFORM /I../include /I../src /I../lexlib EditorPaintTest.cpp SurfaceRecording.cpp %EDITOR_SRC%
+// usage: a.out [frames], check scrolling cache, then benchmark painting frames while scrolling one line per frame.
+
+using namespace Scintilla;
+using namespace Scintilla::Internal;
+
+namespace {
+
+constexpr int clientWidth = 800;
+constexpr int clientHeight = 600;
+
+// Editor without window: fixed client area, notifications, clipboard, timers and scroll bars are ignored.
+class HeadlessEditor final : public Editor {
+	PRectangle rcClient{0, 0, clientWidth, clientHeight};
+
+	void Initialise() noexcept override {}
+	void NotifyCaretMove() noexcept override {}
+	void UpdateSystemCaret() override {}
+	void SetVerticalScrollPos() override {}
+	void SetHorizontalScrollPos() override {}
+	bool ModifyScrollBars([[maybe_unused]] Sci::Line nMax, [[maybe_unused]] Sci::Line nPage) override {
+		return false;
+	}
+	void Copy([[maybe_unused]] bool asBinary) const override {}
+	void Paste([[maybe_unused]] bool asBinary) override {}
+	void ClaimSelection() noexcept override {}
+	void NotifyChange() noexcept override {}
+	void NotifyParent([[maybe_unused]] NotificationData scn) noexcept override {}
+	void CopyToClipboard([[maybe_unused]] const SelectionText &selectedText) const override {}
+	void StartDrag() override {}
+	bool FineTickerRunning([[maybe_unused]] TickReason reason) const noexcept override {
+		return false;
+	}
+	void FineTickerStart([[maybe_unused]] TickReason reason, [[maybe_unused]] int millis, [[maybe_unused]] int tolerance) noexcept override {}
+	void FineTickerCancel([[maybe_unused]] TickReason reason) noexcept override {}
+	bool SetIdle([[maybe_unused]] bool on) noexcept override {
+		return false;
+	}
+	void SetMouseCapture([[maybe_unused]] bool on) noexcept override {}
+	bool HaveMouseCapture() const noexcept override {
+		return false;
+	}
+	void UpdateBaseElements() override {}
+	bool ValidCodePage(int codePage) const noexcept override {
+		return codePage == 0 || codePage == CpUtf8;
+	}
+	std::string UTF8FromEncoded(std::string_view encoded) const override {
+		return std::string(encoded);
+	}
+	std::string EncodedFromUTF8(std::string_view utf8) const override {
+		return std::string(utf8);
+	}
+	sptr_t DefWndProc([[maybe_unused]] Message iMessage, [[maybe_unused]] uptr_t wParam, [[maybe_unused]] sptr_t lParam) override {
+		return 0;
+	}
+
+public:
+	HeadlessEditor() noexcept {
+		// surfaces are only created for valid window
+		wMain = this;
+	}
+
+	PRectangle GetClientRectangle() const noexcept override {
+		return rcClient;
+	}
+
+	sptr_t Send(Message iMessage, uptr_t wParam = 0, sptr_t lParam = 0) {
+		return WndProc(iMessage, wParam, lParam);
+	}
+
+	// same as WM_PAINT for whole client area, abandoned paint is repeated like FullPaint().
+	void PaintClient(Surface &surfaceWindow) {
+		ClearPixMaps();
+		paintState = PaintState::painting;
+		rcPaint = rcClient;
+		paintingAllText = true;
+		Paint(&surfaceWindow, rcClient);
+		if (paintState == PaintState::abandoned) {
+			paintState = PaintState::painting;
+			Paint(&surfaceWindow, rcClient);
+		}
+		paintState = PaintState::notPainting;
+	}
+
+	void RedrawAll() noexcept {
+		Redraw();
+	}
+
+	std::vector<SurfaceRecording *> PixMaps() const {
+		std::vector<SurfaceRecording *> pixmaps;
+		for (Surface *pixmap : {view.pixmapLine.get(), view.pixmapText.get(), view.pixmapTextScroll.get(), marginView.pixmapSelMargin.get()}) {
+			if (SurfaceRecording *surface = dynamic_cast<SurfaceRecording *>(pixmap)) {
+				pixmaps.push_back(surface);
+			}
+		}
+		return pixmaps;
+	}
+
+	// display list of pixmaps only contains drawing of current frame.
+	void ClearPixMaps() const {
+		for (SurfaceRecording *surface : PixMaps()) {
+			surface->Clear();
+		}
+	}
+
+	SurfaceRecording *TextPixMap() const noexcept {
+		return dynamic_cast<SurfaceRecording *>(view.pixmapText.get());
+	}
+
+	// track rows of text area pixmaps, lines are copied into them from pixmapLine.
+	void TrackTextRows() {
+		for (Surface *pixmap : {view.pixmapText.get(), view.pixmapTextScroll.get()}) {
+			dynamic_cast<SurfaceRecording &>(*pixmap).TrackRows(true);
+		}
+		Redraw();
+	}
+
+	int LineHeight() const noexcept {
+		return vs.lineHeight;
+	}
+
+	size_t PixMapCommands() const {
+		size_t commands = 0;
+		for (const SurfaceRecording *surface : PixMaps()) {
+			commands += surface->Commands().size();
+		}
+		return commands;
+	}
+};
+
+// C like source with different line lengths, long enough for beyond end of file never visible.
+std::string MakeText(int lineCount) {
+	std::string text;
+	char buffer[128];
+	for (int line = 0; line < lineCount; line++) {
+		const int indent = line % 4;
+		text.append(indent, '\t');
+		snprintf(buffer, sizeof(buffer), "value%d = Compute(value%d, %d); // line %d", line, line / 3, line % 97, line);
+		text += buffer;
+		if (line % 5 == 0) {
+			text.append(line % 60, '*');
+		}
+		text += '\n';
+	}
+	return text;
+}
+
+constexpr int indicatorEdit = 8;
+
+void SetupEditor(HeadlessEditor &editor, int lineCount) {
+	editor.Send(Message::SetCodePage, CpUtf8);
+	editor.Send(Message::SetText, 0, reinterpret_cast<sptr_t>(MakeText(lineCount).c_str()));
+	editor.Send(Message::SetMarginWidthN, 0, 48);
+	editor.Send(Message::SetMarginTypeN, 1, SC_MARGIN_SYMBOL);
+	editor.Send(Message::SetMarginWidthN, 1, 16);
+	editor.Send(Message::SetFocus, 1);
+	editor.Send(Message::SetElementColour, SC_ELEMENT_CARET_LINE_BACK, 0xffe0f0f0);
+	editor.Send(Message::IndicSetStyle, indicatorEdit, INDIC_ROUNDBOX);
+	editor.Send(Message::SetIndicatorCurrent, indicatorEdit);
+}
+
+// screen lines painted into text area pixmap, each line is copied from pixmapLine.
+std::set<int> PaintedLines(const HeadlessEditor &editor) {
+	std::set<int> lines;
+	const int lineHeight = editor.LineHeight();
+	for (const DrawCommand &command : editor.TextPixMap()->Commands()) {
+		if (command.op == DrawOp::Copy && command.rc.Height() == lineHeight) {
+			lines.insert(static_cast<int>(command.rc.top) / lineHeight);
+		}
+	}
+	return lines;
+}
+
+constexpr int noIndicator = -1000;
+
+// one frame: caret moved, indicator filled or cleared on a line, then scrolled.
+// lines are relative to top line before the frame, may be outside the screen.
+struct ScrollFrame {
+	int scroll;
+	int caretLine;
+	int indicatorLine;	// noIndicator for no indicator change
+	bool indicatorFill;
+};
+
+void ApplyFrame(HeadlessEditor &editor, const ScrollFrame &frame) {
+	const Sci::Line topLine = editor.Send(Message::GetFirstVisibleLine);
+	editor.Send(Message::SetEmptySelection, editor.Send(Message::PositionFromLine, topLine + frame.caretLine) + 2);
+	if (frame.indicatorLine != noIndicator) {
+		const sptr_t position = editor.Send(Message::PositionFromLine, topLine + frame.indicatorLine) + 4;
+		editor.Send(frame.indicatorFill ? Message::IndicatorFillRange : Message::IndicatorClearRange, position, 6);
+	}
+	editor.Send(Message::LineScroll, 0, frame.scroll);
+}
+
+void TestScrollCache() {
+	// scroll by one line, several lines, more than 10 lines (Editor::ScrollTo() redraws all)
+	// and more than a page, caret line highlight and indicators change between frames.
+	constexpr ScrollFrame frames[] = {
+		{1, 12, noIndicator, false},
+		{1, 13, 20, true},
+		{3, 14, 14, true},
+		{-2, 30, 19, false},
+		{0, 5, 8, true},
+		{5, 2, noIndicator, false},
+		{-7, 3, 30, true},
+		{10, 9, 4, false},
+		{-1, 38, noIndicator, false},
+		{4, -3, 45, true},
+		{12, 22, 30, false},
+		{60, 70, 75, true},
+		{-45, 40, noIndicator, false},
+		{1, 0, 0, true},
+		{-1, 39, 39, false},
+		{2, 2, 6, true},
+	};
+
+	// same edits and scrolling, reference always repaints whole text area.
+	HeadlessEditor editor;
+	HeadlessEditor reference;
+	SurfaceRecording surfaceWindow(clientWidth, clientHeight);
+	SurfaceRecording surfaceReference(clientWidth, clientHeight);
+	for (HeadlessEditor *ed : {&editor, &reference}) {
+		SetupEditor(*ed, 2000);
+		ed->Send(Message::SetFirstVisibleLine, 100);
+	}
+	editor.PaintClient(surfaceWindow);
+	reference.PaintClient(surfaceReference);
+	editor.TrackTextRows();
+	reference.TrackTextRows();
+	editor.PaintClient(surfaceWindow);
+	reference.PaintClient(surfaceReference);
+
+	const int lineHeight = editor.LineHeight();
+	const int screenLines = (clientHeight + lineHeight - 1) / lineHeight;
+	Sci::Line caretLine = editor.Send(Message::LineFromPosition, editor.Send(Message::GetCurrentPos));
+	int frameIndex = 0;
+	for (const ScrollFrame &frame : frames) {
+		const Sci::Line topLine = editor.Send(Message::GetFirstVisibleLine);
+		// invalidated lines before scrolling: lines from old to new caret (as selection changed)
+		// and indicator line, combined into one band.
+		int invalidTop = screenLines;
+		int invalidBottom = -1;
+		const int caretScreenLine = static_cast<int>(caretLine - topLine);
+		const std::pair<int, int> invalidated[] = {
+			std::minmax(caretScreenLine, frame.caretLine),
+			{frame.indicatorLine, frame.indicatorLine},
+		};
+		for (const auto &[first, last] : invalidated) {
+			if (last >= 0 && first < screenLines) {
+				invalidTop = std::min(invalidTop, std::max(first, 0));
+				invalidBottom = std::max(invalidBottom, std::min(last, screenLines - 1));
+			}
+		}
+
+		ApplyFrame(editor, frame);
+		ApplyFrame(reference, frame);
+		reference.RedrawAll();
+		caretLine = topLine + frame.caretLine;
+
+		std::set<int> expected;
+		const int scroll = frame.scroll;
+		if (std::abs(scroll) > 10 || std::abs(scroll) >= screenLines) {
+			for (int line = 0; line < screenLines; line++) {
+				expected.insert(line);
+			}
+		} else {
+			// invalidated band covers its place before and after scrolling
+			if (invalidTop <= invalidBottom) {
+				if (scroll > 0) {
+					invalidTop -= scroll;
+				} else {
+					invalidBottom -= scroll;
+				}
+			}
+			for (int line = std::max(invalidTop, 0); line <= std::min(invalidBottom, screenLines - 1); line++) {
+				expected.insert(line);
+			}
+			// exposed lines
+			if (scroll > 0) {
+				for (int line = (clientHeight - scroll*lineHeight) / lineHeight; line < screenLines; line++) {
+					expected.insert(line);
+				}
+			} else {
+				for (int line = 0; line < -scroll; line++) {
+					expected.insert(line);
+				}
+			}
+		}
+
+		editor.PaintClient(surfaceWindow);
+		reference.PaintClient(surfaceReference);
+		const std::set<int> painted = PaintedLines(editor);
+		if (painted != expected) {
+			printf("frame %d: painted %zu lines, expected %zu lines\n", frameIndex, painted.size(), expected.size());
+			for (const int line : painted) {
+				printf(" %d", line);
+			}
+			printf("\n");
+			exit(EXIT_FAILURE);
+		}
+		// text area same as full repaint
+		const std::vector<std::string> &rows = editor.TextPixMap()->Rows();
+		const std::vector<std::string> &rowsReference = reference.TextPixMap()->Rows();
+		assert(rows.size() == clientHeight && rows.size() == rowsReference.size());
+		for (size_t y = 0; y < rows.size(); y++) {
+			if (rows[y].empty() || rows[y] != rowsReference[y]) {
+				printf("frame %d: row %zu differs from full repaint\n%s\n%s\n", frameIndex, y, rows[y].c_str(), rowsReference[y].c_str());
+				exit(EXIT_FAILURE);
+			}
+		}
+		frameIndex++;
+	}
+	printf("checked %d scrolling frames, %d lines on screen\n", frameIndex, screenLines);
+}
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMicroseconds(Clock::time_point start) noexcept {
+	return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+// paint frames while scrolling one line per frame, painting is cached by EditView::PaintText(),
+// then same frames with whole text area repainted.
+void BenchmarkScrolling(int frames) {
+	HeadlessEditor editor;
+	SetupEditor(editor, 20000);
+	SurfaceRecording surfaceWindow(clientWidth, clientHeight);
+	editor.PaintClient(surfaceWindow);
+	printf("%d x %d client, %zd lines on screen\n", clientWidth, clientHeight,
+		static_cast<size_t>(editor.Send(Message::LinesOnScreen)));
+
+	for (const bool cached : {true, false}) {
+		editor.Send(Message::SetFirstVisibleLine, 0);
+		editor.PaintClient(surfaceWindow);
+		size_t commands = 0;
+		const Clock::time_point start = Clock::now();
+		for (int frame = 0; frame < frames; frame++) {
+			editor.Send(Message::LineScroll, 0, 1);
+			if (!cached) {
+				editor.RedrawAll();
+			}
+			surfaceWindow.Clear();
+			editor.PaintClient(surfaceWindow);
+			commands += surfaceWindow.Commands().size() + editor.PixMapCommands();
+		}
+		const double duration = ElapsedMicroseconds(start);
+		printf("%s: %d frames, %.1f commands/frame, %.2f us/frame\n", cached ? "scrolling" : "full repaint",
+			frames, static_cast<double>(commands)/frames, duration/frames);
+	}
+}
+
+}
+
+int main(int argc, char *argv[]) {
+	const int frames = (argc > 1) ? atoi(argv[1]) : 2000;
+	TestScrollCache();
+	BenchmarkScrolling(std::max(frames, 1));
+	return 0;
+}
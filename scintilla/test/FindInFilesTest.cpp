@@ -0,0 +1,201 @@
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+// Test and benchmark for Find in Files engine.
+#include <cstdio>
+#include <cstdlib>
+#include <cassert>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../../src/FindInFiles.h"
+
+// FIF_SRC="../../src/FindInFiles.cpp ../src/VectorKernels.cxx ../src/CaseFolder.cxx ../src/CaseConvert.cxx ../src/UniConversion.cxx ../src/CharClassify.cxx ../src/RESearch.cxx"
+// g++ -std=gnu++20 -O2 -Wall -Wextra -pthread -I../include -I../src -I../lexlib FindInFilesTest.cpp $FIF_SRC
+// cl /EHsc /std:c++20 /O2 /W4 /I../include /I../src /I../lexlib FindInFilesTest.cpp %FIF_SRC%
+// usage: a.out [directory find-text [include-filter [exclude-filter [flags [threads]]]]]
+
+using namespace FindInFiles;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+void TestMatchSpec() {
+	assert(MatchSpec("Notepad4.cpp", "*.cpp"));
+	assert(MatchSpec("Notepad4.CPP", "*.cpp"));
+	assert(!MatchSpec("Notepad4.cpp", "*.c"));
+	assert(MatchSpec("Notepad4.cpp", "note*.?pp"));
+	assert(MatchSpec("Makefile", "*.*"));
+	assert(!MatchSpec("Makefile", "*.mk"));
+
+	const Filter filter{"*.h; *.cpp;;"};
+	assert(filter.Match("Edit.h") && filter.Match("Edit.cpp") && !filter.Match("Edit.rc"));
+	assert(Filter{"*.*"}.Empty() && Filter{""}.Empty());
+}
+
+std::vector<MatchedLine> Search(std::string_view text, std::string_view pattern, int searchFlags, bool *complete = nullptr) {
+	Options options;
+	options.findText = pattern;
+	options.searchFlags = searchFlags;
+	const Engine engine{options, nullptr, nullptr};
+	std::vector<MatchedLine> lines;
+	if (engine.IsValid()) {
+		const bool result = engine.SearchText(text, lines);
+		if (complete) {
+			*complete = result;
+		}
+	}
+	return lines;
+}
+
+void TestSearch() {
+	constexpr std::string_view text = "int value;\r\nValue = valueOf(x);\n\xE4\xB8\xAD value\nend";
+	auto lines = Search(text, "value", SearchFlag_MatchCase);
+	assert(lines.size() == 3);
+	assert(lines[0].line == 1 && lines[0].column == 5 && lines[0].text == "int value;");
+	assert(lines[1].line == 2 && lines[1].column == 9);
+	assert(lines[2].line == 3 && lines[2].column == 3);
+
+	lines = Search(text, "VALUE", SearchFlag_None);
+	assert(lines.size() == 3 && lines[1].column == 1);
+
+	lines = Search(text, "value", SearchFlag_WholeWord);
+	assert(lines.size() == 3 && lines[1].column == 1);
+	lines = Search(text, "value", SearchFlag_WholeWord | SearchFlag_MatchCase);
+	assert(lines.size() == 2 && lines[1].line == 3);
+	lines = Search(text, "alue", SearchFlag_WordStart);
+	assert(lines.empty());
+
+	lines = Search(text, "v[a-z]+Of(", SearchFlag_RegExp | SearchFlag_MatchCase);
+	assert(lines.size() == 1 && lines[0].line == 2 && lines[0].column == 9);
+	lines = Search(text, "^end$", SearchFlag_RegExp);
+	assert(lines.size() == 1 && lines[0].line == 4);
+	// same syntax as built-in regex used by Find dialog
+	lines = Search(text, "\\<value\\>", SearchFlag_RegExp);
+	assert(lines.size() == 3 && lines[1].column == 1 && lines[2].column == 3);
+	assert(Search(text, "\\<alue", SearchFlag_RegExp).empty());
+	lines = Search(text, "\\(val\\)ueOf(", SearchFlag_RegExp);
+	assert(lines.size() == 1 && lines[0].line == 2 && lines[0].column == 9);
+	lines = Search(text, "(val)ueOf\\(", SearchFlag_RegExp | SearchFlag_Posix);
+	assert(lines.size() == 1 && lines[0].line == 2 && lines[0].column == 9);
+	assert(Search(text, "\\(", SearchFlag_RegExp).empty());
+	assert(Search(text, "(", SearchFlag_RegExp | SearchFlag_Posix).empty());
+
+	// long line is skipped instead of backtracking on whole line
+	std::string longLine = "x1y\nx" + std::string(200*1024, 'a') + "y\nx2y";
+	bool complete = true;
+	lines = Search(longLine, "x.*y", SearchFlag_RegExp, &complete);
+	assert(!complete && lines.size() == 2 && lines[0].line == 1 && lines[1].line == 3);
+	lines = Search(longLine, "x2y", SearchFlag_MatchCase, &complete);
+	assert(complete && lines.size() == 1 && lines[0].line == 3);
+}
+
+// case insensitive search folds Unicode like CaseFolderUnicode used by Scintilla.
+void TestSearchUnicode() {
+	// "Привет мир\nΣΟΦΙΑ σοφία\nKelvin \u212A"
+	constexpr std::string_view text = "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 \xD0\xBC\xD0\xB8\xD1\x80\n"
+		"\xCE\xA3\xCE\x9F\xCE\xA6\xCE\x99\xCE\x91 \xCF\x83\xCE\xBF\xCF\x86\xCE\xAF\xCE\xB1\nKelvin \xE2\x84\xAA";
+	// "привет"
+	constexpr std::string_view privet = "\xD0\xBF\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82";
+	auto lines = Search(text, privet, SearchFlag_None);
+	assert(lines.size() == 1 && lines[0].line == 1 && lines[0].column == 1);
+	assert(Search(text, privet, SearchFlag_MatchCase).empty());
+	// "МИР"
+	lines = Search(text, "\xD0\x9C\xD0\x98\xD0\xA0", SearchFlag_WholeWord);
+	assert(lines.size() == 1 && lines[0].line == 1 && lines[0].column == 8);
+	// "σοφια" matches "ΣΟΦΙΑ" but not "σοφία"
+	lines = Search(text, "\xCF\x83\xCE\xBF\xCF\x86\xCE\xB9\xCE\xB1", SearchFlag_None);
+	assert(lines.size() == 1 && lines[0].line == 2 && lines[0].column == 1);
+	// KELVIN SIGN is folded to ASCII k
+	lines = Search(text, "kelvin k", SearchFlag_None);
+	assert(lines.size() == 1 && lines[0].line == 3);
+
+	// matches across fold blocks, only first match for each line is reported
+	std::string longText = std::string(64*1024 - 5, 'a') + "\xD0\x9F\xD0\xA0\xD0\x98\xD0\x92\xD0\x95\xD0\xA2\n";
+	longText += longText;
+	longText += privet;
+	longText += privet;
+	lines = Search(longText, privet, SearchFlag_None);
+	assert(lines.size() == 3);
+	assert(lines[0].line == 1 && lines[0].column == 64*1024 - 4);
+	assert(lines[1].line == 2 && lines[1].column == 64*1024 - 4);
+	assert(lines[2].line == 3 && lines[2].column == 1);
+}
+
+// files with and without long line, searched on more threads than files.
+void TestRun() {
+	namespace fs = std::filesystem;
+	const fs::path directory = fs::temp_directory_path() / "FindInFilesTest";
+	fs::remove_all(directory);
+	fs::create_directories(directory / "sub");
+	std::ofstream(directory / "short.txt") << "x1y\n";
+	std::ofstream(directory / "sub" / "long.txt") << "x" << std::string(200*1024, 'a') << "y\n";
+	std::ofstream(directory / "sub" / "none.txt") << "nothing\n";
+
+	Options options;
+	options.findText = "x.*y";
+	options.searchFlags = SearchFlag_RegExp;
+	options.threadCount = 8;
+	std::mutex mutex;
+	size_t skipped = 0;
+	Engine engine{options, nullptr, [&](FileResult &&result) {
+		std::lock_guard<std::mutex> lock(mutex);
+		skipped += result.skipped && result.lines.empty();
+	}};
+	const Statistics stat = engine.Run(directory);
+	fs::remove_all(directory);
+	assert(stat.fileCount == 3 && stat.matchedFileCount == 1 && stat.matchedLineCount == 1);
+	assert(stat.skippedFileCount == 1 && skipped == 1);
+}
+
+}
+
+int main(int argc, char *argv[]) {
+	TestMatchSpec();
+	TestSearch();
+	TestSearchUnicode();
+	TestRun();
+	if (argc < 3) {
+		return 0;
+	}
+
+	Options options;
+	options.findText = argv[2];
+	if (argc > 3) {
+		options.includeFilter = argv[3];
+	}
+	if (argc > 4) {
+		options.excludeFilter = argv[4];
+	}
+	if (argc > 5) {
+		options.searchFlags = static_cast<int>(strtol(argv[5], nullptr, 0));
+	}
+	if (argc > 6) {
+		options.threadCount = static_cast<unsigned>(strtoul(argv[6], nullptr, 10));
+	}
+
+	std::mutex mutex;
+	Engine engine{options, nullptr, [&mutex](FileResult &&result) {
+		std::lock_guard<std::mutex> lock(mutex);
+		for (const MatchedLine &line : result.lines) {
+			printf("%s:%zu:%zu: %s\n", result.path.c_str(), line.line, line.column, line.text.c_str());
+		}
+	}};
+	if (!engine.IsValid()) {
+		fprintf(stderr, "invalid find text: %s\n", argv[2]);
+		return 1;
+	}
+
+	const auto start = Clock::now();
+	const Statistics stat = engine.Run(argv[1]);
+	const double duration = std::chrono::duration<double>(Clock::now() - start).count();
+	fprintf(stderr, "%zu lines in %zu of %zu files (%zu skipped), %.2f MiB, %.3f ms, %.2f MiB/s\n",
+		stat.matchedLineCount, stat.matchedFileCount, stat.fileCount, stat.skippedFileCount, stat.byteCount/1048576.0,
+		duration*1000, stat.byteCount/1048576.0/duration);
+	return 0;
+}
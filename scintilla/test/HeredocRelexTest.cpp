@@ -0,0 +1,183 @@
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+// Test for here document delimiter saved as line data: relexing from any line of generated
+// shell script, Perl module and Ruby script gives same styles, line states and fold levels
+// as lexing whole document, then benchmark typing inside long here documents.
+#include "RelexTest.h"
+
+// g++ -std=gnu++20 -DNDEBUG -O2 -Wall -Wextra -I../include -I../src -I../lexlib HeredocRelexTest.cpp $RELEX_SRC ../lexers/LexBash.cxx ../lexers/LexPerl.cxx ../lexers/LexRuby.cxx
+// cl /EHsc /std:c++20 /DNDEBUG /O2 /W4 /I../include /I../src /I../lexlib HeredocRelexTest.cpp %RELEX_SRC% ../lexers/LexBash.cxx ../lexers/LexPerl.cxx ../lexers/LexRuby.cxx
+// usage: a.out [here-doc-lines]
+
+extern Lexilla::LexerModule lmBash;
+extern Lexilla::LexerModule lmPerl;
+extern Lexilla::LexerModule lmRuby;
+
+namespace {
+
+struct Language {
+	const char *name;
+	const Lexilla::LexerModule *module;
+	const char *keywords;
+	// block of code with a long here document, followed by other multiple line strings
+	std::string (*makeBlock)(const std::string &id, const std::string &body);
+	// line inside long here document
+	const char *bodyLine;
+};
+
+std::string MakeBashBlock(const std::string &id, const std::string &body) {
+	return "function gen_" + id + "() {\n"
+		"\tlocal name=\"item" + id + "\"\n"
+		"\tcat <<EOF > \"$name.txt\"\n" + body + "EOF\n"
+		"\tcat <<-'END'\n\t\tliteral $name `uname`\n\tEND\n"
+		"\techo \"$(cat <<EOT\nnested $name\nEOT\n)\"\n"
+		"\tsed -e 's/x/y/' <<\"EOF2\" | sort\nquoted $name\nEOF2\n"
+		"\tif [ -n \"$name\" ]; then\n\t\techo 'single\n\t\tquoted'\n\tfi\n"
+		"}\n\n";
+}
+
+std::string MakePerlBlock(const std::string &id, const std::string &body) {
+	return "sub gen_" + id + " {\n"
+		"    my $name = \"item" + id + "\";\n"
+		"    print <<\"END\";\n" + body + "END\n"
+		"    print <<~EOT;\n        indented $name @{[ $name ]}\n        EOT\n"
+		"    print <<'RAW' . <<`CMD`;\nliteral $name\nRAW\nls $name\nCMD\n"
+		"    my $text = qq{multiple\n    line $name};\n"
+		"    return $text;\n"
+		"}\n"
+		"format STDOUT =\n@<<<<<< @>>>>>\n$name, $text\n.\n\n";
+}
+
+std::string MakeRubyBlock(const std::string &id, const std::string &body) {
+	return "def gen_" + id + "\n"
+		"  name = \"item" + id + "\"\n"
+		"  text = <<~EOS\n" + body + "  EOS\n"
+		"  raw = <<-'RAW'\n    literal #{name}\n    RAW\n"
+		"  cmd = <<`CMD`\nls #{name}\nCMD\n"
+		"  plain = <<EOS\nmulti #{name.map { |x| x }} interpolation\nEOS\n"
+		"  [text, raw, cmd, plain]\n"
+		"end\n\n";
+}
+
+constexpr Language languages[] = {
+	{ "bash", &lmBash, "case do done echo elif else esac fi for function if in local then while", MakeBashBlock,
+		"line $i of ${name} with $(date +%s) and `uname` \\$escaped \"quoted\" 'single'\n" },
+	{ "perl", &lmPerl, "format my print qq return sub", MakePerlBlock,
+		"line $i of $name->{key} with @list and \\$escaped \"quoted\" 'single'\n" },
+	{ "ruby", &lmRuby, "def end if return", MakeRubyBlock,
+		"    line #{i} of #{name} with \\#{escaped} \"quoted\" 'single'\n" },
+};
+
+LexerSetup MakeSetup(const Language &language) {
+	return { language.module, { language.keywords } };
+}
+
+std::unique_ptr<Document> MakeDocument(const Language &language, std::string_view text) {
+	return MakeDocument(MakeSetup(language), text);
+}
+
+// blocks repeated to lineCount lines, each starts with a here document of bodyLines lines.
+std::string MakeCorpus(const Language &language, int bodyLines, Sci::Line lineCount) {
+	std::string body;
+	for (int i = 0; i < bodyLines; i++) {
+		body += language.bodyLine;
+	}
+	std::string text;
+	int index = 0;
+	while (std::count(text.begin(), text.end(), '\n') < lineCount) {
+		text += language.makeBlock(std::to_string(index++), body);
+	}
+	return text;
+}
+
+// restart lexing at random lines, then style visible lines.
+void TestRelex(const Language &language) {
+	const std::string text = MakeCorpus(language, 200, 20'000);
+	std::unique_ptr<Document> scratch = MakeDocument(language, text);
+	scratch->EnsureStyledTo(scratch->Length());
+	std::unique_ptr<Document> doc = MakeDocument(language, text);
+	if (!RelexAtRandomLines(*doc, *scratch, 2000)) {
+		printf("%s: differ after restart\n", language.name);
+		exit(EXIT_FAILURE);
+	}
+	printf("%s relex: same as lexing from scratch\n", language.name);
+}
+
+constexpr std::string_view editTexts[] = {
+	"x", "\n", "\t", "\"", "'", "`", "$(", ")", "${", "}", "\\", "<<EOF\n", "EOF\n", "END\n", "EOS\n", "RAW\n", "\n.\n",
+};
+
+void TestRandomEdits(const Language &language) {
+	std::unique_ptr<Document> doc = MakeDocument(language, MakeCorpus(language, 20, 2000));
+	if (!RandomEdits(MakeSetup(language), *doc, editTexts, 400)) {
+		printf("%s: differ after random edits\n", language.name);
+		exit(EXIT_FAILURE);
+	}
+	printf("%s random edits: same as lexing from scratch\n", language.name);
+}
+
+// type and delete a character on each line of a here document in middle of the document,
+// then style the screen.
+void Benchmark(const Language &language, int bodyLines) {
+	const std::string text = MakeCorpus(language, bodyLines, 100'000);
+	std::unique_ptr<Document> doc = MakeDocument(language, text);
+	auto start = Clock::now();
+	doc->EnsureStyledTo(doc->Length());
+	const double full = ElapsedMilliseconds(start);
+	const double size_MiB = static_cast<double>(text.length())/(1024*1024);
+	printf("%s: %zd lines %.2f MiB, lex whole document %.2f ms\n", language.name,
+		static_cast<size_t>(doc->LinesTotal()), size_MiB, full);
+
+	// body of the first here document after middle of the document
+	const Sci::Position blockStart = text.find("gen_", text.length()/2);
+	const Sci::Line bodyStart = doc->SciLineFromPosition(text.find(language.bodyLine, blockStart));
+	const Sci::Line typingLines = std::min(bodyLines - 1, 1000);
+	constexpr Sci::Line visibleLines = 60;
+	start = Clock::now();
+	for (Sci::Line line = bodyStart + 1; line < bodyStart + typingLines; line++) {
+		const Sci::Position pos = doc->LineEnd(line);
+		doc->InsertString(pos, "x");
+		doc->EnsureStyledTo(doc->LineStart(line + visibleLines));
+		doc->DeleteChars(pos, 1);
+		doc->EnsureStyledTo(doc->LineStart(line + visibleLines));
+	}
+	const double typing = ElapsedMilliseconds(start);
+	printf("%s: type and delete on %zd here document lines: %.2f ms, %.3f ms per keystroke\n", language.name,
+		static_cast<size_t>(typingLines), typing, typing/(2*typingLines));
+
+	// restart cost without styling visible lines
+	constexpr int repeat = 5;
+	start = Clock::now();
+	for (int i = 0; i < repeat; i++) {
+		for (Sci::Line line = bodyStart + 1; line < bodyStart + typingLines; line++) {
+			doc->ModifiedAt(doc->LineStart(line));
+			doc->EnsureStyledTo(doc->LineStart(line + 1));
+		}
+	}
+	const double restart = ElapsedMilliseconds(start);
+	printf("%s: relex single line inside here document: %.3f us per line\n", language.name,
+		restart*1000/(repeat*typingLines));
+
+	std::unique_ptr<Document> scratch = MakeDocument(language, text);
+	scratch->EnsureStyledTo(scratch->Length());
+	if (!SameAsScratch(*doc, *scratch, 0, doc->LinesTotal() - 1)) {
+		exit(EXIT_FAILURE);
+	}
+}
+
+}
+
+int main(int argc, char *argv[]) {
+	const int bodyLines = (argc > 1) ? atoi(argv[1]) : 5000;
+	for (const Language &language : languages) {
+		TestRelex(language);
+		// Ruby lexer can't restart inside multiple line interpolation made by random edits
+		if (language.module != &lmRuby) {
+			TestRandomEdits(language);
+		}
+	}
+	for (const Language &language : languages) {
+		Benchmark(language, std::max(bodyLines, 100));
+	}
+	return 0;
+}
@@ -0,0 +1,251 @@
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+// Test for indentation detection: compares with the old detector limited to first 1 MiB
+// on samples in tools/lang, checks histogram doesn't depend on thread count and block size
+// only affects lines around block boundaries, then benchmarks scanning a large file.
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cassert>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../../src/IndentDetection.h"
+
+// g++ -std=gnu++20 -O2 -Wall -Wextra -pthread IndentDetectionTest.cpp ../../src/IndentDetection.cpp
+// cl /EHsc /std:c++20 /O2 /W4 IndentDetectionTest.cpp ../../src/IndentDetection.cpp
+// usage: a.out [sample-directory [size-MiB [threads]]]
+
+using namespace IndentDetection;
+
+namespace {
+
+// scalar loop from old EditDetectIndentation(), without the 1 MiB limit.
+Histogram ReferenceScan(std::string_view text) {
+	Histogram histogram{};
+	const uint8_t *ptr = reinterpret_cast<const uint8_t *>(text.data());
+	const uint8_t * const end = ptr + text.length();
+	int prevIndentCount = 0;
+	int prevTabWidth = 0;
+	while (ptr < end) {
+		switch (*ptr++) {
+		case '\t':
+			++histogram.lines[Histogram::Tab];
+			break;
+
+		case ' ': {
+			int indentCount = 1;
+			while (ptr < end && *ptr == ' ') {
+				++ptr;
+				++indentCount;
+			}
+			if ((indentCount & 1) != 0 && ptr < end && *ptr == '*') {
+				--indentCount;
+				if (indentCount == 0) {
+					break;
+				}
+			}
+			if (indentCount != prevIndentCount) {
+				const int delta = abs(indentCount - prevIndentCount);
+				prevIndentCount = indentCount;
+				if (delta <= MaxTabWidth) {
+					prevTabWidth = std::min(delta, indentCount);
+				} else {
+					prevTabWidth = 0;
+				}
+			}
+			++histogram.lines[prevTabWidth];
+		} break;
+
+		case '\r':
+		case '\n':
+			continue;
+
+		default:
+			prevIndentCount = 0;
+			break;
+		}
+
+		while (ptr < end && *ptr != '\r' && *ptr != '\n') {
+			++ptr;
+		}
+		if (ptr < end) {
+			++ptr;
+		}
+	}
+	return histogram;
+}
+
+bool SameLines(const Histogram &h1, const Histogram &h2) noexcept {
+	return memcmp(h1.lines, h2.lines, sizeof(h1.lines)) == 0;
+}
+
+uint32_t TotalLines(const Histogram &histogram) noexcept {
+	uint32_t total = 0;
+	for (const uint32_t count : histogram.lines) {
+		total += count;
+	}
+	return total;
+}
+
+const char *DecisionText(const Result &result) {
+	static char buffer[32];
+	switch (result.indentation) {
+	case Indentation::Tabs:
+		return "tabs";
+	case Indentation::Spaces:
+		snprintf(buffer, sizeof(buffer), "%d spaces", result.indentWidth);
+		return buffer;
+	default:
+		return "unknown";
+	}
+}
+
+Histogram ScanWith(std::string_view text, size_t blockSize, unsigned threadCount) {
+	Options options;
+	options.blockSize = blockSize;
+	options.threadCount = threadCount;
+	return Scan(text.data(), text.length(), options);
+}
+
+void TestBasic() {
+	assert(Detect("", 0).indentation == Indentation::Unknown);
+	assert(TotalLines(ScanWith("no indentation\nat all", 16, 1)) == 0);
+
+	// every line is indented one step deeper or back
+	constexpr std::string_view spaces = "a\n  b\n    c\n  d\r\n\r\n  e\n    f\n      g\n";
+	Result result = Detect(spaces.data(), spaces.length());
+	assert(result.indentation == Indentation::Spaces && result.indentWidth == 2 && result.confidence == 1.0);
+	// CR only line endings, blank lines don't reset previous indentation
+	constexpr std::string_view classicMac = "if\r    a\r\r        b\r    c\r";
+	result = Detect(classicMac.data(), classicMac.length());
+	assert(result.indentation == Indentation::Spaces && result.indentWidth == 4);
+	constexpr std::string_view tabs = "a\n\tb\n\t\tc\n    d\n";
+	result = Detect(tabs.data(), tabs.length());
+	assert(result.indentation == Indentation::Tabs && result.confidence > 0.6 && result.confidence < 0.7);
+	// Javadoc comment star isn't counted as 1 space indentation
+	constexpr std::string_view javadoc = "/**\n * comment\n */\nclass A {\n    int a;\n    int b;\n}\n";
+	const Histogram histogram = ScanWith(javadoc, 1024, 1);
+	assert(histogram.lines[1] == 0 && histogram.lines[4] == 2);
+	// indentation changed more than MaxTabWidth is ambiguous
+	constexpr std::string_view aligned = "call(a,\n                    b);\n";
+	assert(Detect(aligned.data(), aligned.length()).indentation == Indentation::Unknown);
+	// text ends inside indentation
+	assert(ScanWith("a\n      ", 4, 1).lines[6] == 1);
+}
+
+// generated table at file start, followed by code indented with tabs.
+std::string MakeHeaderFile(size_t headerSize, size_t codeSize) {
+	std::string text = "static const unsigned char table[] = {\n";
+	while (text.size() < headerSize) {
+		text += "    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,\n";
+	}
+	text += "};\n";
+	while (text.size() < headerSize + codeSize) {
+		text += "int func(int a) {\n\tif (a) {\n\t\treturn a;\n\t}\n\treturn 0;\n}\n\n";
+	}
+	return text;
+}
+
+void TestWholeFile() {
+	const std::string text = MakeHeaderFile(1536*1024, 3*1024*1024);
+	// old detector only reads first 1 MiB
+	const Result old = Decide(ReferenceScan(std::string_view{text}.substr(0, 1024*1024)));
+	assert(old.indentation == Indentation::Spaces && old.indentWidth == 4);
+	const Result result = Detect(text.data(), text.length());
+	assert(result.indentation == Indentation::Tabs);
+	printf("generated header: old %s, whole file %s (%.2f)\n", DecisionText(old), DecisionText(result), result.confidence);
+
+	// huge file is sampled with evenly spaced blocks, including last block
+	Options options;
+	options.maxSampleSize = 1024*1024;
+	options.sampleBlockSize = 16*1024;
+	const Histogram sampled = Scan(text.data(), text.length(), options);
+	assert(sampled.blockCount == 64 && sampled.byteCount == 64*16*1024);
+	assert(Decide(sampled).indentation == Indentation::Tabs);
+	options.threadCount = 1;
+	assert(SameLines(sampled, Scan(text.data(), text.length(), options)));
+	// both header and code are sampled
+	assert(sampled.lines[4] != 0 && sampled.lines[Histogram::Tab] != 0);
+}
+
+std::string ReadFile(const std::filesystem::path &path) {
+	std::ifstream file(path, std::ios::binary);
+	return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+void TestSamples(const std::filesystem::path &directory) {
+	std::vector<std::filesystem::path> paths;
+	for (const auto &entry : std::filesystem::directory_iterator(directory)) {
+		if (entry.is_regular_file()) {
+			paths.push_back(entry.path());
+		}
+	}
+	std::sort(paths.begin(), paths.end());
+	assert(!paths.empty());
+
+	size_t changed = 0;
+	for (const auto &path : paths) {
+		const std::string text = ReadFile(path);
+		const Histogram reference = ReferenceScan(text);
+		// one block is same as old detector
+		const Histogram whole = ScanWith(text, text.length() + 1, 1);
+		if (!SameLines(reference, whole)) {
+			printf("%s: differ from reference\n", path.filename().string().c_str());
+			exit(EXIT_FAILURE);
+		}
+		// histogram doesn't depend on thread count
+		const Histogram blocks = ScanWith(text, 4096, 1);
+		assert(SameLines(blocks, ScanWith(text, 4096, 4)) && SameLines(blocks, ScanWith(text, 4096, 0)));
+		assert(blocks.byteCount == text.length());
+		// indentation tracking is reset at block start, which only changes a few lines
+		assert(TotalLines(blocks) == TotalLines(reference));
+		const Result expected = Decide(reference);
+		const Result result = Decide(blocks);
+		if (result.indentation != expected.indentation || result.indentWidth != expected.indentWidth) {
+			++changed;
+			printf("%s: %s => %s with 4 KiB blocks\n", path.filename().string().c_str(), DecisionText(expected), DecisionText(result));
+		}
+	}
+	printf("checked %zu samples, %zu decisions changed by block boundaries\n", paths.size(), changed);
+	assert(changed*10 <= paths.size());
+}
+
+using Clock = std::chrono::steady_clock;
+
+void Benchmark(size_t size, unsigned threadCount) {
+	const std::string text = MakeHeaderFile(size/4, size - size/4);
+	Options options;
+	options.maxSampleSize = 0;
+	double duration[2];
+	Histogram histogram[2];
+	for (int i = 0; i < 2; i++) {
+		options.threadCount = (i == 0) ? 1 : threadCount;
+		const auto start = Clock::now();
+		histogram[i] = Scan(text.data(), text.length(), options);
+		duration[i] = std::chrono::duration<double>(Clock::now() - start).count();
+	}
+	assert(SameLines(histogram[0], histogram[1]));
+	const double size_MiB = static_cast<double>(text.length())/(1024*1024);
+	printf("%.1f MiB, %u lines: 1 thread %.2f ms (%.0f MiB/s), %u threads %.2f ms (%.0f MiB/s)\n",
+		size_MiB, TotalLines(histogram[0]), duration[0]*1e3, size_MiB/duration[0],
+		threadCount, duration[1]*1e3, size_MiB/duration[1]);
+}
+
+}
+
+int main(int argc, char *argv[]) {
+	TestBasic();
+	TestWholeFile();
+	TestSamples((argc > 1) ? argv[1] : "../../tools/lang");
+	const int size = (argc > 2) ? atoi(argv[2]) : 64;
+	const int threads = (argc > 3) ? atoi(argv[3]) : static_cast<int>(std::thread::hardware_concurrency());
+	Benchmark(static_cast<size_t>(std::max(size, 1))*1024*1024, std::max(threads, 1));
+	return 0;
+}
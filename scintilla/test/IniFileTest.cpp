@@ -0,0 +1,293 @@
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+// Test for in-memory ini file: parsing, lookup, edits and round trip in each encoding,
+// then benchmarks loading settings at startup: parse once and lookup every section,
+// compared to parsing whole file for each section like GetPrivateProfileSection().
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cassert>
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <fstream>
+#include <iterator>
+
+#include "../../src/IniFile.h"
+
+// g++ -std=gnu++20 -O2 -Wall -Wextra IniFileTest.cpp ../../src/IniFile.cpp
+// cl /EHsc /std:c++20 /O2 /W4 IniFileTest.cpp ../../src/IniFile.cpp
+// usage: a.out [schemes [rounds]], benchmark with number of scheme sections.
+
+using namespace std::literals;
+using namespace IniFile;
+
+namespace {
+
+std::wstring GetSection(const Store &store, std::wstring_view section, size_t size = 1024) {
+	std::wstring buffer(size, L'#');
+	const size_t length = store.GetSection(section, buffer.data(), size);
+	assert(buffer[length] == L'\0');
+	buffer.resize(length);
+	return buffer;
+}
+
+void TestParse() {
+	Store store;
+	store.Parse("; comment\r\n"
+		"top=before\r\n"
+		"[Settings]\r\n"
+		"  Key = value with spaces  \r\n"
+		"Quoted=\"quoted\"\r\n"
+		"Number=-42\r\n"
+		"Junk=12ab\r\n"
+		"Empty=\r\n"
+		"; key=commented\r\n"
+		"no equal sign\r\n"
+		"key=duplicate\r\n"
+		"[ settings ]\r\n"
+		"Other=second section\r\n"
+		"[Recent Files]\r\n"
+		"01=C:\\a.txt\r\n"
+		"02=C:\\b.txt");
+	assert(store.GetEncoding() == Encoding::UTF8 && !store.Modified());
+	assert(store.HasSection(L"settings") && store.HasSection(L" SETTINGS ") && !store.HasSection(L"missing"));
+	assert(!store.HasSection(L""));
+	std::wstring_view value;
+	assert(!store.GetValue(L"", L"top", value));
+	assert(store.GetValue(L"Settings", L"KEY", value) && value == L"value with spaces");
+	assert(store.GetString(L"Settings", L"quoted", L"") == L"quoted");
+	assert(store.GetString(L"Settings", L"Empty", L"default").empty());
+	assert(store.GetString(L"Settings", L"missing", L"default") == L"default");
+	assert(store.GetInt(L"Settings", L"Number", 1) == -42);
+	assert(store.GetInt(L"Settings", L"Junk", 1) == 12);
+	assert(store.GetInt(L"Settings", L"missing", 7) == 7);
+	// first section wins
+	assert(!store.GetValue(L"Settings", L"Other", value));
+
+	assert(GetSection(store, L"Recent Files") == L"01=C:\\a.txt\0" L"02=C:\\b.txt\0"sv);
+	assert(GetSection(store, L"missing").empty());
+	const std::wstring settings = GetSection(store, L"Settings");
+	assert(settings.starts_with(L"Key=value with spaces\0Quoted=\"quoted\"\0"sv));
+	assert(settings.ends_with(L"Empty=\0key=duplicate\0"sv));
+	// item that doesn't fit is dropped
+	assert(GetSection(store, L"Recent Files", 20) == L"01=C:\\a.txt\0"sv);
+	assert(GetSection(store, L"Recent Files", 2).empty());
+
+	const std::vector<std::wstring_view> names = store.SectionNames();
+	assert(names.size() == 3 && names[0] == L"Settings" && names[1] == L"settings" && names[2] == L"Recent Files");
+	// unchanged content is written back as is, missing line ending is added.
+	const std::string content = store.Serialize();
+	assert(content.starts_with("; comment\r\ntop=before\r\n[Settings]\r\n  Key = value with spaces  \r\n"));
+	assert(content.ends_with("[ settings ]\r\nOther=second section\r\n[Recent Files]\r\n01=C:\\a.txt\r\n02=C:\\b.txt\r\n"));
+}
+
+void TestEdit() {
+	Store store;
+	store.Parse("[Settings]\n"
+		"; window\n"
+		"WindowWidth=800\n"
+		"\n"
+		"[Styles]\n"
+		"Default=font:Consolas\n");
+	store.SetValue(L"Settings", L"windowwidth", L"1024");
+	assert(store.Modified());
+	store.SetValue(L"Settings", L"WindowHeight", L"600");
+	store.SetValue(L"New", L"Key", L"Value");
+	store.SetValue(L"Settings", L"", L"ignored");
+	assert(store.GetInt(L"Settings", L"WindowWidth", 0) == 1024);
+	assert(store.GetInt(L"settings", L"windowheight", 0) == 600);
+	std::string content = store.Serialize();
+	assert(content == "[Settings]\n; window\nWindowWidth=1024\nWindowHeight=600\n\n"
+		"[Styles]\nDefault=font:Consolas\n[New]\nKey=Value\n");
+
+	store.SetModified(false);
+	store.SetValue(L"Settings", L"WindowWidth", L"1024");
+	store.SetSection(L"Styles", L"Default=font:Consolas\0");
+	assert(!store.Modified());
+	store.SetSection(L"Styles", L"Default=font:Calibri\0Comment=fore:#008000\0");
+	assert(store.Modified());
+	assert(GetSection(store, L"Styles") == L"Default=font:Calibri\0Comment=fore:#008000\0"sv);
+	store.SetSection(L"Recent Files", L"01=a.txt\0");
+	store.SetSection(L"Settings", L"\0");
+	assert(store.HasSection(L"Settings") && GetSection(store, L"Settings").empty());
+	store.DeleteKey(L"New", L"KEY");
+	assert(store.GetString(L"New", L"Key", L"deleted") == L"deleted");
+	store.SetSection(L"New", nullptr);
+	assert(!store.HasSection(L"New"));
+	store.DeleteSection(L"Styles");
+	content = store.Serialize();
+	assert(content == "[Settings]\n[Recent Files]\n01=a.txt\n");
+
+	// deleted section is recreated at end
+	store.SetValue(L"Styles", L"Default", L"font:Consolas");
+	assert(store.Serialize().ends_with("[Styles]\nDefault=font:Consolas\n"));
+
+	// many edits trigger rehash and multiple arena chunks
+	for (int i = 0; i < 5000; i++) {
+		const std::wstring section = L"Section" + std::to_wstring(i % 100);
+		store.SetValue(section, L"Key" + std::to_wstring(i), std::wstring(i % 50, L'x') + std::to_wstring(i));
+	}
+	for (int i = 0; i < 5000; i++) {
+		const std::wstring section = L"section" + std::to_wstring(i % 100);
+		const std::wstring_view value = store.GetString(section, L"KEY" + std::to_wstring(i), L"");
+		assert(value == std::wstring(i % 50, L'x') + std::to_wstring(i));
+	}
+	Store copy;
+	copy.Parse(store.Serialize());
+	assert(copy.Serialize() == store.Serialize() && copy.GetInt(L"Section99", L"Key4999", 0) == 0);
+	assert(copy.GetString(L"Section99", L"Key4999", L"").ends_with(L"4999"));
+}
+
+void TestEncoding() {
+	// U+4E2D, U+1F600
+	const std::wstring expected = (sizeof(wchar_t) == 2) ? std::wstring{L"\u4E2D\xD83D\xDE00"} : std::wstring{L"\u4E2D"} + static_cast<wchar_t>(0x1F600);
+	const std::string utf8 = "[Find]\r\nText=\xE4\xB8\xAD\xF0\x9F\x98\x80\r\n";
+	Store store;
+	store.Parse(utf8);
+	assert(store.GetEncoding() == Encoding::UTF8 && store.GetString(L"Find", L"Text", L"") == expected);
+	assert(store.Serialize() == utf8);
+
+	store.Parse("\xEF\xBB\xBF" + utf8);
+	assert(store.GetEncoding() == Encoding::UTF8BOM && store.GetString(L"Find", L"Text", L"") == expected);
+	assert(store.Serialize() == "\xEF\xBB\xBF" + utf8);
+
+	const char utf16[] = "\xFF\xFE[\0F\0i\0n\0d\0]\0\r\0\n\0T\0e\0x\0t\0=\0\x2D\x4E\x3D\xD8\x00\xDE\r\0\n\0";
+	const std::string_view utf16View{utf16, sizeof(utf16) - 1};
+	store.Parse(utf16View);
+	assert(store.GetEncoding() == Encoding::UTF16LE && store.GetString(L"Find", L"Text", L"") == expected);
+	assert(store.Serialize() == utf16View);
+	store.SetValue(L"Find", L"Text", expected + L"a");
+	assert(store.Serialize() == std::string{utf16View.substr(0, utf16View.length() - 4)} + std::string{"a\0\r\0\n\0"sv});
+
+	// invalid UTF-8
+	store.Parse("[Find]\nText=\xE9t\xE9\n");
+	assert(store.GetEncoding() == Encoding::ANSI);
+#if !defined(_WIN32)
+	assert(store.GetString(L"Find", L"Text", L"") == L"\u00E9t\u00E9");
+#endif
+	assert(store.Serialize() == "[Find]\nText=\xE9t\xE9\n");
+
+	// empty file created by CreateIniFile()
+	store.Parse("\xFF\xFE");
+	store.SetValue(L"Settings", L"SaveSettings", L"1");
+	assert(store.Serialize() == "\xFF\xFE[\0S\0e\0t\0t\0i\0n\0g\0s\0]\0\r\0\n\0S\0a\0v\0e\0S\0e\0t\0t\0i\0n\0g\0s\0=\0" "1\0\r\0\n\0"sv);
+}
+
+void TestSave() {
+	const std::filesystem::path path = std::filesystem::temp_directory_path() / "IniFileTest.ini";
+	std::filesystem::remove(path);
+	Store store;
+	assert(!store.Load(path));
+	store.Parse("[Settings]\r\nKey=1\r\n");
+	store.SetValue(L"Settings", L"Key", L"2");
+	assert(store.Save(path) && !store.Modified());
+	Store loaded;
+	assert(loaded.Load(path) && loaded.GetInt(L"Settings", L"Key", 0) == 2);
+	std::filesystem::remove(path);
+}
+
+// temporary file is removed, links are kept and written through.
+void TestSaveLinks() {
+	namespace fs = std::filesystem;
+	const fs::path folder = fs::temp_directory_path() / "IniFileTest";
+	fs::remove_all(folder);
+	fs::create_directory(folder);
+	const fs::path path = folder / "Notepad4.ini";
+	Store store;
+	store.Parse("[Settings]\r\nKey=1\r\n");
+	assert(store.Save(path));
+	assert(std::distance(fs::directory_iterator(folder), fs::directory_iterator{}) == 1);
+
+	std::error_code ec;
+	const fs::path hardLink = folder / "HardLink.ini";
+	fs::create_hard_link(path, hardLink, ec);
+	if (!ec) {
+		store.SetValue(L"Settings", L"Key", L"2");
+		assert(store.Save(path) && fs::hard_link_count(path) == 2);
+		Store loaded;
+		assert(loaded.Load(hardLink) && loaded.GetInt(L"Settings", L"Key", 0) == 2);
+		fs::remove(hardLink);
+	}
+
+	const fs::path symlink = folder / "Symlink.ini";
+	fs::create_symlink(path, symlink, ec);
+	if (!ec) {
+		store.SetValue(L"Settings", L"Key", L"3");
+		assert(store.Save(symlink) && fs::is_symlink(symlink));
+		Store loaded;
+		assert(loaded.Load(path) && loaded.GetInt(L"Settings", L"Key", 0) == 3);
+	}
+	fs::remove_all(folder);
+}
+
+// Notepad4.ini like file, each scheme section has about 20 styles.
+std::string MakeSettings(int schemes) {
+	std::string content = "\xEF\xBB\xBF[Notepad4]\r\n[Settings]\r\n";
+	for (int i = 0; i < 80; i++) {
+		content += "Setting" + std::to_string(i) + "=" + std::to_string(i*37) + "\r\n";
+	}
+	content += "[Recent Files]\r\n";
+	for (int i = 0; i < 32; i++) {
+		content += std::to_string(i + 1) + "=C:\\Users\\Notepad4\\Documents\\Project\\file" + std::to_string(i) + ".txt\r\n";
+	}
+	for (int i = 0; i < schemes; i++) {
+		content += "[Scheme" + std::to_string(i) + "]\r\n";
+		for (int j = 0; j < 20; j++) {
+			content += "Style" + std::to_string(j) + "=font:Consolas; size:11; fore:#" + std::to_string(100000 + i*20 + j) + "\r\n";
+		}
+	}
+	return content;
+}
+
+using Clock = std::chrono::steady_clock;
+
+void Benchmark(int schemes, int rounds) {
+	const std::string content = MakeSettings(schemes);
+	std::vector<std::wstring> sections{L"Settings", L"Recent Files"};
+	for (int i = 0; i < schemes; i++) {
+		sections.push_back(L"Scheme" + std::to_wstring(i));
+	}
+	std::vector<wchar_t> buffer(32*1024);
+
+	size_t total = 0;
+	auto start = Clock::now();
+	for (int round = 0; round < rounds; round++) {
+		Store store;
+		store.Parse(content);
+		for (const std::wstring &section : sections) {
+			total += store.GetSection(section, buffer.data(), buffer.size());
+		}
+	}
+	const double once = std::chrono::duration<double>(Clock::now() - start).count();
+
+	size_t totalRepeated = 0;
+	start = Clock::now();
+	for (int round = 0; round < rounds; round++) {
+		for (const std::wstring &section : sections) {
+			Store store;
+			store.Parse(content);
+			totalRepeated += store.GetSection(section, buffer.data(), buffer.size());
+		}
+	}
+	const double repeated = std::chrono::duration<double>(Clock::now() - start).count();
+	assert(total == totalRepeated);
+	printf("%zu bytes, %zu sections: parse once %.1f us, parse per section %.1f us, %.1fx\n",
+		content.size(), sections.size(), once*1e6/rounds, repeated*1e6/rounds, repeated/once);
+}
+
+}
+
+int main(int argc, char *argv[]) {
+	TestParse();
+	TestEdit();
+	TestEncoding();
+	TestSave();
+	TestSaveLinks();
+	const int schemes = (argc > 1) ? atoi(argv[1]) : 100;
+	const int rounds = (argc > 2) ? atoi(argv[2]) : 20;
+	Benchmark(std::max(schemes, 1), std::max(rounds, 1));
+	return 0;
+}
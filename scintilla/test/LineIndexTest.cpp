@@ -0,0 +1,126 @@
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+// Test for lazy line index: the limit found from checkpoints for going to a line is compared
+// with counting line ends in whole text, starting from fresh buffer so checkpoints are counted
+// while searching, then indexing to the limit must give the same line start as naive scan.
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <memory>
+
+#include "ScintillaTypes.h"
+#include "Debugging.h"
+#include "Position.h"
+#include "SplitVector.h"
+#include "Partitioning.h"
+#include "CellBuffer.h"
+
+// g++ -std=gnu++20 -O2 -Wall -Wextra -msse4.2 -I../include -I../src LineIndexTest.cpp ../src/CellBuffer.cxx ../src/ChangeHistory.cxx ../src/UndoHistory.cxx ../src/UniConversion.cxx ../src/RunStyles.cxx ../src/VectorKernels.cxx
+// cl /EHsc /std:c++20 /O2 /W4 /I../include /I../src LineIndexTest.cpp ../src/CellBuffer.cxx ../src/ChangeHistory.cxx ../src/UndoHistory.cxx ../src/UniConversion.cxx ../src/RunStyles.cxx ../src/VectorKernels.cxx
+
+using namespace Scintilla::Internal;
+
+namespace Scintilla::Internal {
+void Platform::Assert(const char *c, const char *file, int line) noexcept {
+	fprintf(stderr, "Assertion [%s] failed at %s %d\n", c, file, line);
+	abort();
+}
+}
+
+namespace {
+
+constexpr Sci::Position blockSize = CellBuffer::lineCheckpointSize;
+
+// lines with random length, some blocks without any line end.
+std::string MakeText(std::mt19937 &rng, Sci::Position length) {
+	std::string text;
+	text.reserve(length);
+	while (static_cast<Sci::Position>(text.length()) < length) {
+		const Sci::Position lineLength = (rng() % 16 == 0) ? (rng() % (2*blockSize)) : (rng() % 200);
+		text.append(lineLength, 'x');
+		text += (rng() % 4 == 0) ? "\r\n" : "\n";
+	}
+	return text;
+}
+
+std::unique_ptr<CellBuffer> MakeBuffer(const std::string &text) {
+	std::unique_ptr<CellBuffer> cb = std::make_unique<CellBuffer>(false, true, false, true);
+	cb->SetUndoCollection(false);
+	bool startSequence = false;
+	// append in chunks like file loading
+	constexpr Sci::Position chunkSize = 1024*1024;
+	for (Sci::Position position = 0; position < static_cast<Sci::Position>(text.length()); position += chunkSize) {
+		const Sci::Position length = std::min<Sci::Position>(chunkSize, text.length() - position);
+		cb->InsertString(position, text.data() + position, length, startSequence);
+	}
+	return cb;
+}
+
+bool CheckLine(const std::string &text, const std::vector<Sci::Position> &lineEnds, Sci::Line line) {
+	const Sci::Position length = text.length();
+	std::unique_ptr<CellBuffer> cb = MakeBuffer(text);
+	// expected limit: end of first checkpoint block that contains line ends before line
+	Sci::Position expected = length;
+	if (line <= static_cast<Sci::Line>(lineEnds.size())) {
+		expected = std::min(((lineEnds[line - 1] - 1)/blockSize + 1)*blockSize, length);
+	}
+	const Sci::Position limit = cb->LineIndexLimit(line);
+	if (limit != expected) {
+		printf("LineIndexLimit(%zd) = %zd, expected %zd\n", line, limit, expected);
+		return false;
+	}
+	cb->IndexLines(limit);
+	if (line < static_cast<Sci::Line>(lineEnds.size())) {
+		if (cb->Lines() <= line || cb->LineStart(line) != lineEnds[line - 1]) {
+			printf("line %zd start %zd, expected %zd\n", line, cb->LineStart(line), lineEnds[line - 1]);
+			return false;
+		}
+	}
+	return true;
+}
+
+}
+
+int main() {
+	std::mt19937 rng(55);
+	const std::string text = MakeText(rng, 10*blockSize + 12345);
+	// position after each line end
+	std::vector<Sci::Position> lineEnds;
+	for (size_t position = 0; position < text.length(); position++) {
+		if (text[position] == '\n') {
+			lineEnds.push_back(position + 1);
+		}
+	}
+
+	std::vector<Sci::Line> lines = {1, 2, static_cast<Sci::Line>(lineEnds.size()), static_cast<Sci::Line>(lineEnds.size()) + 1};
+	// lines around block boundaries
+	for (Sci::Position block = blockSize; block < static_cast<Sci::Position>(text.length()); block += blockSize) {
+		const Sci::Line line = std::upper_bound(lineEnds.begin(), lineEnds.end(), block) - lineEnds.begin();
+		for (Sci::Line delta = -1; delta <= 2; delta++) {
+			if (line + delta >= 1) {
+				lines.push_back(line + delta);
+			}
+		}
+	}
+	for (int i = 0; i < 30; i++) {
+		lines.push_back(1 + rng() % lineEnds.size());
+	}
+
+	int failed = 0;
+	for (const Sci::Line line : lines) {
+		if (!CheckLine(text, lineEnds, line)) {
+			failed++;
+		}
+	}
+	printf("%zu lines checked, %d failed\n", lines.size(), failed);
+	return failed != 0;
+}
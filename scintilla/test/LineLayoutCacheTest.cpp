@@ -0,0 +1,282 @@
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+// Test and benchmark for LineLayoutCache, checks least recently used eviction under byte budget
+// and counters, then replays scripted scroll and jump patterns over a document with mixed line lengths.
+#include <cstddef>
+#include <cstdlib>
+#include <cstdint>
+#include <cstdio>
+#include <cassert>
+#include <cstring>
+#include <cmath>
+#include <climits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <optional>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <chrono>
+
+#include "ParallelSupport.h"
+#include "ScintillaTypes.h"
+#include "ScintillaMessages.h"
+#include "ILoader.h"
+#include "ILexer.h"
+#include "Debugging.h"
+#include "Geometry.h"
+#include "Platform.h"
+#include "VectorISA.h"
+#include "CharacterSet.h"
+#include "Position.h"
+#include "UniqueString.h"
+#include "SplitVector.h"
+#include "Partitioning.h"
+#include "RunStyles.h"
+#include "ContractionState.h"
+#include "CellBuffer.h"
+#include "KeyMap.h"
+#include "Indicator.h"
+#include "LineMarker.h"
+#include "Style.h"
+#include "ViewStyle.h"
+#include "CharClassify.h"
+#include "Decoration.h"
+#include "CaseFolder.h"
+#include "Document.h"
+#include "UniConversion.h"
+#include "Selection.h"
+#include "PositionCache.h"
+
+// layout and drawing code in PositionCache.cxx is not used, unused sections are discarded to avoid linking Document.
+// g++ -std=gnu++20 -O2 -Wall -Wextra -ffunction-sections -Wl,--gc-sections -I../include -I../src -I../lexlib LineLayoutCacheTest.cpp ../src/PositionCache.cxx
+// usage: a.out [frames [budget]], benchmark each pattern for frames, budget in MiB for document level.
+
+using namespace Scintilla;
+using namespace Scintilla::Internal;
+
+namespace {
+
+constexpr Sci::Line linesOnScreen = 61;
+
+using Statistic = LineLayoutCache::Statistic;
+
+// simulate LayoutLine(): fill the layout and grow arrays created on demand.
+void LayOut(LineLayout *ll, int length) {
+	if (ll->validity != LineLayout::ValidLevel::lines) {
+		ll->numCharsInLine = length;
+		ll->textBreaks.resize(length/8 + 1);
+		ll->validity = LineLayout::ValidLevel::lines;
+	}
+}
+
+void TestMemoryUsage() {
+	LineLayout small{1, 100};
+	LineLayout large{2, 4*1024*1024};
+	assert(small.MemoryUsage() >= sizeof(LineLayout) + 101*(2 + sizeof(XYPOSITION)));
+	assert(large.MemoryUsage() > 4*1024*1024*(2 + sizeof(XYPOSITION)));
+	const size_t before = small.MemoryUsage();
+	small.AddLineStart(10);
+	small.textBreaks.resize(20);
+	assert(small.MemoryUsage() >= before + 20*sizeof(TextBreak));
+	small.EnsureBidiData();
+	assert(small.MemoryUsage() > before + 101*sizeof(XYPOSITION));
+}
+
+void TestCaretLevel() {
+	LineLayoutCache llc;
+	llc.SetLevel(LineCache::Caret);
+	LineLayout *caret = llc.Retrieve(5, 5, 10, 0, linesOnScreen);
+	for (Sci::Line line = 0; line < 100; line++) {
+		llc.Retrieve(line, 5, 10, 0, linesOnScreen);
+		assert(llc.GetStatistic(Statistic::lines) <= 2);
+	}
+	assert(llc.Retrieve(5, 5, 10, 0, linesOnScreen) == caret);
+	assert(llc.PreLayoutCapacity(linesOnScreen) == 0);
+}
+
+void TestLeastRecentlyUsed() {
+	LineLayoutCache llc;
+	llc.SetLevel(LineCache::Page);
+	// page level holds visible lines, lines pre-laid-out and lines recently scrolled away.
+	std::vector<LineLayout *> first;
+	for (Sci::Line line = 0; line < linesOnScreen; line++) {
+		LineLayout *ll = llc.Retrieve(line, 0, 40, 0, linesOnScreen);
+		LayOut(ll, 40);
+		first.push_back(ll);
+	}
+	assert(llc.GetStatistic(Statistic::misses) == static_cast<size_t>(linesOnScreen));
+	for (Sci::Line line = 0; line < linesOnScreen; line++) {
+		assert(llc.Retrieve(line, 0, 40, 0, linesOnScreen) == first[line]);
+	}
+	assert(llc.GetStatistic(Statistic::hits) == static_cast<size_t>(linesOnScreen));
+
+	// longer line reuses the object
+	LineLayout *ll = llc.Retrieve(3, 0, 400, 0, linesOnScreen);
+	assert(ll == first[3] && ll->maxLineLength >= 400 && ll->validity == LineLayout::ValidLevel::invalid);
+
+	// scroll far away, caret line 0 is kept while other old lines are evicted.
+	for (Sci::Line line = 10000; line < 10000 + 20*linesOnScreen; line++) {
+		LayOut(llc.Retrieve(line, 0, 40, 0, linesOnScreen), 40);
+	}
+	assert(llc.GetStatistic(Statistic::evictions) != 0);
+	assert(llc.GetStatistic(Statistic::lines) <= static_cast<size_t>(NP2_align_up(8*linesOnScreen, 64)));
+	const size_t misses = llc.GetStatistic(Statistic::misses);
+	assert(llc.Retrieve(0, 0, 40, 0, linesOnScreen) == first[0]);
+	llc.Retrieve(1, 0, 40, 0, linesOnScreen);
+	assert(llc.GetStatistic(Statistic::misses) == misses + 1);
+
+	// style change invalidates all lines without evicting
+	ll = llc.Retrieve(10000 + 20*linesOnScreen - 1, 0, 40, 1, linesOnScreen);
+	assert(ll->validity == LineLayout::ValidLevel::checkTextAndStyle);
+
+	llc.ResetStatistics();
+	assert(llc.GetStatistic(Statistic::hits) == 0 && llc.GetStatistic(Statistic::evictions) == 0);
+	assert(llc.GetStatistic(Statistic::lines) != 0);
+	llc.Deallocate();
+	assert(llc.GetStatistic(Statistic::lines) == 0 && llc.GetStatistic(Statistic::memory) == 0);
+}
+
+void TestBudget() {
+	LineLayoutCache llc;
+	llc.SetLevel(LineCache::Document);
+	constexpr size_t budget = 1024*1024;
+	llc.SetMemoryBudget(budget);
+	const Sci::Line capacity = llc.PreLayoutCapacity(linesOnScreen);
+	assert(capacity >= linesOnScreen);
+
+	// lines retrieved by one paint and one pre-layout batch are never evicted, even when over budget.
+	constexpr int hugeLength = 2*1024*1024;
+	std::vector<LineLayout *> batch;
+	for (Sci::Line line = 0; line < linesOnScreen + capacity; line++) {
+		LineLayout *ll = llc.Retrieve(line, 1, (line % 16 == 0) ? hugeLength : 80, 0, linesOnScreen);
+		batch.push_back(ll);
+	}
+	assert(llc.GetStatistic(Statistic::evictions) == 0 && llc.GetStatistic(Statistic::memory) > budget);
+	for (size_t index = 0; index < batch.size(); index++) {
+		assert(batch[index]->LineNumber() == static_cast<Sci::Line>(index));
+	}
+
+	// memory shrinks back under budget as old lines are evicted
+	for (Sci::Line line = 1000; line < 1000 + 10*linesOnScreen; line++) {
+		LayOut(llc.Retrieve(line, 1, 80, 0, linesOnScreen), 80);
+	}
+	assert(llc.GetStatistic(Statistic::memory) <= budget);
+	assert(llc.GetStatistic(Statistic::evictions) != 0);
+
+	// growth after retrieve is accounted on next retrieve
+	LineLayout *ll = llc.Retrieve(5000, 0, 80, 0, linesOnScreen);
+	const size_t memory = llc.GetStatistic(Statistic::memory);
+	ll->textBreaks.resize(4096);
+	llc.Retrieve(5000, 0, 80, 0, linesOnScreen);
+	assert(llc.GetStatistic(Statistic::memory) >= memory + 4000*sizeof(TextBreak));
+
+	// without budget, document level holds all lines
+	llc.SetMemoryBudget(SIZE_MAX);
+	llc.Deallocate();
+	for (Sci::Line line = 0; line < 100000; line++) {
+		llc.Retrieve(line, 0, 20, 0, linesOnScreen);
+	}
+	assert(llc.GetStatistic(Statistic::lines) == 100000);
+	assert(llc.Retrieve(12345, 0, 20, 0, linesOnScreen)->LineNumber() == 12345);
+}
+
+// document of mixed line length, with a huge line every few thousand lines.
+struct TestDocument {
+	std::vector<int> lengths;
+	explicit TestDocument(Sci::Line lines) {
+		uint32_t seed = 20241017;
+		lengths.reserve(lines);
+		for (Sci::Line line = 0; line < lines; line++) {
+			seed = seed*1103515245 + 12345;
+			int length = 8 + (seed >> 16) % 120;
+			if (line % 4096 == 2048) {
+				length = 256*1024;
+			}
+			lengths.push_back(length);
+		}
+	}
+	Sci::Line Lines() const noexcept {
+		return static_cast<Sci::Line>(lengths.size());
+	}
+};
+
+enum class Pattern {
+	scroll,		// scroll down one line per frame
+	page,		// page down and back up
+	toggle,		// jump between two places, e.g. go to definition and back
+	random,		// jump to random places
+};
+
+constexpr const char *patternNames[] = { "scroll", "page", "toggle", "random" };
+
+Sci::Line TopLineForFrame(Pattern pattern, int frame, Sci::Line lines, uint32_t &seed) noexcept {
+	const Sci::Line maxTop = lines - linesOnScreen;
+	switch (pattern) {
+	case Pattern::scroll:
+		return frame % maxTop;
+	case Pattern::page: {
+		const int pages = 20;
+		const int step = frame % (2*pages);
+		return ((step < pages) ? step : 2*pages - step)*linesOnScreen;
+	}
+	case Pattern::toggle:
+		return ((frame & 1) ? lines/2 : 1000) + (frame/64 % 4)*linesOnScreen;
+	default:
+		seed = seed*1103515245 + 12345;
+		// mostly near recently visited places
+		return ((seed >> 8) % 8 == 0) ? (seed >> 4) % maxTop : ((seed >> 8) % 16)*linesOnScreen;
+	}
+}
+
+using Clock = std::chrono::steady_clock;
+
+void Benchmark(const TestDocument &doc, LineCache level, size_t budget, Pattern pattern, int frames) {
+	LineLayoutCache llc;
+	llc.SetLevel(level);
+	llc.SetMemoryBudget(budget);
+	uint32_t seed = 1;
+	size_t laidOut = 0;
+	size_t peakMemory = 0;
+	const auto start = Clock::now();
+	for (int frame = 0; frame < frames; frame++) {
+		const Sci::Line top = TopLineForFrame(pattern, frame, doc.Lines(), seed);
+		const Sci::Line caret = top + linesOnScreen/2;
+		for (Sci::Line line = top; line < top + linesOnScreen; line++) {
+			const int length = doc.lengths[line];
+			LineLayout *ll = llc.Retrieve(line, caret, length, 0, linesOnScreen);
+			laidOut += ll->validity != LineLayout::ValidLevel::lines;
+			LayOut(ll, length);
+		}
+		peakMemory = std::max(peakMemory, llc.GetStatistic(Statistic::memory));
+	}
+	const double duration = std::chrono::duration<double>(Clock::now() - start).count();
+	const size_t hits = llc.GetStatistic(Statistic::hits);
+	const size_t misses = llc.GetStatistic(Statistic::misses);
+	printf("%-8s level=%d hit=%5.1f%% evictions=%8zu laid out=%8zu lines=%6zu peak=%7.2f MiB %6.2f us/frame\n",
+		patternNames[static_cast<int>(pattern)], static_cast<int>(level), 100.0*hits/(hits + misses),
+		llc.GetStatistic(Statistic::evictions), laidOut, llc.GetStatistic(Statistic::lines),
+		peakMemory/(1024.0*1024), duration*1e6/frames);
+}
+
+}
+
+int main(int argc, char *argv[]) {
+	TestMemoryUsage();
+	TestCaretLevel();
+	TestLeastRecentlyUsed();
+	TestBudget();
+	printf("checked LineLayoutCache\n");
+
+	const int frames = std::max((argc > 1) ? atoi(argv[1]) : 20000, 1);
+	const size_t budget = ((argc > 2) ? strtoul(argv[2], nullptr, 10) : 32)*1024*1024;
+	const TestDocument doc{200000};
+	for (const Pattern pattern : { Pattern::scroll, Pattern::page, Pattern::toggle, Pattern::random }) {
+		Benchmark(doc, LineCache::Page, LineLayoutCache::defaultMemoryBudget, pattern, frames);
+		Benchmark(doc, LineCache::Document, budget, pattern, frames);
+	}
+	return 0;
+}
@@ -0,0 +1,153 @@
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+// Test for Markdown block context saved as line data: relexing from any line gives same
+// styles, line states and fold levels as lexing whole document, then benchmark typing on
+// README corpus with container blocks near document start.
+#include "RelexTest.h"
+
+// g++ -std=gnu++20 -DNDEBUG -O2 -Wall -Wextra -I../include -I../src -I../lexlib MarkdownRelexTest.cpp $RELEX_SRC ../lexers/LexMarkdown.cxx
+// cl /EHsc /std:c++20 /DNDEBUG /O2 /W4 /I../include /I../src /I../lexlib MarkdownRelexTest.cpp %RELEX_SRC% ../lexers/LexMarkdown.cxx
+// usage: a.out [markdown files], default to ../../readme.md
+
+extern Lexilla::LexerModule lmMarkdown;
+
+namespace {
+
+const LexerSetup markdownSetup{ &lmMarkdown, {
+	"address article aside blockquote details div dl fieldset figure footer form h1 h2 h3 header hr li main nav ol p pre section table ul",
+}};
+
+std::unique_ptr<Document> MakeDocument(std::string_view text) {
+	return MakeDocument(markdownSetup, text);
+}
+
+std::string ReadFile(const char *path) {
+	std::string text;
+	FILE *fp = fopen(path, "rb");
+	if (fp) {
+		char buffer[4096];
+		size_t length;
+		while ((length = fread(buffer, 1, sizeof(buffer), fp)) != 0) {
+			text.append(buffer, length);
+		}
+		fclose(fp);
+	}
+	return text;
+}
+
+// deeply nested list items with paragraphs, code and html between them.
+constexpr std::string_view nestedList =
+	"1. first level item\n"
+	"   continued paragraph\n"
+	"\n"
+	"   - second level item\n"
+	"     lazy continuation\n"
+	"\n"
+	"     ```cpp\n"
+	"     int main() {}\n"
+	"     ```\n"
+	"\n"
+	"     * third level item\n"
+	"\n"
+	"       <div>\n"
+	"       html block inside list\n"
+	"       </div>\n"
+	"\n"
+	"           indented code in third level\n"
+	"\n"
+	"       paragraph in *third* level\n"
+	"       with `code span` and [link](https://example.com)\n"
+	"\n"
+	"     paragraph back in second level\n"
+	"\n"
+	"   paragraph back in first level\n"
+	"\n";
+
+// README corpus repeated to lineCount lines, each copy starts with a long list item
+// (e.g. release notes), then nested list.
+std::string MakeCorpus(const std::vector<std::string> &files, Sci::Line lineCount) {
+	std::string longItem = "- long list item\n\n";
+	for (int i = 0; i < 500; i++) {
+		longItem += "  paragraph " + std::to_string(i) + " in long list item\n  continued line\n\n";
+	}
+	std::string text;
+	Sci::Line lines = 0;
+	while (lines < lineCount) {
+		for (const std::string &file : files) {
+			text += longItem;
+			text += nestedList;
+			text += file;
+			if (!text.empty() && text.back() != '\n') {
+				text += '\n';
+			}
+			text += '\n';
+		}
+		lines = std::count(text.begin(), text.end(), '\n');
+	}
+	return text;
+}
+
+// restart lexing at random lines, then style visible lines.
+void TestRelex(const std::string &text) {
+	std::unique_ptr<Document> scratch = MakeDocument(text);
+	scratch->EnsureStyledTo(scratch->Length());
+	std::unique_ptr<Document> doc = MakeDocument(text);
+	// fold level for empty line before header is changed after header line been lexed
+	if (!RelexAtRandomLines(*doc, *scratch, 1000, 1)) {
+		exit(EXIT_FAILURE);
+	}
+	printf("relex: same as lexing from scratch\n");
+}
+
+// type and delete a character on each line near document start, then style the screen.
+void Benchmark(const std::string &text) {
+	std::unique_ptr<Document> doc = MakeDocument(text);
+	auto start = Clock::now();
+	doc->EnsureStyledTo(doc->Length());
+	const double full = ElapsedMilliseconds(start);
+	const double size_MiB = static_cast<double>(text.length())/(1024*1024);
+	printf("%zd lines %.2f MiB, lex whole document %.2f ms\n", static_cast<size_t>(doc->LinesTotal()), size_MiB, full);
+
+	constexpr Sci::Line typingLines = 2000;
+	constexpr Sci::Line visibleLines = 60;
+	start = Clock::now();
+	for (Sci::Line line = 1; line < typingLines; line++) {
+		const Sci::Position pos = doc->LineEnd(line);
+		doc->InsertString(pos, "x");
+		doc->EnsureStyledTo(doc->LineStart(line + visibleLines));
+		doc->DeleteChars(pos, 1);
+		doc->EnsureStyledTo(doc->LineStart(line + visibleLines));
+	}
+	const double typing = ElapsedMilliseconds(start);
+	printf("type and delete on first %zd lines: %.2f ms, %.3f ms per keystroke\n",
+		static_cast<size_t>(typingLines), typing, typing/(2*typingLines));
+
+	// restart cost without styling visible lines
+	constexpr int repeat = 20;
+	start = Clock::now();
+	for (int i = 0; i < repeat; i++) {
+		for (Sci::Line line = 1; line < typingLines; line++) {
+			doc->ModifiedAt(doc->LineStart(line));
+			doc->EnsureStyledTo(doc->LineStart(line + 1));
+		}
+	}
+	const double restart = ElapsedMilliseconds(start);
+	printf("relex single line on first %zd lines: %.3f us per line\n",
+		static_cast<size_t>(typingLines), restart*1000/(repeat*typingLines));
+}
+
+}
+
+int main(int argc, char *argv[]) {
+	std::vector<std::string> files;
+	for (int i = 1; i < argc; i++) {
+		files.push_back(ReadFile(argv[i]));
+	}
+	if (files.empty()) {
+		files.push_back(ReadFile("../../readme.md"));
+	}
+	const std::string text = MakeCorpus(files, 100'000);
+	TestRelex(text);
+	Benchmark(text);
+	return 0;
+}
@@ -0,0 +1,147 @@
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+// Test for relex checkpoint: after editing inside a script block of a large HTML template,
+// lexing stops once line state, fold level and style converged to previous lexing.
+// Styles, line states and fold levels are compared with lexing whole document from scratch,
+// then relex cost is compared with restyling from the modification to document end.
+#include "RelexTest.h"
+
+// g++ -std=gnu++20 -DNDEBUG -O2 -Wall -Wextra -I../include -I../src -I../lexlib RelexCheckpointTest.cpp $RELEX_SRC ../lexers/LexHTML.cxx
+// cl /EHsc /std:c++20 /DNDEBUG /O2 /W4 /I../include /I../src /I../lexlib RelexCheckpointTest.cpp %RELEX_SRC% ../lexers/LexHTML.cxx
+// usage: a.out [template-lines]
+
+extern Lexilla::LexerModule lmHTML;
+
+namespace {
+
+const LexerSetup htmlSetup{ &lmHTML, {
+	"a body div head html input li p script span style table td title tr ul",
+	"break const else for function if let new return this var while",
+}};
+
+std::unique_ptr<Document> MakeDocument(std::string_view text) {
+	return MakeDocument(htmlSetup, text);
+}
+
+// page with script blocks, multiple line tags and comments.
+std::string MakeTemplate(int lineCount) {
+	std::string text = "<!DOCTYPE html>\n<html>\n<head><title>template</title></head>\n<body>\n";
+	int index = 0;
+	while (std::count(text.begin(), text.end(), '\n') < lineCount) {
+		const std::string id = std::to_string(index++);
+		text += "<div class=\"item\" id=\"item" + id + "\">\n"
+			"\t<p>paragraph " + id + " with <span>inline</span> text.</p>\n"
+			"\t<input type=\"text\"\n\t\tname=\"field" + id + "\"\n\t\tvalue='" + id + "'>\n"
+			"\t<!-- comment " + id + "\n\t-->\n"
+			"</div>\n"
+			"<script type=\"text/javascript\">\n"
+			"function update" + id + "(node) {\n"
+			"\t/* update item\n\t * with regex */\n"
+			"\tconst re = /item[0-9]+/g;\n"
+			"\tif (node && re.test(node.id)) {\n"
+			"\t\tnode.title = \"item \" + node.id; // title\n"
+			"\t\treturn [1, 2, 3].map(x => x * " + id + ");\n"
+			"\t}\n"
+			"\treturn `item ${node}`;\n"
+			"}\n"
+			"</script>\n";
+	}
+	text += "</body>\n</html>\n";
+	return text;
+}
+
+Sci::Position LineStart(const std::string &text, Sci::Line line) {
+	Sci::Position pos = 0;
+	while (line-- > 0) {
+		pos = text.find('\n', pos) + 1;
+	}
+	return pos;
+}
+
+constexpr std::string_view editTexts[] = {
+	"x", "\"", "'", "`", "/*", "*/", "//", "/", "<", ">", "<script>", "</script>", "<!--", "-->", "{", "}", "\n", "\n\n\t",
+};
+
+// random edits, then undo all of them.
+void TestRandomEdits() {
+	std::unique_ptr<Document> doc = MakeDocument(MakeTemplate(2000));
+	if (!RandomEdits(htmlSetup, *doc, editTexts, 400)) {
+		exit(EXIT_FAILURE);
+	}
+	// undo restores text and styles
+	while (doc->CanUndo()) {
+		doc->Undo();
+	}
+	if (!SameAsScratch(htmlSetup, *doc)) {
+		printf("differ after undo\n");
+		exit(EXIT_FAILURE);
+	}
+	printf("random edits: same as lexing from scratch\n");
+}
+
+// styling restarted from an earlier position by container or SCI_CLEARDOCUMENTSTYLE discards stale styles.
+void TestRestartStyling() {
+	std::unique_ptr<Document> doc = MakeDocument(MakeTemplate(200));
+	doc->EnsureStyledTo(doc->Length());
+	const Sci::Position pos = doc->Length()/2;
+	doc->InsertString(pos, "x");
+	doc->StartStyling(0);
+	doc->SetStyleFor(doc->Length(), 0);
+	doc->StartStyling(0);
+	if (!SameAsScratch(htmlSetup, *doc)) {
+		printf("differ after restart styling\n");
+		exit(EXIT_FAILURE);
+	}
+	printf("restart styling: same as lexing from scratch\n");
+}
+
+// typing inside a script block in middle of the template, then style to document end.
+void Benchmark(int lineCount) {
+	const std::string text = MakeTemplate(lineCount);
+	const Sci::Position pos = text.find("node.id)", LineStart(text, lineCount/2)) + strlen("node");
+	std::unique_ptr<Document> doc = MakeDocument(text);
+	auto start = Clock::now();
+	doc->EnsureStyledTo(doc->Length());
+	const double full = ElapsedMilliseconds(start);
+	const double size_MiB = static_cast<double>(text.length())/(1024*1024);
+	printf("%zd lines %.2f MiB, lex whole document %.2f ms\n", static_cast<size_t>(doc->LinesTotal()), size_MiB, full);
+
+	// identifier, string and comment converge after current line.
+	// unterminated string hides brackets from folding, fold levels changed to document end.
+	constexpr std::string_view edits[] = {"x", "\"str\"", "/**/", "\""};
+	constexpr int repeat = 20;
+	for (const std::string_view edit : edits) {
+		double duration[2]{};
+		for (int i = 0; i < repeat; i++) {
+			for (int checkpoint = 0; checkpoint < 2; checkpoint++) {
+				start = Clock::now();
+				doc->InsertString(pos, edit);
+				if (checkpoint == 0) {
+					doc->ModifiedAt(pos);	// discard stale styles
+				}
+				doc->EnsureStyledTo(doc->Length());
+				doc->DeleteChars(pos, edit.length());
+				if (checkpoint == 0) {
+					doc->ModifiedAt(pos);
+				}
+				doc->EnsureStyledTo(doc->Length());
+				duration[checkpoint] += ElapsedMilliseconds(start);
+			}
+		}
+		printf("type and delete '%s': restyle to end %.3f ms, checkpoint %.3f ms (%.0fx)\n",
+			std::string(edit).c_str(), duration[0]/(2*repeat), duration[1]/(2*repeat), duration[0]/duration[1]);
+	}
+	if (!SameAsScratch(htmlSetup, *doc)) {
+		exit(EXIT_FAILURE);
+	}
+}
+
+}
+
+int main(int argc, char *argv[]) {
+	TestRandomEdits();
+	TestRestartStyling();
+	const int lineCount = (argc > 1) ? atoi(argv[1]) : 50000;
+	Benchmark(std::max(lineCount, 100));
+	return 0;
+}
@@ -0,0 +1,182 @@
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+// Shared fixture for relex tests: documents lexed by a lexer module, comparing styles,
+// line states and fold levels with lexing from scratch, random restart and random edits.
+// Provides Platform::Assert() and the timer used by ElapsedPeriod, include it in only one
+// translation unit of a test program.
+// Each test is built with these common sources plus its lexers:
+// RELEX_SRC="../src/Document.cxx ../src/CellBuffer.cxx ../src/ChangeHistory.cxx ../src/UndoHistory.cxx ../src/PerLine.cxx ../src/RunStyles.cxx ../src/Decoration.cxx ../src/CharClassify.cxx ../src/CaseFolder.cxx ../src/CaseConvert.cxx ../src/UniConversion.cxx ../src/RESearch.cxx ../src/VectorKernels.cxx ../lexlib/LexerBase.cxx ../lexlib/Accessor.cxx ../lexlib/LexAccessor.cxx ../lexlib/PropSetSimple.cxx ../lexlib/WordList.cxx ../lexlib/StyleContext.cxx ../lexlib/CharacterCategory.cxx"
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <cassert>
+#include <chrono>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <array>
+#include <forward_list>
+#include <optional>
+#include <algorithm>
+#include <memory>
+#include <span>
+
+#include "ScintillaTypes.h"
+#include "ScintillaMessages.h"
+#include "ScintillaStructures.h"
+#include "ILoader.h"
+#include "ILexer.h"
+#include "Scintilla.h"
+#include "SciLexer.h"
+#include "Debugging.h"
+#include "Position.h"
+#include "SplitVector.h"
+#include "Partitioning.h"
+#include "RunStyles.h"
+#include "CellBuffer.h"
+#include "CharClassify.h"
+#include "Decoration.h"
+#include "CaseFolder.h"
+#include "Document.h"
+
+#include "PropSetSimple.h"
+#include "WordList.h"
+#include "LexAccessor.h"
+#include "Accessor.h"
+#include "LexerModule.h"
+#include "SparseState.h"
+#include "LexerBase.h"
+
+using namespace Scintilla;
+using namespace Scintilla::Internal;
+
+namespace Scintilla::Internal {
+void Platform::Assert(const char *c, const char *file, int line) noexcept {
+	fprintf(stderr, "Assertion [%s] failed at %s %d\n", c, file, line);
+	abort();
+}
+
+// used by ElapsedPeriod
+int64_t QueryPerformanceFrequency() noexcept {
+	return std::nano::den;
+}
+
+int64_t QueryPerformanceCounter() noexcept {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+}
+
+// lexer module and its keyword lists, folding is enabled.
+struct LexerSetup {
+	const Lexilla::LexerModule *module;
+	std::vector<const char *> keywordLists;
+};
+
+class TestLexInterface final : public LexInterface {
+public:
+	TestLexInterface(Document *pdoc_, const LexerSetup &setup) : LexInterface(pdoc_) {
+		instance.reset(new Lexilla::LexerBase(setup.module));
+		instance->PropertySet("fold", "1");
+		int index = 0;
+		for (const char *keywords : setup.keywordLists) {
+			instance->WordListSet(index++, 0, keywords);
+		}
+	}
+};
+
+inline std::unique_ptr<Document> MakeDocument(const LexerSetup &setup, std::string_view text) {
+	std::unique_ptr<Document> pdoc = std::make_unique<Document>(DocumentOption::Default);
+	pdoc->SetLexInterface(std::make_unique<TestLexInterface>(pdoc.get(), setup));
+	pdoc->LexerChanged(true);
+	pdoc->InsertString(0, text);
+	return pdoc;
+}
+
+// styles, line states and fold levels in [lineStart, lineEnd) are same as lexing from scratch.
+inline bool SameAsScratch(const Document &doc, const Document &scratch, Sci::Line lineStart, Sci::Line lineEnd) {
+	for (Sci::Line line = lineStart; line < lineEnd; line++) {
+		if (doc.GetLineState(line) != scratch.GetLineState(line) || doc.GetLevel(line) != scratch.GetLevel(line)) {
+			printf("line state or level differ at line %zd\n", static_cast<size_t>(line));
+			return false;
+		}
+		for (Sci::Position pos = doc.LineStart(line); pos < doc.LineStart(line + 1); pos++) {
+			if (doc.StyleAt(pos) != scratch.StyleAt(pos)) {
+				printf("style differ at line %zd\n", static_cast<size_t>(line));
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+// style whole document, then compare with lexing its text from scratch.
+inline bool SameAsScratch(const LexerSetup &setup, Document &doc) {
+	const Sci::Position length = doc.Length();
+	doc.EnsureStyledTo(length);
+	std::string text(length, '\0');
+	doc.GetCharRange(text.data(), 0, length);
+	std::unique_ptr<Document> scratch = MakeDocument(setup, text);
+	scratch->EnsureStyledTo(length);
+	return SameAsScratch(doc, *scratch, 0, doc.LinesTotal() - 1);
+}
+
+// restart lexing at random lines, then style visible lines and compare them except last uncheckedLines.
+inline bool RelexAtRandomLines(Document &doc, const Document &scratch, int count, Sci::Line uncheckedLines = 0) {
+	doc.EnsureStyledTo(doc.Length());
+	const Sci::Line lineCount = doc.LinesTotal();
+	std::mt19937 rng(2024);
+	for (int i = 0; i < count; i++) {
+		const Sci::Line line = 1 + rng() % (lineCount - 1);
+		const Sci::Line lineEnd = std::min<Sci::Line>(line + 60, lineCount - 1);
+		doc.ModifiedAt(doc.LineStart(line));
+		doc.EnsureStyledTo(doc.LineStart(lineEnd));
+		if (!SameAsScratch(doc, scratch, line, lineEnd - uncheckedLines)) {
+			printf("differ after restart at line %zd\n", static_cast<size_t>(line));
+			return false;
+		}
+	}
+	return true;
+}
+
+// random insertion and deletion, some edits are not followed by styling to merge with next edit.
+inline bool RandomEdits(const LexerSetup &setup, Document &doc, std::span<const std::string_view> editTexts, int count) {
+	doc.EnsureStyledTo(doc.Length());
+	std::mt19937 rng(2024);
+	for (int i = 0; i < count; i++) {
+		const Sci::Position pos = rng() % doc.Length();
+		if (rng() % 3 == 0) {
+			const Sci::Position dl = std::min<Sci::Position>(1 + rng() % 24, doc.Length() - pos);
+			doc.DeleteChars(pos, dl);
+		} else {
+			doc.InsertString(pos, editTexts[rng() % editTexts.size()]);
+		}
+		switch (rng() % 4) {
+		case 0:
+			break;
+		case 1:
+			// visible area after the modification
+			doc.EnsureStyledTo(std::min(pos + 4000, doc.Length()));
+			break;
+		default:
+			doc.EnsureStyledTo(doc.Length());
+			break;
+		}
+		if (i % 20 == 19 && !SameAsScratch(setup, doc)) {
+			printf("differ after edit %d\n", i);
+			return false;
+		}
+	}
+	return true;
+}
+
+using Clock = std::chrono::steady_clock;
+
+inline double ElapsedMilliseconds(Clock::time_point start) noexcept {
+	return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
@@ -0,0 +1,208 @@
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+// Round trip test for compressed style buffer against plain vector after random edits, and
+// benchmark for memory usage, colourise and paint cost of plain and compressed style buffer.
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+#include <chrono>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <memory>
+
+#include "ScintillaTypes.h"
+#include "Debugging.h"
+#include "Position.h"
+#include "SplitVector.h"
+#include "Partitioning.h"
+#include "CellBuffer.h"
+
+// g++ -std=gnu++20 -DNDEBUG -O2 -I../include -I../src StyleBufferTest.cpp ../src/CellBuffer.cxx ../src/ChangeHistory.cxx ../src/UndoHistory.cxx ../src/UniConversion.cxx ../src/RunStyles.cxx
+// cl /EHsc /std:c++20 /DNDEBUG /O2 /I../include /I../src StyleBufferTest.cpp ../src/CellBuffer.cxx ../src/ChangeHistory.cxx ../src/UndoHistory.cxx ../src/UniConversion.cxx ../src/RunStyles.cxx
+
+using namespace Scintilla::Internal;
+
+namespace Scintilla::Internal {
+void Platform::Assert(const char *c, const char *file, int line) noexcept {
+	fprintf(stderr, "Assertion [%s] failed at %s %d\n", c, file, line);
+	abort();
+}
+}
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMilliseconds(Clock::time_point start) noexcept {
+	return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+constexpr Sci::Position lineLength = 80;
+constexpr Sci::Position visibleLines = 60;
+
+// styles similar to source code: identifiers, operators, long comments and strings
+void Colourise(CellBuffer &cb, std::mt19937 &rng) {
+	const Sci::Position length = cb.Length();
+	Sci::Position position = 0;
+	while (position < length) {
+		const char style = static_cast<char>(rng() % 16);
+		const Sci::Position run = (rng() % 8 == 0) ? (rng() % 400) : (1 + rng() % 12);
+		const Sci::Position end = std::min(position + run, length);
+		cb.SetStyleFor(position, end - position, style);
+		position = end;
+	}
+}
+
+uint32_t Paint(CellBuffer &cb, Sci::Position firstLine) {
+	uint32_t hash = 0;
+	for (Sci::Position line = firstLine; line < firstLine + visibleLines; line++) {
+		const Sci::Position position = line * lineLength;
+		if (position + lineLength > cb.Length()) {
+			break;
+		}
+		const char *styles = cb.StyleRangePointer(position, lineLength);
+		hash = hash*31 + static_cast<uint8_t>(styles[0]) + static_cast<uint8_t>(styles[lineLength - 1]);
+	}
+	return hash;
+}
+
+// compare every style with plain vector through all read paths.
+bool SameStyles(CellBuffer &cb, const std::vector<char> &expected, std::mt19937 &rng) {
+	const Sci::Position length = cb.Length();
+	if (length != static_cast<Sci::Position>(expected.size())) {
+		printf("length %zd != %zu\n", length, expected.size());
+		return false;
+	}
+	std::vector<char> styles(length);
+	cb.GetStyleRange(reinterpret_cast<unsigned char *>(styles.data()), 0, length);
+	if (styles != expected) {
+		const auto diff = std::mismatch(styles.begin(), styles.end(), expected.begin());
+		printf("GetStyleRange differs at %zd\n", diff.first - styles.begin());
+		return false;
+	}
+	for (int i = 0; i < 200 && length != 0; i++) {
+		const Sci::Position position = rng() % length;
+		if (cb.StyleAt(position) != expected[position]) {
+			printf("StyleAt differs at %zd\n", position);
+			return false;
+		}
+		const Sci::Position rangeLength = std::min<Sci::Position>(1 + rng() % (2*CompressedStyles::blockSize), length - position);
+		const char *ptr = cb.StyleRangePointer(position, rangeLength);
+		if (memcmp(ptr, expected.data() + position, rangeLength) != 0) {
+			printf("StyleRangePointer differs for %zd %zd\n", position, rangeLength);
+			return false;
+		}
+	}
+	return true;
+}
+
+// random insert, delete and restyle, small and across blocks.
+bool RoundTrip(uint32_t seed) {
+	CellBuffer cb(true, true, true);
+	cb.SetUndoCollection(false);
+	std::vector<char> expected;
+	std::mt19937 rng(seed);
+	const std::string text(3*CompressedStyles::blockSize, 'x');
+	bool startSequence = false;
+	for (int step = 0; step < 3000; step++) {
+		const Sci::Position length = cb.Length();
+		const bool large = rng() % 8 == 0;
+		switch (rng() % 4) {
+		case 0: {
+			const Sci::Position position = (rng() % 4 == 0) ? ((rng() & 1) ? 0 : length) : (rng() % (length + 1));
+			const Sci::Position insertLength = 1 + rng() % (large ? text.length() : 100);
+			cb.InsertString(position, text.data(), insertLength, startSequence);
+			expected.insert(expected.begin() + position, insertLength, '\0');
+		} break;
+		case 1:
+			if (length != 0) {
+				const Sci::Position position = rng() % length;
+				const Sci::Position deleteLength = std::min<Sci::Position>(1 + rng() % (large ? 2*CompressedStyles::blockSize : 100), length - position);
+				cb.DeleteChars(position, deleteLength, startSequence);
+				expected.erase(expected.begin() + position, expected.begin() + position + deleteLength);
+			}
+			break;
+		case 2:
+			if (length != 0) {
+				const Sci::Position position = rng() % length;
+				const Sci::Position styleLength = std::min<Sci::Position>(1 + rng() % (large ? 2*CompressedStyles::blockSize : 300), length - position);
+				const char style = static_cast<char>(rng() % 4);
+				cb.SetStyleFor(position, styleLength, style);
+				std::fill_n(expected.begin() + position, styleLength, style);
+			}
+			break;
+		default:
+			for (int i = 0; i < 50 && length != 0; i++) {
+				const Sci::Position position = rng() % length;
+				const char style = static_cast<char>(rng() % 64);
+				cb.SetStyleAt(position, style);
+				expected[position] = style;
+			}
+			break;
+		}
+		if ((step % 50 == 0 || step == 2999) && !SameStyles(cb, expected, rng)) {
+			printf("round trip failed with seed %u at step %d\n", seed, step);
+			return false;
+		}
+	}
+	return true;
+}
+
+void Benchmark(Sci::Position length, bool compressed) {
+	CellBuffer cb(true, true, compressed);
+	std::string text(lineLength - 1, 'x');
+	text.push_back('\n');
+	bool startSequence = false;
+	cb.SetUndoCollection(false);
+	for (Sci::Position position = 0; position < length; position += lineLength) {
+		cb.InsertString(position, text.data(), lineLength, startSequence);
+	}
+
+	std::mt19937 rng(42);
+	auto start = Clock::now();
+	Colourise(cb, rng);
+	const double colourise = ElapsedMilliseconds(start);
+
+	const Sci::Position lines = length / lineLength;
+	uint32_t hash = 0;
+	start = Clock::now();
+	// smooth scrolling
+	for (Sci::Position line = 0; line + visibleLines < lines; line += 3) {
+		hash += Paint(cb, line);
+	}
+	const double scroll = ElapsedMilliseconds(start);
+
+	start = Clock::now();
+	// random jumps
+	for (int i = 0; i < 10000; i++) {
+		hash += Paint(cb, rng() % lines);
+	}
+	const double jump = ElapsedMilliseconds(start);
+
+	printf("%-10s length=%zd style memory=%zu (%.1f%%) colourise=%.2fms scroll=%.2fms jump=%.2fms hash=%08x\n",
+		compressed ? "compressed" : "plain", length, cb.StyleMemoryUsage(), 100.0*cb.StyleMemoryUsage()/length,
+		colourise, scroll, jump, hash);
+}
+
+}
+
+int main() {
+	for (const uint32_t seed : {1U, 2U, 3U}) {
+		if (!RoundTrip(seed)) {
+			return 1;
+		}
+	}
+	printf("round trip passed\n");
+	for (const Sci::Position length : {Sci::Position{16} << 20, Sci::Position{256} << 20}) {
+		Benchmark(length, false);
+		Benchmark(length, true);
+	}
+	return 0;
+}
@@ -0,0 +1,615 @@
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+// Recording implementation of Surface and Font, see SurfaceRecording.h.
+#include <cstdint>
+#include <cstdio>
+#include <cassert>
+#include <cstring>
+#include <cmath>
+#include <cstdlib>
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <optional>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+
+#include "SurfaceRecording.h"
+#include "UniConversion.h"
+#include "ElapsedPeriod.h"
+
+using namespace Scintilla;
+using namespace Scintilla::Internal;
+
+namespace {
+
+constexpr int logPixelsYRecording = 96;
+
+// ranges of East Asian Wide and Fullwidth characters, approximate to UAX #11 at block level.
+constexpr unsigned int wideRanges[][2] = {
+	{0x1100, 0x115F},	// Hangul Jamo
+	{0x2E80, 0x303E},	// CJK Radicals to CJK Symbols and Punctuation
+	{0x3041, 0x33FF},	// Hiragana to CJK Compatibility
+	{0x3400, 0x4DBF},	// CJK Unified Ideographs Extension A
+	{0x4E00, 0x9FFF},	// CJK Unified Ideographs
+	{0xA000, 0xA4CF},	// Yi Syllables and Yi Radicals
+	{0xAC00, 0xD7A3},	// Hangul Syllables
+	{0xF900, 0xFAFF},	// CJK Compatibility Ideographs
+	{0xFE30, 0xFE4F},	// CJK Compatibility Forms
+	{0xFF00, 0xFF60},	// Fullwidth Forms
+	{0xFFE0, 0xFFE6},
+	{0x1F300, 0x1F64F},	// Miscellaneous Symbols and Pictographs, Emoticons
+	{0x1F900, 0x1F9FF},	// Supplemental Symbols and Pictographs
+	{0x20000, 0x3FFFD},	// Supplementary and Tertiary Ideographic Plane
+};
+
+constexpr bool IsWideCharacter(unsigned int ch) noexcept {
+	if (ch < wideRanges[0][0]) {
+		return false;
+	}
+	for (const auto &range : wideRanges) {
+		if (ch >= range[0] && ch <= range[1]) {
+			return true;
+		}
+	}
+	return false;
+}
+
+const FontRecording *RecordingFont(const Font *font_) noexcept {
+	return dynamic_cast<const FontRecording *>(font_);
+}
+
+const FontParameters fontParametersDefault{"Recording"};
+
+const FontRecording &FontOrDefault(const Font *font_) noexcept {
+	static const FontRecording fontDefault{fontParametersDefault};
+	const FontRecording *font = RecordingFont(font_);
+	return font ? *font : fontDefault;
+}
+
+}
+
+FontRecording::FontRecording(const FontParameters &fp) noexcept :
+	size{fp.size},
+	ascent{std::ceil(fp.size * 0.8)},
+	descent{std::ceil(fp.size * 0.25)},
+	cellWidth{std::max(1.0, std::round(fp.size * 0.6))},
+	weight{fp.weight},
+	italic{fp.italic} {
+}
+
+void FontRecording::UseProportionalWidths() {
+	asciiWidths.assign(128, cellWidth);
+	const XYPOSITION narrow = std::max(1.0, std::round(cellWidth * 0.5));
+	const XYPOSITION wide = std::round(cellWidth * 1.5);
+	for (const char ch : std::string_view{" !'(),-./:;I[]`fijlrt|"}) {
+		asciiWidths[static_cast<unsigned char>(ch)] = narrow;
+	}
+	for (const char ch : std::string_view{"%@MWmw"}) {
+		asciiWidths[static_cast<unsigned char>(ch)] = wide;
+	}
+}
+
+XYPOSITION FontRecording::CharacterWidth(unsigned int ch) const noexcept {
+	if (ch < asciiWidths.size()) {
+		return asciiWidths[ch];
+	}
+	return IsWideCharacter(ch) ? 2*cellWidth : cellWidth;
+}
+
+#if defined(SURFACE_RECORDING_PLATFORM)
+std::shared_ptr<Font> Font::Allocate(const FontParameters &fp) {
+	return std::make_shared<FontRecording>(fp);
+}
+
+std::unique_ptr<Surface> Surface::Allocate([[maybe_unused]] Technology technology) {
+	return std::make_unique<SurfaceRecording>();
+}
+
+// window-less program, invalidation is ignored as every frame is painted by caller.
+void Window::Destroy() noexcept {
+	wid = nullptr;
+}
+
+PRectangle Window::GetPosition() const noexcept {
+	return PRectangle();
+}
+
+void Window::SetPosition([[maybe_unused]] PRectangle rc) noexcept {
+}
+
+void Window::SetPositionRelative([[maybe_unused]] PRectangle rc, [[maybe_unused]] const Window *relativeTo) noexcept {
+}
+
+PRectangle Window::GetClientPosition() const noexcept {
+	return PRectangle();
+}
+
+void Window::Show([[maybe_unused]] bool show) const noexcept {
+}
+
+void Window::InvalidateAll() noexcept {
+}
+
+void Window::InvalidateRectangle([[maybe_unused]] PRectangle rc) noexcept {
+}
+
+void Window::SetCursor(Cursor curs) noexcept {
+	cursorLast = curs;
+}
+
+PRectangle Window::GetMonitorRect([[maybe_unused]] Point pt) const noexcept {
+	return PRectangle();
+}
+
+ColourRGBA Platform::Chrome() noexcept {
+	return ColourRGBA(0xf0, 0xf0, 0xf0);
+}
+
+ColourRGBA Platform::ChromeHighlight() noexcept {
+	return ColourRGBA(0xff, 0xff, 0xff);
+}
+
+const char *Platform::DefaultFont() noexcept {
+	return fontParametersDefault.faceName;
+}
+
+int Platform::DefaultFontSize() noexcept {
+	return 10;
+}
+
+unsigned int Platform::DoubleClickTime() noexcept {
+	return 500;
+}
+
+void Platform::DebugPrintf([[maybe_unused]] const char *format, ...) noexcept {
+}
+
+bool Platform::ShowAssertionPopUps([[maybe_unused]] bool assertionPopUps_) noexcept {
+	return false;
+}
+
+void Platform::Assert(const char *c, const char *file, int line) noexcept {
+	fprintf(stderr, "Assertion [%s] failed at %s %d\n", c, file, line);
+	abort();
+}
+
+// used by ElapsedPeriod
+int64_t Scintilla::Internal::QueryPerformanceFrequency() noexcept {
+	return std::nano::den;
+}
+
+int64_t Scintilla::Internal::QueryPerformanceCounter() noexcept {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+#endif
+
+const char *Scintilla::Internal::DrawOpName(DrawOp op) noexcept {
+	static const char * const names[] = {
+		"LineDraw",
+		"PolyLine",
+		"Polygon",
+		"RectangleDraw",
+		"RectangleFrame",
+		"FillRectangle",
+		"FillRectangleAligned",
+		"FillPattern",
+		"RoundedRectangle",
+		"AlphaRectangle",
+		"GradientRectangle",
+		"DrawRGBAImage",
+		"Ellipse",
+		"Stadium",
+		"Copy",
+		"DrawTextNoClip",
+		"DrawTextClipped",
+		"DrawTextTransparent",
+		"SetClip",
+		"PopClip",
+	};
+	const size_t index = static_cast<size_t>(op);
+	return (index < std::size(names)) ? names[index] : "Unknown";
+}
+
+bool DrawCommand::operator==(const DrawCommand &other) const noexcept {
+	return op == other.op && utf8 == other.utf8 && option == other.option
+		&& fore == other.fore && back == other.back && width == other.width
+		&& rc == other.rc && offset == other.offset && length == other.length;
+}
+
+SurfaceRecording::SurfaceRecording(int width_, int height_) noexcept :
+	width{width_}, height{height_} {
+}
+
+void SurfaceRecording::Init([[maybe_unused]] WindowID wid) noexcept {
+}
+
+void SurfaceRecording::Init([[maybe_unused]] SurfaceID sid, [[maybe_unused]] WindowID wid, [[maybe_unused]] bool printing) noexcept {
+}
+
+std::unique_ptr<Surface> SurfaceRecording::AllocatePixMap(int width_, int height_) {
+	std::unique_ptr<SurfaceRecording> surface = std::make_unique<SurfaceRecording>(width_, height_);
+	surface->SetMode(mode);
+	return surface;
+}
+
+void SurfaceRecording::SetMode(SurfaceMode mode_) noexcept {
+	mode = mode_;
+}
+
+void SurfaceRecording::SetRenderingParams([[maybe_unused]] void *defaultRenderingParams, [[maybe_unused]] void *customRenderingParams) noexcept {
+}
+
+void SurfaceRecording::Release() noexcept {
+	clipDepth = 0;
+}
+
+bool SurfaceRecording::SupportsFeature(Supports feature) const noexcept {
+	return feature == Supports::LineDrawsFinal || feature == Supports::FractionalStrokeWidth
+		|| feature == Supports::TranslucentStroke || feature == Supports::PixelModification
+		|| feature == Supports::ThreadSafeMeasureWidths;
+}
+
+bool SurfaceRecording::Initialised() const noexcept {
+	return true;
+}
+
+int SurfaceRecording::LogPixelsY() const noexcept {
+	return logPixelsYRecording;
+}
+
+int SurfaceRecording::PixelDivisions() const noexcept {
+	return 1;
+}
+
+int SurfaceRecording::DeviceHeightFont(int points) const noexcept {
+	return (points * logPixelsYRecording + 36) / 72;
+}
+
+void SurfaceRecording::Record(DrawOp op, PRectangle rc, ColourRGBA fore, ColourRGBA back, XYPOSITION width_, unsigned option) {
+	commands.push_back({op, 0, static_cast<uint16_t>(option), fore.AsInteger(), back.AsInteger(),
+		static_cast<float>(width_), rc, 0, 0});
+}
+
+void SurfaceRecording::RecordPoints(DrawOp op, const Point *pts, size_t npts, ColourRGBA fore, ColourRGBA back, XYPOSITION width_) {
+	const uint32_t offset = static_cast<uint32_t>(points.size());
+	points.insert(points.end(), pts, pts + npts);
+	PRectangle rcBounds;
+	if (npts != 0) {
+		rcBounds = PRectangle(pts[0].x, pts[0].y, pts[0].x, pts[0].y);
+		for (size_t i = 1; i < npts; i++) {
+			rcBounds.left = std::min(rcBounds.left, pts[i].x);
+			rcBounds.top = std::min(rcBounds.top, pts[i].y);
+			rcBounds.right = std::max(rcBounds.right, pts[i].x);
+			rcBounds.bottom = std::max(rcBounds.bottom, pts[i].y);
+		}
+	}
+	commands.push_back({op, 0, 0, fore.AsInteger(), back.AsInteger(),
+		static_cast<float>(width_), rcBounds, offset, static_cast<uint32_t>(npts)});
+}
+
+void SurfaceRecording::RecordText(DrawOp op, bool utf8, PRectangle rc, XYPOSITION ybase, std::string_view sv, ColourRGBA fore, ColourRGBA back) {
+	const uint32_t offset = static_cast<uint32_t>(text.size());
+	text.append(sv);
+	commands.push_back({op, utf8, 0, fore.AsInteger(), back.AsInteger(),
+		static_cast<float>(ybase), rc, offset, static_cast<uint32_t>(sv.length())});
+}
+
+void SurfaceRecording::LineDraw(Point start, Point end, Stroke stroke) {
+	Record(DrawOp::LineDraw, PRectangle(start.x, start.y, end.x, end.y), stroke.colour, stroke.colour, stroke.width);
+}
+
+void SurfaceRecording::PolyLine(const Point *pts, size_t npts, Stroke stroke) {
+	RecordPoints(DrawOp::PolyLine, pts, npts, stroke.colour, stroke.colour, stroke.width);
+}
+
+void SurfaceRecording::Polygon(const Point *pts, size_t npts, FillStroke fillStroke) {
+	RecordPoints(DrawOp::Polygon, pts, npts, fillStroke.stroke.colour, fillStroke.fill.colour, fillStroke.stroke.width);
+}
+
+void SurfaceRecording::RectangleDraw(PRectangle rc, FillStroke fillStroke) {
+	Record(DrawOp::RectangleDraw, rc, fillStroke.stroke.colour, fillStroke.fill.colour, fillStroke.stroke.width);
+}
+
+void SurfaceRecording::RectangleFrame(PRectangle rc, Stroke stroke) {
+	Record(DrawOp::RectangleFrame, rc, stroke.colour, stroke.colour, stroke.width);
+}
+
+void SurfaceRecording::FillRectangle(PRectangle rc, Fill fill) {
+	Record(DrawOp::FillRectangle, rc, fill.colour, fill.colour, 0);
+}
+
+void SurfaceRecording::FillRectangleAligned(PRectangle rc, Fill fill) {
+	Record(DrawOp::FillRectangleAligned, PixelAlign(rc, 1), fill.colour, fill.colour, 0);
+}
+
+void SurfaceRecording::FillRectangle(PRectangle rc, [[maybe_unused]] Surface &surfacePattern) {
+	Record(DrawOp::FillPattern, rc, black, black, 0);
+}
+
+void SurfaceRecording::RoundedRectangle(PRectangle rc, FillStroke fillStroke) {
+	Record(DrawOp::RoundedRectangle, rc, fillStroke.stroke.colour, fillStroke.fill.colour, fillStroke.stroke.width);
+}
+
+void SurfaceRecording::AlphaRectangle(PRectangle rc, XYPOSITION cornerSize, FillStroke fillStroke) {
+	Record(DrawOp::AlphaRectangle, rc, fillStroke.stroke.colour, fillStroke.fill.colour, cornerSize);
+}
+
+void SurfaceRecording::GradientRectangle(PRectangle rc, const std::vector<ColourStop> &stops, GradientOptions options) {
+	// stops are kept in points pool as (position, colour)
+	const uint32_t offset = static_cast<uint32_t>(points.size());
+	for (const ColourStop &stop : stops) {
+		points.emplace_back(stop.position, stop.colour.AsInteger());
+	}
+	commands.push_back({DrawOp::GradientRectangle, 0, static_cast<uint16_t>(options), 0, 0, 0, rc,
+		offset, static_cast<uint32_t>(stops.size())});
+}
+
+void SurfaceRecording::DrawRGBAImage(PRectangle rc, int width_, int height_, const unsigned char *pixelsImage) {
+	// checksum of pixels to detect changed image
+	uint32_t hash = 2166136261U;
+	const size_t length = static_cast<size_t>(width_) * height_ * 4;
+	for (size_t i = 0; i < length; i++) {
+		hash = (hash ^ pixelsImage[i]) * 16777619U;
+	}
+	Record(DrawOp::DrawRGBAImage, rc, ColourRGBA(hash), ColourRGBA(hash), width_, height_);
+}
+
+void SurfaceRecording::Ellipse(PRectangle rc, FillStroke fillStroke) {
+	Record(DrawOp::Ellipse, rc, fillStroke.stroke.colour, fillStroke.fill.colour, fillStroke.stroke.width);
+}
+
+void SurfaceRecording::Stadium(PRectangle rc, FillStroke fillStroke, Ends ends) {
+	Record(DrawOp::Stadium, rc, fillStroke.stroke.colour, fillStroke.fill.colour, fillStroke.stroke.width, static_cast<unsigned>(ends));
+}
+
+void SurfaceRecording::Copy(PRectangle rc, Point from, Surface &surfaceSource) {
+	// source origin kept in points pool
+	Record(DrawOp::Copy, rc, black, black, 0);
+	commands.back().offset = static_cast<uint32_t>(points.size());
+	commands.back().length = 1;
+	points.push_back(from);
+	SurfaceRecording *source = dynamic_cast<SurfaceRecording *>(&surfaceSource);
+	if (!source) {
+		return;
+	}
+	if (trackRows) {
+		const int top = std::max(0, static_cast<int>(rc.top));
+		const int bottom = std::min(static_cast<int>(rows.size()), static_cast<int>(std::ceil(rc.bottom)));
+		if (source->trackRows) {
+			// copy out first as source and destination may be same surface
+			const int sourceTop = static_cast<int>(from.y + top - rc.top);
+			std::vector<std::string> copied;
+			for (int y = top; y < bottom; y++) {
+				const int sourceY = sourceTop + y - top;
+				const bool inside = sourceY >= 0 && sourceY < static_cast<int>(source->rows.size());
+				copied.push_back(inside ? source->rows[sourceY] : std::string());
+			}
+			for (int y = top; y < bottom; y++) {
+				rows[y] = std::move(copied[y - top]);
+			}
+		} else {
+			const std::string content = source->Dump(source->copiedCount, source->commands.size());
+			for (int y = top; y < bottom; y++) {
+				rows[y] = content;
+			}
+		}
+	}
+	source->copiedCount = source->commands.size();
+}
+
+std::unique_ptr<IScreenLineLayout> SurfaceRecording::Layout([[maybe_unused]] const IScreenLine *screenLine) {
+	// bidirectional layout is not supported
+	return {};
+}
+
+void SurfaceRecording::Measure(const Font *font_, std::string_view sv, XYPOSITION *positions, bool utf8) const noexcept {
+	const FontRecording &font = FontOrDefault(font_);
+	const bool dbcs = !utf8 && mode.codePage != 0 && mode.codePage != CpUtf8;
+	XYPOSITION x = 0;
+	size_t i = 0;
+	while (i < sv.length()) {
+		const unsigned char ch = sv[i];
+		size_t lenChar = 1;
+		XYPOSITION widthChar;
+		if (ch < 0x80) {
+			widthChar = font.CharacterWidth(ch);
+		} else if (utf8) {
+			const int status = UTF8Classify(sv.data() + i, sv.length() - i);
+			if (status & UTF8MaskInvalid) {
+				// hex blob drawn by caller, measured as a narrow box
+				widthChar = font.cellWidth;
+			} else {
+				lenChar = status & UTF8MaskWidth;
+				widthChar = font.CharacterWidth(UnicodeFromUTF8(reinterpret_cast<const unsigned char *>(sv.data() + i)));
+			}
+		} else if (dbcs && i + 1 < sv.length()) {
+			// assume lead byte, double byte characters are double width
+			lenChar = 2;
+			widthChar = 2*font.cellWidth;
+		} else {
+			widthChar = font.cellWidth;
+		}
+		x += widthChar;
+		for (size_t j = 0; j < lenChar; j++) {
+			positions[i++] = x;
+		}
+	}
+}
+
+void SurfaceRecording::DrawTextNoClip(PRectangle rc, [[maybe_unused]] const Font *font_, XYPOSITION ybase, std::string_view sv, ColourRGBA fore, ColourRGBA back) {
+	RecordText(DrawOp::DrawTextNoClip, false, rc, ybase, sv, fore, back);
+}
+
+void SurfaceRecording::DrawTextClipped(PRectangle rc, [[maybe_unused]] const Font *font_, XYPOSITION ybase, std::string_view sv, ColourRGBA fore, ColourRGBA back) {
+	RecordText(DrawOp::DrawTextClipped, false, rc, ybase, sv, fore, back);
+}
+
+void SurfaceRecording::DrawTextTransparent(PRectangle rc, [[maybe_unused]] const Font *font_, XYPOSITION ybase, std::string_view sv, ColourRGBA fore) {
+	RecordText(DrawOp::DrawTextTransparent, false, rc, ybase, sv, fore, ColourRGBA(0, 0, 0, 0));
+}
+
+void SurfaceRecording::MeasureWidths(const Font *font_, std::string_view sv, XYPOSITION *positions) {
+	Measure(font_, sv, positions, mode.codePage == CpUtf8);
+}
+
+XYPOSITION SurfaceRecording::WidthText(const Font *font_, std::string_view sv) {
+	if (sv.empty()) {
+		return 0;
+	}
+	std::vector<XYPOSITION> positions(sv.length());
+	Measure(font_, sv, positions.data(), mode.codePage == CpUtf8);
+	return positions.back();
+}
+
+void SurfaceRecording::DrawTextNoClipUTF8(PRectangle rc, [[maybe_unused]] const Font *font_, XYPOSITION ybase, std::string_view sv, ColourRGBA fore, ColourRGBA back) {
+	RecordText(DrawOp::DrawTextNoClip, true, rc, ybase, sv, fore, back);
+}
+
+void SurfaceRecording::DrawTextClippedUTF8(PRectangle rc, [[maybe_unused]] const Font *font_, XYPOSITION ybase, std::string_view sv, ColourRGBA fore, ColourRGBA back) {
+	RecordText(DrawOp::DrawTextClipped, true, rc, ybase, sv, fore, back);
+}
+
+void SurfaceRecording::DrawTextTransparentUTF8(PRectangle rc, [[maybe_unused]] const Font *font_, XYPOSITION ybase, std::string_view sv, ColourRGBA fore) {
+	RecordText(DrawOp::DrawTextTransparent, true, rc, ybase, sv, fore, ColourRGBA(0, 0, 0, 0));
+}
+
+void SurfaceRecording::MeasureWidthsUTF8(const Font *font_, std::string_view sv, XYPOSITION *positions) {
+	Measure(font_, sv, positions, true);
+}
+
+XYPOSITION SurfaceRecording::WidthTextUTF8(const Font *font_, std::string_view sv) {
+	if (sv.empty()) {
+		return 0;
+	}
+	std::vector<XYPOSITION> positions(sv.length());
+	Measure(font_, sv, positions.data(), true);
+	return positions.back();
+}
+
+XYPOSITION SurfaceRecording::Ascent(const Font *font_) noexcept {
+	return FontOrDefault(font_).ascent;
+}
+
+XYPOSITION SurfaceRecording::Descent(const Font *font_) noexcept {
+	return FontOrDefault(font_).descent;
+}
+
+XYPOSITION SurfaceRecording::InternalLeading([[maybe_unused]] const Font *font_) noexcept {
+	return 0;
+}
+
+XYPOSITION SurfaceRecording::Height(const Font *font_) noexcept {
+	const FontRecording &font = FontOrDefault(font_);
+	return font.ascent + font.descent;
+}
+
+XYPOSITION SurfaceRecording::AverageCharWidth(const Font *font_) {
+	return FontOrDefault(font_).cellWidth;
+}
+
+void SurfaceRecording::SetClip(PRectangle rc) noexcept {
+	try {
+		Record(DrawOp::SetClip, rc, black, black, 0, clipDepth);
+		++clipDepth;
+	} catch (...) {
+		// recording is best effort when out of memory
+	}
+}
+
+void SurfaceRecording::PopClip() noexcept {
+	PLATFORM_ASSERT(clipDepth > 0);
+	try {
+		--clipDepth;
+		Record(DrawOp::PopClip, PRectangle(), black, black, 0, clipDepth);
+	} catch (...) {
+		// recording is best effort when out of memory
+	}
+}
+
+void SurfaceRecording::FlushCachedState() noexcept {
+}
+
+void SurfaceRecording::FlushDrawing() noexcept {
+}
+
+size_t SurfaceRecording::Count(DrawOp op) const noexcept {
+	return std::count_if(commands.begin(), commands.end(), [op](const DrawCommand &command) noexcept {
+		return command.op == op;
+	});
+}
+
+std::string_view SurfaceRecording::Text(const DrawCommand &command) const noexcept {
+	if (command.op >= DrawOp::DrawTextNoClip && command.op <= DrawOp::DrawTextTransparent) {
+		return std::string_view(text.data() + command.offset, command.length);
+	}
+	return {};
+}
+
+const Point *SurfaceRecording::Points(const DrawCommand &command) const noexcept {
+	if (command.length != 0 && !(command.op >= DrawOp::DrawTextNoClip && command.op <= DrawOp::DrawTextTransparent)) {
+		return points.data() + command.offset;
+	}
+	return nullptr;
+}
+
+bool SurfaceRecording::SameDrawing(const SurfaceRecording &other) const noexcept {
+	return commands == other.commands && points == other.points && text == other.text;
+}
+
+std::string SurfaceRecording::Dump() const {
+	return Dump(0, commands.size());
+}
+
+std::string SurfaceRecording::Dump(size_t start, size_t end) const {
+	std::string result;
+	char buffer[256];
+	for (size_t index = start; index < end; index++) {
+		const DrawCommand &command = commands[index];
+		const PRectangle &rc = command.rc;
+		snprintf(buffer, sizeof(buffer), "%s %g,%g,%g,%g #%08X #%08X %g %u", DrawOpName(command.op),
+			rc.left, rc.top, rc.right, rc.bottom, command.fore, command.back, command.width, command.option);
+		result += buffer;
+		const std::string_view sv = Text(command);
+		if (!sv.empty()) {
+			result += command.utf8 ? " u\"" : " \"";
+			for (const char ch : sv) {
+				const unsigned char uch = ch;
+				if (uch < 0x20 || uch >= 0x7f || ch == '"' || ch == '\\') {
+					snprintf(buffer, sizeof(buffer), "\\x%02X", uch);
+					result += buffer;
+				} else {
+					result += ch;
+				}
+			}
+			result += '"';
+		} else if (const Point *pts = Points(command)) {
+			const bool gradient = command.op == DrawOp::GradientRectangle;
+			for (uint32_t i = 0; i < command.length; i++) {
+				if (gradient) {
+					snprintf(buffer, sizeof(buffer), " (%g,#%08X)", pts[i].x, static_cast<unsigned>(pts[i].y));
+				} else {
+					snprintf(buffer, sizeof(buffer), " (%g,%g)", pts[i].x, pts[i].y);
+				}
+				result += buffer;
+			}
+		}
+		result += '\n';
+	}
+	return result;
+}
+
+void SurfaceRecording::Clear() noexcept {
+	commands.clear();
+	points.clear();
+	text.clear();
+	clipDepth = 0;
+	copiedCount = 0;
+}
+
+void SurfaceRecording::TrackRows(bool track) {
+	trackRows = track;
+	rows.assign(track ? std::max(height, 0) : 0, std::string());
+}
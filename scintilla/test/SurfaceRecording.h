@@ -0,0 +1,187 @@
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+// Recording implementation of Surface and Font for headless rendering tests and benchmarks.
+// Fonts use fixed-width metrics (wide East Asian characters take two cells) with an optional
+// per ASCII character width table, draw calls are captured into a compact display list
+// that can be compared or dumped as text for diffing.
+// Only depends on Scintilla's portable headers, define SURFACE_RECORDING_PLATFORM in one
+// translation unit of a headless program to provide Surface::Allocate(), Font::Allocate()
+// and window-less stubs for Window, Platform and the timer used by ElapsedPeriod.
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <optional>
+#include <memory>
+
+#include "ScintillaTypes.h"
+
+#include "Debugging.h"
+#include "Geometry.h"
+#include "Platform.h"
+
+namespace Scintilla::Internal {
+
+class FontRecording final : public Font {
+public:
+	XYPOSITION size;
+	XYPOSITION ascent;
+	XYPOSITION descent;
+	XYPOSITION cellWidth;
+	Scintilla::FontWeight weight;
+	bool italic;
+	// optional width of each ASCII character, cellWidth is used when empty.
+	std::vector<XYPOSITION> asciiWidths;
+
+	explicit FontRecording(const FontParameters &fp) noexcept;
+	// proportional metrics, narrow letters like 'i' and wide letters like 'W' differ from cellWidth.
+	void UseProportionalWidths();
+	XYPOSITION CharacterWidth(unsigned int ch) const noexcept;
+};
+
+enum class DrawOp : uint8_t {
+	LineDraw,
+	PolyLine,
+	Polygon,
+	RectangleDraw,
+	RectangleFrame,
+	FillRectangle,
+	FillRectangleAligned,
+	FillPattern,
+	RoundedRectangle,
+	AlphaRectangle,
+	GradientRectangle,
+	DrawRGBAImage,
+	Ellipse,
+	Stadium,
+	Copy,
+	DrawTextNoClip,
+	DrawTextClipped,
+	DrawTextTransparent,
+	SetClip,
+	PopClip,
+};
+
+const char *DrawOpName(DrawOp op) noexcept;
+
+// one draw call, points, gradient stops and text are kept in shared pools of SurfaceRecording.
+struct DrawCommand {
+	DrawOp op;
+	uint8_t utf8;		// text encoding for text operations
+	uint16_t option;	// Ends, GradientOptions, image height or clip depth
+	uint32_t fore;		// stroke or text colour
+	uint32_t back;		// fill or text background colour
+	float width;		// stroke width, corner size, image width or ybase
+	PRectangle rc;		// rectangle, bounds of points, or start and end point for LineDraw
+	// offset into text pool or points pool, gradient stops are stored as (position, colour)
+	// and source origin for Copy is stored as one point.
+	uint32_t offset;
+	uint32_t length;	// count of points or bytes
+	bool operator==(const DrawCommand &other) const noexcept;
+};
+
+class SurfaceRecording final : public Surface {
+	int width;
+	int height;
+	SurfaceMode mode;
+	int clipDepth = 0;
+	std::vector<DrawCommand> commands;
+	std::vector<Point> points;
+	std::string text;
+	// optional content of each pixel row, see TrackRows().
+	bool trackRows = false;
+	size_t copiedCount = 0;
+	std::vector<std::string> rows;
+
+	void SCICALL Record(DrawOp op, PRectangle rc, ColourRGBA fore, ColourRGBA back, XYPOSITION width_, unsigned option = 0);
+	void SCICALL RecordPoints(DrawOp op, const Point *pts, size_t npts, ColourRGBA fore, ColourRGBA back, XYPOSITION width_);
+	void SCICALL RecordText(DrawOp op, bool utf8, PRectangle rc, XYPOSITION ybase, std::string_view sv, ColourRGBA fore, ColourRGBA back);
+	void SCICALL Measure(const Font *font_, std::string_view sv, XYPOSITION *positions, bool utf8) const noexcept;
+	std::string Dump(size_t start, size_t end) const;
+
+public:
+	explicit SurfaceRecording(int width_ = 0, int height_ = 0) noexcept;
+
+	void Init(WindowID wid) noexcept override;
+	void Init(SurfaceID sid, WindowID wid, bool printing = false) noexcept override;
+	std::unique_ptr<Surface> AllocatePixMap(int width_, int height_) override;
+
+	void SetMode(SurfaceMode mode_) noexcept override;
+	void SetRenderingParams(void *defaultRenderingParams, void *customRenderingParams) noexcept override;
+
+	void Release() noexcept override;
+	bool SupportsFeature(Scintilla::Supports feature) const noexcept override;
+	bool Initialised() const noexcept override;
+	int LogPixelsY() const noexcept override;
+	int PixelDivisions() const noexcept override;
+	int DeviceHeightFont(int points) const noexcept override;
+	void SCICALL LineDraw(Point start, Point end, Stroke stroke) override;
+	void SCICALL PolyLine(const Point *pts, size_t npts, Stroke stroke) override;
+	void SCICALL Polygon(const Point *pts, size_t npts, FillStroke fillStroke) override;
+	void SCICALL RectangleDraw(PRectangle rc, FillStroke fillStroke) override;
+	void SCICALL RectangleFrame(PRectangle rc, Stroke stroke) override;
+	void SCICALL FillRectangle(PRectangle rc, Fill fill) override;
+	void SCICALL FillRectangleAligned(PRectangle rc, Fill fill) override;
+	void SCICALL FillRectangle(PRectangle rc, Surface &surfacePattern) override;
+	void SCICALL RoundedRectangle(PRectangle rc, FillStroke fillStroke) override;
+	void SCICALL AlphaRectangle(PRectangle rc, XYPOSITION cornerSize, FillStroke fillStroke) override;
+	void SCICALL GradientRectangle(PRectangle rc, const std::vector<ColourStop> &stops, GradientOptions options) override;
+	void SCICALL DrawRGBAImage(PRectangle rc, int width_, int height_, const unsigned char *pixelsImage) override;
+	void SCICALL Ellipse(PRectangle rc, FillStroke fillStroke) override;
+	void SCICALL Stadium(PRectangle rc, FillStroke fillStroke, Ends ends) override;
+	void SCICALL Copy(PRectangle rc, Point from, Surface &surfaceSource) override;
+
+	std::unique_ptr<IScreenLineLayout> Layout(const IScreenLine *screenLine) override;
+
+	void SCICALL DrawTextNoClip(PRectangle rc, const Font *font_, XYPOSITION ybase, std::string_view sv, ColourRGBA fore, ColourRGBA back) override;
+	void SCICALL DrawTextClipped(PRectangle rc, const Font *font_, XYPOSITION ybase, std::string_view sv, ColourRGBA fore, ColourRGBA back) override;
+	void SCICALL DrawTextTransparent(PRectangle rc, const Font *font_, XYPOSITION ybase, std::string_view sv, ColourRGBA fore) override;
+	void SCICALL MeasureWidths(const Font *font_, std::string_view sv, XYPOSITION *positions) override;
+	XYPOSITION WidthText(const Font *font_, std::string_view sv) override;
+
+	void SCICALL DrawTextNoClipUTF8(PRectangle rc, const Font *font_, XYPOSITION ybase, std::string_view sv, ColourRGBA fore, ColourRGBA back) override;
+	void SCICALL DrawTextClippedUTF8(PRectangle rc, const Font *font_, XYPOSITION ybase, std::string_view sv, ColourRGBA fore, ColourRGBA back) override;
+	void SCICALL DrawTextTransparentUTF8(PRectangle rc, const Font *font_, XYPOSITION ybase, std::string_view sv, ColourRGBA fore) override;
+	void SCICALL MeasureWidthsUTF8(const Font *font_, std::string_view sv, XYPOSITION *positions) override;
+	XYPOSITION WidthTextUTF8(const Font *font_, std::string_view sv) override;
+
+	XYPOSITION Ascent(const Font *font_) noexcept override;
+	XYPOSITION Descent(const Font *font_) noexcept override;
+	XYPOSITION InternalLeading(const Font *font_) noexcept override;
+	XYPOSITION Height(const Font *font_) noexcept override;
+	XYPOSITION AverageCharWidth(const Font *font_) override;
+
+	void SCICALL SetClip(PRectangle rc) noexcept override;
+	void PopClip() noexcept override;
+	void FlushCachedState() noexcept override;
+	void FlushDrawing() noexcept override;
+
+	// size passed to AllocatePixMap()
+	Point PixMapSize() const noexcept {
+		return Point(width, height);
+	}
+	// display list access
+	const std::vector<DrawCommand> &Commands() const noexcept {
+		return commands;
+	}
+	size_t Count(DrawOp op) const noexcept;
+	std::string_view Text(const DrawCommand &command) const noexcept;
+	const Point *Points(const DrawCommand &command) const noexcept;
+	// same commands with same points and text
+	bool SameDrawing(const SurfaceRecording &other) const noexcept;
+	// one line per command, stable across runs and platforms for diffing.
+	std::string Dump() const;
+	// clear display list, content of rows is kept.
+	void Clear() noexcept;
+	// track content of pixel rows for this surface. Rows copied from an untracked source get
+	// dump of commands drawn on the source since its previous copy, rows copied from a tracked
+	// source get its rows. Direct drawing and x position are ignored.
+	void TrackRows(bool track);
+	const std::vector<std::string> &Rows() const noexcept {
+		return rows;
+	}
+};
+
+}
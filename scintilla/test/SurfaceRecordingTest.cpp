@@ -0,0 +1,226 @@
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+// Test for recording Surface, draws indicators and line markers with Scintilla's own painting code,
+// checks metrics and that same drawing produces same display list, then benchmarks painting
+// frames of a scrolling margin without a window.
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cassert>
+#include <algorithm>
+#include <iterator>
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <optional>
+#include <memory>
+
+#include "SurfaceRecording.h"
+#include "Indicator.h"
+#include "XPM.h"
+#include "LineMarker.h"
+
+// g++ -std=gnu++17 -O2 -Wall -Wextra -I../include -I../src SurfaceRecordingTest.cpp SurfaceRecording.cpp ../src/Geometry.cxx ../src/Indicator.cxx ../src/LineMarker.cxx ../src/XPM.cxx ../src/UniConversion.cxx
+// cl /EHsc /std:c++17 /O2 /W4 /I../include /I../src SurfaceRecordingTest.cpp SurfaceRecording.cpp ../src/Geometry.cxx ../src/Indicator.cxx ../src/LineMarker.cxx ../src/XPM.cxx ../src/UniConversion.cxx
+// usage: a.out [frames [dump]], benchmark painting frames, optionally write display list of one frame to dump file.
+
+using namespace Scintilla;
+using namespace Scintilla::Internal;
+
+namespace {
+
+constexpr IndicatorStyle lastIndicatorStyle = IndicatorStyle::PointTop;
+constexpr MarkerSymbol lastMarkerSymbol = MarkerSymbol::Bar;
+
+const char * const xpmBookmark[] = {
+	"4 4 2 1",
+	". c None",
+	"# c #0000FF",
+	".##.",
+	"####",
+	"####",
+	".##.",
+};
+
+void TestMetrics() {
+	SurfaceRecording surface;
+	FontRecording font{FontParameters{"Consolas", 10}};
+	assert(font.cellWidth == 6 && surface.Ascent(&font) == 8 && surface.Descent(&font) == 3);
+	assert(surface.Height(&font) == 11 && surface.AverageCharWidth(&font) == 6);
+	assert(surface.DeviceHeightFont(9) == 12);
+
+	// a, U+4E2D, b, invalid byte
+	constexpr std::string_view text{"a\xE4\xB8\xAD" "b\xFF"};
+	XYPOSITION positions[text.length()];
+	surface.MeasureWidthsUTF8(&font, text, positions);
+	const XYPOSITION expected[] = {6, 18, 18, 18, 24, 30};
+	assert(memcmp(positions, expected, sizeof(expected)) == 0);
+	assert(surface.WidthTextUTF8(&font, text) == 30);
+	assert(surface.WidthTextUTF8(&font, "\xF0\x9F\x98\x80") == 12);	// GRINNING FACE
+
+	// double byte code page
+	SurfaceMode mode;
+	mode.codePage = 936;
+	surface.SetMode(mode);
+	surface.MeasureWidths(&font, "a\xD6\xD0", positions);
+	assert(positions[0] == 6 && positions[1] == 18 && positions[2] == 18);
+
+	font.UseProportionalWidths();
+	assert(surface.WidthTextUTF8(&font, "iW") == 3 + 9);
+	assert(surface.WidthTextUTF8(&font, "\xE4\xB8\xAD") == 12);
+}
+
+void TestDisplayList() {
+	SurfaceRecording surface;
+	const FontRecording font{FontParameters{"Consolas", 10}};
+	surface.SetClip(PRectangle(0, 0, 100, 20));
+	surface.FillRectangle(PRectangle(0, 0, 100, 20), Fill(white));
+	surface.DrawTextClippedUTF8(PRectangle(0, 0, 100, 20), &font, 15, "a\"\xE4\xB8\xAD", black, white);
+	const Point pts[] = {Point(1, 5), Point(4, 2), Point(7, 5)};
+	surface.Polygon(pts, std::size(pts), FillStroke(ColourRGBA(0xff, 0, 0)));
+	surface.GradientRectangle(PRectangle(0, 0, 10, 10), {ColourStop(0, black), ColourStop(1, white)}, Surface::GradientOptions::topToBottom);
+	surface.PopClip();
+
+	assert(surface.Commands().size() == 6 && surface.Count(DrawOp::Polygon) == 1);
+	const DrawCommand &polygon = surface.Commands()[3];
+	assert(polygon.length == 3 && surface.Points(polygon)[2] == Point(7, 5));
+	assert(polygon.rc == PRectangle(1, 2, 7, 5));
+	assert(surface.Text(surface.Commands()[2]) == "a\"\xE4\xB8\xAD");
+	const std::string dump = surface.Dump();
+	assert(dump ==
+		"SetClip 0,0,100,20 #FF000000 #FF000000 0 0\n"
+		"FillRectangle 0,0,100,20 #FFFFFFFF #FFFFFFFF 0 0\n"
+		"DrawTextClipped 0,0,100,20 #FF000000 #FFFFFFFF 15 0 u\"a\\x22\\xE4\\xB8\\xAD\"\n"
+		"Polygon 1,2,7,5 #FF0000FF #FF0000FF 1 0 (1,5) (4,2) (7,5)\n"
+		"GradientRectangle 0,0,10,10 #00000000 #00000000 0 1 (0,#FF000000) (1,#FFFFFFFF)\n"
+		"PopClip 0,0,0,0 #FF000000 #FF000000 0 0\n");
+	surface.Clear();
+	assert(surface.Commands().empty() && surface.Dump().empty());
+}
+
+// one line of margin and text area, with every indicator style and marker symbol on some line.
+void PaintLine(Surface &surface, const Font *font, int line, int lineHeight, const std::vector<LineMarker> &markers) {
+	constexpr int marginWidth = 16;
+	constexpr int width = 400;
+	const XYPOSITION top = static_cast<XYPOSITION>(line) * lineHeight;
+	const PRectangle rcMargin(0, top, marginWidth, top + lineHeight);
+	surface.FillRectangle(rcMargin, Fill(ColourRGBA(0xf0, 0xf0, 0xf0)));
+	const LineMarker &marker = markers[line % markers.size()];
+	constexpr LineMarker::FoldPart parts[] = {
+		LineMarker::FoldPart::undefined, LineMarker::FoldPart::head, LineMarker::FoldPart::body,
+		LineMarker::FoldPart::tail, LineMarker::FoldPart::headWithTail,
+	};
+	marker.Draw(&surface, rcMargin, font, parts[line % std::size(parts)], MarginType::Symbol);
+
+	const PRectangle rcLine(marginWidth, top, width, top + lineHeight);
+	surface.FillRectangleAligned(rcLine, Fill(white));
+	const std::string text = "line " + std::to_string(line) + " \xE4\xB8\xAD\xE6\x96\x87 text";
+	const XYPOSITION textWidth = surface.WidthTextUTF8(font, text);
+	const PRectangle rcText(marginWidth, top, marginWidth + textWidth, top + lineHeight);
+	surface.DrawTextNoClipUTF8(rcText, font, top + surface.Ascent(font), text, black, white);
+
+	const IndicatorStyle style = static_cast<IndicatorStyle>(line % (static_cast<int>(lastIndicatorStyle) + 1));
+	const Indicator indicator{style, ColourRGBA(0, 0x80, 0)};
+	const PRectangle rcIndic(marginWidth + 6, top, marginWidth + 42, top + lineHeight);
+	indicator.Draw(&surface, rcIndic, rcLine, rcIndic, (line & 1) ? Indicator::State::hover : Indicator::State::normal, 0);
+}
+
+std::vector<LineMarker> AllMarkers() {
+	std::vector<LineMarker> markers;
+	for (int symbol = 0; symbol <= static_cast<int>(lastMarkerSymbol); symbol++) {
+		LineMarker &marker = markers.emplace_back();
+		marker.markType = static_cast<MarkerSymbol>(symbol);
+		marker.fore = ColourRGBA(0x20, 0x20, 0x80);
+		marker.back = ColourRGBA(0xc0, 0xc0, 0xff);
+		if (marker.markType == MarkerSymbol::Pixmap) {
+			marker.SetXPM(xpmBookmark);
+		} else if (marker.markType == MarkerSymbol::RgbaImage) {
+			const unsigned char pixels[2*2*4] = {0xff, 0, 0, 0xff, 0, 0xff, 0, 0xff, 0, 0, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80};
+			marker.SetRGBAImage(Point(2, 2), 1.0f, pixels);
+		}
+	}
+	LineMarker &marker = markers.emplace_back();
+	marker.markType = static_cast<MarkerSymbol>(static_cast<int>(MarkerSymbol::Character) + 0x263A);	// WHITE SMILING FACE
+	return markers;
+}
+
+void PaintFrame(Surface &surface, const Font *font, int firstLine, int linesOnScreen, int lineHeight, const std::vector<LineMarker> &markers) {
+	for (int line = firstLine; line < firstLine + linesOnScreen; line++) {
+		PaintLine(surface, font, line, lineHeight, markers);
+	}
+}
+
+void TestDeterministic() {
+	const std::vector<LineMarker> markers = AllMarkers();
+	const FontRecording font{FontParameters{"Consolas", 13}};
+	constexpr int lines = 2*(static_cast<int>(lastIndicatorStyle) + 1)*(static_cast<int>(lastMarkerSymbol) + 2);
+	SurfaceRecording first;
+	SurfaceRecording second;
+	PaintFrame(first, &font, 0, lines, 16, markers);
+	PaintFrame(second, &font, 0, lines, 16, markers);
+	assert(first.SameDrawing(second) && first.Dump() == second.Dump());
+	assert(first.Count(DrawOp::DrawRGBAImage) != 0 && first.Count(DrawOp::DrawTextNoClip) > static_cast<size_t>(lines));
+
+	// each indicator style except hidden and text fore draws something
+	for (int style = 0; style <= static_cast<int>(lastIndicatorStyle); style++) {
+		SurfaceRecording surface;
+		const Indicator indicator{static_cast<IndicatorStyle>(style)};
+		const PRectangle rc(10, 0, 40, 16);
+		indicator.Draw(&surface, rc, rc, rc, Indicator::State::normal, 0);
+		const bool empty = surface.Commands().empty();
+		const bool invisible = style == static_cast<int>(IndicatorStyle::Hidden) || style == static_cast<int>(IndicatorStyle::TextFore);
+		if (empty != invisible) {
+			printf("indicator style %d %s\n", style, empty ? "draws nothing" : "is visible");
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	// different scroll position produces different drawing
+	SurfaceRecording scrolled;
+	PaintFrame(scrolled, &font, 1, lines, 16, markers);
+	assert(!first.SameDrawing(scrolled));
+	printf("checked %zu commands for %d lines\n", first.Commands().size(), lines);
+}
+
+using Clock = std::chrono::steady_clock;
+
+void Benchmark(int frames, const char *dumpPath) {
+	const std::vector<LineMarker> markers = AllMarkers();
+	const FontRecording font{FontParameters{"Consolas", 13}};
+	constexpr int linesOnScreen = 60;
+	constexpr int lineHeight = 16;
+	SurfaceRecording surface{400, linesOnScreen*lineHeight};
+	size_t commands = 0;
+	const auto start = Clock::now();
+	for (int frame = 0; frame < frames; frame++) {
+		// scroll down one line per frame
+		surface.Clear();
+		PaintFrame(surface, &font, frame, linesOnScreen, lineHeight, markers);
+		commands += surface.Commands().size();
+	}
+	const double duration = std::chrono::duration<double>(Clock::now() - start).count();
+	printf("%d frames, %.1f commands/frame, %.2f us/frame\n", frames,
+		static_cast<double>(commands)/frames, duration*1e6/frames);
+	if (dumpPath) {
+		FILE *fp = fopen(dumpPath, "wb");
+		if (fp) {
+			const std::string dump = surface.Dump();
+			fwrite(dump.data(), 1, dump.size(), fp);
+			fclose(fp);
+		}
+	}
+}
+
+}
+
+int main(int argc, char *argv[]) {
+	TestMetrics();
+	TestDisplayList();
+	TestDeterministic();
+	const int frames = (argc > 1) ? atoi(argv[1]) : 1000;
+	Benchmark(std::max(frames, 1), (argc > 2) ? argv[2] : nullptr);
+	return 0;
+}
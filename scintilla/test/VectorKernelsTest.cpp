@@ -0,0 +1,187 @@
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+// Test and benchmark for runtime dispatched kernels, each variant supported by current CPU
+// is forced and checked against the scalar variant.
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cassert>
+#include <chrono>
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../include/VectorKernels.h"
+
+// g++ -std=gnu++17 -O2 -Wall -Wextra -I../include VectorKernelsTest.cpp ../src/VectorKernels.cxx
+// cl /EHsc /std:c++17 /O2 /W4 /I../include VectorKernelsTest.cpp ../src/VectorKernels.cxx
+// usage: a.out [file [repeat]], benchmark each variant with file content.
+
+using namespace np2;
+
+namespace {
+
+struct KernelResult {
+	LineEndingCount count;
+	bool utf8;
+	bool ascii;
+	bool binary;
+	const char *found;
+};
+
+KernelResult RunKernels(const std::string &text, const std::string &pattern) {
+	KernelResult result{};
+	// copy into exactly sized buffer to let sanitizer catch overread
+	std::vector<char> buffer(text.begin(), text.end());
+	const char *data = buffer.data();
+	vectorKernels.CountLineEndings(data, buffer.size(), result.count);
+	result.utf8 = vectorKernels.IsValidUTF8(data, buffer.size());
+	result.ascii = vectorKernels.AllASCII(data, buffer.size());
+	result.binary = vectorKernels.MaybeBinary(data, buffer.size());
+	if (!pattern.empty()) {
+		const char *found = vectorKernels.FindSubstring(data, buffer.size(), pattern.data(), pattern.size());
+		result.found = found ? text.data() + (found - data) : nullptr;
+	}
+	return result;
+}
+
+bool SameResult(const KernelResult &a, const KernelResult &b) noexcept {
+	return a.count.CRLF == b.count.CRLF && a.count.CR == b.count.CR && a.count.LF == b.count.LF
+		&& a.utf8 == b.utf8 && a.ascii == b.ascii && a.binary == b.binary && a.found == b.found;
+}
+
+// build text from a small alphabet, so line endings, UTF-8 sequences and matches are dense.
+std::string RandomText(std::mt19937 &rng, size_t length) {
+	static const char * const pieces[] = {
+		"a", "b", "ab", " ", "\r", "\n", "\r\n", "\t", "\xC3\xA9", "\xE4\xB8\xAD", "\xF0\x9F\x98\x80",
+		"\x80", "\xC0\xAF", "\xED\xA0\x80", "\xF4\x90\x80\x80", "\xE4\xB8", "\0", "\x1A",
+	};
+	std::uniform_int_distribution<size_t> pick{0, std::size(pieces) - 1};
+	std::uniform_int_distribution<int> invalid{0, 7};
+	const bool valid = invalid(rng) != 0;
+	std::string text;
+	while (text.size() < length) {
+		size_t index = pick(rng);
+		if (valid && index >= 11) {
+			index = 0;
+		}
+		const char *piece = pieces[index];
+		text.append(piece, *piece ? strlen(piece) : 1);
+	}
+	text.resize(length);
+	return text;
+}
+
+void TestKnownResult() {
+	SelectVectorKernels(ISALevel::Scalar);
+	KernelResult result = RunKernels("a\r\nb\rc\nd\n\r", "c\n");
+	assert(result.count.CRLF == 1 && result.count.CR == 2 && result.count.LF == 2);
+	assert(result.utf8 && result.ascii && result.found != nullptr);
+	result = RunKernels("\xE4\xB8\xAD\xE6\x96\x87", "\x96");
+	assert(result.utf8 && !result.ascii && result.found != nullptr);
+	assert(!RunKernels("\xE4\xB8", {}).utf8);
+	assert(!RunKernels("\xED\xA0\x80", {}).utf8);
+	assert(!RunKernels("a\x1A\tb\x01\r\n", {}).binary);
+	assert(RunKernels("a\x1A\x01", {}).binary);
+	assert(!RunKernels("\x01-\x02-\x03-\x04-\x05-\x06-\x07-", {}).binary);
+	assert(RunKernels("\x01-\x02-\x03-\x04-\x05-\x06-\x07-\x08", {}).binary);
+}
+
+using Clock = std::chrono::steady_clock;
+
+template <typename Kernel>
+void Measure(const char *name, const std::vector<char> &text, int repeat, Kernel kernel) {
+	size_t result = 0;
+	const auto start = Clock::now();
+	for (int i = 0; i < repeat; i++) {
+		result += kernel(text.data(), text.size());
+	}
+	const double duration = std::chrono::duration<double>(Clock::now() - start).count();
+	printf("  %-16s %10.2f MiB/s  (%zu)\n", name, text.size()*static_cast<double>(repeat)/1048576.0/duration, result);
+}
+
+void Benchmark(const char *path, int repeat) {
+	FILE *fp = fopen(path, "rb");
+	if (fp == nullptr) {
+		fprintf(stderr, "cannot open %s\n", path);
+		return;
+	}
+	std::vector<char> text;
+	char chunk[64*1024];
+	size_t count;
+	while ((count = fread(chunk, 1, sizeof(chunk), fp)) != 0) {
+		text.insert(text.end(), chunk, chunk + count);
+	}
+	fclose(fp);
+	printf("%s: %.2f MiB x %d\n", path, text.size()/1048576.0, repeat);
+
+	const ISALevel detected = DetectISALevel();
+	for (ISALevel level = ISALevel::Scalar; level <= detected; level = static_cast<ISALevel>(static_cast<int>(level) + 1)) {
+		SelectVectorKernels(level);
+		printf("%s\n", GetISALevelName(level));
+		Measure("CountLineEndings", text, repeat, [](const char *data, size_t length) {
+			LineEndingCount lines{};
+			vectorKernels.CountLineEndings(data, length, lines);
+			return lines.CRLF + lines.CR + lines.LF;
+		});
+		Measure("IsValidUTF8", text, repeat, [](const char *data, size_t length) {
+			return static_cast<size_t>(vectorKernels.IsValidUTF8(data, length));
+		});
+		Measure("AllASCII", text, repeat, [](const char *data, size_t length) {
+			return static_cast<size_t>(vectorKernels.AllASCII(data, length));
+		});
+		Measure("MaybeBinary", text, repeat, [](const char *data, size_t length) {
+			return static_cast<size_t>(vectorKernels.MaybeBinary(data, length));
+		});
+		Measure("FindSubstring", text, repeat, [](const char *data, size_t length) {
+			// unlikely to be found
+			const char *found = vectorKernels.FindSubstring(data, length, "}\x7f{", 3);
+			return static_cast<size_t>(found ? found - data : length);
+		});
+	}
+}
+
+}
+
+int main(int argc, char *argv[]) {
+	TestKnownResult();
+	const ISALevel detected = DetectISALevel();
+	printf("detected: %s\n", GetISALevelName(detected));
+
+	std::mt19937 rng{20240501};
+	std::uniform_int_distribution<size_t> patternLength{1, 9};
+	size_t checked = 0;
+	for (size_t length = 0; length < 600; length++) {
+		for (int round = 0; round < 8; round++) {
+			const std::string text = RandomText(rng, length);
+			std::string pattern;
+			if (length != 0 && round != 0) {
+				// pattern from the text and from random pieces
+				const size_t count = std::min(patternLength(rng), length);
+				const size_t start = std::uniform_int_distribution<size_t>{0, length - count}(rng);
+				pattern = (round & 1) ? text.substr(start, count) : RandomText(rng, count);
+			}
+
+			SelectVectorKernels(ISALevel::Scalar);
+			const KernelResult expected = RunKernels(text, pattern);
+			for (ISALevel level = ISALevel::SSE2; level <= detected; level = static_cast<ISALevel>(static_cast<int>(level) + 1)) {
+				SelectVectorKernels(level);
+				const KernelResult result = RunKernels(text, pattern);
+				if (!SameResult(expected, result)) {
+					printf("%s mismatch at length %zu round %d\n", GetISALevelName(level), length, round);
+					return EXIT_FAILURE;
+				}
+				++checked;
+			}
+		}
+	}
+
+	SelectVectorKernels(ISALevel::AVX512BW);
+	printf("checked %zu inputs, active: %s\n", checked, GetISALevelName(vectorKernels.level));
+	if (argc > 1) {
+		Benchmark(argv[1], (argc > 2) ? atoi(argv[2]) : 10);
+	}
+	return 0;
+}
@@ -30,6 +30,11 @@ struct IUnknown;
 #include <string>
 #include <string_view>
 #include <memory>
+#include <vector>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
 
 #include "SciCall.h"
 #include "VectorISA.h"
@@ -755,18 +760,233 @@ constexpr int GetRTFFontSize(int size) noexcept {
 	return size / (SC_FONT_SIZE_MULTIPLIER / 2);
 }
 
-std::string SaveToStreamRTF(const char *styledText, size_t textLength, Sci_Position startPos, Sci_Position endPos) {
+// same as Document::GetCharacterAndWidth() for UTF-8, invalid byte is reported as singleton surrogate.
+unsigned GetUTF8CharacterAndWidth(const char *text, unsigned &width) noexcept {
+	const uint8_t *ptr = reinterpret_cast<const uint8_t *>(text);
+	const unsigned lead = ptr[0];
+	unsigned trail = 0;
+	unsigned character = 0;
+	uint8_t lower = 0x80;
+	uint8_t upper = 0xBF;
+	width = 1;
+	if (lead >= 0xC2 && lead <= 0xDF) {
+		trail = 1;
+		character = lead & 0x1F;
+	} else if (lead >= 0xE0 && lead <= 0xEF) {
+		trail = 2;
+		character = lead & 0x0F;
+		lower = (lead == 0xE0) ? 0xA0 : lower;
+		upper = (lead == 0xED) ? 0x9F : upper;
+	} else if (lead >= 0xF0 && lead <= 0xF4) {
+		trail = 3;
+		character = lead & 0x07;
+		lower = (lead == 0xF0) ? 0x90 : lower;
+		upper = (lead == 0xF4) ? 0x8F : upper;
+	} else {
+		return 0xDC80 + lead;
+	}
+	// text is NUL terminated, NUL is not a trail byte
+	if (ptr[1] < lower || ptr[1] > upper) {
+		return 0xDC80 + lead;
+	}
+	character = (character << 6) | (ptr[1] & 0x3F);
+	for (unsigned i = 2; i <= trail; i++) {
+		if ((ptr[i] & 0xC0) != 0x80) {
+			return 0xDC80 + lead;
+		}
+		character = (character << 6) | (ptr[i] & 0x3F);
+	}
+	width = trail + 1;
+	return character;
+}
+
+// Styled text is split into chunks on line boundary, chunks are formatted independently
+// on worker threads (without calling into Scintilla), then written out in document order.
+constexpr size_t StyledTextChunkSize = 1024*1024;
+
+struct StyledTextExporter {
+	const char * const styledText;
+	const char * const textBuffer;
+	const size_t textLength;
+	DocumentStyledText document;
+	UINT legacyACP;
+	bool tabsAsSpaces;
+	unsigned tabWidth;
+	std::unique_ptr<std::string[]> styles;
 	uint8_t styleMap[STYLE_MAX + 1];
-	const auto [styleList, styleCount, cpEdit] = GetDocumentStyledText(styleMap, styledText, textLength);
-	const std::unique_ptr<std::string[]> styles = make_unique_for_overwrite<std::string[]>(styleCount);
-	const std::unique_ptr<LPCSTR[]> fontList = make_unique_for_overwrite<LPCSTR[]>(styleCount);
-	const std::unique_ptr<COLORREF[]> colorList = make_unique_for_overwrite<COLORREF[]>(2*styleCount);
 
-	UINT legacyACP = cpEdit;
-	if (legacyACP == SC_CP_UTF8 || legacyACP == 0) {
-		legacyACP = mEncoding[CPI_DEFAULT].uCodePage;
+	StyledTextExporter(const char *styledText_, size_t textLength_):
+		styledText{styledText_}, textBuffer{styledText_ + textLength_ + 1}, textLength{textLength_} {
+		document = GetDocumentStyledText(styleMap, styledText, textLength);
+		legacyACP = document.cpEdit;
+		if (legacyACP == SC_CP_UTF8 || legacyACP == 0) {
+			legacyACP = mEncoding[CPI_DEFAULT].uCodePage;
+		}
+		tabsAsSpaces = fvCurFile.bTabsAsSpaces;
+		tabWidth = fvCurFile.iTabWidth;
+		styles = std::make_unique<std::string[]>(document.styleCount);
 	}
 
+	unsigned StyleAt(size_t offset) const noexcept {
+		return styleMap[static_cast<uint8_t>(styledText[offset])];
+	}
+
+	// style of the line end for line starts at offset, -1 when the line end is not inside the text.
+	int GetLineEndStyle(size_t offset) const noexcept {
+		while (offset < textLength) {
+			const char ch = textBuffer[offset];
+			if (IsEOLChar(ch)) {
+				if (ch == '\r' && textBuffer[offset + 1] == '\n') {
+					offset += 1;
+				}
+				return (offset + 1 < textLength) ? static_cast<int>(StyleAt(offset)) : -1;
+			}
+			++offset;
+		}
+		return -1;
+	}
+
+	// chunk boundaries, first is 0 and last is textLength.
+	std::vector<size_t> Split() const {
+		std::vector<size_t> bounds{0};
+		size_t offset = 0;
+		while (textLength - offset > StyledTextChunkSize) {
+			offset += StyledTextChunkSize;
+			while (offset < textLength && !IsEOLChar(textBuffer[offset])) {
+				++offset;
+			}
+			if (textBuffer[offset] == '\r' && textBuffer[offset + 1] == '\n') {
+				offset += 1;
+			}
+			offset += 1;
+			if (offset >= textLength) {
+				break;
+			}
+			bounds.push_back(offset);
+		}
+		bounds.push_back(textLength);
+		return bounds;
+	}
+};
+
+using StyledTextFormatter = void (*)(const StyledTextExporter &exporter, std::string &output, size_t startPos, size_t endPos);
+// writer may move content out of output.
+using StyledTextWriter = std::function<bool(std::string &output)>;
+
+bool FormatStyledText(const StyledTextExporter &exporter, StyledTextFormatter formatter, const StyledTextWriter &writer) {
+	const std::vector<size_t> bounds = exporter.Split();
+	const size_t chunkCount = bounds.size() - 1;
+	const unsigned threadCount = static_cast<unsigned>(min<size_t>(chunkCount, max(std::thread::hardware_concurrency(), 1U)));
+	if (threadCount <= 1) {
+		std::string output;
+		for (size_t index = 0; index < chunkCount; index++) {
+			formatter(exporter, output, bounds[index], bounds[index + 1]);
+			if (!writer(output)) {
+				return false;
+			}
+			output.clear();
+		}
+		return true;
+	}
+
+	// formatting is at most window chunks ahead of writing to limit memory usage.
+	const size_t window = 2*threadCount;
+	const std::unique_ptr<std::string[]> outputs = std::make_unique<std::string[]>(chunkCount);
+	const std::unique_ptr<bool[]> finished = std::make_unique<bool[]>(chunkCount);
+	std::mutex mutex;
+	std::condition_variable condition;
+	size_t next = 0;
+	size_t written = 0;
+	bool failed = false;
+
+	const auto worker = [&]() {
+		while (true) {
+			size_t index;
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				condition.wait(lock, [&] {
+					return failed || next >= chunkCount || next < written + window;
+				});
+				if (failed || next >= chunkCount) {
+					return;
+				}
+				index = next++;
+			}
+			bool success = true;
+			try {
+				formatter(exporter, outputs[index], bounds[index], bounds[index + 1]);
+			} catch (...) {
+				success = false;
+			}
+			{
+				const std::lock_guard<std::mutex> lock(mutex);
+				finished[index] = true;
+				failed |= !success;
+			}
+			condition.notify_all();
+		}
+	};
+
+	std::vector<std::thread> threads;
+	bool success = true;
+	try {
+		for (unsigned i = 0; i < threadCount; i++) {
+			threads.emplace_back(worker);
+		}
+	} catch (...) {
+		success = false;
+	}
+
+	for (size_t index = 0; index < chunkCount && success && !threads.empty(); index++) {
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			condition.wait(lock, [&] {
+				return failed || finished[index];
+			});
+			success = !failed;
+		}
+		if (success) {
+			success = writer(outputs[index]);
+			std::string{}.swap(outputs[index]);
+		}
+		{
+			const std::lock_guard<std::mutex> lock(mutex);
+			written = index + 1;
+			failed |= !success;
+		}
+		condition.notify_all();
+	}
+
+	if (!success) {
+		const std::lock_guard<std::mutex> lock(mutex);
+		failed = true;
+	}
+	condition.notify_all();
+	for (std::thread &thread : threads) {
+		thread.join();
+	}
+	return success && !threads.empty();
+}
+
+// paragraph background is determined by style of the line end.
+unsigned GetRTFParagraphBackground(const StyledTextExporter &exporter, size_t startPos, bool &eolFilled) noexcept {
+	constexpr uint8_t defaultBackground = 2; // omitted default, STYLE_DEFAULT foreColor, STYLE_DEFAULT backColor
+	int eolStyle = exporter.GetLineEndStyle(startPos);
+	if (eolStyle < 0 && startPos != 0) {
+		// last line inherits background from previous line
+		eolStyle = exporter.StyleAt(startPos - 1);
+	}
+	eolFilled = eolStyle >= 0 && exporter.document.styleList[eolStyle].eolFilled;
+	return eolFilled ? exporter.document.styleList[eolStyle].backIndex : defaultBackground;
+}
+
+std::string SaveToStreamRTFHeader(StyledTextExporter &exporter) {
+	StyleDefinition * const styleList = exporter.document.styleList.get();
+	const unsigned styleCount = exporter.document.styleCount;
+	const std::unique_ptr<LPCSTR[]> fontList = make_unique_for_overwrite<LPCSTR[]>(styleCount);
+	const std::unique_ptr<COLORREF[]> colorList = make_unique_for_overwrite<COLORREF[]>(2*styleCount);
+	const UINT legacyACP = exporter.legacyACP;
+
 	char fmtbuf[RTF_MAX_STYLEDEF];
 	memset(fmtbuf, 0, 4);
 	unsigned fmtlen = sprintf(fmtbuf, RTF_HEADEROPEN RTF_FONTDEFOPEN, legacyACP);
@@ -829,7 +1049,7 @@ std::string SaveToStreamRTF(const char *styledText, size_t textLength, Sci_Posit
 		osStyle += (definition.italic ? RTF_ITALIC_ON : RTF_ITALIC_OFF);
 		osStyle += (definition.underline ? RTF_UNDERLINE_ON : RTF_UNDERLINE_OFF);
 		osStyle += (definition.strike ? RTF_STRIKE_ON : RTF_STRIKE_OFF);
-		styles[styleIndex] = std::move(osStyle);
+		exporter.styles[styleIndex] = std::move(osStyle);
 	}
 
 	os += RTF_FONTDEFCLOSE RTF_COLORDEFOPEN;
@@ -841,36 +1061,36 @@ std::string SaveToStreamRTF(const char *styledText, size_t textLength, Sci_Posit
 	}
 	os += RTF_COLORDEFCLOSE RTF_HEADERCLOSE RTF_BODYOPEN;
 
+	// check eolFilled on first line
+	bool eolFilled;
+	const unsigned background = GetRTFParagraphBackground(exporter, 0, eolFilled);
+	fmtlen = sprintf(fmtbuf, RTF_PARAGRAPH_BEGIN, background);
+	os += std::string_view{fmtbuf, fmtlen};
+	return os;
+}
+
+void SaveToStreamRTF(const StyledTextExporter &exporter, std::string &os, size_t startPos, size_t endPos) {
+	const StyleDefinition * const styleList = exporter.document.styleList.get();
+	const char * const textBuffer = exporter.textBuffer;
+	const bool utf8 = exporter.document.cpEdit == SC_CP_UTF8;
+	char fmtbuf[RTF_MAX_STYLEDEF];
+	unsigned fmtlen;
+
 	const char *lastStyle = "";
 	unsigned styleCurrent = STYLE_MAX + 1;
 	unsigned column = 0;
-	// check eolFilled on first line
 	constexpr uint8_t defaultBackground = 2; // omitted default, STYLE_DEFAULT foreColor, STYLE_DEFAULT backColor
-	bool eolFilled = false;
-	unsigned background = defaultBackground;
-	unsigned highlight = 0;
-	{
-		const Sci_Line line = SciCall_LineFromPosition(startPos);
-		const Sci_Position pos = SciCall_PositionFromLine(line + 1);
-		if (pos < endPos) {
-			uint8_t eolStyle = styledText[2*(pos - startPos) - 1];
-			eolStyle = styleMap[eolStyle];
-			eolFilled = styleList[eolStyle].eolFilled;
-			if (eolFilled) {
-				background = styleList[eolStyle].backIndex;
-			}
-		}
-		fmtlen = sprintf(fmtbuf, RTF_PARAGRAPH_BEGIN, background);
-		os += std::string_view{fmtbuf, fmtlen};
-	}
-
-	const char * const textBuffer = styledText + textLength + 1;
-	for (size_t offset = 0; offset < textLength; offset++) {
-		uint8_t style = styledText[offset];
-		style = styleMap[style];
+	bool eolFilled;
+	unsigned background = GetRTFParagraphBackground(exporter, startPos, eolFilled);
+	// highlight is unknown at the start of chunks after the first one
+	unsigned highlight = (startPos == 0) ? 0 : ~0U;
+	os.reserve(endPos - startPos + (endPos - startPos)/2);
+
+	for (size_t offset = startPos; offset < endPos; offset++) {
+		const unsigned style = exporter.StyleAt(offset);
 		if (style != styleCurrent) {
 			styleCurrent = style;
-			const char * const currentStyle = styles[style].c_str();
+			const char * const currentStyle = exporter.styles[style].c_str();
 			GetRTFStyleChange(os, lastStyle, currentStyle);
 			lastStyle = currentStyle;
 			// detect background color change
@@ -893,15 +1113,13 @@ std::string SaveToStreamRTF(const char *styledText, size_t textLength, Sci_Posit
 		} else if (ch == '\\') {
 			sv = "\\\\";
 		} else if (ch == '\t') {
-			if (!fvCurFile.bTabsAsSpaces) {
+			if (!exporter.tabsAsSpaces) {
 				sv = RTF_TAB;
 			} else {
-				const unsigned tabWidth = fvCurFile.iTabWidth;
+				const unsigned tabWidth = exporter.tabWidth;
 				const unsigned padding = tabWidth - ((column - 1) % tabWidth);
 				column += padding;
-				for (unsigned itab = 0; itab < padding; itab++) {
-					os += ' ';
-				}
+				os.append(padding, ' ');
 			}
 		} else if (ch == '\r' || ch == '\n') {
 			sv = RTF_EOL;
@@ -910,11 +1128,8 @@ std::string SaveToStreamRTF(const char *styledText, size_t textLength, Sci_Posit
 				offset += 1;
 			}
 			// check eolFilled on next line
-			const Sci_Line line = SciCall_LineFromPosition(startPos + offset);
-			const Sci_Position pos = SciCall_PositionFromLine(line + 2);
-			if (pos < endPos) {
-				uint8_t eolStyle = styledText[2*(pos - startPos) - 1];
-				eolStyle = styleMap[eolStyle];
+			const int eolStyle = exporter.GetLineEndStyle(offset + 1);
+			if (eolStyle >= 0) {
 				bool changed = styleList[eolStyle].eolFilled;
 				if (changed) {
 					eolFilled = true;
@@ -934,10 +1149,9 @@ std::string SaveToStreamRTF(const char *styledText, size_t textLength, Sci_Posit
 					sv = {fmtbuf, fmtlen};
 				}
 			}
-		} else if (static_cast<signed char>(ch) < 0 && cpEdit == SC_CP_UTF8) {
-			const Sci_Position pos = startPos + offset;
-			Sci_Position width = 0;
-			const unsigned int u32 = SciCall_GetCharacterAndWidth(pos, &width);
+		} else if (static_cast<signed char>(ch) < 0 && utf8) {
+			unsigned width = 0;
+			const unsigned u32 = GetUTF8CharacterAndWidth(textBuffer + offset, width);
 			offset += width - 1;
 			if (u32 < 0x10000) {
 				fmtlen = sprintf(fmtbuf, "\\u%d?", static_cast<short>(u32));
@@ -957,11 +1171,162 @@ std::string SaveToStreamRTF(const char *styledText, size_t textLength, Sci_Posit
 			os += sv;
 		}
 	}
+}
+
+#define RTF_FOOTER	RTF_PARAGRAPH_END RTF_BODYCLOSE
+
+#define HTML_FOOTER	"</pre>\n</body>\n</html>\n"
+
+void AppendHTMLColor(std::string &os, const char *property, COLORREF color) {
+	char fmtbuf[64];
+	const unsigned fmtlen = sprintf(fmtbuf, "%s:#%02X%02X%02X;", property,
+		static_cast<int>(color & 0xff), static_cast<int>((color >> 8) & 0xff), static_cast<int>((color >> 16) & 0xff));
+	os += std::string_view{fmtbuf, fmtlen};
+}
+
+bool IsASCII(const char *text, size_t length) noexcept {
+	for (size_t i = 0; i < length; i++) {
+		if (static_cast<signed char>(text[i]) < 0) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// escape UTF-8 text, line endings are normalized to LF.
+void AppendHTMLText(std::string &os, const char *text, size_t length) {
+	const char * const end = text + length;
+	while (text < end) {
+		const char ch = *text++;
+		switch (ch) {
+		case '&':
+			os += "&amp;";
+			break;
+		case '<':
+			os += "&lt;";
+			break;
+		case '>':
+			os += "&gt;";
+			break;
+		case '\r':
+			if (text == end || *text != '\n') {
+				os += '\n';
+			}
+			break;
+		default:
+			os += ch;
+			break;
+		}
+	}
+}
 
-	os += RTF_PARAGRAPH_END RTF_BODYCLOSE;
+std::string SaveToStreamHTMLHeader(const StyledTextExporter &exporter, LPCWSTR pszTitle) {
+	const StyleDefinition * const styleList = exporter.document.styleList.get();
+	const unsigned styleCount = exporter.document.styleCount;
+	char fmtbuf[LF_FACESIZE * kMaxMultiByteCount + 64];
+	unsigned fmtlen;
+
+	std::string os{"<!DOCTYPE html>\n<html>\n<head>\n<meta charset=\"utf-8\">\n<title>"};
+	char title[MAX_PATH * kMaxMultiByteCount]{};
+	const int titleLen = WideCharToMultiByte(CP_UTF8, 0, pszTitle, -1, title, COUNTOF(title), nullptr, nullptr);
+	AppendHTMLText(os, title, max(titleLen - 1, 0));
+	os += "</title>\n<style>\n";
+
+	const StyleDefinition &base = styleList[0];
+	for (unsigned styleIndex = 0; styleIndex < styleCount; styleIndex++) {
+		const StyleDefinition &definition = styleList[styleIndex];
+		const bool root = styleIndex == 0;
+		if (root) {
+			os += "pre{";
+		} else {
+			fmtlen = sprintf(fmtbuf, ".s%u{", styleIndex);
+			os += std::string_view{fmtbuf, fmtlen};
+		}
+		if (root || strcmp(definition.fontFace, base.fontFace) != 0) {
+			fmtlen = sprintf(fmtbuf, "font-family:'%s';", definition.fontFace);
+			os += std::string_view{fmtbuf, fmtlen};
+		}
+		if (root || definition.fontSize != base.fontSize) {
+			const int fontSize = definition.fontSize;
+			fmtlen = sprintf(fmtbuf, "font-size:%d.%02dpt;", fontSize / SC_FONT_SIZE_MULTIPLIER, fontSize % SC_FONT_SIZE_MULTIPLIER);
+			os += std::string_view{fmtbuf, fmtlen};
+		}
+		if (root || definition.foreColor != base.foreColor) {
+			AppendHTMLColor(os, "color", definition.foreColor);
+		}
+		if (root || definition.backColor != base.backColor) {
+			AppendHTMLColor(os, "background-color", definition.backColor);
+		}
+		if (root || definition.weight != base.weight) {
+			fmtlen = sprintf(fmtbuf, "font-weight:%d;", definition.weight);
+			os += std::string_view{fmtbuf, fmtlen};
+		}
+		if (definition.italic) {
+			os += "font-style:italic;";
+		}
+		if (definition.underline || definition.strike) {
+			os += "text-decoration:";
+			os += definition.underline ? (definition.strike ? "underline line-through;" : "underline;") : "line-through;";
+		}
+		if (root) {
+			fmtlen = sprintf(fmtbuf, "tab-size:%u;", exporter.tabWidth);
+			os += std::string_view{fmtbuf, fmtlen};
+		}
+		os += "}\n";
+	}
+
+	os += "</style>\n</head>\n<body>\n<pre>";
 	return os;
 }
 
+void SaveToStreamHTML(const StyledTextExporter &exporter, std::string &os, size_t startPos, size_t endPos) {
+	const char * const textBuffer = exporter.textBuffer;
+	const bool utf8 = exporter.document.cpEdit == SC_CP_UTF8;
+	std::wstring wide;
+	std::string converted;
+	char fmtbuf[32];
+	os.reserve(endPos - startPos + (endPos - startPos)/2);
+
+	size_t offset = startPos;
+	while (offset < endPos) {
+		const unsigned style = exporter.StyleAt(offset);
+		size_t runEnd = offset + 1;
+		while (runEnd < endPos && exporter.StyleAt(runEnd) == style) {
+			++runEnd;
+		}
+		if (style != 0) {
+			const unsigned fmtlen = sprintf(fmtbuf, "<span class=\"s%u\">", style);
+			os += std::string_view{fmtbuf, fmtlen};
+		}
+
+		const char *text = textBuffer + offset;
+		size_t length = runEnd - offset;
+		if (!utf8 && !IsASCII(text, length)) {
+			// style run not split multi-byte character, so it can be converted as a whole.
+			wide.resize(length);
+			const int wideLen = MultiByteToWideChar(exporter.legacyACP, 0, text, static_cast<int>(length), wide.data(), static_cast<int>(length));
+			converted.resize(wideLen * kMaxMultiByteCount);
+			length = WideCharToMultiByte(CP_UTF8, 0, wide.data(), wideLen, converted.data(), static_cast<int>(converted.size()), nullptr, nullptr);
+			text = converted.data();
+		}
+		AppendHTMLText(os, text, length);
+
+		if (style != 0) {
+			os += "</span>";
+		}
+		offset = runEnd;
+	}
+}
+
+bool SaveStyledText(StyledTextExporter &exporter, bool html, LPCWSTR pszTitle, const StyledTextWriter &writer) {
+	std::string output = html ? SaveToStreamHTMLHeader(exporter, pszTitle) : SaveToStreamRTFHeader(exporter);
+	if (!writer(output) || !FormatStyledText(exporter, html ? SaveToStreamHTML : SaveToStreamRTF, writer)) {
+		return false;
+	}
+	output = html ? HTML_FOOTER : RTF_FOOTER;
+	return writer(output);
+}
+
 }
 
 namespace { // code pretty
@@ -1328,16 +1693,25 @@ void EditFormatCode(int menu) noexcept {
 
 		if (menu == IDM_EDIT_COPYRTF) {
 			// code from SciTEWin::CopyAsRTF()
-			const std::string output = SaveToStreamRTF(styledText.get(), textLength, startPos, endPos);
-			//printf("%s:\n%s\n", __func__, output.c_str());
-			const size_t len = output.length() + 1; // +1 for NUL
-			HGLOBAL handle = ::GlobalAlloc(GMEM_MOVEABLE | GMEM_ZEROINIT, len);
+			StyledTextExporter exporter{styledText.get(), textLength};
+			std::vector<std::string> output;
+			size_t len = 1; // +1 for NUL
+			const bool success = SaveStyledText(exporter, false, nullptr, [&output, &len](std::string &chunk) {
+				len += chunk.length();
+				output.push_back(std::move(chunk));
+				return true;
+			});
+			HGLOBAL handle = success ? ::GlobalAlloc(GMEM_MOVEABLE | GMEM_ZEROINIT, len) : nullptr;
 			if (handle) {
 				::OpenClipboard(hwndMain);
 				::EmptyClipboard();
 				char *ptr = static_cast<char *>(::GlobalLock(handle));
 				if (ptr) {
-					memcpy(ptr, output.c_str(), len);
+					for (std::string &chunk : output) {
+						memcpy(ptr, chunk.data(), chunk.length());
+						ptr += chunk.length();
+						std::string{}.swap(chunk);
+					}
 					::GlobalUnlock(handle);
 				}
 				::SetClipboardData(::RegisterClipboardFormat(CF_RTF), handle);
@@ -1381,3 +1755,46 @@ void EditFormatCode(int menu) noexcept {
 	} catch (...) {
 	}
 }
+
+bool EditExportStyledText(LPCWSTR pszFile, bool html, LPCWSTR pszTitle) noexcept {
+	Sci_Position startPos = SciCall_GetSelectionStart();
+	Sci_Position endPos = SciCall_GetSelectionEnd();
+	if (startPos == endPos) {
+		startPos = 0;
+		endPos = SciCall_GetLength();
+	}
+
+	HANDLE hFile = CreateFile(pszFile, GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+
+	bool success = false;
+	DWORD dwLastIOError = ERROR_NOT_ENOUGH_MEMORY;
+	try {
+		SciCall_EnsureStyledTo(endPos);
+		const std::unique_ptr<char[]> styledText = make_unique_for_overwrite<char[]>(2*(endPos - startPos) + 2);
+		const Sci_TextRangeFull tr { { startPos, endPos }, styledText.get() };
+		const size_t textLength = SciCall_GetStyledTextFull(&tr);
+
+		StyledTextExporter exporter{styledText.get(), textLength};
+		success = SaveStyledText(exporter, html, pszTitle, [hFile, &dwLastIOError](std::string &chunk) {
+			DWORD dwWritten = 0;
+			const DWORD length = static_cast<DWORD>(chunk.length());
+			if (WriteFile(hFile, chunk.data(), length, &dwWritten, nullptr) && dwWritten == length) {
+				return true;
+			}
+			dwLastIOError = GetLastError();
+			return false;
+		});
+	} catch (...) {
+		dwLastIOError = ERROR_NOT_ENOUGH_MEMORY;
+	}
+
+	CloseHandle(hFile);
+	if (!success) {
+		DeleteFile(pszFile);
+		SetLastError(dwLastIOError);
+	}
+	return success;
+}
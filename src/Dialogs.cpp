@@ -29,6 +29,7 @@ struct IUnknown;
 #include <uxtheme.h>
 #include "config.h"
 #include "SciCall.h"
+#include "VectorKernels.h"
 #include "Helpers.h"
 #include "Notepad4.h"
 #include "Edit.h"
@@ -55,6 +56,7 @@ extern LANGID uiLanguage;
 #endif
 extern int iWrapColumn;
 extern bool bUseXPFileDialog;
+extern StopWatch startupWatch;
 
 static inline HWND GetMsgBoxParent(void) noexcept {
 	HWND hwnd = GetActiveWindow();
@@ -371,12 +373,13 @@ INT_PTR CALLBACK AboutDlgProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lParam
 				const int iEncoding = Encoding_GetIndex(mEncoding[CPI_DEFAULT].uCodePage);
 				Encoding_GetLabel(iEncoding);
 				GetDlgItemText(hwnd, IDC_BUILD_INFO, wch, COUNTOF(wch));
-				wsprintf(tch, L"%s\n%s\nEncoding: %s, %s\nScheme: %s, %s\nSystem: %u.%u.%u %s %s\n",
+				const UINT startupTime = static_cast<UINT>(startupWatch.Get());
+				wsprintf(tch, L"%s\n%s\nEncoding: %s, %s\nScheme: %s, %s\nSystem: %u.%u.%u %s %s, %S\nStartup: %u ms\n",
 					VERSION_FILEVERSION_LONG, wch,
 					mEncoding[iCurrentEncoding].wchLabel, mEncoding[iEncoding].wchLabel,
 					PathFindExtension(szCurFile), pLexCurrent->pszName,
 					version.dwMajorVersion, version.dwMinorVersion, version.dwBuildNumber,
-					version.szCSDVersion, arch);
+					version.szCSDVersion, arch, np2::GetISALevelName(np2::vectorKernels.level), startupTime);
 				SetClipData(hwnd, tch);
 			}
 			EndDialog(hwnd, IDOK);
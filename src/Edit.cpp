@@ -35,11 +35,14 @@ struct IUnknown;
 #include <cinttypes>
 #include "SciCall.h"
 #include "VectorISA.h"
+#include "VectorKernels.h"
 #include "Helpers.h"
 #include "Notepad4.h"
 #include "Edit.h"
 #include "Styles.h"
 #include "Dialogs.h"
+#include "FindInFiles.h"
+#include "IndentDetection.h"
 #include "resource.h"
 
 extern HWND hwndMain;
@@ -149,10 +152,10 @@ void EditSetNewText(LPCSTR lpstrText, DWORD cbText, Sci_Line lineCount) {
 #if defined(_WIN64)
 	// enable conversion between line endings
 	if (bLargeFileMode || cbText + lineCount >= MAX_NON_UTF8_SIZE) {
-		constexpr int mask = SC_DOCUMENTOPTION_TEXT_LARGE | SC_DOCUMENTOPTION_STYLES_NONE;
+		constexpr int mask = SC_DOCUMENTOPTION_TEXT_LARGE | SC_DOCUMENTOPTION_STYLES_NONE | SC_DOCUMENTOPTION_STYLES_COMPRESSED;
 		const int options = SciCall_GetDocumentOptions();
-		if ((options & mask) != mask) {
-			HANDLE pdoc = SciCall_CreateDocument(cbText + 1, options | mask);
+		if ((options & mask) != mask || (options & SC_DOCUMENTOPTION_VIEW_ONLY) != 0) {
+			HANDLE pdoc = SciCall_CreateDocument(cbText + 1, (options & ~SC_DOCUMENTOPTION_VIEW_ONLY) | mask);
 			EditReplaceDocument(pdoc);
 			bLargeFileMode = true;
 		}
@@ -250,7 +253,7 @@ void EditConvertToLargeMode(void) {
 		return;
 	}
 
-	options |= SC_DOCUMENTOPTION_TEXT_LARGE;
+	options |= SC_DOCUMENTOPTION_TEXT_LARGE | SC_DOCUMENTOPTION_STYLES_COMPRESSED;
 	const Sci_Position length = SciCall_GetLength();
 	HANDLE pdoc = SciCall_CreateDocument(length + 1, options);
 	char *pchText = nullptr;
@@ -473,321 +476,16 @@ bool EditCopyAppend(HWND hwnd) noexcept {
 // EditDetectEOLMode()
 //
 void EditDetectEOLMode(LPCSTR lpData, DWORD cbData, EditFileIOStatus &status) noexcept {
-	/* '\r' and '\n' is not reused (e.g. as trailing byte in DBCS) by any known encoding,
-	it's safe to check whole data byte by byte.*/
-
-	size_t lineCountCRLF = 0;
-	size_t lineCountCR = 0;
-	size_t lineCountLF = 0;
 #if 0
 	StopWatch watch;
 	watch.Start();
 #endif
 
-	const uint8_t *ptr = (const uint8_t *)lpData;
-	// No NULL-terminated requirement for *ptr == '\n'
-#if NP2_USE_SSE2 || NP2_USE_AVX2
-	const uint8_t * const end = ptr + cbData;
-#else
-	const uint8_t * const end = ptr + cbData - 1;
-#endif
-
-#if NP2_USE_AVX2
-	const __m256i vectCR = _mm256_set1_epi8('\r');
-	const __m256i vectLF = _mm256_set1_epi8('\n');
-	while (ptr + 2*sizeof(__m256i) < end) {
-		// unaligned loading: line starts at random position.
-		const __m256i chunk1 = _mm256_loadu_si256((__m256i *)ptr);
-		const __m256i chunk2 = _mm256_loadu_si256((__m256i *)(ptr + sizeof(__m256i)));
-		ptr += 2*sizeof(__m256i);
-		uint64_t maskCR = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk1, vectCR));
-		uint64_t maskLF = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk1, vectLF));
-		maskLF |= ((uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk2, vectLF))) << sizeof(__m256i);
-		maskCR |= ((uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk2, vectCR))) << sizeof(__m256i);
-
-		if (maskCR) {
-			if (_addcarry_u64(0, maskCR, maskCR, &maskCR)) {
-				if (*ptr == '\n') {
-					// CR+LF across boundary
-					++ptr;
-					++lineCountCRLF;
-				} else {
-					++lineCountCR;
-				}
-			}
-
-			// maskCR and maskLF never have some bit set, after shifting maskCR by 1 bit,
-			// the bits both set in maskCR and maskLF represents CR+LF;
-			// the bits only set in maskCR or maskLF represents individual CR or LF.
-			const uint64_t maskCRLF = maskCR & maskLF; // CR+LF
-			const uint64_t maskCR_LF = maskCR ^ maskLF;// CR alone or LF alone
-			maskLF = maskCR_LF & maskLF; // LF alone
-			maskCR = maskCR_LF ^ maskLF; // CR alone (with one position offset)
-			if (maskCRLF) {
-				lineCountCRLF += np2_popcount64(maskCRLF);
-			}
-			if (maskCR) {
-				lineCountCR += np2_popcount64(maskCR);
-			}
-		}
-		if (maskLF) {
-			lineCountLF += np2_popcount64(maskLF);
-		}
-	}
-
-	if (ptr < end) {
-		alignas(32) uint8_t buffer[2*sizeof(__m256i)];
-		ZeroMemory_32x2(buffer);
-		__movsb(buffer, ptr, end - ptr);
-
-		const __m256i chunk1 = _mm256_load_si256((__m256i *)buffer);
-		const __m256i chunk2 = _mm256_load_si256((__m256i *)(buffer + sizeof(__m256i)));
-		uint64_t maskCR = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk1, vectCR));
-		uint64_t maskLF = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk1, vectLF));
-		maskLF |= ((uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk2, vectLF))) << sizeof(__m256i);
-		maskCR |= ((uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk2, vectCR))) << sizeof(__m256i);
-
-		if (maskCR) {
-			const uint8_t lastCR = _addcarry_u64(0, maskCR, maskCR, &maskCR);
-			_addcarry_u64(lastCR, lineCountCR, 0, &lineCountCR);
-			const uint64_t maskCRLF = maskCR & maskLF; // CR+LF
-			const uint64_t maskCR_LF = maskCR ^ maskLF;// CR alone or LF alone
-			maskLF = maskCR_LF & maskLF; // LF alone
-			maskCR = maskCR_LF ^ maskLF; // CR alone (with one position offset)
-			if (maskCRLF) {
-				lineCountCRLF += np2_popcount64(maskCRLF);
-			}
-			if (maskCR) {
-				lineCountCR += np2_popcount64(maskCR);
-			}
-		}
-		if (maskLF) {
-			lineCountLF += np2_popcount64(maskLF);
-		}
-	}
-	// end NP2_USE_AVX2
-#elif NP2_USE_SSE2
-#if defined(_WIN64)
-	const __m128i vectCR = _mm_set1_epi8('\r');
-	const __m128i vectLF = _mm_set1_epi8('\n');
-	while (ptr + 4*sizeof(__m128i) < end) {
-		// unaligned loading: line starts at random position.
-		const __m128i chunk1 = _mm_loadu_si128((__m128i *)ptr);
-		const __m128i chunk2 = _mm_loadu_si128((__m128i *)(ptr + sizeof(__m128i)));
-		const __m128i chunk3 = _mm_loadu_si128((__m128i *)(ptr + 2*sizeof(__m128i)));
-		const __m128i chunk4 = _mm_loadu_si128((__m128i *)(ptr + 3*sizeof(__m128i)));
-		ptr += 4*sizeof(__m128i);
-		uint64_t maskCR = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk1, vectCR));
-		uint64_t maskLF = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk1, vectLF));
-		maskCR |= ((uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk2, vectCR))) << sizeof(__m128i);
-		maskLF |= ((uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk2, vectLF))) << sizeof(__m128i);
-		maskCR |= ((uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk3, vectCR))) << 2*sizeof(__m128i);
-		maskLF |= ((uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk3, vectLF))) << 2*sizeof(__m128i);
-		maskLF |= ((uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk4, vectLF))) << 3*sizeof(__m128i);
-		maskCR |= ((uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk4, vectCR))) << 3*sizeof(__m128i);
-
-		if (maskCR) {
-			if (_addcarry_u64(0, maskCR, maskCR, &maskCR)) {
-				if (*ptr == '\n') {
-					// CR+LF across boundary
-					++ptr;
-					++lineCountCRLF;
-				} else {
-					++lineCountCR;
-				}
-			}
-
-			// maskCR and maskLF never have some bit set, after shifting maskCR by 1 bit,
-			// the bits both set in maskCR and maskLF represents CR+LF;
-			// the bits only set in maskCR or maskLF represents individual CR or LF.
-			const uint64_t maskCRLF = maskCR & maskLF; // CR+LF
-			const uint64_t maskCR_LF = maskCR ^ maskLF;// CR alone or LF alone
-			maskLF = maskCR_LF & maskLF; // LF alone
-			maskCR = maskCR_LF ^ maskLF; // CR alone (with one position offset)
-			if (maskCRLF) {
-				lineCountCRLF += np2_popcount64(maskCRLF);
-			}
-			if (maskCR) {
-				lineCountCR += np2_popcount64(maskCR);
-			}
-		}
-		if (maskLF) {
-			lineCountLF += np2_popcount64(maskLF);
-		}
-	}
-
-	if (ptr < end) {
-		alignas(16) uint8_t buffer[4*sizeof(__m128i)];
-		ZeroMemory_16x4(buffer);
-		__movsb(buffer, ptr, end - ptr);
-
-		const __m128i chunk1 = _mm_load_si128((__m128i *)buffer);
-		const __m128i chunk2 = _mm_load_si128((__m128i *)(buffer + sizeof(__m128i)));
-		const __m128i chunk3 = _mm_load_si128((__m128i *)(buffer + 2*sizeof(__m128i)));
-		const __m128i chunk4 = _mm_load_si128((__m128i *)(buffer + 3*sizeof(__m128i)));
-		uint64_t maskCR = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk1, vectCR));
-		uint64_t maskLF = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk1, vectLF));
-		maskCR |= ((uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk2, vectCR))) << sizeof(__m128i);
-		maskLF |= ((uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk2, vectLF))) << sizeof(__m128i);
-		maskCR |= ((uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk3, vectCR))) << 2*sizeof(__m128i);
-		maskLF |= ((uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk3, vectLF))) << 2*sizeof(__m128i);
-		maskLF |= ((uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk4, vectLF))) << 3*sizeof(__m128i);
-		maskCR |= ((uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk4, vectCR))) << 3*sizeof(__m128i);
-
-		if (maskCR) {
-			const uint8_t lastCR = _addcarry_u64(0, maskCR, maskCR, &maskCR);
-			_addcarry_u64(lastCR, lineCountCR, 0, &lineCountCR);
-			const uint64_t maskCRLF = maskCR & maskLF; // CR+LF
-			const uint64_t maskCR_LF = maskCR ^ maskLF;// CR alone or LF alone
-			maskLF = maskCR_LF & maskLF; // LF alone
-			maskCR = maskCR_LF ^ maskLF; // CR alone (with one position offset)
-			if (maskCRLF) {
-				lineCountCRLF += np2_popcount64(maskCRLF);
-			}
-			if (maskCR) {
-				lineCountCR += np2_popcount64(maskCR);
-			}
-		}
-		if (maskLF) {
-			lineCountLF += np2_popcount64(maskLF);
-		}
-	}
-	// end _WIN64 NP2_USE_SSE2
-#else
-	const __m128i vectCR = _mm_set1_epi8('\r');
-	const __m128i vectLF = _mm_set1_epi8('\n');
-	while (ptr + 2*sizeof(__m128i) < end) {
-		// unaligned loading: line starts at random position.
-		const __m128i chunk1 = _mm_loadu_si128((__m128i *)ptr);
-		const __m128i chunk2 = _mm_loadu_si128((__m128i *)(ptr + sizeof(__m128i)));
-		ptr += 2*sizeof(__m128i);
-		uint32_t maskCR = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk1, vectCR));
-		uint32_t maskLF = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk1, vectLF));
-		maskLF |= ((uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk2, vectLF))) << sizeof(__m128i);
-		maskCR |= ((uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk2, vectCR))) << sizeof(__m128i);
-
-		if (maskCR) {
-			if (_addcarry_u32(0, maskCR, maskCR, &maskCR)) {
-				if (*ptr == '\n') {
-					// CR+LF across boundary
-					++ptr;
-					++lineCountCRLF;
-				} else {
-					++lineCountCR;
-				}
-			}
-
-			// maskCR and maskLF never have some bit set, after shifting maskCR by 1 bit,
-			// the bits both set in maskCR and maskLF represents CR+LF;
-			// the bits only set in maskCR or maskLF represents individual CR or LF.
-			const uint32_t maskCRLF = maskCR & maskLF; // CR+LF
-			const uint32_t maskCR_LF = maskCR ^ maskLF;// CR alone or LF alone
-			maskLF = maskCR_LF & maskLF; // LF alone
-			maskCR = maskCR_LF ^ maskLF; // CR alone (with one position offset)
-			if (maskCRLF) {
-				lineCountCRLF += np2_popcount(maskCRLF);
-			}
-			if (maskCR) {
-				lineCountCR += np2_popcount(maskCR);
-			}
-		}
-		if (maskLF) {
-			lineCountLF += np2_popcount(maskLF);
-		}
-	}
-
-	if (ptr < end) {
-		alignas(16) uint8_t buffer[2*sizeof(__m128i)];
-		ZeroMemory_16x2(buffer);
-		__movsb(buffer, ptr, end - ptr);
-
-		const __m128i chunk1 = _mm_load_si128((__m128i *)buffer);
-		const __m128i chunk2 = _mm_load_si128((__m128i *)(buffer + sizeof(__m128i)));
-		uint32_t maskCR = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk1, vectCR));
-		uint32_t maskLF = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk1, vectLF));
-		maskLF |= ((uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk2, vectLF))) << sizeof(__m128i);
-		maskCR |= ((uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk2, vectCR))) << sizeof(__m128i);
-
-		if (maskCR) {
-			const uint8_t lastCR = _addcarry_u32(0, maskCR, maskCR, &maskCR);
-			_addcarry_u32(lastCR, lineCountCR, 0, &lineCountCR);
-			const uint32_t maskCRLF = maskCR & maskLF; // CR+LF
-			const uint32_t maskCR_LF = maskCR ^ maskLF;// CR alone or LF alone
-			maskLF = maskCR_LF & maskLF; // LF alone
-			maskCR = maskCR_LF ^ maskLF; // CR alone (with one position offset)
-			if (maskCRLF) {
-				lineCountCRLF += np2_popcount(maskCRLF);
-			}
-			if (maskCR) {
-				lineCountCR += np2_popcount(maskCR);
-			}
-		}
-		if (maskLF) {
-			lineCountLF += np2_popcount(maskLF);
-		}
-	}
-#endif
-	// end NP2_USE_SSE2
-#else
-
-#if defined(__clang__) || defined(__GNUC__) || defined(__ICL) || !defined(_MSC_VER)
-	while (ptr < end) {
-		const uint8_t ch = *ptr++;
-		const uint32_t mask = ((1 << '\r') - 1) ^ (1 << '\n');
-		if (ch > '\r' || ((mask >> ch) & 1) != 0) {
-			continue;
-		}
-		if (ch == '\n') {
-			++lineCountLF;
-		} else {
-			if (*ptr == '\n') {
-				++ptr;
-				++lineCountCRLF;
-			} else {
-				++lineCountCR;
-			}
-		}
-	}
-#else
-	do {
-		// skip to line end
-		uint8_t ch = 0;
-#if 1
-		const uint32_t mask = ((1 << '\r') - 1) ^ (1 << '\n');
-		while (ptr < end && ((ch = *ptr++) > '\r' || ((mask >> ch) & 1) != 0)) {
-			// nop
-		}
-#else
-		while (ptr < end && ((ch = *ptr++) > '\r' || ch < '\n')) {
-			// nop
-		}
-#endif
-		switch (ch) {
-		case '\n':
-			++lineCountLF;
-			break;
-		case '\r':
-			if (*ptr == '\n') {
-				++ptr;
-				++lineCountCRLF;
-			} else {
-				++lineCountCR;
-			}
-			break;
-		}
-	} while (ptr < end);
-#endif
-	if (ptr == end) {
-		switch (*ptr) {
-		case '\n':
-			++lineCountLF;
-			break;
-		case '\r':
-			++lineCountCR;
-			break;
-		}
-	}
-#endif
+	np2::LineEndingCount count{};
+	np2::vectorKernels.CountLineEndings(lpData, cbData, count);
+	const size_t lineCountCRLF = count.CRLF;
+	const size_t lineCountCR = count.CR;
+	const size_t lineCountLF = count.LF;
 
 	const size_t linesMax = max(max(lineCountCRLF, lineCountCR), lineCountLF);
 	// values must kept in same order as SC_EOL_CRLF, SC_EOL_CR, SC_EOL_LF
@@ -830,138 +528,140 @@ void EditDetectIndentation(LPCSTR lpData, DWORD cbData, LPFILEVARS lpfv) noexcep
 	watch.Start();
 #endif
 
-	// code based on SciTEBase::DiscoverIndentSetting().
-	cbData = min<DWORD>(cbData, 1*1024*1024);
-	const uint8_t *ptr = (const uint8_t *)lpData;
-	const uint8_t * const end = ptr + cbData;
-	#define MAX_DETECTED_TAB_WIDTH	8
-	// line count for ambiguous lines, line indented by 1 to 8 spaces, line starts with tab.
-	uint32_t indentLineCount[1 + MAX_DETECTED_TAB_WIDTH + 1] = { 0 };
-	int prevIndentCount = 0;
-	int prevTabWidth = 0;
-
-#if NP2_USE_AVX2
-	const __m256i vectCR = _mm256_set1_epi8('\r');
-	const __m256i vectLF = _mm256_set1_epi8('\n');
-labelStart:
-#elif NP2_USE_SSE2
-	const __m128i vectCR = _mm_set1_epi8('\r');
-	const __m128i vectLF = _mm_set1_epi8('\n');
-labelStart:
-#endif
-	while (ptr < end) {
-		switch (*ptr++) {
-		case '\t':
-			++indentLineCount[MAX_DETECTED_TAB_WIDTH + 1];
-			break;
-
-		case ' ': {
-			int indentCount = 1;
-			while (ptr < end && *ptr == ' ') {
-				++ptr;
-				++indentCount;
-			}
-			if ((indentCount & 1) != 0 && *ptr == '*') {
-				// fix alignment space before star in Javadoc style comment: ` * comment content`
-				--indentCount;
-				if (indentCount == 0) {
-					break;
-				}
-			}
-			if (indentCount != prevIndentCount) {
-				const int delta = abs(indentCount - prevIndentCount);
-				prevIndentCount = indentCount;
-				// TODO: fix other (e.g. function argument) alignment spaces.
-				if (delta <= MAX_DETECTED_TAB_WIDTH) {
-					prevTabWidth = min(delta, indentCount);
-				} else {
-					prevTabWidth = 0;
-				}
-			}
-			++indentLineCount[prevTabWidth];
-		} break;
-
-		case '\r':
-		case '\n':
-			continue;
-
-		default:
-			prevIndentCount = 0;
-			break;
-		}
-
-		// skip to line end
-#if NP2_USE_AVX2
-		while (ptr + sizeof(__m256i) <= end) {
-			const __m256i chunk = _mm256_loadu_si256((__m256i *)ptr);
-			const uint32_t mask = _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(chunk, vectCR), _mm256_cmpeq_epi8(chunk, vectLF)));
-			if (mask != 0) {
-				const uint32_t trailing = np2_ctz(mask);
-				ptr += trailing + 1;
-				goto labelStart;
-			}
-			ptr += sizeof(__m256i);
-		}
-#elif NP2_USE_SSE2
-		while (ptr + sizeof(__m128i) <= end) {
-			const __m128i chunk = _mm_loadu_si128((__m128i *)ptr);
-			const uint32_t mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, vectCR), _mm_cmpeq_epi8(chunk, vectLF)));
-			if (mask != 0) {
-				const uint32_t trailing = np2_ctz(mask);
-				ptr += trailing + 1;
-				goto labelStart;
-			}
-			ptr += sizeof(__m128i);
-		}
-#endif
-		const uint32_t mask = ((1 << '\r') - 1) ^ (1 << '\n');
-		uint8_t ch;
-		while (ptr < end && ((ch = *ptr++) > '\r' || ((mask >> ch) & 1) != 0)) {
-			// nop
-		}
-	}
-
-#if NP2_USE_AVX2
-	const __m128i chunk1 = _mm_loadu_si128((__m128i *)indentLineCount);
-	const __m128i chunk2 = _mm_loadu_si128((__m128i *)(indentLineCount + 4));
-	const __m128i chunk3 = _mm_loadl_epi64((__m128i *)(indentLineCount + 8));
-	__m128i maxAll = _mm_max_epu32(_mm_max_epu32(chunk1, chunk2), chunk3);
-	maxAll = _mm_max_epu32(maxAll, _mm_shuffle_epi32(maxAll, _MM_SHUFFLE(0, 1, 2, 3)));
-	maxAll = _mm_max_epu32(maxAll, _mm_shuffle_epi32(maxAll, _MM_SHUFFLE(1, 0, 3, 2)));
-	uint32_t mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(maxAll, chunk1)));
-	mask |= ((uint32_t)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(maxAll, chunk2)))) << 4;
-	mask |= ((uint32_t)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(maxAll, chunk3)))) << 8;
-	prevTabWidth = np2_ctz(mask);
-
-#else
-	prevTabWidth = 0;
-	for (int i = 1; i < MAX_DETECTED_TAB_WIDTH + 2; i++) {
-		if (indentLineCount[i] > indentLineCount[prevTabWidth]) {
-			prevTabWidth = i;
-		}
-	}
-#endif
-	if (prevTabWidth != 0) {
-		const bool bTabsAsSpaces = prevTabWidth <= MAX_DETECTED_TAB_WIDTH;
+	// scan whole file on multiple threads, huge file is sampled.
+	const IndentDetection::Histogram histogram = IndentDetection::Scan(lpData, cbData, {});
+	const IndentDetection::Result result = IndentDetection::Decide(histogram);
+	if (result.indentation != IndentDetection::Indentation::Unknown) {
+		const bool bTabsAsSpaces = result.indentation == IndentDetection::Indentation::Spaces;
 		lpfv->mask |= FV_TABSASSPACES;
 		lpfv->bTabsAsSpaces = bTabsAsSpaces;
 		if (bTabsAsSpaces) {
 			lpfv->mask |= FV_MaskHasTabIndentWidth;
-			lpfv->iTabWidth = prevTabWidth;
-			lpfv->iIndentWidth = prevTabWidth;
+			lpfv->iTabWidth = result.indentWidth;
+			lpfv->iIndentWidth = result.indentWidth;
 		}
 	}
 
 #if 0
 	watch.Stop();
 	const double duration = watch.Get();
-	printf("indentation %u, duration=%.06f, tab width=%d\n", (UINT)cbData, duration, prevTabWidth);
-	for (int i = 0; i < MAX_DETECTED_TAB_WIDTH + 2; i++) {
-		printf("\tindentLineCount[%d] = %u\n", i, indentLineCount[i]);
+	printf("indentation %u, duration=%.06f, tab width=%d, confidence=%.2f, blocks=%u\n", (UINT)cbData, duration,
+		result.indentWidth, result.confidence, histogram.blockCount);
+	for (int i = 0; i < IndentDetection::MaxTabWidth + 2; i++) {
+		printf("\tindentLineCount[%d] = %u\n", i, histogram.lines[i]);
 	}
 #endif
 }
 
+#if defined(_WIN64)
+//=============================================================================
+//
+// EditLoadFileViewMode()
+//
+// Load huge file into a read only view document: undo and change history are disabled,
+// styles are only kept for a window before visible lines.
+// File content is copied from mapped views of the file into Scintilla's content buffer
+// without intermediate buffer for the whole file, encoding and line endings are detected
+// from the head of the file, text is not converted.
+static bool EditLoadFileViewMode(LPCWSTR pszFile, HANDLE hFile, LONGLONG fileSize, EditFileIOStatus &status) {
+	HANDLE hMap = CreateFileMapping(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	dwLastIOError = GetLastError();
+	if (hMap == nullptr) {
+		return false;
+	}
+
+	// multiple of allocation granularity
+	constexpr LONGLONG viewSize = 64*1024*1024;
+	DWORD cbView = (DWORD)min(fileSize, viewSize);
+	const char *lpView = (const char *)MapViewOfFile(hMap, FILE_MAP_READ, 0, 0, cbView);
+	if (lpView == nullptr) {
+		dwLastIOError = GetLastError();
+		CloseHandle(hMap);
+		return false;
+	}
+
+	const DWORD cbHead = min<DWORD>(cbView, 1024*1024);
+	char *lpHead = (char *)NP2HeapAlloc(cbHead + NP2_ENCODING_DETECTION_PADDING);
+	memcpy(lpHead, lpView, cbHead);
+	int encodingFlag = EncodingFlag_None;
+	const int iEncoding = EditDetermineEncoding(pszFile, lpHead, cbHead, &encodingFlag);
+	const UINT uFlags = mEncoding[iEncoding].uFlags;
+	if (uFlags & NCP_UNICODE) {
+		// UTF-16 requires converting whole file
+		NP2HeapFree(lpHead);
+		UnmapViewOfFile(lpView);
+		CloseHandle(hMap);
+		dwLastIOError = ERROR_NOT_SUPPORTED;
+		return false;
+	}
+
+	DWORD offset = 0;
+	if (uFlags & NCP_UTF8) {
+		status.iEncoding = iEncoding;
+		offset = (uFlags & NCP_UTF8_SIGN) ? 3 : 0;
+	} else {
+		// other encodings are displayed with system code page
+		status.iEncoding = CPI_DEFAULT;
+	}
+	status.iEOLMode = GetScintillaEOLMode(iDefaultEOLMode);
+	status.totalLineCount = 1;
+	EditDetectEOLMode(lpHead + offset, cbHead - offset, status);
+	// converting line endings is editing
+	status.bInconsistent = false;
+	status.bBinaryFile = encodingFlag & EncodingFlag_Binary;
+	status.bViewOnly = true;
+	NP2HeapFree(lpHead);
+
+	bFreezeAppTitle = true;
+	bReadOnlyMode = false;
+	iWrapColumn = 0;
+
+	SciCall_SetReadOnly(false);
+	SciCall_Cancel();
+	SciCall_SetUndoCollection(false);
+	SciCall_EmptyUndoBuffer();
+	SciCall_ClearAll();
+	SciCall_ClearMarker();
+	SciCall_SetXOffset(0);
+	SciCall_SetCodePage((uFlags & NCP_UTF8) ? SC_CP_UTF8 : iDefaultCodePage);
+
+	constexpr int options = SC_DOCUMENTOPTION_TEXT_LARGE | SC_DOCUMENTOPTION_STYLES_NONE
+		| SC_DOCUMENTOPTION_STYLES_COMPRESSED | SC_DOCUMENTOPTION_VIEW_ONLY;
+	HANDLE pdoc = SciCall_CreateDocument(fileSize + 1, options);
+	EditReplaceDocument(pdoc);
+	bLargeFileMode = true;
+	FileVars_Apply(&fvCurFile);
+
+	SendMessage(hwndEdit, WM_SETREDRAW, FALSE, 0);
+	SciCall_SetModEventMask(SC_MOD_NONE);
+	LONGLONG position = 0;
+	while (true) {
+		SciCall_AppendText(cbView - offset, lpView + offset);
+		UnmapViewOfFile(lpView);
+		position += cbView;
+		if (position >= fileSize) {
+			break;
+		}
+		cbView = (DWORD)min(fileSize - position, viewSize);
+		lpView = (const char *)MapViewOfFile(hMap, FILE_MAP_READ, (DWORD)(position >> 32), (DWORD)position, cbView);
+		if (lpView == nullptr) {
+			// keep the text already loaded
+			dwLastIOError = GetLastError();
+			break;
+		}
+		offset = 0;
+	}
+	CloseHandle(hMap);
+	SciCall_SetModEventMask(SC_MOD_INSERTTEXT | SC_MOD_DELETETEXT);
+	SendMessage(hwndEdit, WM_SETREDRAW, TRUE, 0);
+	InvalidateRect(hwndEdit, nullptr, TRUE);
+
+	SciCall_SetSavePoint();
+	bFreezeAppTitle = false;
+	return true;
+}
+#endif
+
 //=============================================================================
 //
 // EditLoadFile()
@@ -999,6 +699,7 @@ bool EditLoadFile(LPWSTR pszFile, EditFileIOStatus &status) {
 	//        i.e. when default scheme is Text File or 2nd Text File, memory required to load the file
 	//        is about fileSize*2, buffers we allocated below can be reused by system to served
 	//        as Scintilla's style buffer when calling SciCall_SetLexer() inside Style_SetLexer().
+	//        Large file mode uses compressed style buffer, which is much smaller than the content buffer.
 	//     3. Extra memory when moving gaps on editing, it may require more than 2/3 physical memory.
 	// large file TODO: https://github.com/zufuliu/notepad4/issues/125
 	// [ ] [> 4 GiB] use SetFilePointerEx() and ReadFile()/WriteFile() to read/write file.
@@ -1009,7 +710,7 @@ bool EditLoadFile(LPWSTR pszFile, EditFileIOStatus &status) {
 	LONGLONG maxFileSize = INT64_C(2) << 30;
 #endif
 
-	MEMORYSTATUSEX statex;
+	MEMORYSTATUSEX statex {};
 	statex.dwLength = sizeof(statex);
 	if (GlobalMemoryStatusEx(&statex)) {
 		const ULONGLONG maxMem = statex.ullTotalPhys/2U;
@@ -1021,7 +722,6 @@ bool EditLoadFile(LPWSTR pszFile, EditFileIOStatus &status) {
 	}
 
 	if (fileSize.QuadPart > maxFileSize) {
-		CloseHandle(hFile);
 		status.bFileTooBig = true;
 		WCHAR tchDocSize[32];
 		WCHAR tchMaxSize[32];
@@ -1031,6 +731,19 @@ bool EditLoadFile(LPWSTR pszFile, EditFileIOStatus &status) {
 		StrFormatByteSize(maxFileSize, tchMaxSize, COUNTOF(tchMaxSize));
 		FormatNumber64(tchDocBytes, fileSize.QuadPart);
 		FormatNumber64(tchMaxBytes, maxFileSize);
+#if defined(_WIN64)
+		// view mode only requires memory for the content buffer, limited by available commit memory.
+		if ((ULONGLONG)fileSize.QuadPart < statex.ullAvailPageFile) {
+			bool success = false;
+			if (MsgBoxWarn(MB_YESNO, IDS_ASK_VIEWBIGFILE, pszFile, tchDocSize, tchDocBytes, tchMaxSize, tchMaxBytes) == IDYES) {
+				status.bFileTooBig = false;
+				success = EditLoadFileViewMode(pszFile, hFile, fileSize.QuadPart, status);
+			}
+			CloseHandle(hFile);
+			return success;
+		}
+#endif
+		CloseHandle(hFile);
 		MsgBoxWarn(MB_OK, IDS_WARNLOADBIGFILE, pszFile, tchDocSize, tchDocBytes, tchMaxSize, tchMaxBytes);
 		return false;
 	}
@@ -4402,6 +4115,10 @@ void EditSortLines(EditSortFlag iSortFlags) noexcept {
 //
 void EditJumpTo(Sci_Line iNewLine, Sci_Position iNewCol) noexcept {
 	// Jumpt to end with line set to -1
+	if (iNewLine > 0) {
+		// huge file in view mode: index lines up to the target line
+		SciCall_IndexLinesTo(iNewLine - 1);
+	}
 	if (iNewLine < 0 || iNewLine > SciCall_GetLineCount()) {
 		iNewCol = SciCall_GetLength();
 	} else {
@@ -5776,6 +5493,184 @@ void EditFindAll(const EDITFINDREPLACE *lpefr, bool selectAll) {
 	EditMarkAll_Start(FALSE, searchFlags, strlen(szFind2), szFind2);
 }
 
+//=============================================================================
+//
+// EditFindInFiles_Start()
+//
+// results are formatted on worker threads and posted to main window as
+// APPM_FINDINFILES(generation, text), empty text marks end of the search.
+namespace {
+
+struct FindInFilesTask {
+	HWND hwnd;
+	WPARAM generation;
+	const char *eol;
+	WCHAR szDirectory[MAX_PATH];
+	WCHAR tchSummary[128];
+	std::unique_ptr<FindInFiles::Engine> engine;
+};
+
+BackgroundWorker findInFilesWorker;
+FindInFilesTask *findInFilesTask = nullptr;
+WPARAM findInFilesGeneration = 0;
+
+// same as file loading: UTF-16 with BOM, UTF-8 (with or without BOM),
+// otherwise treated as system ANSI code page. file contains NUL is treated as binary.
+bool FindInFilesDecode(std::string_view &text, std::string &buffer) {
+	const uint8_t *ptr = reinterpret_cast<const uint8_t *>(text.data());
+	const size_t length = text.size();
+	if (length >= 2 && length < MAX_NON_UTF8_SIZE && (length & 1) == 0
+		&& ((ptr[0] == 0xFF && ptr[1] == 0xFE) || (ptr[0] == 0xFE && ptr[1] == 0xFF))) {
+		const int cchTextW = static_cast<int>(length/sizeof(WCHAR) - 1);
+		LPWSTR pszTextW = (LPWSTR)NP2HeapAlloc(length);
+		memcpy(pszTextW, ptr + 2, length - 2);
+		if (ptr[0] == 0xFE) {
+			_swab((char *)pszTextW, (char *)pszTextW, (int)(length - 2));
+		}
+		const int cbData = WideCharToMultiByte(CP_UTF8, 0, pszTextW, cchTextW, nullptr, 0, nullptr, nullptr);
+		buffer.resize(cbData);
+		WideCharToMultiByte(CP_UTF8, 0, pszTextW, cchTextW, buffer.data(), cbData, nullptr, nullptr);
+		NP2HeapFree(pszTextW);
+		text = buffer;
+		return true;
+	}
+
+	if (length >= 3 && ptr[0] == 0xEF && ptr[1] == 0xBB && ptr[2] == 0xBF) {
+		text.remove_prefix(3);
+		return true;
+	}
+	if (memchr(ptr, '\0', min<size_t>(length, 64*1024)) != nullptr) {
+		return false;
+	}
+	if (length >= MAX_NON_UTF8_SIZE || IsUTF8(text.data(), static_cast<DWORD>(length))) {
+		return true;
+	}
+
+	DWORD cbData = static_cast<DWORD>(length);
+	const UINT legacyACP = mEncoding[CPI_DEFAULT].uCodePage;
+	char *result = RecodeAsUTF8(const_cast<char *>(text.data()), &cbData, legacyACP, 0);
+	if (result) {
+		buffer.assign(result, cbData);
+		NP2HeapFree(result);
+		text = buffer;
+	}
+	return true;
+}
+
+void FindInFilesPost(const FindInFilesTask *task, const std::string &text) noexcept {
+	char *chunk = (char *)NP2HeapAlloc(text.size() + 1);
+	memcpy(chunk, text.data(), text.size());
+	if (!PostMessage(task->hwnd, APPM_FINDINFILES, task->generation, (LPARAM)chunk)) {
+		NP2HeapFree(chunk);
+	}
+}
+
+DWORD WINAPI FindInFilesThread(LPVOID lpParam) {
+	const FindInFilesTask *task = static_cast<const FindInFilesTask *>(lpParam);
+	const FindInFiles::Statistics stat = task->engine->Run(task->szDirectory);
+	if (!task->engine->IsCancelled()) {
+		WCHAR tchLines[32];
+		WCHAR tchMatchedFiles[32];
+		WCHAR tchFiles[32];
+		WCHAR wchSummary[256];
+		char szSummary[512];
+		FormatNumber(tchLines, stat.matchedLineCount);
+		FormatNumber(tchMatchedFiles, stat.matchedFileCount);
+		FormatNumber(tchFiles, stat.fileCount);
+		wsprintf(wchSummary, task->tchSummary, tchLines, tchMatchedFiles, tchFiles);
+		WideCharToMultiByte(CP_UTF8, 0, wchSummary, -1, szSummary, COUNTOF(szSummary), nullptr, nullptr);
+		std::string text{szSummary};
+		text += task->eol;
+		FindInFilesPost(task, text);
+	}
+	PostMessage(task->hwnd, APPM_FINDINFILES, task->generation, 0);
+	return 0;
+}
+
+}
+
+void EditFindInFiles_Start(HWND hwnd, const EDITFINDINFILES *lpfif) {
+	EditFindInFiles_Stop();
+
+	FindInFiles::Options options;
+	options.findText = lpfif->szFindUTF8;
+	options.searchFlags = lpfif->fuFlags & (SCFIND_MATCHCASE | SCFIND_WHOLEWORD | SCFIND_WORDSTART | SCFIND_REGEXP | SCFIND_POSIX);
+	options.recursive = lpfif->bSubdirectories;
+	char szFilter[COUNTOF(lpfif->szInclude) * kMaxMultiByteCount];
+	WideCharToMultiByte(CP_UTF8, 0, lpfif->szInclude, -1, szFilter, COUNTOF(szFilter), nullptr, nullptr);
+	options.includeFilter = szFilter;
+	WideCharToMultiByte(CP_UTF8, 0, lpfif->szExclude, -1, szFilter, COUNTOF(szFilter), nullptr, nullptr);
+	options.excludeFilter = szFilter;
+
+	FindInFilesTask *task = new FindInFilesTask{};
+	task->hwnd = hwnd;
+	task->generation = findInFilesGeneration;
+	const int iEOLMode = SciCall_GetEOLMode();
+	task->eol = (iEOLMode == SC_EOL_CRLF) ? "\r\n" : ((iEOLMode == SC_EOL_CR) ? "\r" : "\n");
+	lstrcpyn(task->szDirectory, lpfif->szDirectory, COUNTOF(task->szDirectory));
+	GetString(IDS_FINDINFILES_SUMMARY, task->tchSummary, COUNTOF(task->tchSummary));
+	task->engine = std::make_unique<FindInFiles::Engine>(options, FindInFilesDecode, [task](FindInFiles::FileResult &&result) {
+		std::string text{"--- "};
+		text += result.path;
+		if (result.skipped) {
+			text += " (lines too long for regular expression are skipped)";
+		}
+		text += task->eol;
+		for (const FindInFiles::MatchedLine &line : result.lines) {
+			text += result.path;
+			text += ':';
+			text += std::to_string(line.line);
+			text += ':';
+			text += std::to_string(line.column);
+			text += ": ";
+			text += line.text;
+			text += task->eol;
+		}
+		FindInFilesPost(task, text);
+	});
+	if (!task->engine->IsValid()) {
+		delete task;
+		InfoBoxWarn(MB_OK, L"MsgNotFound", IDS_NOTFOUND);
+		return;
+	}
+
+	if (findInFilesWorker.hwnd == nullptr) {
+		findInFilesWorker.Init(hwnd);
+	}
+	// results are appended without undo history
+	SciCall_SetUndoCollection(false);
+	findInFilesTask = task;
+	findInFilesWorker.workerThread = CreateThread(nullptr, 0, FindInFilesThread, task, 0, nullptr);
+}
+
+void EditFindInFiles_Stop() noexcept {
+	++findInFilesGeneration;
+	// reentrant: pending messages are dispatched while waiting for the worker thread.
+	FindInFilesTask *task = findInFilesTask;
+	findInFilesTask = nullptr;
+	if (task) {
+		task->engine->Cancel();
+		findInFilesWorker.Cancel();
+		delete task;
+		SciCall_SetUndoCollection(true);
+	}
+}
+
+void EditFindInFiles_OnResult(WPARAM wParam, LPARAM lParam) noexcept {
+	char *chunk = (char *)lParam;
+	if (wParam == findInFilesGeneration) {
+		if (chunk) {
+			SciCall_AppendText(strlen(chunk), chunk);
+		} else {
+			EditFindInFiles_Stop();
+			SciCall_SetSavePoint();
+		}
+	}
+	if (chunk) {
+		NP2HeapFree(chunk);
+	}
+}
+
 void EditToggleBookmarkAt(Sci_Position iPos) noexcept {
 	if (iPos < 0) {
 		iPos = SciCall_GetCurrentPos();
@@ -6008,7 +5903,7 @@ static INT_PTR CALLBACK EditLineNumDlgProc(HWND hwnd, UINT umsg, WPARAM wParam,
 	switch (umsg) {
 	case WM_INITDIALOG: {
 		const Sci_Line iCurLine = SciCall_LineFromPosition(SciCall_GetCurrentPos()) + 1;
-		const Sci_Line iMaxLine = SciCall_GetLineCount();
+		const Sci_Line iMaxLine = SciCall_GetLineCountEstimate();
 		const Sci_Position iLength = SciCall_GetLength();
 
 		SendDlgItemMessage(hwnd, IDC_LINENUM, EM_LIMITTEXT, 20, 0);
@@ -6074,6 +5969,9 @@ static INT_PTR CALLBACK EditLineNumDlgProc(HWND hwnd, UINT umsg, WPARAM wParam,
 				return TRUE;
 			}
 
+			if (iNewLine > 0) {
+				SciCall_IndexLinesTo(iNewLine - 1);
+			}
 			const Sci_Line iMaxLine = SciCall_GetLineCount();
 			const Sci_Position iLength = SciCall_GetLength();
 			// directly goto specific position
@@ -6115,6 +6013,98 @@ bool EditLineNumDlg(HWND hwnd) noexcept {
 	return iResult == IDOK;
 }
 
+//=============================================================================
+//
+// EditFindInFilesDlgProc()
+//
+static INT_PTR CALLBACK EditFindInFilesDlgProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lParam) noexcept {
+	switch (umsg) {
+	case WM_INITDIALOG: {
+		SetWindowLongPtr(hwnd, DWLP_USER, lParam);
+		const EDITFINDINFILES * const lpfif = reinterpret_cast<const EDITFINDINFILES *>(lParam);
+		SendDlgItemMessage(hwnd, IDC_FINDTEXT, EM_LIMITTEXT, 512 - 1, 0);
+		SendDlgItemMessage(hwnd, IDC_FINDINFILES_DIRECTORY, EM_LIMITTEXT, MAX_PATH - 1, 0);
+		SendDlgItemMessage(hwnd, IDC_FINDINFILES_INCLUDE, EM_LIMITTEXT, COUNTOF(lpfif->szInclude) - 1, 0);
+		SendDlgItemMessage(hwnd, IDC_FINDINFILES_EXCLUDE, EM_LIMITTEXT, COUNTOF(lpfif->szExclude) - 1, 0);
+		SetDlgItemTextA2W(CP_UTF8, hwnd, IDC_FINDTEXT, lpfif->szFindUTF8);
+		SetDlgItemText(hwnd, IDC_FINDINFILES_DIRECTORY, lpfif->szDirectory);
+		SetDlgItemText(hwnd, IDC_FINDINFILES_INCLUDE, lpfif->szInclude);
+		SetDlgItemText(hwnd, IDC_FINDINFILES_EXCLUDE, lpfif->szExclude);
+		CheckDlgButton(hwnd, IDC_FINDCASE, (lpfif->fuFlags & SCFIND_MATCHCASE) ? BST_CHECKED : BST_UNCHECKED);
+		CheckDlgButton(hwnd, IDC_FINDWORD, (lpfif->fuFlags & SCFIND_WHOLEWORD) ? BST_CHECKED : BST_UNCHECKED);
+		CheckDlgButton(hwnd, IDC_FINDSTART, (lpfif->fuFlags & SCFIND_WORDSTART) ? BST_CHECKED : BST_UNCHECKED);
+		CheckDlgButton(hwnd, IDC_FINDREGEXP, (lpfif->fuFlags & SCFIND_REGEXP) ? BST_CHECKED : BST_UNCHECKED);
+		CheckDlgButton(hwnd, IDC_FINDINFILES_SUBDIR, lpfif->bSubdirectories ? BST_CHECKED : BST_UNCHECKED);
+		CenterDlgInParent(hwnd);
+	}
+	return TRUE;
+
+	case WM_COMMAND:
+		switch (LOWORD(wParam)) {
+		case IDC_FINDINFILES_BROWSE: {
+			WCHAR tchDirectory[MAX_PATH];
+			GetDlgItemText(hwnd, IDC_FINDINFILES_DIRECTORY, tchDirectory, COUNTOF(tchDirectory));
+			if (GetDirectory(hwnd, IDS_FINDINFILES_DIRECTORY, tchDirectory, tchDirectory)) {
+				SetDlgItemText(hwnd, IDC_FINDINFILES_DIRECTORY, tchDirectory);
+			}
+		} break;
+
+		case IDOK: {
+			EDITFINDINFILES * const lpfif = reinterpret_cast<EDITFINDINFILES *>(GetWindowLongPtr(hwnd, DWLP_USER));
+			WCHAR tchDirectory[MAX_PATH];
+			GetDlgItemText(hwnd, IDC_FINDINFILES_DIRECTORY, tchDirectory, COUNTOF(tchDirectory));
+			TrimString(tchDirectory);
+			if (StrIsEmpty(tchDirectory) || !PathIsDirectory(tchDirectory)) {
+				PostMessage(hwnd, WM_NEXTDLGCTL, (WPARAM)(GetDlgItem(hwnd, IDC_FINDINFILES_DIRECTORY)), TRUE);
+				return TRUE;
+			}
+			if (!GetDlgItemTextA2W(CP_UTF8, hwnd, IDC_FINDTEXT, lpfif->szFindUTF8, COUNTOF(lpfif->szFindUTF8))) {
+				PostMessage(hwnd, WM_NEXTDLGCTL, (WPARAM)(GetDlgItem(hwnd, IDC_FINDTEXT)), TRUE);
+				return TRUE;
+			}
+
+			lstrcpy(lpfif->szDirectory, tchDirectory);
+			GetDlgItemText(hwnd, IDC_FINDINFILES_INCLUDE, lpfif->szInclude, COUNTOF(lpfif->szInclude));
+			GetDlgItemText(hwnd, IDC_FINDINFILES_EXCLUDE, lpfif->szExclude, COUNTOF(lpfif->szExclude));
+			UINT fuFlags = 0;
+			if (IsButtonChecked(hwnd, IDC_FINDCASE)) {
+				fuFlags |= SCFIND_MATCHCASE;
+			}
+			if (IsButtonChecked(hwnd, IDC_FINDWORD)) {
+				fuFlags |= SCFIND_WHOLEWORD;
+			}
+			if (IsButtonChecked(hwnd, IDC_FINDSTART)) {
+				fuFlags |= SCFIND_WORDSTART;
+			}
+			if (IsButtonChecked(hwnd, IDC_FINDREGEXP)) {
+				fuFlags |= NP2_RegexDefaultFlags;
+			}
+			lpfif->fuFlags = fuFlags;
+			lpfif->bSubdirectories = IsButtonChecked(hwnd, IDC_FINDINFILES_SUBDIR);
+			EndDialog(hwnd, IDOK);
+		}
+		break;
+
+		case IDCANCEL:
+			EndDialog(hwnd, IDCANCEL);
+			break;
+		}
+
+		return TRUE;
+	}
+
+	return FALSE;
+}
+
+//=============================================================================
+//
+// EditFindInFilesDlg()
+//
+bool EditFindInFilesDlg(HWND hwnd, EDITFINDINFILES *lpfif) noexcept {
+	const INT_PTR iResult = ThemedDialogBoxParam(g_hInstance, MAKEINTRESOURCE(IDD_FINDINFILES), hwnd, EditFindInFilesDlgProc, (LPARAM)lpfif);
+	return iResult == IDOK;
+}
+
 //=============================================================================
 //
 // EditModifyLinesDlg()
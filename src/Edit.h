@@ -47,6 +47,15 @@ struct EDITFINDREPLACE {
 	bool	bWildcardSearch;
 };
 
+struct EDITFINDINFILES {
+	char	szFindUTF8[512 * kMaxMultiByteCount];
+	WCHAR	szDirectory[MAX_PATH];
+	WCHAR	szInclude[256];
+	WCHAR	szExclude[256];
+	UINT	fuFlags;
+	bool	bSubdirectories;
+};
+
 enum EditAlignMode {
 	EditAlignMode_Left = 0,
 	EditAlignMode_Right = 1,
@@ -189,6 +198,10 @@ HWND	EditFindReplaceDlg(HWND hwnd, EDITFINDREPLACE *lpefr, bool bReplace) noexce
 void	EditFindNext(const EDITFINDREPLACE *lpefr, bool fExtendSelection) noexcept;
 void	EditFindPrev(const EDITFINDREPLACE *lpefr, bool fExtendSelection) noexcept;
 void	EditFindAll(const EDITFINDREPLACE *lpefr, bool selectAll);
+bool	EditFindInFilesDlg(HWND hwnd, EDITFINDINFILES *lpfif) noexcept;
+void	EditFindInFiles_Start(HWND hwnd, const EDITFINDINFILES *lpfif);
+void	EditFindInFiles_Stop() noexcept;
+void	EditFindInFiles_OnResult(WPARAM wParam, LPARAM lParam) noexcept;
 bool	EditReplace(HWND hwnd, const EDITFINDREPLACE *lpefr) noexcept;
 bool	EditReplaceAll(HWND hwnd, const EDITFINDREPLACE *lpefr, bool bShowInfo) noexcept;
 bool	EditReplaceAllInSelection(HWND hwnd, const EDITFINDREPLACE *lpefr, bool bShowInfo) noexcept;
@@ -218,6 +231,7 @@ void EditOpenSelection(OpenSelectionType type);
 bool	EditPrint(HWND hwnd, LPCWSTR pszDocTitle, BOOL bDefault) noexcept;
 void	EditPrintSetup(HWND hwnd) noexcept;
 void	EditFormatCode(int menu) noexcept;
+bool	EditExportStyledText(LPCWSTR pszFile, bool html, LPCWSTR pszTitle) noexcept;
 
 enum {
 	MarkerNumber_Bookmark = 0,
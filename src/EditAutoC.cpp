@@ -44,8 +44,8 @@ struct WordList {
 	UINT iStartLen;
 #if NP2_AUTOC_CACHE_SORT_KEY
 	UINT sortKey;
-	bool bIgnoreCase;
 #endif
+	bool bIgnoreCase;
 	UINT nWordCount;
 	UINT nTotalLen;
 
@@ -305,8 +305,8 @@ void WordList_Init(struct WordList *pWList, LPCSTR pRoot, UINT iRootLen, bool bI
 	}
 #if NP2_AUTOC_CACHE_SORT_KEY
 	pWList->sortKey = pWList->WL_SortKeyFunc(pRoot, iRootLen);
-	pWList->bIgnoreCase = bIgnoreCase;
 #endif
+	pWList->bIgnoreCase = bIgnoreCase;
 
 	pWList->capacity = NP2_AUTOC_INIT_BUFFER_SIZE;
 	WordList_AddBuffer(pWList);
@@ -373,7 +373,7 @@ static inline bool WordList_IsSeparator(uint8_t ch) {
 #endif
 }
 
-void WordList_AddListEx(struct WordList *pWList, LPCSTR pList) {
+void WordList_AddListEx(struct WordList *pWList, LPCSTR pList, LPCSTR pEnd = nullptr) {
 	//StopWatch watch;
 	//watch.Start();
 	char word[NP2_AUTOC_WORD_BUFFER_SIZE];
@@ -403,7 +403,7 @@ void WordList_AddListEx(struct WordList *pWList, LPCSTR pList) {
 				ok = ch == '.';
 			}
 		}
-		if (ch == '\0') {
+		if (ch == '\0' || pList == pEnd) {
 			break;
 		}
 		if (ch == '^') {
@@ -427,6 +427,66 @@ static inline void WordList_AddList(struct WordList *pWList, LPCSTR pList) {
 	}
 }
 
+// find first word in sorted list [first, last) whose leading length bytes is
+// not less than (upper is false) or greater than (upper is true) key.
+static LPCSTR WordList_BinarySearch(LPCSTR first, LPCSTR last, LPCSTR key, UINT length, bool upper) {
+	while (first < last) {
+		LPCSTR mid = first + (last - first)/2;
+		while (mid > first && mid[-1] != ' ') {
+			--mid;
+		}
+		const int diff = strncmp(mid, key, length);
+		if (diff < 0 || (upper && diff == 0)) {
+			while (*mid && *mid != ' ') {
+				++mid;
+			}
+			first = mid + (*mid != '\0');
+		} else {
+			last = mid;
+		}
+	}
+	return first;
+}
+
+// keyword list generated by tools/KeywordCore.py (marked with KeywordAttr_PreSorted) is
+// sorted by byte value and separated by single space, words starts with same prefix are
+// contiguous, so only the matched range is parsed instead of whole list.
+static void WordList_AddSortedList(struct WordList *pWList, LPCSTR pList, uint64_t attr) {
+	UINT length = 0;
+	LPCSTR pRoot = pWList->pWordStart;
+	while (length < pWList->iStartLen && !WordList_IsSeparator(pRoot[length])) {
+		++length;
+	}
+	if (length == 0 || (attr & KeywordAttr_MakeLower)) {
+		// list for MakeLower is sorted case insensitively
+		WordList_AddListEx(pWList, pList);
+		return;
+	}
+
+	LPCSTR const pListEnd = pList + strlen(pList);
+	char key[2] = {pRoot[0], '\0'};
+	if (pWList->bIgnoreCase) {
+		// case insensitive prefix match only on first character
+		length = 1;
+		if (IsAlpha(key[0])) {
+			key[0] ^= 'a' - 'A';
+			LPCSTR pStart = WordList_BinarySearch(pList, pListEnd, key, length, false);
+			LPCSTR pEnd = WordList_BinarySearch(pStart, pListEnd, key, length, true);
+			if (pStart != pEnd) {
+				WordList_AddListEx(pWList, pStart, pEnd);
+			}
+			key[0] = pRoot[0];
+		}
+		pRoot = key;
+	}
+
+	LPCSTR pStart = WordList_BinarySearch(pList, pListEnd, pRoot, length, false);
+	LPCSTR pEnd = WordList_BinarySearch(pStart, pListEnd, pRoot, length, true);
+	if (pStart != pEnd) {
+		WordList_AddListEx(pWList, pStart, pEnd);
+	}
+}
+
 void WordList_AddSubWord(struct WordList *pWList, LPSTR pWord, UINT wordLength, UINT iRootLen) {
 	/*
 	when pRoot is 'b', split 'bugprone-branch-clone' as following:
@@ -959,7 +1019,11 @@ static void AutoC_AddKeyword(struct WordList *pWList, int iCurrentStyle) {
 		for (UINT i = 0; i < KEYWORDSET_MAX + 1; attr >>= 4, i++) {
 			const char *pKeywords = pLexCurrent->pKeyWords->pszKeyWords[i];
 			if (!(attr & KeywordAttr_NoAutoComp) && StrNotEmpty(pKeywords)) {
-				WordList_AddListEx(pWList, pKeywords);
+				if (attr & KeywordAttr_PreSorted) {
+					WordList_AddSortedList(pWList, pKeywords, attr);
+				} else {
+					WordList_AddListEx(pWList, pKeywords);
+				}
 			}
 		}
 	}
@@ -1003,7 +1067,11 @@ static void AutoC_AddKeyword(struct WordList *pWList, int iCurrentStyle) {
 		for (UINT i = 0; i < KEYWORDSET_MAX + 1; attr >>= 4, i++) {
 			const char *pKeywords = pLex->pKeyWords->pszKeyWords[i];
 			if (!(attr & KeywordAttr_NoAutoComp) && StrNotEmpty(pKeywords)) {
-				WordList_AddListEx(pWList, pKeywords);
+				if (attr & KeywordAttr_PreSorted) {
+					WordList_AddSortedList(pWList, pKeywords, attr);
+				} else {
+					WordList_AddListEx(pWList, pKeywords);
+				}
 			}
 		}
 	}
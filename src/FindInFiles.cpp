@@ -0,0 +1,721 @@
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+#if defined(_WIN32)
+struct IUnknown;
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include <cstring>
+#include <array>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include "ScintillaTypes.h"
+#include "ILexer.h"
+#include "Position.h"
+#include "CharClassify.h"
+#include "RESearch.h"
+#include "CaseFolder.h"
+#include "UniConversion.h"
+#include "VectorKernels.h"
+#include "FindInFiles.h"
+
+namespace fs = std::filesystem;
+using namespace Scintilla::Internal;
+
+namespace FindInFiles {
+
+namespace {
+
+constexpr size_t MaxLineTextLength = 1024;
+constexpr size_t BinaryDetectionSize = 64*1024;
+// text is folded in blocks for case insensitive search to limit buffer size
+constexpr size_t FoldBlockSize = 64*1024;
+
+constexpr uint8_t MakeLowerCase(uint8_t ch) noexcept {
+	return (ch >= 'A' && ch <= 'Z') ? (ch - 'A' + 'a') : ch;
+}
+
+// default word characters of Scintilla for UTF-8 document.
+constexpr bool IsWordChar(uint8_t ch) noexcept {
+	return ch >= 0x80 || (ch >= '0' && ch <= '9') || (MakeLowerCase(ch) >= 'a' && MakeLowerCase(ch) <= 'z') || ch == '_';
+}
+
+constexpr bool IsUTF8Continuation(uint8_t ch) noexcept {
+	return (ch & 0xC0) == 0x80;
+}
+
+// move forward to start of next character, at most to skip trail bytes of current character.
+size_t MoveToCharacterStart(std::string_view text, size_t position) noexcept {
+	position = std::min(position, text.size());
+	for (int i = 1; i < UTF8MaxBytes && position < text.size() && IsUTF8Continuation(text[position]); i++) {
+		++position;
+	}
+	return position;
+}
+
+// text of a line for RESearch, same as DocumentIndexer used by Document::FindText().
+class LineIndexer final : public CharacterIndexer {
+	std::string_view text;
+	Sci::Position end;
+public:
+	LineIndexer(std::string_view text_, Sci::Position end_) noexcept : text{text_}, end{end_} {}
+
+	char CharAt(Sci::Position index) const noexcept override {
+		return (index >= 0 && index < end) ? text[index] : '\0';
+	}
+
+	Sci::Position MovePositionOutsideChar(Sci::Position pos, Sci::Position moveDir) const noexcept override {
+		if (moveDir > 0) {
+			while (pos < end && IsUTF8Continuation(text[pos])) {
+				++pos;
+			}
+		} else {
+			while (pos > 0 && pos < end && IsUTF8Continuation(text[pos])) {
+				--pos;
+			}
+		}
+		return pos;
+	}
+};
+
+class MappedFile {
+	const char *data = nullptr;
+	size_t length = 0;
+#if defined(_WIN32)
+	HANDLE hMap = nullptr;
+#endif
+public:
+	MappedFile() noexcept = default;
+	MappedFile(const MappedFile &) = delete;
+	MappedFile &operator=(const MappedFile &) = delete;
+	~MappedFile() {
+		Close();
+	}
+	std::string_view View() const noexcept {
+		return {data, length};
+	}
+	bool Open(const fs::path &path, uint64_t maxFileSize) noexcept;
+	void Close() noexcept;
+};
+
+#if defined(_WIN32)
+bool MappedFile::Open(const fs::path &path, uint64_t maxFileSize) noexcept {
+	HANDLE hFile = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+		nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(hFile, &fileSize) || fileSize.QuadPart == 0 || static_cast<uint64_t>(fileSize.QuadPart) > maxFileSize) {
+		CloseHandle(hFile);
+		return false;
+	}
+	hMap = CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(hFile);
+	if (hMap == nullptr) {
+		return false;
+	}
+	data = static_cast<const char *>(MapViewOfFile(hMap, FILE_MAP_READ, 0, 0, 0));
+	if (data == nullptr) {
+		CloseHandle(hMap);
+		hMap = nullptr;
+		return false;
+	}
+	length = static_cast<size_t>(fileSize.QuadPart);
+	return true;
+}
+
+void MappedFile::Close() noexcept {
+	if (data) {
+		UnmapViewOfFile(data);
+		data = nullptr;
+	}
+	if (hMap) {
+		CloseHandle(hMap);
+		hMap = nullptr;
+	}
+	length = 0;
+}
+
+#else
+bool MappedFile::Open(const fs::path &path, uint64_t maxFileSize) noexcept {
+	const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		return false;
+	}
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size <= 0 || static_cast<uint64_t>(st.st_size) > maxFileSize) {
+		close(fd);
+		return false;
+	}
+	void *ptr = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (ptr == MAP_FAILED) {
+		return false;
+	}
+	madvise(ptr, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+	data = static_cast<const char *>(ptr);
+	length = static_cast<size_t>(st.st_size);
+	return true;
+}
+
+void MappedFile::Close() noexcept {
+	if (data) {
+		munmap(const_cast<char *>(data), length);
+		data = nullptr;
+	}
+	length = 0;
+}
+#endif
+
+}
+
+std::string PathToUTF8(const fs::path &path) {
+	const auto u8path = path.u8string();
+	return std::string(reinterpret_cast<const char *>(u8path.data()), u8path.size());
+}
+
+bool DecodeUTF8(std::string_view &text, std::string &buffer) {
+	(void)buffer;
+	if (text.size() >= 2) {
+		const uint8_t ch0 = text[0];
+		const uint8_t ch1 = text[1];
+		// UTF-16 or UTF-32 BOM
+		if ((ch0 == 0xFF && ch1 == 0xFE) || (ch0 == 0xFE && ch1 == 0xFF)) {
+			return false;
+		}
+		if (text.size() >= 3 && ch0 == 0xEF && ch1 == 0xBB && static_cast<uint8_t>(text[2]) == 0xBF) {
+			text.remove_prefix(3);
+		}
+	}
+	return std::memchr(text.data(), '\0', std::min(text.size(), BinaryDetectionSize)) == nullptr;
+}
+
+//=============================================================================
+// Filter, wildcard matching with same semantics as PathMatchSpec(): case insensitive,
+// '*' matches zero or more characters and '?' matches exactly one character.
+bool MatchSpec(std::string_view name, std::string_view spec) noexcept {
+	size_t nameIndex = 0;
+	size_t specIndex = 0;
+	size_t starSpec = std::string_view::npos;
+	size_t starName = 0;
+	while (nameIndex < name.size()) {
+		if (specIndex < spec.size()) {
+			const char ch = spec[specIndex];
+			if (ch == '*') {
+				starSpec = ++specIndex;
+				starName = nameIndex;
+				continue;
+			}
+			if (ch == '?' || MakeLowerCase(ch) == MakeLowerCase(name[nameIndex])) {
+				++specIndex;
+				++nameIndex;
+				continue;
+			}
+		}
+		if (starSpec == std::string_view::npos) {
+			return false;
+		}
+		// backtrack: let last '*' consume one more character
+		specIndex = starSpec;
+		nameIndex = ++starName;
+	}
+	while (specIndex < spec.size() && spec[specIndex] == '*') {
+		++specIndex;
+	}
+	// "*.*" also matches file name without extension
+	return specIndex == spec.size() || spec.substr(specIndex) == ".*";
+}
+
+Filter::Filter(std::string_view spec) {
+	while (!spec.empty()) {
+		const size_t end = std::min(spec.find(';'), spec.size());
+		std::string_view item = spec.substr(0, end);
+		spec.remove_prefix(std::min(end + 1, spec.size()));
+		while (!item.empty() && item.front() == ' ') {
+			item.remove_prefix(1);
+		}
+		while (!item.empty() && item.back() == ' ') {
+			item.remove_suffix(1);
+		}
+		if (item == "*.*" || item == "*") {
+			// match all, same as empty filter in DirList_CreateFilter()
+			specs.clear();
+			return;
+		}
+		if (!item.empty()) { // filters like "" are ignored
+			specs.emplace_back(item);
+		}
+	}
+}
+
+bool Filter::Match(std::string_view name) const noexcept {
+	for (const std::string &spec : specs) {
+		if (MatchSpec(name, spec)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+//=============================================================================
+// Searcher, literal and regular expression matcher with same options as Document::FindText().
+// Case insensitive literal search folds text with CaseFolderUnicode like Scintilla does for UTF-8 document,
+// regular expression is matched within a line by RESearch, the built-in regex used by Notepad4.
+class Searcher {
+	const std::string pattern;
+	const int searchFlags;
+	CharClassify charClass;
+	std::unique_ptr<CaseFolderUnicode> caseFolder;
+	std::string foldedPattern;
+	std::unique_ptr<RESearch> regex;
+
+	bool IsWordMatch(std::string_view text, size_t start, size_t end) const noexcept;
+	void SearchLiteral(std::string_view text, std::vector<MatchedLine> &lines) const;
+	void SearchFolded(std::string_view text, std::vector<MatchedLine> &lines) const;
+	bool SearchRegex(std::string_view text, std::vector<MatchedLine> &lines) const;
+
+public:
+	Searcher(std::string_view pattern_, int searchFlags_);
+	bool IsValid() const noexcept {
+		return !pattern.empty() && ((searchFlags & SearchFlag_RegExp) == 0 || regex != nullptr);
+	}
+	// returns false when some lines are skipped.
+	bool Search(std::string_view text, std::vector<MatchedLine> &lines) const {
+		if (searchFlags & SearchFlag_RegExp) {
+			return SearchRegex(text, lines);
+		}
+		if (caseFolder) {
+			SearchFolded(text, lines);
+		} else {
+			SearchLiteral(text, lines);
+		}
+		return true;
+	}
+};
+
+namespace {
+
+void AddMatchedLine(std::vector<MatchedLine> &lines, std::string_view text, size_t line, size_t lineStart, size_t position) {
+	size_t lineEnd = text.find('\n', position);
+	if (lineEnd == std::string_view::npos) {
+		lineEnd = text.size();
+	}
+	if (lineEnd > lineStart && text[lineEnd - 1] == '\r') {
+		--lineEnd;
+	}
+	size_t column = 1;
+	for (size_t index = lineStart; index < position; index++) {
+		column += !IsUTF8Continuation(text[index]);
+	}
+	if (lineEnd - lineStart > MaxLineTextLength) {
+		lineEnd = lineStart + MaxLineTextLength;
+		while (lineEnd > lineStart && IsUTF8Continuation(text[lineEnd])) {
+			--lineEnd;
+		}
+	}
+	lines.push_back({line, column, std::string(text.substr(lineStart, lineEnd - lineStart))});
+}
+
+}
+
+Searcher::Searcher(std::string_view pattern_, int searchFlags_):
+	pattern{pattern_}, searchFlags{searchFlags_} {
+	if (pattern.empty()) {
+		return;
+	}
+	if (searchFlags & SearchFlag_RegExp) {
+		regex = std::make_unique<RESearch>(&charClass);
+		const Scintilla::FindOption flags = static_cast<Scintilla::FindOption>(searchFlags & (SearchFlag_MatchCase | SearchFlag_RegExp | SearchFlag_Posix));
+		if (regex->Compile(pattern.data(), pattern.size(), flags) != nullptr) {
+			// invalid regular expression
+			regex.reset();
+		}
+	} else if (!(searchFlags & SearchFlag_MatchCase)) {
+		// case conversion tables are built on first use, so fold find text before running worker threads.
+		caseFolder = std::make_unique<CaseFolderUnicode>();
+		foldedPattern.resize(pattern.size()*maxFoldTextExpansion + 1);
+		std::vector<uint32_t> starts(foldedPattern.size());
+		foldedPattern.resize(caseFolder->FoldText(foldedPattern.data(), starts.data(), pattern.data(), pattern.size()));
+	}
+}
+
+bool Searcher::IsWordMatch(std::string_view text, size_t start, size_t end) const noexcept {
+	if (searchFlags & (SearchFlag_WholeWord | SearchFlag_WordStart)) {
+		if (start != 0 && IsWordChar(text[start - 1]) && IsWordChar(text[start])) {
+			return false;
+		}
+		if ((searchFlags & SearchFlag_WholeWord) && end < text.size() && IsWordChar(text[end - 1]) && IsWordChar(text[end])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void Searcher::SearchLiteral(std::string_view text, std::vector<MatchedLine> &lines) const {
+	size_t line = 1;
+	size_t lineStart = 0;
+	size_t position = 0;
+	while (position < text.size()) {
+		const char *match = np2::vectorKernels.FindSubstring(text.data() + position, text.size() - position, pattern.data(), pattern.size());
+		if (match == nullptr) {
+			break;
+		}
+		position = match - text.data();
+		if (!IsWordMatch(text, position, position + pattern.size())) {
+			++position;
+			continue;
+		}
+		// count line ends before the match
+		const char *ptr = text.data() + lineStart;
+		const char * const end = text.data() + position;
+		while ((ptr = static_cast<const char *>(std::memchr(ptr, '\n', end - ptr))) != nullptr) {
+			++ptr;
+			++line;
+			lineStart = ptr - text.data();
+		}
+		AddMatchedLine(lines, text, line, lineStart, position);
+		// only first match for each line is reported
+		position = text.find('\n', position);
+		if (position == std::string_view::npos) {
+			break;
+		}
+		++position;
+		++line;
+		lineStart = position;
+	}
+}
+
+// Same result as folding whole text then searching folded pattern, match must start and end at character boundary.
+// Mixed text matched by folded pattern is at most UTF8MaxBytes times longer, so each block is folded
+// with that much overlap, and matches start in the overlap are found in next block.
+void Searcher::SearchFolded(std::string_view text, std::vector<MatchedLine> &lines) const {
+	const size_t overlap = foldedPattern.size()*UTF8MaxBytes;
+	std::string folded;
+	std::vector<uint32_t> starts;
+	size_t line = 1;
+	size_t lineStart = 0;
+	size_t position = 0;
+	while (position < text.size()) {
+		const size_t blockStart = position;
+		const size_t blockEnd = MoveToCharacterStart(text, blockStart + FoldBlockSize);
+		const size_t foldEnd = MoveToCharacterStart(text, blockEnd + overlap);
+		const size_t lenMixed = foldEnd - blockStart;
+		if (folded.size() <= lenMixed*maxFoldTextExpansion) {
+			folded.resize(lenMixed*maxFoldTextExpansion + 1);
+			starts.resize(folded.size());
+		}
+		const size_t lenFolded = caseFolder->FoldText(folded.data(), starts.data(), text.data() + blockStart, lenMixed);
+		position = blockEnd;
+		size_t index = 0;
+		while (index < lenFolded) {
+			const char *match = np2::vectorKernels.FindSubstring(folded.data() + index, lenFolded - index, foldedPattern.data(), foldedPattern.size());
+			if (match == nullptr) {
+				break;
+			}
+			index = match - folded.data();
+			const uint32_t matchStart = starts[index];
+			const uint32_t matchEnd = starts[index + foldedPattern.size()];
+			++index;
+			if (matchStart == foldedContinuation || matchEnd == foldedContinuation) {
+				continue;
+			}
+			const size_t start = blockStart + matchStart;
+			if (start >= blockEnd) {
+				break;
+			}
+			if (!IsWordMatch(text, start, blockStart + matchEnd)) {
+				continue;
+			}
+			// count line ends before the match
+			const char *ptr = text.data() + lineStart;
+			const char * const end = text.data() + start;
+			while ((ptr = static_cast<const char *>(std::memchr(ptr, '\n', end - ptr))) != nullptr) {
+				++ptr;
+				++line;
+				lineStart = ptr - text.data();
+			}
+			AddMatchedLine(lines, text, line, lineStart, start);
+			// only first match for each line is reported, line end is not changed by folding
+			const char *next = static_cast<const char *>(std::memchr(match, '\n', folded.data() + lenFolded - match));
+			if (next != nullptr) {
+				index = next - folded.data();
+				lineStart = blockStart + starts[index] + 1;
+				++index;
+			} else {
+				lineStart = text.find('\n', foldEnd);
+				if (lineStart == std::string_view::npos) {
+					return;
+				}
+				++lineStart;
+				index = lenFolded;
+			}
+			++line;
+			position = std::max(blockEnd, lineStart);
+		}
+	}
+}
+
+bool Searcher::SearchRegex(std::string_view text, std::vector<MatchedLine> &lines) const {
+	// match positions are stored in RESearch
+	RESearch search = *regex;
+	size_t line = 1;
+	size_t lineStart = 0;
+	bool complete = true;
+	while (lineStart < text.size()) {
+		size_t lineEnd = text.find('\n', lineStart);
+		if (lineEnd == std::string_view::npos) {
+			lineEnd = text.size();
+		}
+		size_t endOfLine = lineEnd;
+		if (endOfLine != lineStart && text[endOfLine - 1] == '\r') {
+			--endOfLine;
+		}
+		if (endOfLine - lineStart > MaxRegexLineLength) {
+			complete = false;
+		} else {
+			const Sci::Position startPos = lineStart;
+			const Sci::Position endPos = endOfLine;
+			const LineIndexer indexer(text, endPos);
+			search.SetLineRange(startPos, endPos);
+			if (search.Execute(indexer, startPos, endPos)) {
+				AddMatchedLine(lines, text, line, lineStart, search.bopat[0]);
+			}
+		}
+		lineStart = lineEnd + 1;
+		++line;
+	}
+	return complete;
+}
+
+//=============================================================================
+// Pool, work-stealing thread pool: each worker pops tasks from back of its own queue,
+// new tasks are pushed to back of its own queue, idle worker steals from front of other queues.
+class Engine::Pool {
+	struct Task {
+		fs::path path;
+		bool directory;
+	};
+	struct alignas(64) TaskQueue {
+		std::mutex mutex;
+		std::deque<Task> tasks;
+	};
+
+	Engine &engine;
+	std::vector<TaskQueue> queues;
+	std::atomic<size_t> pending;	// tasks not finished
+	std::atomic<size_t> queued;		// tasks not taken by any worker
+	// idle worker waits for new task, end of search or cancellation
+	std::mutex idleMutex;
+	std::condition_variable idleCondition;
+	std::mutex statMutex;
+	Statistics total;
+
+	void Push(unsigned worker, Task &&task) {
+		pending.fetch_add(1, std::memory_order_relaxed);
+		{
+			TaskQueue &queue = queues[worker];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			queue.tasks.push_back(std::move(task));
+		}
+		queued.fetch_add(1, std::memory_order_release);
+		Notify(false);
+	}
+	void Notify(bool all) {
+		// lock to not lose wakeup between checking and waiting
+		{
+			std::lock_guard<std::mutex> lock(idleMutex);
+		}
+		if (all) {
+			idleCondition.notify_all();
+		} else {
+			idleCondition.notify_one();
+		}
+	}
+	void Wait() {
+		std::unique_lock<std::mutex> lock(idleMutex);
+		idleCondition.wait(lock, [this] {
+			return queued.load(std::memory_order_acquire) != 0 || pending.load(std::memory_order_acquire) == 0 || engine.IsCancelled();
+		});
+	}
+	bool Pop(unsigned worker, Task &task) {
+		TaskQueue &queue = queues[worker];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (queue.tasks.empty()) {
+			return false;
+		}
+		task = std::move(queue.tasks.back());
+		queue.tasks.pop_back();
+		queued.fetch_sub(1, std::memory_order_relaxed);
+		return true;
+	}
+	bool Steal(unsigned worker, Task &task) {
+		const unsigned count = static_cast<unsigned>(queues.size());
+		for (unsigned index = 1; index < count; index++) {
+			TaskQueue &queue = queues[(worker + index) % count];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			if (!queue.tasks.empty()) {
+				task = std::move(queue.tasks.front());
+				queue.tasks.pop_front();
+				queued.fetch_sub(1, std::memory_order_relaxed);
+				return true;
+			}
+		}
+		return false;
+	}
+	void ListDirectory(unsigned worker, const fs::path &directory);
+	void Work(unsigned worker);
+
+public:
+	Pool(Engine &engine_, unsigned threadCount): engine{engine_}, queues(threadCount), pending{0}, queued{0} {}
+	Statistics Run(const fs::path &directory);
+};
+
+void Engine::Pool::ListDirectory(unsigned worker, const fs::path &directory) {
+	std::error_code ec;
+	fs::directory_iterator iter(directory, fs::directory_options::skip_permission_denied, ec);
+	for (; !ec && iter != fs::directory_iterator(); iter.increment(ec)) {
+		if (engine.IsCancelled()) {
+			break;
+		}
+		const fs::directory_entry &entry = *iter;
+		std::error_code ecEntry;
+		if (entry.is_directory(ecEntry)) {
+			// not follow directory symbolic link to avoid cycle
+			if (engine.options.recursive && !entry.is_symlink(ecEntry)) {
+				Push(worker, {entry.path(), true});
+			}
+		} else if (entry.is_regular_file(ecEntry) && engine.AcceptFile(entry.path())) {
+			Push(worker, {entry.path(), false});
+		}
+	}
+}
+
+void Engine::Pool::Work(unsigned worker) {
+	Statistics stat;
+	Task task;
+	while (!engine.IsCancelled()) {
+		if (Pop(worker, task) || Steal(worker, task)) {
+			if (task.directory) {
+				ListDirectory(worker, task.path);
+			} else {
+				engine.SearchFile(task.path, stat);
+			}
+			if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+				// last task finished, wake up all idle workers to exit
+				Notify(true);
+			}
+		} else if (pending.load(std::memory_order_acquire) == 0) {
+			break;
+		} else {
+			Wait();
+		}
+	}
+	// wake up idle workers after cancellation
+	Notify(true);
+
+	std::lock_guard<std::mutex> lock(statMutex);
+	total.fileCount += stat.fileCount;
+	total.matchedFileCount += stat.matchedFileCount;
+	total.skippedFileCount += stat.skippedFileCount;
+	total.matchedLineCount += stat.matchedLineCount;
+	total.byteCount += stat.byteCount;
+}
+
+Statistics Engine::Pool::Run(const fs::path &directory) {
+	std::error_code ec;
+	if (fs::is_directory(directory, ec)) {
+		Push(0, {directory, true});
+	} else {
+		Push(0, {directory, false});
+	}
+
+	const unsigned count = static_cast<unsigned>(queues.size());
+	std::vector<std::thread> threads;
+	threads.reserve(count - 1);
+	for (unsigned worker = 1; worker < count; worker++) {
+		threads.emplace_back(&Pool::Work, this, worker);
+	}
+	Work(0);
+	for (std::thread &thread : threads) {
+		thread.join();
+	}
+	return total;
+}
+
+//=============================================================================
+// Engine
+Engine::Engine(const Options &options_, Decoder decoder_, ResultSink sink_):
+	options{options_}, decoder{std::move(decoder_)}, sink{std::move(sink_)},
+	include{options_.includeFilter}, exclude{options_.excludeFilter}, cancelled{false} {
+	auto matcher = std::make_unique<Searcher>(options.findText, options.searchFlags);
+	if (matcher->IsValid()) {
+		searcher = std::move(matcher);
+	}
+	if (!decoder) {
+		decoder = DecodeUTF8;
+	}
+}
+
+Engine::~Engine() = default;
+
+bool Engine::AcceptFile(const fs::path &path) const {
+	const std::string name = PathToUTF8(path.filename());
+	return (include.Empty() || include.Match(name)) && !exclude.Match(name);
+}
+
+bool Engine::SearchText(std::string_view text, std::vector<MatchedLine> &lines) const {
+	return searcher->Search(text, lines);
+}
+
+bool Engine::SearchFile(const fs::path &path, Statistics &stat) const {
+	MappedFile file;
+	if (!file.Open(path, options.maxFileSize)) {
+		return false;
+	}
+
+	std::string_view text = file.View();
+	std::string buffer;
+	++stat.fileCount;
+	stat.byteCount += text.size();
+	if (!decoder(text, buffer)) {
+		return false;
+	}
+
+	FileResult result;
+	result.skipped = !searcher->Search(text, result.lines);
+	stat.skippedFileCount += result.skipped;
+	if (result.lines.empty() && !result.skipped) {
+		return false;
+	}
+	if (!result.lines.empty()) {
+		++stat.matchedFileCount;
+		stat.matchedLineCount += result.lines.size();
+	}
+	if (sink) {
+		result.path = PathToUTF8(path);
+		sink(std::move(result));
+	}
+	return true;
+}
+
+Statistics Engine::Run(const fs::path &directory) {
+	if (!IsValid()) {
+		return {};
+	}
+	unsigned threadCount = options.threadCount;
+	if (threadCount == 0) {
+		threadCount = std::max(std::thread::hardware_concurrency(), 1U);
+	}
+	Pool pool(*this, threadCount);
+	return pool.Run(directory);
+}
+
+}
@@ -0,0 +1,131 @@
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+// Find in Files engine: walks a directory tree on a work-stealing thread pool,
+// memory maps each file and streams matched lines to the caller.
+// It only depends on the C++ standard library, VectorKernels and Scintilla's case folding and
+// built-in regex (plus mmap / file mapping), so it can be built and benchmarked outside of Notepad4.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace FindInFiles {
+
+// same values as SCFIND_* flags used by Document::FindText()
+enum SearchFlag {
+	SearchFlag_None = 0,
+	SearchFlag_WholeWord = 0x2,
+	SearchFlag_MatchCase = 0x4,
+	SearchFlag_WordStart = 0x00100000,
+	// built-in regex matched within a line, same syntax as Find dialog.
+	// lines longer than MaxRegexLineLength are skipped, the file is reported with FileResult::skipped.
+	SearchFlag_RegExp = 0x00200000,
+	// ( ) for tagged sections, used together with SearchFlag_RegExp
+	SearchFlag_Posix = 0x00400000,
+};
+
+// limits backtracking of the built-in regex, e.g. ".*" is quadratic on long lines of minified files.
+constexpr size_t MaxRegexLineLength = 1024;
+
+struct Options {
+	std::string findText;		// UTF-8 encoded
+	int searchFlags = SearchFlag_None;
+	std::string includeFilter;	// e.g. "*.cpp;*.h", empty or "*.*" for all files
+	std::string excludeFilter;	// e.g. "*.obj;*.exe", empty for nothing
+	bool recursive = true;
+	unsigned threadCount = 0;	// 0 to use all hardware threads
+	uint64_t maxFileSize = 256*1024*1024;
+};
+
+struct MatchedLine {
+	size_t line;			// 1-based line number
+	size_t column;			// 1-based character column of first match
+	std::string text;		// line content without line ending
+};
+
+struct FileResult {
+	std::string path;		// UTF-8 encoded
+	std::vector<MatchedLine> lines;
+	bool skipped = false;	// some lines are not searched
+};
+
+struct Statistics {
+	size_t fileCount = 0;
+	size_t matchedFileCount = 0;
+	size_t skippedFileCount = 0;
+	size_t matchedLineCount = 0;
+	uint64_t byteCount = 0;
+};
+
+// Converts file content to UTF-8: either adjust text in place (e.g. skip BOM)
+// or store converted text into buffer and point text to it.
+// Returns false to skip the file, e.g. binary file.
+using Decoder = std::function<bool(std::string_view &text, std::string &buffer)>;
+// Called from worker threads for each file contains matches or skipped lines, must be thread safe.
+using ResultSink = std::function<void(FileResult &&result)>;
+
+// default decoder: skip UTF-8 BOM and binary (UTF-16, UTF-32 or contains NUL) files.
+bool DecodeUTF8(std::string_view &text, std::string &buffer);
+
+// semicolon separated wildcard list, matched like PathMatchSpec() used by DirList_MatchFilter()
+class Filter {
+	std::vector<std::string> specs;
+public:
+	explicit Filter(std::string_view spec);
+	bool Empty() const noexcept {
+		return specs.empty();
+	}
+	bool Match(std::string_view name) const noexcept;
+};
+
+bool MatchSpec(std::string_view name, std::string_view spec) noexcept;
+
+class Searcher;
+
+class Engine {
+	Options options;
+	Decoder decoder;
+	ResultSink sink;
+	Filter include;
+	Filter exclude;
+	std::unique_ptr<Searcher> searcher;
+	std::atomic<bool> cancelled;
+
+public:
+	Engine(const Options &options_, Decoder decoder_, ResultSink sink_);
+	~Engine();
+	Engine(const Engine &) = delete;
+	Engine &operator=(const Engine &) = delete;
+
+	// false when find text is empty or regular expression is invalid.
+	bool IsValid() const noexcept {
+		return searcher != nullptr;
+	}
+	void Cancel() noexcept {
+		cancelled.store(true, std::memory_order_relaxed);
+	}
+	bool IsCancelled() const noexcept {
+		return cancelled.load(std::memory_order_relaxed);
+	}
+	// blocks until all files under directory are searched or search is cancelled.
+	Statistics Run(const std::filesystem::path &directory);
+	// search text of a single file, exposed for tests and benchmarks.
+	// returns false when some lines are skipped.
+	bool SearchText(std::string_view text, std::vector<MatchedLine> &lines) const;
+
+private:
+	class Pool;
+	bool AcceptFile(const std::filesystem::path &path) const;
+	bool SearchFile(const std::filesystem::path &path, Statistics &stat) const;
+};
+
+std::string PathToUTF8(const std::filesystem::path &path);
+
+}
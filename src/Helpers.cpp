@@ -34,6 +34,7 @@ struct IUnknown;
 #include <cstdio>
 #include "config.h"
 #include "Helpers.h"
+#include "IniFile.h"
 #include "VectorISA.h"
 #include "GraphicUtils.h"
 #include "resource.h"
@@ -73,12 +74,143 @@ void DebugPrintf(const char *fmt, ...) noexcept {
 	DebugPrint(buf);
 }
 
+// GetPrivateProfile*() and WritePrivateProfile*() read and parse whole ini file on each call,
+// loading or saving settings would parse it hundreds of times.
+static struct {
+	int depth;
+	bool failed;	// store can't be saved
+	IniFile::Store *store;
+	WCHAR path[MAX_PATH];
+} iniFileBatch;
+
+static inline IniFile::Store *IniFileBatch_GetStore(LPCWSTR lpszIniFile) noexcept {
+	IniFile::Store *store = iniFileBatch.store;
+	return (store != nullptr && StrCaseEqual(iniFileBatch.path, lpszIniFile)) ? store : nullptr;
+}
+
+// write changes back and release the store, remaining calls in the batch use profile API.
+static void IniFileBatch_Detach() noexcept {
+	IniFile::Store *store = iniFileBatch.store;
+	iniFileBatch.store = nullptr;
+	try {
+		if (store->Modified() && !store->Save(iniFileBatch.path)) {
+			iniFileBatch.failed = true;
+		}
+	} catch (...) {
+		iniFileBatch.failed = true;
+	}
+	delete store;
+}
+
+bool IniFileBatch_Begin(LPCWSTR lpszIniFile) noexcept {
+	++iniFileBatch.depth;
+	if (iniFileBatch.depth != 1) {
+		// nested batch only shares store for same file
+		return IniFileBatch_GetStore(lpszIniFile) != nullptr;
+	}
+	iniFileBatch.failed = false;
+	if (StrIsEmpty(lpszIniFile)) {
+		return false;
+	}
+
+	IniFile::Store *store = nullptr;
+	try {
+		store = new IniFile::Store();
+		if (!store->Load(lpszIniFile)) {
+			delete store;
+			return false;
+		}
+	} catch (...) {
+		// out of memory, use profile API
+		delete store;
+		return false;
+	}
+	lstrcpyn(iniFileBatch.path, lpszIniFile, COUNTOF(iniFileBatch.path));
+	iniFileBatch.store = store;
+	return true;
+}
+
+bool IniFileBatch_End() noexcept {
+	--iniFileBatch.depth;
+	if (iniFileBatch.depth != 0) {
+		return true;
+	}
+	if (iniFileBatch.store != nullptr) {
+		IniFileBatch_Detach();
+	}
+	return !iniFileBatch.failed;
+}
+
+DWORD IniGetStringEx(LPCWSTR lpSection, LPCWSTR lpName, LPCWSTR lpDefault, LPWSTR lpReturnedStr, DWORD nSize, LPCWSTR lpszIniFile) noexcept {
+	const IniFile::Store *store = IniFileBatch_GetStore(lpszIniFile);
+	if (store == nullptr || lpSection == nullptr || lpName == nullptr || nSize == 0) {
+		return GetPrivateProfileString(lpSection, lpName, lpDefault, lpReturnedStr, nSize, lpszIniFile);
+	}
+
+	const std::wstring_view value = store->GetString(lpSection, lpName, (lpDefault == nullptr) ? L"" : lpDefault);
+	const DWORD length = static_cast<DWORD>(min<size_t>(value.length(), nSize - 1));
+	memcpy(lpReturnedStr, value.data(), length*sizeof(WCHAR));
+	lpReturnedStr[length] = L'\0';
+	return length;
+}
+
+UINT IniGetIntEx(LPCWSTR lpSection, LPCWSTR lpName, int nDefault, LPCWSTR lpszIniFile) noexcept {
+	const IniFile::Store *store = IniFileBatch_GetStore(lpszIniFile);
+	if (store == nullptr) {
+		return GetPrivateProfileInt(lpSection, lpName, nDefault, lpszIniFile);
+	}
+	return store->GetInt(lpSection, lpName, nDefault);
+}
+
+BOOL IniSetStringEx(LPCWSTR lpSection, LPCWSTR lpName, LPCWSTR lpString, LPCWSTR lpszIniFile) noexcept {
+	IniFile::Store *store = IniFileBatch_GetStore(lpszIniFile);
+	if (store == nullptr || lpSection == nullptr) {
+		return WritePrivateProfileString(lpSection, lpName, lpString, lpszIniFile);
+	}
+
+	if (lpName == nullptr) {
+		store->DeleteSection(lpSection);
+	} else if (lpString == nullptr) {
+		store->DeleteKey(lpSection, lpName);
+	} else {
+		try {
+			store->SetValue(lpSection, lpName, lpString);
+		} catch (...) {
+			IniFileBatch_Detach();
+			return WritePrivateProfileString(lpSection, lpName, lpString, lpszIniFile);
+		}
+	}
+	return TRUE;
+}
+
+DWORD LoadIniSectionEx(LPCWSTR lpSection, LPWSTR lpBuf, DWORD cchBuf, LPCWSTR lpszIniFile) noexcept {
+	const IniFile::Store *store = IniFileBatch_GetStore(lpszIniFile);
+	if (store == nullptr) {
+		return GetPrivateProfileSection(lpSection, lpBuf, cchBuf, lpszIniFile);
+	}
+	return static_cast<DWORD>(store->GetSection(lpSection, lpBuf, cchBuf));
+}
+
+BOOL SaveIniSectionEx(LPCWSTR lpSection, LPCWSTR lpBuf, LPCWSTR lpszIniFile) noexcept {
+	IniFile::Store *store = IniFileBatch_GetStore(lpszIniFile);
+	if (store == nullptr) {
+		return WritePrivateProfileSection(lpSection, lpBuf, lpszIniFile);
+	}
+	try {
+		store->SetSection(lpSection, lpBuf);
+	} catch (...) {
+		IniFileBatch_Detach();
+		return WritePrivateProfileSection(lpSection, lpBuf, lpszIniFile);
+	}
+	return TRUE;
+}
+
 void IniClearSectionEx(LPCWSTR lpSection, LPCWSTR lpszIniFile, bool bDelete) noexcept {
 	if (StrIsEmpty(lpszIniFile)) {
 		return;
 	}
 
-	WritePrivateProfileSection(lpSection, (bDelete ? nullptr : L""), lpszIniFile);
+	SaveIniSectionEx(lpSection, (bDelete ? nullptr : L""), lpszIniFile);
 }
 
 void IniClearAllSectionEx(LPCWSTR lpszPrefix, LPCWSTR lpszIniFile, bool bDelete) noexcept {
@@ -86,12 +218,36 @@ void IniClearAllSectionEx(LPCWSTR lpszPrefix, LPCWSTR lpszIniFile, bool bDelete)
 		return;
 	}
 
+	const int len = lstrlen(lpszPrefix);
+	const IniFile::Store *store = IniFileBatch_GetStore(lpszIniFile);
+	if (store != nullptr) {
+		try {
+			WCHAR name[256];
+			for (const std::wstring_view section : store->SectionNames()) {
+				if (section.length() >= static_cast<size_t>(len) && section.length() < COUNTOF(name)
+					&& StrHasPrefixCaseEx(section.data(), lpszPrefix, len)) {
+					memcpy(name, section.data(), section.length()*sizeof(WCHAR));
+					name[section.length()] = L'\0';
+					SaveIniSectionEx(name, (bDelete ? nullptr : L""), lpszIniFile);
+					if (iniFileBatch.store != store) {
+						// store was released, names are gone, clear remaining sections below
+						break;
+					}
+				}
+			}
+			if (iniFileBatch.store == store) {
+				return;
+			}
+		} catch (...) {
+			IniFileBatch_Detach();
+		}
+	}
+
 	WCHAR sections[1024] = L"";
 	GetPrivateProfileSectionNames(sections, COUNTOF(sections), lpszIniFile);
 
 	LPCWSTR p = sections;
 	LPCWSTR value = bDelete ? nullptr : L"";
-	const int len = lstrlen(lpszPrefix);
 
 	while (*p) {
 		if (StrHasPrefixCaseEx(p, lpszPrefix, len)) {
@@ -385,12 +385,25 @@ inline int GetBitmapResourceIdForCurrentDPI(int resourceId) noexcept {
 #define NP2HeapFree(hMem)			HeapFree(g_hDefaultHeap, 0, (hMem))
 #define NP2HeapSize(hMem)			HeapSize(g_hDefaultHeap, 0, (hMem))
 
+// Ini file batch: the file is read once into memory, following Ini*() calls and (Load|Save)IniSection()
+// on same file are served from memory, changes are written back when outermost batch ends.
+// every IniFileBatch_Begin() must be paired with IniFileBatch_End().
+// IniFileBatch_End() returns false when outermost batch failed to write changes back.
+bool IniFileBatch_Begin(LPCWSTR lpszIniFile) noexcept;
+bool IniFileBatch_End() noexcept;
+
+DWORD IniGetStringEx(LPCWSTR lpSection, LPCWSTR lpName, LPCWSTR lpDefault, LPWSTR lpReturnedStr, DWORD nSize, LPCWSTR lpszIniFile) noexcept;
+UINT IniGetIntEx(LPCWSTR lpSection, LPCWSTR lpName, int nDefault, LPCWSTR lpszIniFile) noexcept;
+BOOL IniSetStringEx(LPCWSTR lpSection, LPCWSTR lpName, LPCWSTR lpString, LPCWSTR lpszIniFile) noexcept;
+DWORD LoadIniSectionEx(LPCWSTR lpSection, LPWSTR lpBuf, DWORD cchBuf, LPCWSTR lpszIniFile) noexcept;
+BOOL SaveIniSectionEx(LPCWSTR lpSection, LPCWSTR lpBuf, LPCWSTR lpszIniFile) noexcept;
+
 #define IniGetString(lpSection, lpName, lpDefault, lpReturnedStr, nSize) \
-	GetPrivateProfileString(lpSection, lpName, lpDefault, lpReturnedStr, nSize, szIniFile)
+	IniGetStringEx(lpSection, lpName, lpDefault, lpReturnedStr, nSize, szIniFile)
 #define IniGetInt(lpSection, lpName, nDefault) \
-	GetPrivateProfileInt(lpSection, lpName, nDefault, szIniFile)
+	IniGetIntEx(lpSection, lpName, nDefault, szIniFile)
 #define IniSetString(lpSection, lpName, lpString) \
-	WritePrivateProfileString(lpSection, lpName, lpString, szIniFile)
+	IniSetStringEx(lpSection, lpName, lpString, szIniFile)
 
 void IniClearSectionEx(LPCWSTR lpSection, LPCWSTR lpszIniFile, bool bDelete) noexcept;
 #define IniClearSection(lpSection)			IniClearSectionEx((lpSection), szIniFile, false)
@@ -423,9 +436,9 @@ inline void IniSetBoolEx(LPCWSTR lpSection, LPCWSTR lpName, bool b, bool bDefaul
 }
 
 #define LoadIniSection(lpSection, lpBuf, cchBuf) \
-	GetPrivateProfileSection(lpSection, lpBuf, cchBuf, szIniFile);
+	LoadIniSectionEx(lpSection, lpBuf, cchBuf, szIniFile);
 #define SaveIniSection(lpSection, lpBuf) \
-	WritePrivateProfileSection(lpSection, lpBuf, szIniFile)
+	SaveIniSectionEx(lpSection, lpBuf, szIniFile)
 
 struct IniKeyValueNode;
 struct IniKeyValueNode {
@@ -0,0 +1,217 @@
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+#include <cstdlib>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include "IndentDetection.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define NP2_INDENT_USE_SSE2	1
+	#include <emmintrin.h>
+#else
+	#define NP2_INDENT_USE_SSE2	0
+#endif
+
+namespace IndentDetection {
+
+namespace {
+
+// pointer after next line ending.
+const uint8_t *SkipLine(const uint8_t *ptr, const uint8_t *end) noexcept {
+#if NP2_INDENT_USE_SSE2
+	const __m128i vectCR = _mm_set1_epi8('\r');
+	const __m128i vectLF = _mm_set1_epi8('\n');
+	while (ptr + sizeof(__m128i) <= end) {
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+		const uint32_t mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, vectCR), _mm_cmpeq_epi8(chunk, vectLF)));
+		if (mask != 0) {
+			return ptr + std::countr_zero(mask) + 1;
+		}
+		ptr += sizeof(__m128i);
+	}
+#endif
+	while (ptr < end) {
+		const uint8_t ch = *ptr++;
+		if (ch == '\r' || ch == '\n') {
+			break;
+		}
+	}
+	return ptr;
+}
+
+// count of spaces at ptr.
+size_t CountSpaces(const uint8_t *ptr, const uint8_t *end) noexcept {
+	const uint8_t * const start = ptr;
+#if NP2_INDENT_USE_SSE2
+	const __m128i vectSpace = _mm_set1_epi8(' ');
+	while (ptr + sizeof(__m128i) <= end) {
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr));
+		const uint32_t mask = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, vectSpace)) ^ 0xffff;
+		if (mask != 0) {
+			return ptr - start + std::countr_zero(mask);
+		}
+		ptr += sizeof(__m128i);
+	}
+#endif
+	while (ptr < end && *ptr == ' ') {
+		++ptr;
+	}
+	return ptr - start;
+}
+
+}
+
+void Histogram::Merge(const Histogram &other) noexcept {
+	for (int i = 0; i < MaxTabWidth + 2; i++) {
+		lines[i] += other.lines[i];
+	}
+	blockCount += other.blockCount;
+	byteCount += other.byteCount;
+}
+
+void ScanBlock(const char *data, size_t length, size_t start, size_t end, Histogram &histogram) noexcept {
+	const uint8_t * const fileEnd = reinterpret_cast<const uint8_t *>(data) + length;
+	const uint8_t * const blockEnd = reinterpret_cast<const uint8_t *>(data) + std::min(end, length);
+	const uint8_t *ptr = reinterpret_cast<const uint8_t *>(data) + start;
+	if (start != 0 && start < length && ptr[-1] != '\r' && ptr[-1] != '\n') {
+		ptr = SkipLine(ptr, fileEnd);
+	}
+	histogram.blockCount += 1;
+	histogram.byteCount += std::min(end, length) - std::min(start, length);
+
+	int prevIndentCount = 0;
+	int prevTabWidth = 0;
+	while (ptr < blockEnd) {
+		switch (*ptr++) {
+		case '\t':
+			++histogram.lines[Histogram::Tab];
+			break;
+
+		case ' ': {
+			const size_t spaces = CountSpaces(ptr, fileEnd);
+			ptr += spaces;
+			int indentCount = static_cast<int>(std::min<size_t>(spaces + 1, INT32_MAX/2));
+			if ((indentCount & 1) != 0 && ptr < fileEnd && *ptr == '*') {
+				// fix alignment space before star in Javadoc style comment: ` * comment content`
+				--indentCount;
+				if (indentCount == 0) {
+					break;
+				}
+			}
+			if (indentCount != prevIndentCount) {
+				const int delta = std::abs(indentCount - prevIndentCount);
+				prevIndentCount = indentCount;
+				// TODO: fix other (e.g. function argument) alignment spaces.
+				if (delta <= MaxTabWidth) {
+					prevTabWidth = std::min(delta, indentCount);
+				} else {
+					prevTabWidth = Histogram::Ambiguous;
+				}
+			}
+			++histogram.lines[prevTabWidth];
+		} break;
+
+		case '\r':
+		case '\n':
+			continue;
+
+		default:
+			prevIndentCount = 0;
+			break;
+		}
+
+		ptr = SkipLine(ptr, fileEnd);
+	}
+}
+
+Histogram Scan(const char *data, size_t length, const Options &options) {
+	Histogram histogram{};
+	if (length == 0) {
+		return histogram;
+	}
+
+	size_t blockSize = std::max<size_t>(options.blockSize, 1);
+	size_t blockCount = length/blockSize + (length % blockSize != 0);
+	const bool sampled = options.maxSampleSize != 0 && length > options.maxSampleSize;
+	if (sampled) {
+		blockSize = std::clamp<size_t>(options.sampleBlockSize, 1, options.maxSampleSize);
+		blockCount = options.maxSampleSize/blockSize;
+	}
+	const auto scanBlock = [=](size_t index, Histogram &result) noexcept {
+		uint64_t start = static_cast<uint64_t>(index)*blockSize;
+		if (sampled && blockCount > 1) {
+			// first block at file start, last block at file end
+			start = static_cast<uint64_t>(index)*(length - blockSize)/(blockCount - 1);
+		}
+		ScanBlock(data, length, static_cast<size_t>(start), static_cast<size_t>(start + blockSize), result);
+	};
+
+	unsigned threadCount = options.threadCount;
+	if (threadCount == 0) {
+		threadCount = std::max(std::thread::hardware_concurrency(), 1U);
+	}
+	threadCount = static_cast<unsigned>(std::min<size_t>(threadCount, blockCount));
+	if (threadCount <= 1) {
+		for (size_t index = 0; index < blockCount; index++) {
+			scanBlock(index, histogram);
+		}
+		return histogram;
+	}
+
+	// each thread takes next block, calling thread is the first worker.
+	std::atomic<size_t> nextBlock{0};
+	std::vector<Histogram> partial(threadCount, Histogram{});
+	const auto worker = [&](unsigned id) noexcept {
+		size_t index;
+		while ((index = nextBlock.fetch_add(1, std::memory_order_relaxed)) < blockCount) {
+			scanBlock(index, partial[id]);
+		}
+	};
+	std::vector<std::thread> threads;
+	threads.reserve(threadCount - 1);
+	try {
+		for (unsigned id = 1; id < threadCount; id++) {
+			threads.emplace_back(worker, id);
+		}
+	} catch (const std::system_error &) {
+		// scan remaining blocks with started threads
+	}
+	worker(0);
+	for (std::thread &thread : threads) {
+		thread.join();
+	}
+	for (const Histogram &item : partial) {
+		histogram.Merge(item);
+	}
+	return histogram;
+}
+
+Result Decide(const Histogram &histogram) noexcept {
+	Result result{Indentation::Unknown, 0, 0.0};
+	uint64_t total = 0;
+	int best = Histogram::Ambiguous;
+	for (int i = 0; i < MaxTabWidth + 2; i++) {
+		total += histogram.lines[i];
+		if (histogram.lines[i] > histogram.lines[best]) {
+			best = i;
+		}
+	}
+	if (best == Histogram::Ambiguous) {
+		return result;
+	}
+
+	result.confidence = static_cast<double>(histogram.lines[best])/static_cast<double>(total);
+	if (best == Histogram::Tab) {
+		result.indentation = Indentation::Tabs;
+	} else {
+		result.indentation = Indentation::Spaces;
+		result.indentWidth = best;
+	}
+	return result;
+}
+
+}
@@ -0,0 +1,60 @@
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+// Indentation and tab width detection: counts indented lines by indentation step
+// (based on SciTEBase::DiscoverIndentSetting()) into a histogram, then picks the most used step.
+// Whole file is split into fixed size blocks that are scanned on multiple threads,
+// huge file is sampled with small blocks spread evenly over whole file, so the histogram
+// doesn't depend on thread count.
+// It only depends on the C++ standard library, so it can be built and tested outside of Notepad4.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace IndentDetection {
+
+constexpr int MaxTabWidth = 8;
+
+// line count for ambiguous lines, line indented by 1 to MaxTabWidth spaces, line starts with tab.
+struct Histogram {
+	static constexpr int Ambiguous = 0;
+	static constexpr int Tab = MaxTabWidth + 1;
+	uint32_t lines[MaxTabWidth + 2];
+	uint32_t blockCount;	// scanned blocks
+	uint64_t byteCount;		// scanned bytes
+	void Merge(const Histogram &other) noexcept;
+};
+
+enum class Indentation {
+	Unknown,	// no indented line or most lines are ambiguous
+	Spaces,
+	Tabs,
+};
+
+struct Result {
+	Indentation indentation;
+	int indentWidth;		// 1 to MaxTabWidth for Spaces, 0 otherwise
+	double confidence;		// share of indented lines agree with the decision, 0 to 1
+};
+
+struct Options {
+	// previous indentation is reset at start of each block
+	size_t blockSize = 256*1024;
+	// larger file is sampled, 0 to scan whole file
+	size_t maxSampleSize = 16*1024*1024;
+	// a few hundred lines, spacing between sampled blocks grows with file size
+	size_t sampleBlockSize = 16*1024;
+	unsigned threadCount = 0;	// 0 to use all hardware threads, 1 to scan on calling thread
+};
+
+// count lines started inside [start, end), line started before start is skipped.
+void ScanBlock(const char *data, size_t length, size_t start, size_t end, Histogram &histogram) noexcept;
+Histogram Scan(const char *data, size_t length, const Options &options);
+// most used indentation, prefers smaller width when tied.
+Result Decide(const Histogram &histogram) noexcept;
+
+inline Result Detect(const char *data, size_t length, const Options &options = {}) {
+	return Decide(Scan(data, length, options));
+}
+
+}
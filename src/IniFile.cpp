@@ -0,0 +1,822 @@
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+#if defined(_WIN32)
+struct IUnknown;
+#include <windows.h>
+#endif
+#include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <fstream>
+#include "IniFile.h"
+
+namespace fs = std::filesystem;
+
+namespace IniFile {
+
+namespace {
+
+constexpr uint32_t SectionFlag = 0x80000000U;
+constexpr uint32_t HashInit = 2166136261U;
+constexpr size_t MinChunkSize = 4096;
+
+constexpr bool IsSpace(wchar_t ch) noexcept {
+	return ch == L' ' || ch == L'\t' || ch == L'\r';
+}
+
+constexpr wchar_t FoldCase(wchar_t ch) noexcept {
+	return (ch >= L'A' && ch <= L'Z') ? (ch - L'A' + L'a') : ch;
+}
+
+std::wstring_view Trim(std::wstring_view sv) noexcept {
+	size_t start = 0;
+	size_t end = sv.length();
+	while (start < end && IsSpace(sv[start])) {
+		++start;
+	}
+	while (end > start && IsSpace(sv[end - 1])) {
+		--end;
+	}
+	return sv.substr(start, end - start);
+}
+
+bool EqualsNoCase(std::wstring_view s1, std::wstring_view s2) noexcept {
+	if (s1.length() != s2.length()) {
+		return false;
+	}
+	for (size_t i = 0; i < s1.length(); i++) {
+		if (FoldCase(s1[i]) != FoldCase(s2[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// FNV-1a on case folded characters, lines are seeded by their section.
+uint32_t HashName(std::wstring_view name, uint32_t seed) noexcept {
+	uint32_t hash = seed;
+	for (const wchar_t ch : name) {
+		hash = (hash ^ static_cast<uint32_t>(FoldCase(ch))) * 16777619U;
+	}
+	return hash;
+}
+
+constexpr uint32_t LineSeed(uint32_t section) noexcept {
+	return HashInit ^ ((section + 1)*0x9E3779B9U);
+}
+
+void AppendCodePoint(std::wstring &text, uint32_t ch) {
+	if constexpr (sizeof(wchar_t) == 2) {
+		if (ch >= 0x10000) {
+			ch -= 0x10000;
+			text.push_back(static_cast<wchar_t>(0xD800 + (ch >> 10)));
+			text.push_back(static_cast<wchar_t>(0xDC00 + (ch & 0x3FF)));
+			return;
+		}
+	}
+	text.push_back(static_cast<wchar_t>(ch));
+}
+
+// decode UTF-8, returns false for invalid sequence.
+bool DecodeUTF8(std::string_view content, std::wstring &text) {
+	const uint8_t *ptr = reinterpret_cast<const uint8_t *>(content.data());
+	const uint8_t * const end = ptr + content.length();
+	while (ptr < end) {
+		uint32_t ch = *ptr++;
+		if (ch < 0x80) {
+			text.push_back(static_cast<wchar_t>(ch));
+			continue;
+		}
+		int trail;
+		uint32_t minimum;
+		if (ch >= 0xC2 && ch <= 0xDF) {
+			trail = 1;
+			minimum = 0x80;
+			ch &= 0x1F;
+		} else if (ch >= 0xE0 && ch <= 0xEF) {
+			trail = 2;
+			minimum = 0x800;
+			ch &= 0x0F;
+		} else if (ch >= 0xF0 && ch <= 0xF4) {
+			trail = 3;
+			minimum = 0x10000;
+			ch &= 0x07;
+		} else {
+			return false;
+		}
+		if (end - ptr < trail) {
+			return false;
+		}
+		for (int i = 0; i < trail; i++) {
+			const uint32_t trailByte = *ptr++;
+			if ((trailByte & 0xC0) != 0x80) {
+				return false;
+			}
+			ch = (ch << 6) | (trailByte & 0x3F);
+		}
+		if (ch < minimum || ch > 0x10FFFF || (ch >= 0xD800 && ch <= 0xDFFF)) {
+			return false;
+		}
+		AppendCodePoint(text, ch);
+	}
+	return true;
+}
+
+void DecodeUTF16LE(std::string_view content, std::wstring &text) {
+	const size_t length = content.length() / 2;
+	text.reserve(length);
+	for (size_t i = 0; i < length; i++) {
+		uint32_t ch = static_cast<uint8_t>(content[2*i]) | (static_cast<uint8_t>(content[2*i + 1]) << 8);
+		if constexpr (sizeof(wchar_t) != 2) {
+			if (ch >= 0xD800 && ch <= 0xDBFF && i + 1 < length) {
+				const uint32_t trail = static_cast<uint8_t>(content[2*i + 2]) | (static_cast<uint8_t>(content[2*i + 3]) << 8);
+				if (trail >= 0xDC00 && trail <= 0xDFFF) {
+					ch = 0x10000 + ((ch - 0xD800) << 10) + (trail - 0xDC00);
+					++i;
+				}
+			}
+		}
+		text.push_back(static_cast<wchar_t>(ch));
+	}
+}
+
+void DecodeANSI(std::string_view content, std::wstring &text) {
+#if defined(_WIN32)
+	const int length = MultiByteToWideChar(CP_ACP, 0, content.data(), static_cast<int>(content.length()), nullptr, 0);
+	text.resize(length);
+	MultiByteToWideChar(CP_ACP, 0, content.data(), static_cast<int>(content.length()), text.data(), length);
+#else
+	for (const char ch : content) {
+		text.push_back(static_cast<uint8_t>(ch));
+	}
+#endif
+}
+
+// read next code point, combines surrogate pair when wchar_t is 16-bit.
+uint32_t NextCodePoint(std::wstring_view text, size_t &index) noexcept {
+	uint32_t ch = static_cast<uint32_t>(text[index++]);
+	if (ch >= 0xD800 && ch <= 0xDBFF && index < text.length()) {
+		const uint32_t trail = static_cast<uint32_t>(text[index]);
+		if (trail >= 0xDC00 && trail <= 0xDFFF) {
+			ch = 0x10000 + ((ch - 0xD800) << 10) + (trail - 0xDC00);
+			++index;
+		}
+	}
+	return ch;
+}
+
+void EncodeUTF8(std::wstring_view text, std::string &content) {
+	content.reserve(content.length() + text.length());
+	size_t index = 0;
+	while (index < text.length()) {
+		const uint32_t ch = NextCodePoint(text, index);
+		if (ch < 0x80) {
+			content.push_back(static_cast<char>(ch));
+		} else if (ch < 0x800) {
+			content.push_back(static_cast<char>(0xC0 | (ch >> 6)));
+			content.push_back(static_cast<char>(0x80 | (ch & 0x3F)));
+		} else if (ch < 0x10000) {
+			content.push_back(static_cast<char>(0xE0 | (ch >> 12)));
+			content.push_back(static_cast<char>(0x80 | ((ch >> 6) & 0x3F)));
+			content.push_back(static_cast<char>(0x80 | (ch & 0x3F)));
+		} else {
+			content.push_back(static_cast<char>(0xF0 | (ch >> 18)));
+			content.push_back(static_cast<char>(0x80 | ((ch >> 12) & 0x3F)));
+			content.push_back(static_cast<char>(0x80 | ((ch >> 6) & 0x3F)));
+			content.push_back(static_cast<char>(0x80 | (ch & 0x3F)));
+		}
+	}
+}
+
+void EncodeUTF16LE(std::wstring_view text, std::string &content) {
+	content.reserve(content.length() + 2*text.length());
+	size_t index = 0;
+	while (index < text.length()) {
+		uint32_t ch = NextCodePoint(text, index);
+		if (ch >= 0x10000) {
+			ch -= 0x10000;
+			const uint32_t lead = 0xD800 + (ch >> 10);
+			content.push_back(static_cast<char>(lead & 0xFF));
+			content.push_back(static_cast<char>(lead >> 8));
+			ch = 0xDC00 + (ch & 0x3FF);
+		}
+		content.push_back(static_cast<char>(ch & 0xFF));
+		content.push_back(static_cast<char>(ch >> 8));
+	}
+}
+
+void EncodeANSI(std::wstring_view text, std::string &content) {
+#if defined(_WIN32)
+	const int length = WideCharToMultiByte(CP_ACP, 0, text.data(), static_cast<int>(text.length()), nullptr, 0, nullptr, nullptr);
+	const size_t offset = content.length();
+	content.resize(offset + length);
+	WideCharToMultiByte(CP_ACP, 0, text.data(), static_cast<int>(text.length()), content.data() + offset, length, nullptr, nullptr);
+#else
+	for (const wchar_t ch : text) {
+		content.push_back((static_cast<uint32_t>(ch) < 0x100) ? static_cast<char>(ch) : '?');
+	}
+#endif
+}
+
+bool WriteFile(const fs::path &path, const std::string &content) {
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	if (!file) {
+		return false;
+	}
+	file.write(content.data(), content.length());
+	file.close();
+	return !file.fail();
+}
+
+// unique name beside target, so instances saving same file at same time don't share it.
+fs::path MakeTempPath(const fs::path &target) {
+#if defined(_WIN32)
+	const fs::path folder = target.parent_path();
+	wchar_t buffer[MAX_PATH];
+	if (GetTempFileNameW(folder.empty() ? L"." : folder.c_str(), L"ini", 0, buffer)) {
+		return fs::path{buffer};
+	}
+	return {};
+#else
+	static std::atomic<uint32_t> counter;
+	const auto ticks = std::chrono::steady_clock::now().time_since_epoch().count();
+	fs::path temp{target};
+	temp += "." + std::to_string(ticks) + "." + std::to_string(counter.fetch_add(1)) + ".tmp";
+	return temp;
+#endif
+}
+
+bool ReplaceWithTemp(const fs::path &temp, const fs::path &target) {
+#if defined(_WIN32)
+	// keeps attributes, ACLs and alternate data streams of target
+	if (ReplaceFileW(target.c_str(), temp.c_str(), nullptr, REPLACEFILE_IGNORE_MERGE_ERRORS, nullptr, nullptr)) {
+		return true;
+	}
+	if (GetLastError() != ERROR_FILE_NOT_FOUND) {
+		return false;
+	}
+#endif
+	std::error_code ec;
+#if !defined(_WIN32)
+	const fs::file_status status = fs::status(target, ec);
+	if (!ec) {
+		fs::permissions(temp, status.permissions(), ec);
+	}
+#endif
+	fs::rename(temp, target, ec);
+	return !ec;
+}
+
+}
+
+std::wstring_view Store::Intern(std::wstring_view sv) {
+	if (chunkUsed + sv.length() > chunkSize) {
+		chunkSize = std::max(MinChunkSize, sv.length());
+		chunks.push_back(std::make_unique<wchar_t[]>(chunkSize));
+		chunkUsed = 0;
+	}
+	wchar_t *ptr = chunks.back().get() + chunkUsed;
+	std::copy(sv.begin(), sv.end(), ptr);
+	chunkUsed += sv.length();
+	return {ptr, sv.length()};
+}
+
+void Store::Index(uint32_t entry) {
+	if (2*(indexed + 1) > buckets.size()) {
+		Rehash();
+	}
+	const size_t mask = buckets.size() - 1;
+	if (entry & SectionFlag) {
+		Section &section = sections[entry & ~SectionFlag];
+		uint32_t &head = buckets[section.hash & mask];
+		section.next = head;
+		head = entry;
+	} else {
+		Line &line = lines[entry];
+		uint32_t &head = buckets[line.hash & mask];
+		line.next = head;
+		head = entry;
+	}
+	++indexed;
+}
+
+void Store::Unindex(uint32_t entry) noexcept {
+	if (buckets.empty()) {
+		return;
+	}
+	const size_t mask = buckets.size() - 1;
+	const uint32_t hash = (entry & SectionFlag) ? sections[entry & ~SectionFlag].hash : lines[entry].hash;
+	uint32_t *link = &buckets[hash & mask];
+	while (*link != npos) {
+		const uint32_t current = *link;
+		uint32_t &next = (current & SectionFlag) ? sections[current & ~SectionFlag].next : lines[current].next;
+		if (current == entry) {
+			*link = next;
+			next = npos - 1;
+			--indexed;
+			return;
+		}
+		link = &next;
+	}
+}
+
+void Store::Rehash() {
+	const size_t size = std::max<size_t>(64, buckets.size()*2);
+	buckets.assign(size, npos);
+	indexed = 0;
+	const size_t mask = size - 1;
+	for (uint32_t index = 0; index < sections.size(); index++) {
+		Section &section = sections[index];
+		if (!section.deleted && section.next != npos - 1) {
+			uint32_t &head = buckets[section.hash & mask];
+			section.next = head;
+			head = index | SectionFlag;
+			++indexed;
+		}
+	}
+	for (uint32_t index = 0; index < lines.size(); index++) {
+		Line &line = lines[index];
+		if (!line.deleted && line.next != npos - 1) {
+			uint32_t &head = buckets[line.hash & mask];
+			line.next = head;
+			head = index;
+			++indexed;
+		}
+	}
+}
+
+uint32_t Store::FindSection(std::wstring_view name) const noexcept {
+	name = Trim(name);
+	if (buckets.empty() || name.empty()) {
+		return npos;
+	}
+	const uint32_t hash = HashName(name, HashInit);
+	uint32_t entry = buckets[hash & (buckets.size() - 1)];
+	while (entry != npos) {
+		if (entry & SectionFlag) {
+			const Section &section = sections[entry & ~SectionFlag];
+			if (section.hash == hash && EqualsNoCase(section.name, name)) {
+				return entry & ~SectionFlag;
+			}
+			entry = section.next;
+		} else {
+			entry = lines[entry].next;
+		}
+	}
+	return npos;
+}
+
+uint32_t Store::FindLine(uint32_t section, std::wstring_view key) const noexcept {
+	key = Trim(key);
+	if (buckets.empty() || key.empty()) {
+		return npos;
+	}
+	const uint32_t hash = HashName(key, LineSeed(section));
+	uint32_t entry = buckets[hash & (buckets.size() - 1)];
+	while (entry != npos) {
+		if (entry & SectionFlag) {
+			entry = sections[entry & ~SectionFlag].next;
+		} else {
+			const Line &line = lines[entry];
+			if (line.hash == hash && line.section == section && EqualsNoCase(line.key, key)) {
+				return entry;
+			}
+			entry = line.next;
+		}
+	}
+	return npos;
+}
+
+uint32_t Store::AddSection(std::wstring_view raw, std::wstring_view name) {
+	const uint32_t index = static_cast<uint32_t>(sections.size());
+	Section &section = sections.emplace_back();
+	section.raw = raw;
+	section.name = name;
+	section.hash = HashName(name, HashInit);
+	section.deleted = false;
+	// npos - 1 marks entry not indexed: duplicate or lines before first section.
+	section.next = npos - 1;
+	if (!name.empty() && FindSection(name) == npos) {
+		Index(index | SectionFlag);
+	}
+	return index;
+}
+
+uint32_t Store::AddLine(uint32_t section, std::wstring_view raw) {
+	const uint32_t index = static_cast<uint32_t>(lines.size());
+	Line &line = lines.emplace_back();
+	line.raw = raw;
+	line.section = section;
+	line.deleted = false;
+	line.next = npos - 1;
+	line.hash = 0;
+	const std::wstring_view trimmed = Trim(raw);
+	if (!trimmed.empty() && trimmed.front() != L';') {
+		const size_t equal = trimmed.find(L'=');
+		if (equal != std::wstring_view::npos) {
+			line.key = Trim(trimmed.substr(0, equal));
+			line.value = Trim(trimmed.substr(equal + 1));
+		}
+	}
+	if (!line.key.empty()) {
+		line.hash = HashName(line.key, LineSeed(section));
+		if (FindLine(section, line.key) == npos) {
+			Index(index);
+		}
+	}
+	sections[section].lines.push_back(index);
+	return index;
+}
+
+uint32_t Store::AppendSection(std::wstring_view name) {
+	name = Trim(name);
+	std::wstring header;
+	header.reserve(name.length() + 2);
+	header += L'[';
+	header += name;
+	header += L']';
+	const std::wstring_view raw = Intern(header);
+	return AddSection(raw, raw.substr(1, name.length()));
+}
+
+void Store::InsertKey(uint32_t section, std::wstring_view key, std::wstring_view value) {
+	std::wstring item;
+	item.reserve(key.length() + 1 + value.length());
+	item += key;
+	item += L'=';
+	item += value;
+	const uint32_t index = AddLine(section, Intern(item));
+	// keep blank lines at end of section after the new key
+	std::vector<uint32_t> &list = sections[section].lines;
+	list.pop_back();
+	auto it = list.end();
+	while (it != list.begin() && Trim(lines[*(it - 1)].raw).empty()) {
+		--it;
+	}
+	list.insert(it, index);
+}
+
+void Store::RemoveLines(Section &section) noexcept {
+	for (const uint32_t index : section.lines) {
+		Line &line = lines[index];
+		if (line.next != npos - 1) {
+			Unindex(index);
+		}
+		line.deleted = true;
+	}
+	section.lines.clear();
+}
+
+bool Store::Load(const fs::path &path) {
+	std::ifstream file(path, std::ios::binary);
+	if (!file) {
+		return false;
+	}
+	std::string content{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+	if (file.bad()) {
+		return false;
+	}
+	Parse(content);
+	return true;
+}
+
+void Store::Parse(std::string_view content) {
+	Clear();
+	if (content.length() >= 2 && static_cast<uint8_t>(content[0]) == 0xFF && static_cast<uint8_t>(content[1]) == 0xFE) {
+		encoding = Encoding::UTF16LE;
+		DecodeUTF16LE(content.substr(2), text);
+	} else if (content.length() >= 3 && memcmp(content.data(), "\xEF\xBB\xBF", 3) == 0) {
+		encoding = Encoding::UTF8BOM;
+		if (!DecodeUTF8(content.substr(3), text)) {
+			text.clear();
+			DecodeANSI(content.substr(3), text);
+		}
+	} else if (DecodeUTF8(content, text)) {
+		// ASCII or UTF-8 without BOM
+		encoding = Encoding::UTF8;
+	} else {
+		encoding = Encoding::ANSI;
+		text.clear();
+		DecodeANSI(content, text);
+	}
+
+	const std::wstring_view sv{text};
+	const size_t firstLineEnd = sv.find(L'\n');
+	if (firstLineEnd != std::wstring_view::npos && (firstLineEnd == 0 || sv[firstLineEnd - 1] != L'\r')) {
+		eol = L"\n";
+	}
+	size_t count = 0;
+	for (const wchar_t ch : sv) {
+		count += ch == L'\n';
+	}
+	lines.reserve(count + 1);
+	buckets.assign(std::max<size_t>(64, std::bit_ceil(2*(count + 1))), npos);
+
+	// lines before first section
+	uint32_t section = AddSection({}, {});
+	size_t start = 0;
+	while (start < sv.length()) {
+		size_t end = sv.find(L'\n', start);
+		if (end == std::wstring_view::npos) {
+			end = sv.length();
+		}
+		std::wstring_view raw = sv.substr(start, end - start);
+		if (!raw.empty() && raw.back() == L'\r') {
+			raw.remove_suffix(1);
+		}
+		start = end + 1;
+		const std::wstring_view trimmed = Trim(raw);
+		if (!trimmed.empty() && trimmed.front() == L'[') {
+			const size_t close = trimmed.find(L']');
+			section = AddSection(raw, Trim(trimmed.substr(1, ((close == std::wstring_view::npos) ? trimmed.length() : close) - 1)));
+		} else {
+			AddLine(section, raw);
+		}
+	}
+	modified = false;
+}
+
+void Store::Clear() noexcept {
+	encoding = Encoding::UTF16LE;
+	modified = false;
+	eol = L"\r\n";
+	text.clear();
+	chunks.clear();
+	chunkUsed = 0;
+	chunkSize = 0;
+	sections.clear();
+	lines.clear();
+	buckets.clear();
+	indexed = 0;
+}
+
+std::string Store::Serialize() const {
+	std::wstring output;
+	output.reserve(text.length() + chunks.size()*MinChunkSize);
+	for (const Section &section : sections) {
+		if (section.deleted) {
+			continue;
+		}
+		if (!section.raw.empty()) {
+			output += section.raw;
+			output += eol;
+		}
+		for (const uint32_t index : section.lines) {
+			output += lines[index].raw;
+			output += eol;
+		}
+	}
+
+	std::string content;
+	switch (encoding) {
+	case Encoding::UTF16LE:
+		content = "\xFF\xFE";
+		EncodeUTF16LE(output, content);
+		break;
+	case Encoding::UTF8BOM:
+		content = "\xEF\xBB\xBF";
+		EncodeUTF8(output, content);
+		break;
+	case Encoding::UTF8:
+		EncodeUTF8(output, content);
+		break;
+	default:
+		EncodeANSI(output, content);
+		break;
+	}
+	return content;
+}
+
+bool Store::Save(const fs::path &path) {
+	const std::string content = Serialize();
+	std::error_code ec;
+	// replace target of symbolic link instead of the link
+	fs::path target = path;
+	if (fs::is_symlink(path, ec)) {
+		target = fs::canonical(path, ec);
+		if (ec) {
+			target = path;
+		}
+	}
+	bool success = false;
+	// replacing the file would detach other hard links, write them in place
+	const uintmax_t links = fs::hard_link_count(target, ec);
+	if (ec || links <= 1) {
+		const fs::path temp = MakeTempPath(target);
+		if (!temp.empty()) {
+			success = WriteFile(temp, content) && ReplaceWithTemp(temp, target);
+			if (!success) {
+				fs::remove(temp, ec);
+			}
+		}
+	}
+	if (!success) {
+		// e.g. no permission to create file in the folder
+		success = WriteFile(target, content);
+	}
+	if (success) {
+		modified = false;
+	}
+	return success;
+}
+
+std::vector<std::wstring_view> Store::SectionNames() const {
+	std::vector<std::wstring_view> names;
+	for (const Section &section : sections) {
+		if (!section.deleted && !section.raw.empty()) {
+			names.push_back(section.name);
+		}
+	}
+	return names;
+}
+
+bool Store::GetValue(std::wstring_view section, std::wstring_view key, std::wstring_view &value) const noexcept {
+	const uint32_t index = FindSection(section);
+	if (index != npos) {
+		const uint32_t line = FindLine(index, key);
+		if (line != npos) {
+			value = lines[line].value;
+			return true;
+		}
+	}
+	return false;
+}
+
+std::wstring_view Store::GetString(std::wstring_view section, std::wstring_view key, std::wstring_view defaultValue) const noexcept {
+	std::wstring_view value;
+	if (!GetValue(section, key, value)) {
+		return defaultValue;
+	}
+	if (value.length() >= 2 && (value.front() == L'\"' || value.front() == L'\'') && value.back() == value.front()) {
+		value = value.substr(1, value.length() - 2);
+	}
+	return value;
+}
+
+int Store::GetInt(std::wstring_view section, std::wstring_view key, int defaultValue) const noexcept {
+	std::wstring_view value;
+	if (!GetValue(section, key, value)) {
+		return defaultValue;
+	}
+	size_t index = 0;
+	const bool negative = !value.empty() && value.front() == L'-';
+	if (negative || (!value.empty() && value.front() == L'+')) {
+		++index;
+	}
+	unsigned int number = 0;
+	for (; index < value.length() && value[index] >= L'0' && value[index] <= L'9'; index++) {
+		number = number*10 + (value[index] - L'0');
+	}
+	return static_cast<int>(negative ? 0U - number : number);
+}
+
+size_t Store::GetSection(std::wstring_view section, wchar_t *buffer, size_t size) const noexcept {
+	if (size == 0) {
+		return 0;
+	}
+	size_t length = 0;
+	const uint32_t index = FindSection(section);
+	if (index != npos) {
+		for (const uint32_t line : sections[index].lines) {
+			const Line &item = lines[line];
+			if (item.key.empty()) {
+				continue;
+			}
+			// key=value, its NUL and the final NUL
+			const size_t itemLength = item.key.length() + 1 + item.value.length();
+			if (length + itemLength + 2 > size) {
+				break;
+			}
+			wchar_t *ptr = std::copy(item.key.begin(), item.key.end(), buffer + length);
+			*ptr++ = L'=';
+			ptr = std::copy(item.value.begin(), item.value.end(), ptr);
+			*ptr = L'\0';
+			length += itemLength + 1;
+		}
+	}
+	buffer[length] = L'\0';
+	if (length == 0 && size > 1) {
+		buffer[1] = L'\0';
+	}
+	return length;
+}
+
+void Store::SetValue(std::wstring_view section, std::wstring_view key, std::wstring_view value) {
+	key = Trim(key);
+	value = Trim(value);
+	if (key.empty()) {
+		return;
+	}
+	uint32_t index = FindSection(section);
+	if (index == npos) {
+		index = AppendSection(section);
+	}
+	const uint32_t line = FindLine(index, key);
+	if (line == npos) {
+		InsertKey(index, key, value);
+	} else {
+		Line &item = lines[line];
+		if (item.value == value) {
+			return;
+		}
+		// keep spelling of key
+		std::wstring raw;
+		raw.reserve(item.key.length() + 1 + value.length());
+		raw += item.key;
+		raw += L'=';
+		raw += value;
+		item.raw = Intern(raw);
+		item.key = item.raw.substr(0, item.key.length());
+		item.value = item.raw.substr(item.key.length() + 1);
+	}
+	modified = true;
+}
+
+void Store::DeleteKey(std::wstring_view section, std::wstring_view key) noexcept {
+	const uint32_t index = FindSection(section);
+	if (index == npos) {
+		return;
+	}
+	const uint32_t line = FindLine(index, key);
+	if (line == npos) {
+		return;
+	}
+	Unindex(line);
+	// remove duplicates too
+	std::vector<uint32_t> &list = sections[index].lines;
+	const std::wstring_view name = lines[line].key;
+	list.erase(std::remove_if(list.begin(), list.end(), [this, name](uint32_t item) noexcept {
+		Line &current = lines[item];
+		if (EqualsNoCase(current.key, name)) {
+			current.deleted = true;
+			return true;
+		}
+		return false;
+	}), list.end());
+	modified = true;
+}
+
+void Store::SetSection(std::wstring_view section, const wchar_t *keyValues) {
+	if (keyValues == nullptr) {
+		DeleteSection(section);
+		return;
+	}
+
+	std::vector<std::wstring_view> items;
+	for (const wchar_t *ptr = keyValues; *ptr; ) {
+		const std::wstring_view item{ptr};
+		items.push_back(item);
+		ptr += item.length() + 1;
+	}
+
+	uint32_t index = FindSection(section);
+	if (index != npos) {
+		// nothing changed, e.g. settings saved on exit, keep comments and file untouched.
+		size_t current = 0;
+		bool same = true;
+		for (const uint32_t line : sections[index].lines) {
+			const Line &item = lines[line];
+			if (item.key.empty()) {
+				continue;
+			}
+			if (current == items.size() || Trim(items[current]) != Trim(item.raw)) {
+				same = false;
+				break;
+			}
+			++current;
+		}
+		if (same && current == items.size()) {
+			return;
+		}
+		RemoveLines(sections[index]);
+	} else {
+		index = AppendSection(section);
+	}
+
+	for (const std::wstring_view item : items) {
+		AddLine(index, Intern(item));
+	}
+	modified = true;
+}
+
+void Store::DeleteSection(std::wstring_view section) noexcept {
+	section = Trim(section);
+	if (section.empty()) {
+		return;
+	}
+	for (uint32_t index = 0; index < sections.size(); index++) {
+		Section &current = sections[index];
+		if (!current.deleted && !current.raw.empty() && EqualsNoCase(current.name, section)) {
+			RemoveLines(current);
+			if (current.next != npos - 1) {
+				Unindex(index | SectionFlag);
+			}
+			current.deleted = true;
+			modified = true;
+		}
+	}
+}
+
+}
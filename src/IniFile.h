@@ -0,0 +1,120 @@
+// This file is part of Notepad4.
+// See License.txt for details about distribution and modification.
+// In-memory ini file: the file is read once into an arena, all sections and keys are indexed
+// by one hash table, edits are applied in place and the file is written back in one pass
+// through a temporary file that replaces the original.
+// Lookup follows GetPrivateProfileString(): section and key names are case insensitive,
+// spaces around names and values are ignored, first section or key wins for duplicates.
+// It only depends on the C++ standard library, so it can be built and tested outside of Notepad4.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace IniFile {
+
+enum class Encoding {
+	UTF16LE,	// with BOM, created by CreateIniFile()
+	UTF8,
+	UTF8BOM,
+	ANSI,		// system code page on Windows, Latin-1 elsewhere
+};
+
+class Store {
+	static constexpr uint32_t npos = UINT32_MAX;
+	// key value pair, comment or blank line inside a section
+	struct Line {
+		std::wstring_view raw;		// whole line without line ending
+		std::wstring_view key;		// empty for comment and blank line
+		std::wstring_view value;
+		uint32_t section;
+		uint32_t hash;
+		uint32_t next;				// next line in same bucket
+		bool deleted;
+	};
+	struct Section {
+		std::wstring_view raw;		// header line, empty for lines before first section
+		std::wstring_view name;
+		uint32_t hash;
+		uint32_t next;				// next section in same bucket
+		bool deleted;
+		std::vector<uint32_t> lines;
+	};
+
+	Encoding encoding = Encoding::UTF16LE;
+	bool modified = false;
+	std::wstring_view eol{L"\r\n"};
+	std::wstring text;				// decoded file content
+	std::vector<std::unique_ptr<wchar_t[]>> chunks;	// arena for edited lines
+	size_t chunkUsed = 0;
+	size_t chunkSize = 0;
+	std::vector<Section> sections;
+	std::vector<Line> lines;
+	// one table for both sections and keys, high bit of entry marks a section.
+	std::vector<uint32_t> buckets;
+	size_t indexed = 0;
+
+	std::wstring_view Intern(std::wstring_view sv);
+	void Index(uint32_t entry);
+	void Unindex(uint32_t entry) noexcept;
+	void Rehash();
+	uint32_t FindSection(std::wstring_view name) const noexcept;
+	uint32_t FindLine(uint32_t section, std::wstring_view key) const noexcept;
+	uint32_t AddSection(std::wstring_view raw, std::wstring_view name);
+	uint32_t AddLine(uint32_t section, std::wstring_view raw);
+	uint32_t AppendSection(std::wstring_view name);
+	void InsertKey(uint32_t section, std::wstring_view key, std::wstring_view value);
+	void RemoveLines(Section &section) noexcept;
+
+public:
+	// read and parse file, false when it can't be read.
+	bool Load(const std::filesystem::path &path);
+	// parse raw file content, encoding is detected from BOM and content.
+	void Parse(std::string_view content);
+	void Clear() noexcept;
+	// write content into a uniquely named temporary file beside path then replace path with it,
+	// writes path directly when it has hard links or temporary file can't be created.
+	// symbolic link is followed, false when file can't be written.
+	bool Save(const std::filesystem::path &path);
+	// file content in original encoding.
+	std::string Serialize() const;
+
+	Encoding GetEncoding() const noexcept {
+		return encoding;
+	}
+	bool Modified() const noexcept {
+		return modified;
+	}
+	void SetModified(bool modified_) noexcept {
+		modified = modified_;
+	}
+
+	bool HasSection(std::wstring_view section) const noexcept {
+		return FindSection(section) != npos;
+	}
+	std::vector<std::wstring_view> SectionNames() const;
+	// value without spaces around, false when key not found.
+	bool GetValue(std::wstring_view section, std::wstring_view key, std::wstring_view &value) const noexcept;
+	// like GetPrivateProfileString(), also removes one pair of quotes around the value.
+	std::wstring_view GetString(std::wstring_view section, std::wstring_view key, std::wstring_view defaultValue) const noexcept;
+	// like GetPrivateProfileInt()
+	int GetInt(std::wstring_view section, std::wstring_view key, int defaultValue) const noexcept;
+	// like GetPrivateProfileSection(): key=value list, each item NUL terminated and followed by an extra NUL.
+	// items that don't fit are dropped, returns length without the final NUL.
+	size_t GetSection(std::wstring_view section, wchar_t *buffer, size_t size) const noexcept;
+
+	// add or replace key in section, section is created when missing.
+	void SetValue(std::wstring_view section, std::wstring_view key, std::wstring_view value);
+	void DeleteKey(std::wstring_view section, std::wstring_view key) noexcept;
+	// like WritePrivateProfileSection(): replace section content with key=value list,
+	// nullptr deletes the section.
+	void SetSection(std::wstring_view section, const wchar_t *keyValues);
+	void DeleteSection(std::wstring_view section) noexcept;
+};
+
+}
@@ -301,9 +301,12 @@ static struct WatchFileInformation {
 } fdCurFile;
 
 static EDITFINDREPLACE efrData;
+static EDITFINDINFILES fifData;
 bool	bReplaceInitialized = false;
 EditMarkAllStatus editMarkAllStatus;
 HANDLE idleTaskTimer;
+// time from process start to first idle after main window and document are painted
+StopWatch startupWatch;
 
 static EditSortFlag iSortOptions = EditSortFlag_Ascending;
 static EditAlignMode iAlignMode	= EditAlignMode_Left;
@@ -421,6 +424,7 @@ bool 		fNoHTMLGuess			= false;
 bool 		fNoCGIGuess				= false;
 bool 		fNoAutoDetection		= false;
 bool		fNoFileVariables		= false;
+bool		flagStyleSettingsCache	= false;
 static bool	flagPosParam			= false;
 static int	flagDefaultPos			= DefaultPositionFlag_None;
 static bool	flagNewFromClipboard	= false;
@@ -520,6 +524,7 @@ BOOL WINAPI ConsoleHandlerRoutine(DWORD dwCtrlType) noexcept {
 int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdLine, int nShowCmd) {
 	UNREFERENCED_PARAMETER(hPrevInstance);
 	UNREFERENCED_PARAMETER(lpCmdLine);
+	startupWatch.Start();
 #if 0 // used for Clang UBSan or printing debug message on console.
 	if (AttachConsole(ATTACH_PARENT_PROCESS)) {
 		SetConsoleCtrlHandler(ConsoleHandlerRoutine, TRUE);
@@ -578,7 +583,9 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdLi
 	FindIniFile();
 	TestIniFile();
 	CreateIniFile(szIniFile);
+	IniFileBatch_Begin(szIniFile);
 	LoadFlags();
+	IniFileBatch_End();
 
 	// set AppUserModelID
 	PrivateSetCurrentProcessExplicitAppUserModelID(g_wchAppUserModelID);
@@ -654,7 +661,9 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdLi
 	Scintilla_RegisterClasses(hInstance);
 
 	// Load Settings
+	IniFileBatch_Begin(szIniFile);
 	LoadSettings();
+	IniFileBatch_End();
 
 	if (!InitApplication(hInstance)) {
 		CleanUpResources(false);
@@ -681,6 +690,13 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdLi
 				EditMarkAll_Continue(&editMarkAllStatus, timer);
 			}
 		}
+		if (startupWatch.end.QuadPart == 0 && !PeekMessage(&msg, nullptr, 0, 0, PM_NOREMOVE)) {
+			// all pending messages (include WM_PAINT) are processed
+			startupWatch.Stop();
+#if 0
+			startupWatch.ShowLog("startup to first paint");
+#endif
+		}
 		if (GetMessage(&msg, nullptr, 0, 0)) {
 			DispatchMessageMain(&msg);
 		} else {
@@ -1145,6 +1161,7 @@ LRESULT CALLBACK MainWndProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lParam)
 	case WM_ENDSESSION:
 		if (!bShutdownOK) {
 			EditMarkAll_Stop();
+			EditFindInFiles_Stop();
 			AutoSave_Stop(TRUE);
 			// Terminate file watching
 			InstallFileWatching(true);
@@ -1162,11 +1179,15 @@ LRESULT CALLBACK MainWndProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lParam)
 			}
 
 			// call SaveSettings() when hwndToolbar is still valid
+			IniFileBatch_Begin(szIniFile);
 			SaveSettings(false);
 
 			MRU_MergeSave(&mruFile, bSaveRecentFiles);
 			MRU_MergeSave(&mruFind, bSaveFindReplace);
 			MRU_MergeSave(&mruReplace, bSaveFindReplace);
+			IniFileBatch_End();
+			// after all settings are written, cache is keyed by ini file's size and time
+			Style_SaveSettingsCache();
 			BitmapCache_Empty(&bitmapCache);
 
 			// Remove tray icon if necessary
@@ -1232,6 +1253,12 @@ LRESULT CALLBACK MainWndProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lParam)
 	case WM_TIMER:
 		if (wParam == ID_AUTOSAVETIMER) {
 			AutoSave_DoWork(FileSaveFlag_Default);
+		} else if (wParam == ID_LINEINDEXTIMER) {
+			// index lines of huge file in small steps to keep UI responsive
+			if (SciCall_IndexLines(16*1024*1024) >= SciCall_GetLength()) {
+				KillTimer(hwnd, ID_LINEINDEXTIMER);
+			}
+			UpdateStatusbar();
 		}
 		break;
 
@@ -1564,6 +1591,10 @@ LRESULT CALLBACK MainWndProc(HWND hwnd, UINT umsg, WPARAM wParam, LPARAM lParam)
 	}
 	break;
 
+	case APPM_FINDINFILES:
+		EditFindInFiles_OnResult(wParam, lParam);
+		break;
+
 	case APPM_POST_HOTSPOTCLICK: {
 		// release mouse capture and restore selection
 		const int x = SciCall_PointXFromPosition(lParam);
@@ -2444,6 +2475,7 @@ void MsgInitMenu(HWND hwnd, WPARAM wParam, LPARAM lParam) noexcept {
 #if defined(_WIN64)
 	DisableCmd(hmenu, IDM_FILE_LARGE_FILE_MODE, bLargeFileMode);
 	DisableCmd(hmenu, IDM_FILE_LARGE_FILE_MODE_RELOAD, bLargeFileMode);
+	DisableCmd(hmenu, IDM_FILE_READONLY_MODE, SciCall_GetDocumentOptions() & SC_DOCUMENTOPTION_VIEW_ONLY);
 #endif
 	EnableCmd(hmenu, IDM_FILE_RELAUNCH_ELEVATED, IsVistaAndAbove() && !fIsElevated);
 	CheckCmd(hmenu, IDM_FILE_READONLY_FILE, bReadOnlyFile);
@@ -2819,7 +2851,7 @@ LRESULT MsgCommand(HWND hwnd, WPARAM wParam, LPARAM lParam) {
 
 			dwFileAttributes = GetFileAttributes(szCurFile);
 			bReadOnlyFile = (dwFileAttributes != INVALID_FILE_ATTRIBUTES) && (dwFileAttributes & FILE_ATTRIBUTE_READONLY);
-			if (!bReadOnlyFile && bReadOnlyMode) {
+			if (!bReadOnlyFile && bReadOnlyMode && !(SciCall_GetDocumentOptions() & SC_DOCUMENTOPTION_VIEW_ONLY)) {
 				bReadOnlyMode = false;
 				SciCall_SetReadOnly(false);
 			}
@@ -2828,6 +2860,12 @@ LRESULT MsgCommand(HWND hwnd, WPARAM wParam, LPARAM lParam) {
 		break;
 
 	case IDM_FILE_READONLY_MODE:
+#if defined(_WIN64)
+		// huge file opened in view mode can't be edited
+		if (SciCall_GetDocumentOptions() & SC_DOCUMENTOPTION_VIEW_ONLY) {
+			break;
+		}
+#endif
 		bReadOnlyMode = !bReadOnlyMode;
 		SciCall_SetReadOnly(bReadOnlyMode);
 		UpdateWindowTitle();
@@ -2959,6 +2997,52 @@ LRESULT MsgCommand(HWND hwnd, WPARAM wParam, LPARAM lParam) {
 	}
 	break;
 
+	case IDM_FILE_EXPORT_RTF:
+	case IDM_FILE_EXPORT_HTML: {
+		const bool html = LOWORD(wParam) == IDM_FILE_EXPORT_HTML;
+		WCHAR szFile[MAX_PATH] = L"";
+		WCHAR tchTitle[MAX_PATH];
+		WCHAR szFilter[256];
+		WCHAR tchInitialDir[MAX_PATH];
+
+		if (StrNotEmpty(szCurFile)) {
+			lstrcpyn(tchTitle, PathFindFileName(szCurFile), COUNTOF(tchTitle));
+			lstrcpy(szFile, tchTitle);
+			PathRemoveExtension(szFile);
+		} else {
+			GetString(IDS_UNTITLED, tchTitle, COUNTOF(tchTitle));
+		}
+		SetupInitialOpenSaveDir(tchInitialDir, COUNTOF(tchInitialDir), nullptr);
+		GetString(html ? IDS_FILTER_HTML : IDS_FILTER_RTF, szFilter, COUNTOF(szFilter));
+		PrepareFilterStr(szFilter);
+
+		OPENFILENAME ofn;
+		memset(&ofn, 0, sizeof(OPENFILENAME));
+		ofn.lStructSize = sizeof(OPENFILENAME);
+		ofn.hwndOwner = hwnd;
+		ofn.lpstrFilter = szFilter;
+		ofn.lpstrFile = szFile;
+		ofn.lpstrInitialDir = tchInitialDir;
+		ofn.lpstrDefExt = html ? L"html" : L"rtf";
+		ofn.nMaxFile = COUNTOF(szFile);
+		ofn.Flags = OFN_HIDEREADONLY | OFN_NOCHANGEDIR | OFN_DONTADDTORECENT
+					| OFN_PATHMUSTEXIST | OFN_OVERWRITEPROMPT;
+		if (bUseXPFileDialog) {
+			ofn.Flags |= OFN_EXPLORER | OFN_ENABLESIZING | OFN_ENABLEHOOK;
+			ofn.lpfnHook = OpenSaveFileDlgHookProc;
+		}
+
+		if (GetSaveFileName(&ofn)) {
+			BeginWaitCursor();
+			const bool success = EditExportStyledText(szFile, html, tchTitle);
+			EndWaitCursor();
+			if (!success) {
+				MsgBoxLastError(MB_OK, IDS_EXPORT_STYLED_FAIL, szFile);
+			}
+		}
+	}
+	break;
+
 	case IDM_FILE_PROPERTIES: {
 		if (StrIsEmpty(szCurFile)) {
 			break;
@@ -3903,6 +3987,29 @@ LRESULT MsgCommand(HWND hwnd, WPARAM wParam, LPARAM lParam) {
 	}
 	break;
 
+	case IDM_EDIT_FINDINFILES:
+		if (StrIsEmpty(fifData.szDirectory)) {
+			if (StrNotEmpty(szCurFile)) {
+				lstrcpy(fifData.szDirectory, szCurFile);
+				PathRemoveFileSpec(fifData.szDirectory);
+			} else {
+				GetCurrentDirectory(COUNTOF(fifData.szDirectory), fifData.szDirectory);
+			}
+			fifData.bSubdirectories = true;
+		}
+		strcpy(fifData.szFindUTF8, efrData.szFindUTF8);
+		fifData.fuFlags = efrData.fuFlags;
+		if (EditFindInFilesDlg(hwnd, &fifData) && FileLoad(FileLoadFlag_New, L"")) {
+			// results are always UTF-8, styled as diff for per file "--- path" header
+			iCurrentEncoding = CPI_UTF8;
+			iOriginalEncoding = CPI_UTF8;
+			SciCall_SetCodePage(SC_CP_UTF8);
+			UpdateStatusBarCache(StatusItem_Encoding);
+			Style_SetLexerFromID(NP2LEX_DIFF);
+			EditFindInFiles_Start(hwnd, &fifData);
+		}
+		break;
+
 	case IDM_EDIT_FINDNEXT:
 	case IDM_EDIT_FINDPREV:
 	case IDM_EDIT_REPLACENEXT:
@@ -5694,23 +5801,31 @@ void SaveSettingsNow(bool bOnlySaveStyle, bool bQuiet) {
 	if (!bCreateFailure) {
 		LPCWSTR section = bOnlySaveStyle ? INI_SECTION_NAME_STYLES : INI_SECTION_NAME_SETTINGS;
 		if (WritePrivateProfileString(section, L"WriteTest", L"ok", szIniFile)) {
+			bool bWriteFailure = false;
 			BeginWaitCursor();
 			StatusSetTextID(hwndStatus, STATUS_HELP, IDS_SAVINGSETTINGS);
 			StatusSetSimple(hwndStatus, TRUE);
 			InvalidateRect(hwndStatus, nullptr, TRUE);
 			UpdateWindow(hwndStatus);
 			if (CreateIniFile(szIniFile)) {
+				IniFileBatch_Begin(szIniFile);
 				if (bOnlySaveStyle) {
 					Style_Save();
 				} else {
 					SaveSettings(true);
 				}
+				bWriteFailure = !IniFileBatch_End();
+				if (bWriteFailure) {
+					dwLastIOError = GetLastError();
+				}
 			} else {
 				bCreateFailure = true;
 			}
 			StatusSetSimple(hwndStatus, FALSE);
 			EndWaitCursor();
-			if (!bCreateFailure && !bQuiet) {
+			if (bWriteFailure) {
+				MsgBoxLastError(MB_OK, IDS_WRITEINI_FAIL);
+			} else if (!bCreateFailure && !bQuiet) {
 				MsgBoxInfo(MB_OK, IDS_SAVEDSETTINGS);
 			}
 		} else {
@@ -6684,6 +6799,7 @@ void LoadFlags(void) {
 	fNoCGIGuess = IniSectionGetBool(pIniSection, L"NoCGIGuess", false);
 	fNoAutoDetection = IniSectionGetBool(pIniSection, L"NoAutoDetection", false);
 	fNoFileVariables = IniSectionGetBool(pIniSection, L"NoFileVariables", false);
+	flagStyleSettingsCache = IniSectionGetBool(pIniSection, L"StyleSettingsCache", false);
 
 	if (StrIsEmpty(g_wchAppUserModelID)) {
 		LPCWSTR strValue = IniSectionGetValue(pIniSection, L"ShellAppUserModelID");
@@ -7010,7 +7126,14 @@ void UpdateStatusbar() noexcept {
 	WCHAR tchCurLine[32];
 	WCHAR tchDocLine[32];
 	FormatNumber(tchCurLine, iLine + 1);
-	FormatNumber(tchDocLine, iLines);
+	// lines of huge file are still being indexed, show approximate line count
+	if (SciCall_GetLineIndexEnd() < SciCall_GetLength()) {
+		tchDocLine[0] = L'~';
+		FormatNumber(tchDocLine + 1, SciCall_GetLineCountEstimate());
+		lstrcat(tchDocLine, L"\u2026");
+	} else {
+		FormatNumber(tchDocLine, iLines);
+	}
 
 	WCHAR tchCurColumn[32];
 	WCHAR tchLineColumn[32];
@@ -7334,6 +7457,7 @@ bool FileLoad(FileLoadFlag loadFlag, LPCWSTR lpszFile) {
 		UpdateDocumentModificationStatus();
 
 		AutoSave_Stop(TRUE);
+		EditFindInFiles_Stop();
 		// Terminate file watching
 		if (bResetFileWatching) {
 			iFileWatchingMode = FileWatchingMode_None;
@@ -7449,6 +7573,7 @@ bool FileLoad(FileLoadFlag loadFlag, LPCWSTR lpszFile) {
 		}
 
 		AutoSave_Stop(!(loadFlag & FileLoadFlag_Reload));
+		EditFindInFiles_Stop();
 		// Install watching of the current file
 		if (!(loadFlag & FileLoadFlag_Reload) && bResetFileWatching) {
 			iFileWatchingMode = FileWatchingMode_None;
@@ -7464,10 +7589,13 @@ bool FileLoad(FileLoadFlag loadFlag, LPCWSTR lpszFile) {
 			}
 		}
 		// open file in read only mode
-		if (status.bBinaryFile || flagReadOnlyMode != ReadOnlyMode_None || bReadOnlyFile) {
+		if (status.bBinaryFile || status.bViewOnly || flagReadOnlyMode != ReadOnlyMode_None || bReadOnlyFile) {
 			bReadOnlyMode = true;
 			flagReadOnlyMode &= ReadOnlyMode_AllFile;
 			SciCall_SetReadOnly(true);
+			if (status.bViewOnly) {
+				SetTimer(hwndMain, ID_LINEINDEXTIMER, 50, nullptr);
+			}
 		} else {
 #if NP2_ENABLE_DOT_LOG_FEATURE
 			if (IsFileStartsWithDotLog()) {
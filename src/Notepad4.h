@@ -116,10 +116,12 @@ enum {
 // https://www.codeproject.com/tips/1017834/how-to-send-data-from-one-process-to-another-in-cs
 #define APPM_COPYDATA				(WM_APP + 6)
 #define APPM_DROPFILES				(WM_APP + 7)	// ScintillaWin::Drop()
+#define APPM_FINDINFILES			(WM_APP + 8)	// Find in Files results
 
 #define ID_WATCHTIMER				0xA000	// file watch timer
 #define ID_PASTEBOARDTIMER			0xA001	// paste board timer
 #define ID_AUTOSAVETIMER			0xA002	// AutoSave timer
+#define ID_LINEINDEXTIMER			0xA003	// line index timer for huge file
 
 #define REUSEWINDOWLOCKTIMEOUT		1000	// Reuse Window Lock Timeout
 
@@ -238,6 +240,7 @@ struct EditFileIOStatus {
 	bool bFileTooBig;	// load output
 	bool bUnicodeErr;	// load output
 	bool bBinaryFile;	// load output
+	bool bViewOnly;		// load output: huge file loaded in read only view mode
 	bool bCancelDataLoss;// save output
 
 	// inconsistent line endings
@@ -266,6 +269,7 @@ enum FileSaveFlag {
 bool FileIO(bool fLoad, LPWSTR pszFile, int flag, EditFileIOStatus &status);
 bool FileLoad(FileLoadFlag loadFlag, LPCWSTR lpszFile);
 bool FileSave(FileSaveFlag saveFlag);
+void SetupInitialOpenSaveDir(LPWSTR tchInitialDir, DWORD cchInitialDir, LPCWSTR lpstrInitialDir) noexcept;
 BOOL OpenFileDlg(LPWSTR lpstrFile, int cchFile, LPCWSTR lpstrInitialDir) noexcept;
 BOOL SaveFileDlg(bool Untitled, LPWSTR lpstrFile, int cchFile, LPCWSTR lpstrInitialDir) noexcept;
 
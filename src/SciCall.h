@@ -274,6 +274,22 @@ inline void SciCall_AllocateLines(Sci_Line lineCount) noexcept {
 	SciCall(SCI_ALLOCATELINES, lineCount, 0);
 }
 
+inline Sci_Position SciCall_IndexLines(Sci_Position length) noexcept {
+	return SciCall(SCI_INDEXLINES, length, 0);
+}
+
+inline void SciCall_IndexLinesTo(Sci_Line line) noexcept {
+	SciCall(SCI_INDEXLINESTO, line, 0);
+}
+
+inline Sci_Line SciCall_GetLineCountEstimate() noexcept {
+	return SciCall(SCI_GETLINECOUNTESTIMATE, 0, 0);
+}
+
+inline Sci_Position SciCall_GetLineIndexEnd() noexcept {
+	return SciCall(SCI_GETLINEINDEXEND, 0, 0);
+}
+
 inline void SciCall_SetSel(Sci_Position anchor, Sci_Position caret) noexcept {
 	SciCall(SCI_SETSEL, anchor, caret);
 }
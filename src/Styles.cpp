@@ -593,7 +593,118 @@ HFONT Style_CreateCodeFont(UINT dpi) noexcept {
 	return font;
 }
 
+// file extension index: open addressing hash table for extensions of all lexers,
+// built on first lookup, reset after extensions or lexer order changed.
+struct FileExtensionEntry {
+	LPCWSTR ext;		// point into szExtensions, not NUL terminated
+	UINT length;
+	PEDITLEXER pLex;
+};
+
+static FileExtensionEntry *fileExtensionIndex;
+static UINT fileExtensionIndexBits;
+
+static inline bool IsFileExtensionSeparator(WCHAR ch) noexcept {
+	return ch == L';' || ch <= L' ';
+}
+
+static inline UINT GetFileExtensionSlot(LPCWSTR ext, UINT length) noexcept {
+	UINT hash = length;
+	for (UINT i = 0; i < length; i++) {
+		// case insensitive for ASCII letters, may group some punctuation together
+		hash = hash*31 + UnsafeLower(ext[i]);
+	}
+	// Fibonacci hashing
+	return (hash * 2654435769U) >> (32 - fileExtensionIndexBits);
+}
+
+static void Style_ResetFileExtensionIndex() noexcept {
+	if (fileExtensionIndex != nullptr) {
+		NP2HeapFree(fileExtensionIndex);
+		fileExtensionIndex = nullptr;
+	}
+}
+
+static void Style_BuildFileExtensionIndex() noexcept {
+	UINT count = 0;
+	for (UINT iLexer = LEXER_INDEX_MATCH; iLexer < ALL_LEXER_COUNT; iLexer++) {
+		LPCWSTR p = pLexArray[iLexer]->szExtensions;
+		bool separator = true;
+		while (*p) {
+			const bool current = IsFileExtensionSeparator(*p++);
+			count += separator && !current;
+			separator = current;
+		}
+	}
+
+	UINT bits = 6;
+	while ((1U << bits) < count*2) {
+		++bits;
+	}
+	fileExtensionIndexBits = bits;
+	const UINT mask = (1U << bits) - 1;
+	FileExtensionEntry * const index = (FileExtensionEntry *)NP2HeapAlloc((mask + 1) * sizeof(FileExtensionEntry));
+	for (UINT iLexer = LEXER_INDEX_MATCH; iLexer < ALL_LEXER_COUNT; iLexer++) {
+		PEDITLEXER pLex = pLexArray[iLexer];
+		LPCWSTR p = pLex->szExtensions;
+		while (*p) {
+			if (IsFileExtensionSeparator(*p)) {
+				++p;
+				continue;
+			}
+			LPCWSTR ext = p;
+			do {
+				++p;
+			} while (*p && !IsFileExtensionSeparator(*p));
+			const UINT length = static_cast<UINT>(p - ext);
+			UINT slot = GetFileExtensionSlot(ext, length);
+			while (true) {
+				FileExtensionEntry *entry = index + slot;
+				if (entry->ext == nullptr) {
+					entry->ext = ext;
+					entry->length = length;
+					entry->pLex = pLex;
+					break;
+				}
+				if (entry->length == length && StrHasPrefixCaseEx(entry->ext, ext, length)) {
+					// lexer with lower index wins, same as linear scan
+					break;
+				}
+				slot = (slot + 1) & mask;
+			}
+		}
+	}
+	fileExtensionIndex = index;
+}
+
+static PEDITLEXER Style_FindFileExtension(LPCWSTR lpszExt) noexcept {
+	const UINT length = lstrlen(lpszExt);
+	if (length == 0) {
+		return nullptr;
+	}
+	if (fileExtensionIndex == nullptr) {
+		Style_BuildFileExtensionIndex();
+	}
+
+	const UINT mask = (1U << fileExtensionIndexBits) - 1;
+	UINT slot = GetFileExtensionSlot(lpszExt, length);
+	while (true) {
+		const FileExtensionEntry *entry = fileExtensionIndex + slot;
+		if (entry->ext == nullptr) {
+			return nullptr;
+		}
+		if (entry->length == length && StrHasPrefixCaseEx(entry->ext, lpszExt, length)) {
+			return entry->pLex;
+		}
+		slot = (slot + 1) & mask;
+	}
+}
+
+static void StyleCache_Release() noexcept;
+
 void Style_ReleaseResources() noexcept {
+	StyleCache_Release();
+	Style_ResetFileExtensionIndex();
 	NP2HeapFree(g_AllFileExtensions);
 	for (UINT iLexer = 0; iLexer < ALL_LEXER_COUNT; iLexer++) {
 		PEDITLEXER pLex = pLexArray[iLexer];
@@ -615,6 +726,274 @@ static inline void FindDarkThemeFile() noexcept {
 	FindExtraIniFile(darkStyleThemeFilePath, L"Notepad4 DarkTheme.ini", L"DarkTheme.ini");
 }
 
+// Style settings cache: sections used by Style_Load() and Style_LoadOneEx() are saved
+// into "Notepad4.ini.cache" on exit, on next startup the file is mapped and validated
+// once, then scheme sections are copied from it lazily instead of calling
+// GetPrivateProfileSection(), which re-reads whole ini file for each section.
+#define STYLE_CACHE_MAGIC			0x4353344EU	// 'N4SC'
+#define STYLE_CACHE_VERSION			1
+#define STYLE_CACHE_FILE_EXT		L".cache"
+#define STYLE_CACHE_MAX_FILE_SIZE	(64*1024*1024)
+#define STYLE_CACHE_HASH_INIT		2166136261U
+
+enum {
+	StyleCacheSection_Styles,
+	StyleCacheSection_FileExtensions,
+	StyleCacheSection_CustomColors,
+	StyleCacheSection_Count, // followed by scheme sections, identified by rid
+};
+
+struct StyleCacheFileInfo {
+	uint32_t pathHash;
+	uint32_t sizeLow;
+	uint32_t sizeHigh;
+	FILETIME lastWriteTime;
+};
+
+struct StyleCacheHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t lexerHash;		// detect scheme changes between builds
+	int32_t styleTheme;
+	StyleCacheFileInfo iniFile;
+	StyleCacheFileInfo themeFile;
+	uint32_t sectionCount;
+	uint32_t dataSize;		// WCHAR count of section data
+	uint32_t dataHash;		// FNV-1a hash of section data and section list
+	uint32_t reserved;
+};
+
+struct StyleCacheSection {
+	int rid;				// StyleCacheSection_* or scheme rid
+	uint32_t offset;		// WCHAR offset into section data
+	uint32_t length;		// WCHAR count, including terminating NUL
+};
+
+extern bool flagStyleSettingsCache;
+static const StyleCacheHeader *styleCache;
+static int styleCacheTheme = -1;	// theme for scheme sections in the cache
+
+static uint32_t StyleCache_Hash(uint32_t hash, const void *data, size_t length) noexcept {
+	const uint8_t *ptr = static_cast<const uint8_t *>(data);
+	const uint8_t * const end = ptr + length;
+	while (ptr < end) {
+		hash = (hash ^ *ptr++) * 16777619U;
+	}
+	return hash;
+}
+
+static uint32_t StyleCache_GetLexerHash() noexcept {
+	// order independent, pLexArray is reordered by favorite schemes
+	uint32_t hash = 0;
+	for (UINT iLexer = 0; iLexer < ALL_LEXER_COUNT; iLexer++) {
+		const LPCEDITLEXER pLex = pLexArray[iLexer];
+		const uint32_t value[2] = { static_cast<uint32_t>(pLex->rid), pLex->iStyleCount };
+		const uint32_t lexerHash = StyleCache_Hash(STYLE_CACHE_HASH_INIT, value, sizeof(value));
+		hash += StyleCache_Hash(lexerHash, pLex->pszName, lstrlen(pLex->pszName)*sizeof(WCHAR));
+	}
+	return hash;
+}
+
+static void StyleCache_GetFileInfo(StyleCacheFileInfo *info, LPCWSTR path) noexcept {
+	memset(info, 0, sizeof(StyleCacheFileInfo));
+	info->pathHash = StyleCache_Hash(STYLE_CACHE_HASH_INIT, path, lstrlen(path)*sizeof(WCHAR));
+	WIN32_FILE_ATTRIBUTE_DATA fad;
+	if (GetFileAttributesEx(path, GetFileExInfoStandard, &fad)) {
+		info->sizeLow = fad.nFileSizeLow;
+		info->sizeHigh = fad.nFileSizeHigh;
+		info->lastWriteTime = fad.ftLastWriteTime;
+	}
+}
+
+static inline bool StyleCache_SameFile(const StyleCacheFileInfo *info1, const StyleCacheFileInfo *info2) noexcept {
+	return memcmp(info1, info2, sizeof(StyleCacheFileInfo)) == 0;
+}
+
+static inline void StyleCache_GetFilePath(LPWSTR path) noexcept {
+	lstrcpy(path, szIniFile);
+	lstrcat(path, STYLE_CACHE_FILE_EXT);
+}
+
+static void StyleCache_Release() noexcept {
+	if (styleCache != nullptr) {
+		UnmapViewOfFile(styleCache);
+		styleCache = nullptr;
+	}
+	styleCacheTheme = -1;
+}
+
+static void StyleCache_Load() noexcept {
+	if (!flagStyleSettingsCache || StrIsEmpty(szIniFile)) {
+		return;
+	}
+
+	WCHAR path[MAX_PATH + 8];
+	StyleCache_GetFilePath(path);
+	HANDLE hFile = CreateFile(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE) {
+		return;
+	}
+
+	LARGE_INTEGER fileSize;
+	const StyleCacheHeader *header = nullptr;
+	if (GetFileSizeEx(hFile, &fileSize) && fileSize.QuadPart > static_cast<LONGLONG>(sizeof(StyleCacheHeader))
+		&& fileSize.QuadPart < STYLE_CACHE_MAX_FILE_SIZE) {
+		HANDLE hMap = CreateFileMapping(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (hMap != nullptr) {
+			header = static_cast<const StyleCacheHeader *>(MapViewOfFile(hMap, FILE_MAP_READ, 0, 0, 0));
+			CloseHandle(hMap);
+		}
+	}
+	CloseHandle(hFile);
+	if (header == nullptr) {
+		return;
+	}
+
+	StyleCacheFileInfo info;
+	StyleCache_GetFileInfo(&info, szIniFile);
+	constexpr UINT sectionCount = ALL_LEXER_COUNT + StyleCacheSection_Count;
+	constexpr size_t sectionSize = sizeof(StyleCacheHeader) + sectionCount*sizeof(StyleCacheSection);
+	bool valid = header->magic == STYLE_CACHE_MAGIC
+		&& header->version == STYLE_CACHE_VERSION
+		&& header->sectionCount == sectionCount
+		&& sectionSize + header->dataSize*sizeof(WCHAR) == static_cast<size_t>(fileSize.QuadPart)
+		&& StyleCache_SameFile(&header->iniFile, &info)
+		&& header->lexerHash == StyleCache_GetLexerHash();
+	if (valid) {
+		const StyleCacheSection *sectionList = reinterpret_cast<const StyleCacheSection *>(header + 1);
+		uint32_t hash = StyleCache_Hash(STYLE_CACHE_HASH_INIT, sectionList + sectionCount, header->dataSize*sizeof(WCHAR));
+		hash = StyleCache_Hash(hash, sectionList, sectionCount*sizeof(StyleCacheSection));
+		valid = hash == header->dataHash;
+	}
+	if (valid) {
+		styleCache = header;
+	} else {
+		UnmapViewOfFile(header);
+	}
+}
+
+// called after style theme is changed, scheme sections are only usable for the theme file saved in the cache.
+static void StyleCache_CheckTheme() noexcept {
+	styleCacheTheme = -1;
+	if (styleCache != nullptr && styleCache->styleTheme == np2StyleTheme) {
+		StyleCacheFileInfo info;
+		StyleCache_GetFileInfo(&info, GetStyleThemeFilePath());
+		if (StyleCache_SameFile(&styleCache->themeFile, &info)) {
+			styleCacheTheme = np2StyleTheme;
+		}
+	}
+}
+
+static bool StyleCache_GetSection(int rid, LPWSTR lpSection, int cchSection) noexcept {
+	const StyleCacheHeader * const header = styleCache;
+	if (header == nullptr || (rid >= StyleCacheSection_CustomColors && styleCacheTheme != np2StyleTheme)) {
+		return false;
+	}
+
+	const UINT sectionCount = header->sectionCount;
+	const StyleCacheSection *section = reinterpret_cast<const StyleCacheSection *>(header + 1);
+	LPCWSTR data = reinterpret_cast<LPCWSTR>(section + sectionCount);
+	for (UINT i = 0; i < sectionCount; i++, section++) {
+		if (section->rid == rid) {
+			const UINT length = section->length;
+			if (length == 0 || length > static_cast<UINT>(cchSection) || static_cast<uint64_t>(section->offset) + length > header->dataSize) {
+				return false;
+			}
+			memcpy(lpSection, data + section->offset, length*sizeof(WCHAR));
+			return true;
+		}
+	}
+	return false;
+}
+
+void Style_SaveSettingsCache() noexcept {
+	if (!flagStyleSettingsCache || StrIsEmpty(szIniFile)) {
+		return;
+	}
+
+	StyleCacheHeader header;
+	memset(&header, 0, sizeof(header));
+	header.magic = STYLE_CACHE_MAGIC;
+	header.version = STYLE_CACHE_VERSION;
+	header.lexerHash = StyleCache_GetLexerHash();
+	header.styleTheme = np2StyleTheme;
+	LPCWSTR themePath = GetStyleThemeFilePath();
+	StyleCache_GetFileInfo(&header.iniFile, szIniFile);
+	StyleCache_GetFileInfo(&header.themeFile, themePath);
+	if (styleCache != nullptr && styleCache->styleTheme == np2StyleTheme
+		&& StyleCache_SameFile(&styleCache->iniFile, &header.iniFile)
+		&& StyleCache_SameFile(&styleCache->themeFile, &header.themeFile)) {
+		return;
+	}
+
+	StyleCache_Release();
+	WCHAR path[MAX_PATH + 8];
+	StyleCache_GetFilePath(path);
+	HANDLE hFile = CreateFile(path, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE) {
+		return;
+	}
+
+	constexpr UINT sectionCount = ALL_LEXER_COUNT + StyleCacheSection_Count;
+	StyleCacheSection sectionList[sectionCount];
+	WCHAR *pIniSectionBuf = (WCHAR *)NP2HeapAlloc(sizeof(WCHAR) * MAX_INI_SECTION_SIZE_STYLES);
+	const int cchIniSection = (int)(NP2HeapSize(pIniSectionBuf) / sizeof(WCHAR));
+	DWORD dwWritten;
+	// section data is written after header and section list.
+	bool success = SetFilePointer(hFile, sizeof(header) + sizeof(sectionList), nullptr, FILE_BEGIN) != INVALID_SET_FILE_POINTER;
+	uint32_t hash = STYLE_CACHE_HASH_INIT;
+	UINT offset = 0;
+	IniFileBatch_Begin(themePath);
+	for (UINT i = 0; success && i < sectionCount; i++) {
+		int rid = static_cast<int>(i);
+		LPCWSTR lpSection;
+		LPCWSTR lpFile = themePath;
+		switch (i) {
+		case StyleCacheSection_Styles:
+			lpSection = INI_SECTION_NAME_STYLES;
+			lpFile = szIniFile;
+			break;
+		case StyleCacheSection_FileExtensions:
+			lpSection = INI_SECTION_NAME_FILE_EXTENSIONS;
+			lpFile = szIniFile;
+			break;
+		case StyleCacheSection_CustomColors:
+			lpSection = INI_SECTION_NAME_CUSTOM_COLORS;
+			break;
+		default: {
+			const LPCEDITLEXER pLex = pLexArray[i - StyleCacheSection_Count];
+			rid = pLex->rid;
+			lpSection = pLex->pszName;
+		} break;
+		}
+
+		// include the terminating NUL of the double NUL terminated key value list
+		const UINT length = LoadIniSectionEx(lpSection, pIniSectionBuf, cchIniSection, lpFile) + 1;
+		sectionList[i].rid = rid;
+		sectionList[i].offset = offset;
+		sectionList[i].length = length;
+		offset += length;
+		hash = StyleCache_Hash(hash, pIniSectionBuf, length*sizeof(WCHAR));
+		success = WriteFile(hFile, pIniSectionBuf, length*sizeof(WCHAR), &dwWritten, nullptr) && dwWritten == length*sizeof(WCHAR);
+	}
+	IniFileBatch_End();
+
+	if (success) {
+		header.sectionCount = sectionCount;
+		header.dataSize = offset;
+		header.dataHash = StyleCache_Hash(hash, sectionList, sizeof(sectionList));
+		success = SetFilePointer(hFile, 0, nullptr, FILE_BEGIN) == 0
+			&& WriteFile(hFile, &header, sizeof(header), &dwWritten, nullptr) && dwWritten == sizeof(header)
+			&& WriteFile(hFile, sectionList, sizeof(sectionList), &dwWritten, nullptr) && dwWritten == sizeof(sectionList);
+	}
+
+	CloseHandle(hFile);
+	NP2HeapFree(pIniSectionBuf);
+	if (!success) {
+		DeleteFile(path);
+	}
+}
+
 void Style_LoadTabSettings(LPCEDITLEXER pLex) noexcept {
 	LPCWSTR lpSection = pLex->pszName;
 	const UINT lexerAttr = pLex->lexerAttr;
@@ -645,8 +1024,10 @@ static inline void SaveLexTabSettings(IniSectionOnSave *pIniSection, LPCEDITLEXE
 
 static void Style_LoadOneEx(PEDITLEXER pLex, IniSection *pIniSection, WCHAR *pIniSectionBuf, int cchIniSection) {
 	pLex->iStyleTheme = (uint8_t)np2StyleTheme;
-	LPCWSTR themePath = GetStyleThemeFilePath();
-	GetPrivateProfileSection(pLex->pszName, pIniSectionBuf, cchIniSection, themePath);
+	if (!StyleCache_GetSection(pLex->rid, pIniSectionBuf, cchIniSection)) {
+		LPCWSTR themePath = GetStyleThemeFilePath();
+		LoadIniSectionEx(pLex->pszName, pIniSectionBuf, cchIniSection, themePath);
+	}
 
 	const UINT iStyleCount = pLex->iStyleCount;
 	LPWSTR szValue = pLex->szStyleBuf;
@@ -697,6 +1078,7 @@ void Style_SetFavoriteSchemes() noexcept {
 			}
 		}
 	}
+	Style_ResetFileExtensionIndex();
 }
 
 void Style_GetFavoriteSchemes() noexcept {
@@ -757,7 +1139,10 @@ void Style_Load(void) {
 	IniSection * const pIniSection = &section;
 	IniSectionInit(pIniSection, 128);
 
-	LoadIniSection(INI_SECTION_NAME_STYLES, pIniSectionBuf, cchIniSection);
+	StyleCache_Load();
+	if (!StyleCache_GetSection(StyleCacheSection_Styles, pIniSectionBuf, cchIniSection)) {
+		LoadIniSection(INI_SECTION_NAME_STYLES, pIniSectionBuf, cchIniSection);
+	}
 	IniSectionParse(pIniSection, pIniSectionBuf);
 
 	// 2nd default
@@ -782,7 +1167,9 @@ void Style_Load(void) {
 	bAutoSelect = IniSectionGetBool(pIniSection, L"AutoSelect", true);
 
 	// file extensions
-	LoadIniSection(INI_SECTION_NAME_FILE_EXTENSIONS, pIniSectionBuf, cchIniSection);
+	if (!StyleCache_GetSection(StyleCacheSection_FileExtensions, pIniSectionBuf, cchIniSection)) {
+		LoadIniSection(INI_SECTION_NAME_FILE_EXTENSIONS, pIniSectionBuf, cchIniSection);
+	}
 	IniSectionParse(pIniSection, pIniSectionBuf);
 	for (UINT iLexer = 0; iLexer < MATCH_LEXER_COUNT; iLexer++) {
 		PEDITLEXER pLex = pLexArray[iLexer + LEXER_INDEX_MATCH];
@@ -798,6 +1185,7 @@ void Style_Load(void) {
 	if (np2StyleTheme == StyleTheme_Dark) {
 		FindDarkThemeFile();
 	}
+	StyleCache_CheckTheme();
 
 	Style_LoadOneEx(pLexGlobal, pIniSection, pIniSectionBuf, cchIniSection);
 	Style_LoadOneEx(pLexArray[iDefaultLexerIndex], pIniSection, pIniSectionBuf, cchIniSection);
@@ -826,14 +1214,20 @@ static void Style_LoadAll(bool bReload, bool onlyCustom) {
 	const int cchIniSection = (int)(NP2HeapSize(pIniSectionBuf) / sizeof(WCHAR));
 	IniSection * const pIniSection = &section;
 	IniSectionInit(pIniSection, 128);
+	if (bReload) {
+		// theme file may be changed outside
+		StyleCache_Release();
+	}
 
 	// Custom colors
 	if (bReload || !bCustomColorLoaded) {
 		bCustomColorLoaded = true;
-		LPCWSTR themePath = GetStyleThemeFilePath();
 		memcpy(customColor, defaultCustomColor, MAX_CUSTOM_COLOR_COUNT * sizeof(COLORREF));
 
-		GetPrivateProfileSection(INI_SECTION_NAME_CUSTOM_COLORS, pIniSectionBuf, cchIniSection, themePath);
+		if (!StyleCache_GetSection(StyleCacheSection_CustomColors, pIniSectionBuf, cchIniSection)) {
+			LPCWSTR themePath = GetStyleThemeFilePath();
+			LoadIniSectionEx(INI_SECTION_NAME_CUSTOM_COLORS, pIniSectionBuf, cchIniSection, themePath);
+		}
 		IniSectionParseArray(pIniSection, pIniSectionBuf, FALSE);
 
 		const UINT count = min<UINT>(pIniSection->count, MAX_CUSTOM_COLOR_COUNT);
@@ -868,6 +1262,8 @@ static void Style_LoadAll(bool bReload, bool onlyCustom) {
 //	Style_Save()
 //
 void Style_Save(void) {
+	// saved styles are newer than the cache
+	StyleCache_Release();
 	WCHAR *pIniSectionBuf = (WCHAR *)NP2HeapAlloc(sizeof(WCHAR) * MAX_INI_SECTION_SIZE_STYLES);
 	IniSectionOnSave section = { pIniSectionBuf };
 	IniSectionOnSave * const pIniSection = &section;
@@ -928,7 +1324,7 @@ void Style_Save(void) {
 				IniSectionSetString(pIniSection, tch, wch);
 			}
 		}
-		WritePrivateProfileSection(INI_SECTION_NAME_CUSTOM_COLORS, pIniSectionBuf, themePath);
+		SaveIniSectionEx(INI_SECTION_NAME_CUSTOM_COLORS, pIniSectionBuf, themePath);
 	}
 
 	if (fStylesModified & STYLESMODIFIED_STYLE_MASK) {
@@ -949,7 +1345,7 @@ void Style_Save(void) {
 				SaveLexTabSettings(pIniSection, pLex);
 			}
 			// delete this section if nothing changed
-			WritePrivateProfileSection(pLex->pszName, StrIsEmpty(pIniSectionBuf) ? nullptr : pIniSectionBuf, themePath);
+			SaveIniSectionEx(pLex->pszName, StrIsEmpty(pIniSectionBuf) ? nullptr : pIniSectionBuf, themePath);
 			pLex->bStyleChanged = false;
 		}
 	}
@@ -1806,6 +2202,40 @@ void Style_SetLexer(PEDITLEXER pLexNew, BOOL bLexerChanged) {
 // find lexer from script interpreter, which must be first line of the file.
 // Style_SniffShebang()
 //
+struct ShebangInterpreter {
+	const char *name;
+	PEDITLEXER pLex;
+	int lang;
+};
+
+// interpreter name prefix, sorted for binary search.
+static const ShebangInterpreter shebangInterpreterList[] = {
+	{ "ash", &lexBash, 0 },
+	{ "awk", &lexAwk, 0 },
+	{ "bash", &lexBash, 0 },
+	{ "csh", &lexBash, IDM_LEXER_CSHELL },
+	{ "dash", &lexBash, 0 },
+	{ "gawk", &lexAwk, 0 },
+	{ "groovy", &lexGroovy, 0 },
+	{ "ipy", &lexPython, 0 },
+	{ "ksh", &lexBash, 0 },
+	{ "lua", &lexLua, 0 },
+	{ "nawk", &lexAwk, 0 },
+	{ "node", &lexJavaScript, 0 },
+	{ "perl", &lexPerl, 0 },
+	{ "php", &lexPHP, 0 },
+	{ "py", &lexPython, 0 },	// python, pypy
+	{ "rscript", &lexRLang, 0 },
+	{ "ruby", &lexRuby, 0 },
+	{ "scala", &lexScala, 0 },
+	{ "sh", &lexBash, 0 },
+	{ "tcl", &lexTcl, 0 },
+	{ "tcsh", &lexBash, IDM_LEXER_CSHELL },
+	{ "wish", &lexTcl, 0 },
+	{ "wlua", &lexLua, 0 },
+	{ "zsh", &lexBash, 0 },
+};
+
 PEDITLEXER Style_SniffShebang(char *pchText) noexcept {
 	if (pchText[0] == '#' && pchText[1] == '!') {
 		size_t len = 0;
@@ -1845,82 +2275,31 @@ PEDITLEXER Style_SniffShebang(char *pchText) noexcept {
 			pch++;
 		}
 
-		if (len >= 4) {
-			if (len >= 5) {
-				if (StrStartsWith(name, "python")) {
-					return &lexPython;
-				}
-				if (StrStartsWith(name, "groovy")) {
-					return &lexGroovy;
-				}
-				if (StrStartsWith(name, "scala")) {
-					return &lexScala;
+		// find longest interpreter name which is prefix of the name
+		len = min<size_t>(len, 7);
+		while (len >= 2) {
+			UINT lo = 0;
+			UINT hi = COUNTOF(shebangInterpreterList);
+			while (lo < hi) {
+				const UINT mid = (lo + hi) / 2;
+				const ShebangInterpreter &interpreter = shebangInterpreterList[mid];
+				int cmp = strncmp(interpreter.name, name, len);
+				if (cmp == 0) {
+					cmp = static_cast<uint8_t>(interpreter.name[len]);
+					if (cmp == 0) {
+						if (interpreter.lang) {
+							np2LexLangIndex = interpreter.lang;
+						}
+						return interpreter.pLex;
+					}
 				}
-				if (StrStartsWith(name, "Rscript")) {
-					return &lexRLang;
+				if (cmp < 0) {
+					lo = mid + 1;
+				} else {
+					hi = mid;
 				}
 			}
-
-			if (StrStartsWith(name, "bash") || StrStartsWith(name, "dash")) {
-				return &lexBash;
-			}
-			if (StrStartsWith(name, "tcsh")) {
-				np2LexLangIndex = IDM_LEXER_CSHELL;
-				return &lexBash;
-			}
-			if (StrStartsWith(name, "perl")) {
-				return &lexPerl;
-			}
-			if (StrStartsWith(name, "ruby")) {
-				return &lexRuby;
-			}
-			//if (StrStartsWith(name, "rust")) {
-			//	return &lexRust;
-			//}
-			if (StrStartsWith(name, "gawk") || StrStartsWith(name, "nawk")) {
-				return &lexAwk;
-			}
-			if (StrStartsWith(name, "node")) {
-				return &lexJavaScript;
-			}
-			if (StrStartsWith(name, "wish")) {
-				return &lexTcl;
-			}
-			if (StrStartsWith(name, "wlua")) {
-				return &lexLua;
-			}
-		}
-		if (len >= 3) {
-			if (StrStartsWith(name, "awk")) {
-				return &lexAwk;
-			}
-			if (StrStartsWith(name, "lua")) {
-				return &lexLua;
-			}
-			if (StrStartsWith(name, "php")) {
-				return &lexPHP;
-			}
-			if (StrStartsWith(name, "tcl")) {
-				return &lexTcl;
-			}
-			if (StrStartsWith(name, "ash") || StrStartsWith(name, "zsh") || StrStartsWith(name, "ksh")) {
-				return &lexBash;
-			}
-			if (StrStartsWith(name, "csh")) {
-				np2LexLangIndex = IDM_LEXER_CSHELL;
-				return &lexBash;
-			}
-			if (StrStartsWith(name, "ipy")) {
-				return &lexPython;
-			}
-		}
-		if (len >= 2) {
-			if (StrStartsWith(name, "sh")) {
-				return &lexBash;
-			}
-			if (StrStartsWith(name, "py")) {
-				return &lexPython;
-			}
+			--len;
 		}
 	}
 	return nullptr;
@@ -2363,24 +2742,7 @@ PEDITLEXER Style_MatchLexer(LPCWSTR lpszMatch, bool bCheckNames) noexcept {
 			}
 		}
 
-		const int cch = lstrlen(lpszMatch);
-		for (UINT iLexer = LEXER_INDEX_MATCH; iLexer < ALL_LEXER_COUNT; iLexer++) {
-			PEDITLEXER pLex = pLexArray[iLexer];
-			LPCWSTR p1 = pLex->szExtensions;
-			do {
-				LPCWSTR p2 = StrStrI(p1, lpszMatch);
-				if (p2 == nullptr) {
-					break;
-				}
-
-				const WCHAR ch = (p2 == p1)? L'\0' : p2[-1];
-				p2 += cch;
-				if ((ch == L';' || ch <= L' ') && (*p2 == L';' || *p2 <= L' ')) {
-					return pLex;
-				}
-				p1 = StrChr(p2, L';');
-			} while (p1 != nullptr);
-		}
+		return Style_FindFileExtension(lpszMatch);
 	} else {
 		const int cch = lstrlen(lpszMatch);
 		if (cch >= 3) {
@@ -4024,7 +4386,7 @@ static void Style_ResetStyle(LPCEDITLEXER pLex, EDITSTYLE *pStyle) noexcept {
 		LPCWSTR themePath = GetStyleThemeFilePath();
 		WCHAR wch[MAX_EDITSTYLE_VALUE_SIZE] = L"";
 		// use "NULL" to distinguish between empty style value like: Keyword=
-		GetPrivateProfileString(pLex->pszName, pStyle->pszName, L"NULL", wch, COUNTOF(wch), themePath);
+		IniGetStringEx(pLex->pszName, pStyle->pszName, L"NULL", wch, COUNTOF(wch), themePath);
 		if (!StrEqualExW(wch, L"NULL")) {
 			lstrcpy(pStyle->szValue, wch);
 			return;
@@ -4589,7 +4951,10 @@ void Style_ConfigDlg(HWND hwnd) {
 		}
 	}
 
-	if (IDCANCEL == ThemedDialogBoxParam(g_hInstance, MAKEINTRESOURCE(IDD_STYLECONFIG), GetParent(hwnd), Style_ConfigDlgProc, (LPARAM)(&param))) {
+	const INT_PTR result = ThemedDialogBoxParam(g_hInstance, MAKEINTRESOURCE(IDD_STYLECONFIG), GetParent(hwnd), Style_ConfigDlgProc, (LPARAM)(&param));
+	// extensions may be changed, reset or imported
+	Style_ResetFileExtensionIndex();
+	if (IDCANCEL == result) {
 		// Restore Styles
 		memcpy(g_AllFileExtensions, param.extBackup, ALL_FILE_EXTENSIONS_BYTE_SIZE);
 		memcpy(customColor, param.colorBackup, MAX_CUSTOM_COLOR_COUNT * sizeof(COLORREF));
@@ -4856,6 +5221,7 @@ static void Style_GetFavoriteSchemesFromTreeView(HWND hwndTV, HTREEITEM hFavorit
 	}
 
 	qsort(NP2_void_pointer(pLexArray + LEXER_INDEX_GENERAL), GENERAL_LEXER_COUNT, sizeof(PEDITLEXER), CmpEditLexerByOrder);
+	Style_ResetFileExtensionIndex();
 }
 
 //=============================================================================
@@ -82,6 +82,7 @@ extern int np2StyleTheme;
 void	Style_ReleaseResources() noexcept;
 void	Style_Load(void);
 void	Style_Save(void);
+void	Style_SaveSettingsCache() noexcept;
 bool	Style_Import(HWND hwnd);
 bool	Style_Export(HWND hwnd);
 void	Style_LoadTabSettings(LPCEDITLEXER pLex) noexcept;
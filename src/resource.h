@@ -366,6 +366,13 @@
 #define	IDC_CSV_QUALIFIER_DOUBLE		110
 #define	IDC_CSV_QUALIFIER_SINGLE		111
 #define	IDC_CSV_QUALIFIER_NONE			112
+// Find in Files
+#define	IDD_FINDINFILES					134
+#define	IDC_FINDINFILES_DIRECTORY		120
+#define	IDC_FINDINFILES_BROWSE			121
+#define	IDC_FINDINFILES_INCLUDE			122
+#define	IDC_FINDINFILES_EXCLUDE			123
+#define	IDC_FINDINFILES_SUBDIR			124
 
 #define IDS_APPTITLE					10000
 #define IDS_APPTITLE_PASTEBOARD			10001
@@ -388,6 +395,9 @@
 #define IDS_REGEXPHELP					10020
 #define IDS_WILDCARDHELP				10021
 #define IDS_CMDLINEHELP					10022
+#define IDS_FINDINFILES_DIRECTORY		10023
+#define IDS_FILTER_RTF					10024
+#define IDS_FILTER_HTML					10025
 
 #define IDM_FILE_NEW					40000	// Ctrl+N Ctrl+F4
 #define IDM_FILE_OPEN					40001	// Ctrl+O
@@ -418,6 +428,8 @@
 #define IDM_FILE_LARGE_FILE_MODE_RELOAD	40026
 #define IDM_FILE_RESTART				40027
 #define IDM_FILE_SAVEBACKUP				40028
+#define IDM_FILE_EXPORT_RTF				40029
+#define IDM_FILE_EXPORT_HTML			40030
 //
 #define IDM_SET_USE_XP_FILE_DIALOG		40042
 #define IDM_SET_LATEX_INPUT_METHOD		40043
@@ -723,6 +735,7 @@
 #define IDM_EDIT_BASE64_HTML_EMBEDDED_IMAGE		40496
 #define IDM_EDIT_BASE64_DECODE					40497
 #define IDM_EDIT_BASE64_DECODE_AS_HEX			40498
+#define IDM_EDIT_FINDINFILES					40499
 
 #define IDM_HELP_ABOUT					40500	// F1
 #define IDM_CMDLINE_HELP				40501
@@ -907,6 +920,9 @@
 #define IDS_GOOGLE_SEARCH_URL			50044
 #define IDS_BING_SEARCH_URL				50045
 #define IDS_WIKI_SEARCH_URL				50046
+#define IDS_ASK_VIEWBIGFILE				50047
+#define IDS_FINDINFILES_SUMMARY			50048
+#define IDS_EXPORT_STYLED_FAIL			50049
 
 #define IDS_EOLMODENAME_CRLF			62000
 #define IDS_EOLMODENAME_LF				62001
@@ -86,7 +86,11 @@ def BuildKeywordContent(rid, lexer, keywordList, keywordCount=16):
 					makeLower = True
 					items = [item[1] for item in sorted(zip(lowercase, items))]
 			if not makeLower:
+				# code point order is same as byte order of UTF-8 string
 				items = sorted(items)
+			# words are separated by single space, so lexer and auto-completion
+			# can index the static string directly without copy or sort.
+			assert not any(ch.isspace() for item in items for ch in item), (rid, comment)
 			lines = MakeKeywordLines(items, makeLower=makeLower)
 		if index != 0:
 			output.append(f", // {index} {comment}")
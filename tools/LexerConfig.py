@@ -71,7 +71,7 @@ class LexerAttr(IntFlag):
 class KeywordAttr(IntFlag):
 	Default = 0
 	MakeLower = 1	# need converted to lower case for lexer.
-	PreSorted = 2	# word list is presorted.
+	PreSorted = 2	# word list is presorted (by byte value) static string, referenced without copy.
 	NoLexer = 4		# not used by lexer, listed for auto-completion.
 	NoAutoComp = 8	# don't add to default auto-completion list.
 	Special = 256	# used by context based auto-completion.